@@ -39,6 +39,14 @@ typedef struct {
     PyObject *_co_freevars;
 } _PyCoCached;
 
+// Tier-2 executors projected from this code object's hot loops; the
+// layout is private to the interpreter (see pycore_uops.h):
+typedef struct _PyExecutorArray _PyExecutorArray;
+
+// Where and for which tools sys.monitoring has instrumented this code
+// object (see pycore_instruments.h):
+typedef struct _PyCoMonitoringData _PyCoMonitoringData;
+
 // To avoid repeating ourselves in deepfreeze.py, all PyCodeObject members are
 // defined in this macro:
 #define _PyCode_DEF(SIZE) {                                                    \
@@ -100,6 +108,9 @@ typedef struct {
     _PyCoCached *_co_cached;      /* cached co_* attributes */                 \
     int _co_firsttraceable;       /* index of first traceable instruction */   \
     char *_co_linearray;          /* array of line offsets */                  \
+    _PyExecutorArray *_co_executors; /* tier-2 executors for hot loops */      \
+    _PyCoMonitoringData *_co_monitoring; /* sys.monitoring instrumentation */  \
+    uint32_t _co_instrumentation_version; /* monitoring version applied */     \
     /* Scratch space for extra data relating to the code object.               \
        Type is a void* to keep the format private in codeobject.c to force     \
        people to go through the proper APIs. */                                \
@@ -248,6 +248,11 @@ typedef struct {
     int allow_exec;
     int allow_threads;
     int allow_daemon_threads;
+    /* If set, the interpreter gets its own GIL, so it can run in parallel
+       with other interpreters.  It also gets its own allocator and caches
+       and it may only import extension modules that support isolation
+       (multi-phase init). */
+    int own_gil;
 } _PyInterpreterConfig;
 
 #define _PyInterpreterConfig_INIT \
@@ -256,6 +261,7 @@ typedef struct {
         .allow_exec = 0, \
         .allow_threads = 1, \
         .allow_daemon_threads = 0, \
+        .own_gil = 1, \
     }
 
 #define _PyInterpreterConfig_LEGACY_INIT \
@@ -264,6 +270,7 @@ typedef struct {
         .allow_exec = 1, \
         .allow_threads = 1, \
         .allow_daemon_threads = 1, \
+        .own_gil = 0, \
     }
 
 /* --- Helper functions --------------------------------------- */
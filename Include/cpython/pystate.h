@@ -11,6 +11,11 @@ is available in a given context.  For example, forking the process
 might not be allowed in the current interpreter (i.e. os.fork() would fail).
 */
 
+/* Set if the interpreter has its own GIL, and so its own object allocator,
+   interned strings and caches, instead of sharing the main interpreter's.
+   The main interpreter owns the shared ones, so it never has this flag. */
+#define Py_RTFLAGS_OWN_GIL (1UL << 5)
+
 /* Set if threads are allowed. */
 #define Py_RTFLAGS_THREADS (1UL << 10)
 
@@ -179,7 +184,7 @@ struct _ts {
      * if the thread holds the last reference to the lock, decref'ing the
      * lock will delete the lock, and that may trigger arbitrary Python code
      * if there's a weakref, with a callback, to the lock.  But by this time
-     * _PyRuntime.gilstate.tstate_current is already NULL, so only the simplest
+     * the thread-local current tstate is already NULL, so only the simplest
      * of C code can be allowed to run (in particular it must not be possible to
      * release the GIL).
      * So instead of holding the lock directly, the tstate holds a weakref to
@@ -33,6 +33,18 @@ PyAPI_FUNC(PyObject *) _PyObject_Call(
 extern PyObject * _PyObject_CallMethodFormat(
         PyThreadState *tstate, PyObject *callable, const char *format, ...);
 
+extern PyObject *const *
+_PyStack_UnpackDict(PyThreadState *tstate,
+                    PyObject *const *args, Py_ssize_t nargs,
+                    PyObject *kwargs, PyObject **p_kwnames);
+
+extern void
+_PyStack_UnpackDict_Free(PyObject *const *stack, Py_ssize_t nargs,
+                         PyObject *kwnames);
+
+extern void
+_PyStack_UnpackDict_FreeNoDecRef(PyObject *const *stack, PyObject *kwnames);
+
 
 // Static inline variant of public PyVectorcall_Function().
 static inline vectorcallfunc
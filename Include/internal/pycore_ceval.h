@@ -21,7 +21,6 @@ struct _ceval_runtime_state;
 
 
 extern void _Py_FinishPendingCalls(PyThreadState *tstate);
-extern void _PyEval_InitRuntimeState(struct _ceval_runtime_state *);
 extern void _PyEval_InitState(struct _ceval_state *, PyThread_type_lock);
 extern void _PyEval_FiniState(struct _ceval_state *ceval);
 PyAPI_FUNC(void) _PyEval_SignalReceived(PyInterpreterState *interp);
@@ -76,6 +75,9 @@ extern int _PyPerfTrampoline_Init(int activate);
 extern int _PyPerfTrampoline_Fini(void);
 extern int _PyIsPerfTrampolineActive(void);
 extern PyStatus _PyPerfTrampoline_AfterFork_Child(void);
+extern void _PyPerfTrampoline_RegisterCode(const void *code_addr,
+                                           unsigned int code_size,
+                                           PyCodeObject *co);
 #ifdef PY_HAVE_PERF_TRAMPOLINE
 extern _PyPerf_Callbacks _Py_perfmap_callbacks;
 #endif
@@ -96,10 +98,18 @@ _PyEval_Vector(PyThreadState *tstate,
             PyObject* const* args, size_t argcount,
             PyObject *kwnames);
 
-extern int _PyEval_ThreadsInitialized(struct pyruntimestate *runtime);
-extern PyStatus _PyEval_InitGIL(PyThreadState *tstate);
+// Used by the instruction bodies, which are also compiled outside ceval.c
+// as JIT stencils
+extern void _PyEval_FormatExcCheckArg(PyThreadState *tstate, PyObject *exc,
+                                      const char *format_str, PyObject *obj);
+extern void _PyEval_FormatExcUnbound(PyThreadState *tstate, PyCodeObject *co,
+                                     int oparg);
+
+extern int _PyEval_ThreadsInitialized(void);
+extern PyStatus _PyEval_InitGIL(PyThreadState *tstate, int own_gil);
 extern void _PyEval_FiniGIL(PyInterpreterState *interp);
 
+extern void _PyEval_AcquireLock(PyThreadState *tstate);
 extern void _PyEval_ReleaseLock(PyThreadState *tstate);
 
 extern void _PyEval_DeactivateOpCache(void);
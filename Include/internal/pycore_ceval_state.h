@@ -49,7 +49,6 @@ struct _ceval_runtime_state {
        the main thread of the main interpreter can handle signals: see
        _Py_ThreadCanHandleSignals(). */
     _Py_atomic_int signals_pending;
-    struct _gil_runtime_state gil;
 };
 
 #ifdef PY_HAVE_PERF_TRAMPOLINE
@@ -90,6 +89,12 @@ struct _ceval_state {
     _Py_atomic_int gil_drop_request;
     /* The GC is ready to be executed */
     _Py_atomic_int gc_scheduled;
+    /* The GIL that protects this interpreter.  It is either the
+       interpreter's own GIL (PyInterpreterState._gil) or the main
+       interpreter's, which is shared. */
+    struct _gil_runtime_state *gil;
+    /* Is gil owned by this interpreter? */
+    int own_gil;
     struct _pending_calls pending;
 };
 
@@ -54,6 +54,12 @@ typedef struct {
 
 #define INLINE_CACHE_ENTRIES_BINARY_SUBSCR CACHE_ENTRIES(_PyBinarySubscrCache)
 
+typedef struct {
+    _Py_CODEUNIT counter;
+} _PyBinarySliceCache;
+
+#define INLINE_CACHE_ENTRIES_BINARY_SLICE CACHE_ENTRIES(_PyBinarySliceCache)
+
 typedef struct {
     _Py_CODEUNIT counter;
     _Py_CODEUNIT version[2];
@@ -71,7 +77,8 @@ typedef struct {
 // MUST be the max(_PyAttrCache, _PyLoadMethodCache)
 #define INLINE_CACHE_ENTRIES_LOAD_ATTR CACHE_ENTRIES(_PyLoadMethodCache)
 
-#define INLINE_CACHE_ENTRIES_STORE_ATTR CACHE_ENTRIES(_PyAttrCache)
+// MUST be the max(_PyAttrCache, _PyLoadMethodCache)
+#define INLINE_CACHE_ENTRIES_STORE_ATTR CACHE_ENTRIES(_PyLoadMethodCache)
 
 typedef struct {
     _Py_CODEUNIT counter;
@@ -93,6 +100,48 @@ typedef struct {
 
 #define INLINE_CACHE_ENTRIES_FOR_ITER CACHE_ENTRIES(_PyForIterCache)
 
+typedef struct {
+    _Py_CODEUNIT counter;
+} _PyContainsOpCache;
+
+#define INLINE_CACHE_ENTRIES_CONTAINS_OP CACHE_ENTRIES(_PyContainsOpCache)
+
+typedef struct {
+    _Py_CODEUNIT counter;
+} _PyFormatValueCache;
+
+#define INLINE_CACHE_ENTRIES_FORMAT_VALUE CACHE_ENTRIES(_PyFormatValueCache)
+
+typedef struct {
+    _Py_CODEUNIT counter;
+} _PyCallFunctionExCache;
+
+#define INLINE_CACHE_ENTRIES_CALL_FUNCTION_EX \
+    CACHE_ENTRIES(_PyCallFunctionExCache)
+
+typedef struct {
+    _Py_CODEUNIT counter;
+} _PySendCache;
+
+#define INLINE_CACHE_ENTRIES_SEND CACHE_ENTRIES(_PySendCache)
+
+typedef struct {
+    _Py_CODEUNIT counter;
+    _Py_CODEUNIT class_version[2];
+    _Py_CODEUNIT self_type_version[2];
+    _Py_CODEUNIT descr[4];
+} _PySuperAttrCache;
+
+#define INLINE_CACHE_ENTRIES_LOAD_SUPER_ATTR CACHE_ENTRIES(_PySuperAttrCache)
+
+typedef struct {
+    /* Counts down to the next attempt at projecting a trace; once
+       specialized, holds the index of the executor in co_executors. */
+    _Py_CODEUNIT counter;
+} _PyJumpBackwardCache;
+
+#define INLINE_CACHE_ENTRIES_JUMP_BACKWARD CACHE_ENTRIES(_PyJumpBackwardCache)
+
 // Borrowed references to common callables:
 struct callable_cache {
     PyObject *isinstance;
@@ -223,10 +272,14 @@ extern void _Py_Specialize_LoadGlobal(PyObject *globals, PyObject *builtins,
                                       _Py_CODEUNIT *instr, PyObject *name);
 extern void _Py_Specialize_BinarySubscr(PyObject *sub, PyObject *container,
                                         _Py_CODEUNIT *instr);
+extern void _Py_Specialize_BinarySlice(PyObject *container, PyObject *start,
+                                       PyObject *stop, _Py_CODEUNIT *instr);
 extern void _Py_Specialize_StoreSubscr(PyObject *container, PyObject *sub,
                                        _Py_CODEUNIT *instr);
 extern void _Py_Specialize_Call(PyObject *callable, _Py_CODEUNIT *instr,
                                 int nargs, PyObject *kwnames);
+extern void _Py_Specialize_CallFunctionEx(PyObject *func, PyObject *callargs,
+                                          _Py_CODEUNIT *instr);
 extern void _Py_Specialize_BinaryOp(PyObject *lhs, PyObject *rhs, _Py_CODEUNIT *instr,
                                     int oparg, PyObject **locals);
 extern void _Py_Specialize_CompareOp(PyObject *lhs, PyObject *rhs,
@@ -234,6 +287,68 @@ extern void _Py_Specialize_CompareOp(PyObject *lhs, PyObject *rhs,
 extern void _Py_Specialize_UnpackSequence(PyObject *seq, _Py_CODEUNIT *instr,
                                           int oparg);
 extern void _Py_Specialize_ForIter(PyObject *iter, _Py_CODEUNIT *instr, int oparg);
+extern void _Py_Specialize_Send(PyObject *receiver, _Py_CODEUNIT *instr, int oparg);
+extern void _Py_Specialize_FormatValue(PyObject *value, _Py_CODEUNIT *instr,
+                                       int oparg);
+extern void _Py_Specialize_ContainsOp(PyObject *value, PyObject *container,
+                                      _Py_CODEUNIT *instr);
+extern void _Py_Specialize_LoadSuperAttr(PyObject *global_super, PyObject *cls,
+                                         PyObject *self, _Py_CODEUNIT *instr,
+                                         PyObject *name, int load_method);
+
+/* Specialization profiles, which prime the adaptive counters of new code
+   objects from those of earlier ones with the same bytecode */
+struct _Py_specialization_profile_state {
+    // Profile key -> hints (bytes) to apply, or NULL if there is no profile
+    struct _Py_hashtable_t *hints;
+    // Code objects created since the profile was loaded
+    struct _Py_hashtable_t *codes;
+    // Where to write the profile at exit (PYTHONSPECIALIZATIONPROFILE)
+    PyObject *path;
+};
+
+extern void _PySpecializationProfile_CodeCreated(PyInterpreterState *interp,
+                                                 PyCodeObject *code);
+extern void _PySpecializationProfile_CodeDestroyed(PyInterpreterState *interp,
+                                                   PyCodeObject *code);
+extern int _PySpecializationProfile_Load(PyInterpreterState *interp,
+                                         PyObject *path);
+extern int _PySpecializationProfile_Dump(PyInterpreterState *interp,
+                                         PyObject *path);
+extern PyStatus _PySpecializationProfile_Init(PyInterpreterState *interp);
+extern void _PySpecializationProfile_AtExit(PyInterpreterState *interp);
+extern void _PySpecializationProfile_Fini(PyInterpreterState *interp);
+
+/* Specialization telemetry: counts of specialization attempts, failures and
+   deoptimizations for each instruction, which unlike Py_STATS are available
+   in every build and can be turned on and off at run time */
+struct _Py_specialization_telemetry_state {
+    int enabled;
+    // The SPEC_FAIL kind of the specialization attempt in progress
+    int failure_kind;
+    // Counts for each opcode, or NULL if telemetry has never been on
+    struct _PySpecializationCounts *opcodes;
+    // Code object -> counts for each of its instructions
+    struct _Py_hashtable_t *codes;
+    // The last code object looked up in codes, and its counts
+    PyCodeObject *last_code;
+    struct _PyInstructionCounts *last_counts;
+};
+
+extern void _PySpecializationTelemetry_RecordMiss(PyInterpreterState *interp,
+                                                  PyCodeObject *code,
+                                                  _Py_CODEUNIT *instr,
+                                                  int opcode, int deopt);
+extern void _PySpecializationTelemetry_CodeDestroyed(PyInterpreterState *interp,
+                                                     PyCodeObject *code);
+extern int _PySpecializationTelemetry_Enable(PyInterpreterState *interp,
+                                             int enabled);
+extern void _PySpecializationTelemetry_Clear(PyInterpreterState *interp);
+extern PyObject *_PySpecializationTelemetry_GetCounts(
+    PyInterpreterState *interp, PyCodeObject *code);
+extern PyObject *_PySpecializationTelemetry_Dump(PyInterpreterState *interp,
+                                                 PyObject *dirname);
+extern void _PySpecializationTelemetry_Fini(PyInterpreterState *interp);
 
 /* Finalizer function for static codeobjects used in deepfreeze.py */
 extern void _PyStaticCode_Fini(PyCodeObject *co);
@@ -405,6 +520,11 @@ write_location_entry_start(uint8_t *ptr, int code, int length)
 
 #define MAX_BACKOFF_VALUE (16 - ADAPTIVE_BACKOFF_BITS)
 
+// Loops are only worth projecting a trace for after they have run for a
+// while, and only once the instructions in their body have specialized.
+#define ADAPTIVE_BACK_EDGE_VALUE 16
+#define ADAPTIVE_BACK_EDGE_BACKOFF 4
+
 
 static inline uint16_t
 adaptive_counter_bits(int value, int backoff) {
@@ -424,6 +544,12 @@ adaptive_counter_cooldown(void) {
                                  ADAPTIVE_COOLDOWN_BACKOFF);
 }
 
+static inline uint16_t
+adaptive_counter_back_edge(void) {
+    return adaptive_counter_bits(ADAPTIVE_BACK_EDGE_VALUE,
+                                 ADAPTIVE_BACK_EDGE_BACKOFF);
+}
+
 static inline uint16_t
 adaptive_counter_backoff(uint16_t counter) {
     unsigned int backoff = counter & ((1<<ADAPTIVE_BACKOFF_BITS)-1);
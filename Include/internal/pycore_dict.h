@@ -10,7 +10,7 @@ extern "C" {
 #endif
 
 #include "pycore_dict_state.h"
-#include "pycore_runtime.h"         // _PyRuntime
+#include "pycore_pystate.h"         // _PyInterpreterState_GetVersionsOwner()
 
 
 /* runtime lifecycle */
@@ -56,6 +56,11 @@ extern int _PyObjectDict_SetItem(PyTypeObject *tp, PyObject **dictptr, PyObject
 
 extern PyObject *_PyDict_Pop_KnownHash(PyObject *, PyObject *, Py_hash_t, PyObject *);
 
+/* Advances a forward dict key, value or item iterator without allocating.
+ * Returns 1 and sets *pkey and *pvalue (if not NULL) to new references on
+ * success, 0 when exhausted and -1 on error. */
+extern int _PyDictIter_Next(PyObject *iter, PyObject **pkey, PyObject **pvalue);
+
 #define DKIX_EMPTY (-1)
 #define DKIX_DUMMY (-2)  /* Used internally */
 #define DKIX_ERROR (-3)
@@ -149,7 +154,8 @@ static inline PyDictUnicodeEntry* DK_UNICODE_ENTRIES(PyDictKeysObject *dk) {
 #define DICT_VERSION_MASK (DICT_VERSION_INCREMENT - 1)
 
 #define DICT_NEXT_VERSION() \
-    (_PyRuntime.dict_state.global_version += DICT_VERSION_INCREMENT)
+    (_PyInterpreterState_GetVersionsOwner()->dict_state.global_version \
+     += DICT_VERSION_INCREMENT)
 
 void
 _PyDict_SendEvent(int watcher_bits,
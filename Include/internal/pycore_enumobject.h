@@ -0,0 +1,19 @@
+#ifndef Py_INTERNAL_ENUMOBJECT_H
+#define Py_INTERNAL_ENUMOBJECT_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef Py_BUILD_CORE
+#  error "this header requires Py_BUILD_CORE define"
+#endif
+
+/* Advances an enumerate object without packing the result into a tuple.
+ * Returns 1 and sets *pindex and *pitem to new references on success,
+ * 0 when the underlying iterator is exhausted and -1 on error. */
+extern int _PyEnum_NextPair(PyObject *en, PyObject **pindex, PyObject **pitem);
+
+#ifdef __cplusplus
+}
+#endif
+#endif   /* !Py_INTERNAL_ENUMOBJECT_H */
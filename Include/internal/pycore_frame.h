@@ -223,6 +223,27 @@ _PyFrame_PushUnchecked(PyThreadState *tstate, PyFunctionObject *func)
     return new_frame;
 }
 
+/* Pushes a frame for a shim code object without checking for space.
+ * The shim frame remains incomplete, so it is hidden from tracebacks
+ * and trace functions. The caller must fill in the stackdepth values
+ * on its stack.
+ * Must be guarded by _PyThreadState_HasStackSpace()
+ * Consumes reference to func. */
+static inline _PyInterpreterFrame *
+_PyFrame_PushTrampolineUnchecked(PyThreadState *tstate, PyFunctionObject *func,
+                                 PyCodeObject *code, int stackdepth)
+{
+    CALL_STAT_INC(frames_pushed);
+    _PyInterpreterFrame *frame = (_PyInterpreterFrame *)tstate->datastack_top;
+    tstate->datastack_top += code->co_framesize;
+    assert(tstate->datastack_top < tstate->datastack_limit);
+    _PyFrame_InitializeSpecials(frame, func, NULL, code);
+    frame->stacktop = code->co_nlocalsplus + stackdepth;
+    /* Point at the leading NOP, so that the frame resumes after it */
+    frame->prev_instr = _PyCode_CODE(code);
+    return frame;
+}
+
 int _PyInterpreterFrame_GetLine(_PyInterpreterFrame *frame);
 
 static inline
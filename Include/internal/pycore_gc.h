@@ -15,7 +15,7 @@ typedef struct {
     uintptr_t _gc_next;
 
     // Pointer to previous object in the list.
-    // Lowest two bits are used for flags documented later.
+    // Lowest three bits are used for flags documented later.
     uintptr_t _gc_prev;
 } PyGC_Head;
 
@@ -49,8 +49,12 @@ static inline int _PyObject_GC_MAY_BE_TRACKED(PyObject *obj) {
 #define _PyGC_PREV_MASK_FINALIZED  (1)
 /* Bit 1 is set when the object is in generation which is GCed currently. */
 #define _PyGC_PREV_MASK_COLLECTING (2)
-/* The (N-2) most significant bits contain the real address. */
-#define _PyGC_PREV_SHIFT           (2)
+/* Bit 2 tells which of its two spaces an object in the oldest generation is
+   in, for incremental collection. */
+#define _PyGC_PREV_MASK_OLD_SPACE  (4)
+/* The (N-3) most significant bits contain the real address.  This relies on
+   GC headers being at least 8-byte aligned, as every allocator gives. */
+#define _PyGC_PREV_SHIFT           (3)
 #define _PyGC_PREV_MASK            (((uintptr_t) -1) << _PyGC_PREV_SHIFT)
 
 // Lowest bit of _gc_next is used for flags only in GC.
@@ -63,7 +67,7 @@ static inline void _PyGCHead_SET_NEXT(PyGC_Head *gc, PyGC_Head *next) {
     gc->_gc_next = _Py_CAST(uintptr_t, next);
 }
 
-// Lowest two bits of _gc_prev is used for _PyGC_PREV_MASK_* flags.
+// Lowest three bits of _gc_prev is used for _PyGC_PREV_MASK_* flags.
 static inline PyGC_Head* _PyGCHead_PREV(PyGC_Head *gc) {
     uintptr_t prev = (gc->_gc_prev & _PyGC_PREV_MASK);
     return _Py_CAST(PyGC_Head*, prev);
@@ -187,6 +191,18 @@ struct _gc_runtime_state {
        collections, and are awaiting to undergo a full collection for
        the first time. */
     Py_ssize_t long_lived_pending;
+    /* Is the oldest generation collected in increments (see
+       Modules/gcmodule.c)? */
+    int incremental;
+    /* Is a pass of increments over the oldest generation under way? */
+    int scanning_old;
+    /* Objects in the oldest generation whose _PyGC_PREV_MASK_OLD_SPACE bit
+       is this have been scanned by the current pass. */
+    int visited_space;
+    /* The budget of each increment: the number of old objects it takes,
+       and its duration.  Zero means no limit. */
+    Py_ssize_t increment_size;
+    _PyTime_t increment_duration;
 };
 
 
@@ -8,15 +8,14 @@ extern "C" {
 #  error "this header requires Py_BUILD_CORE define"
 #endif
 
-#include "pycore_object.h"  // _PyObject_IMMORTAL_REFCNT
+#include "pycore_object.h"  // _Py_IsImmortal()
 
 #ifdef Py_DEBUG
 static inline void
 _PyStaticObject_CheckRefcnt(PyObject *obj) {
-    if (Py_REFCNT(obj) < _PyObject_IMMORTAL_REFCNT) {
+    if (!_Py_IsImmortal(obj)) {
         _PyObject_ASSERT_FAILED_MSG(obj,
-            "immortal object has less refcnt than expected "
-            "_PyObject_IMMORTAL_REFCNT");
+            "statically allocated object is not immortal");
     }
 }
 #endif
@@ -870,6 +869,7 @@ _PyStaticObjects_CheckRefcnt(PyInterpreterState *interp) {
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(digest_size));
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(digestmod));
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(dir_fd));
+    _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(dirname));
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(discard));
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(dispatch_table));
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(displayhook));
@@ -882,6 +882,7 @@ _PyStaticObjects_CheckRefcnt(PyInterpreterState *interp) {
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(e));
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(effective_ids));
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(element_factory));
+    _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(enabled));
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(encode));
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(encoding));
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(end));
@@ -1014,6 +1015,8 @@ _PyStaticObjects_CheckRefcnt(PyInterpreterState *interp) {
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(mapping));
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(match));
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(max_length));
+    _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(max_objects));
+    _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(max_usec));
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(maxdigits));
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(maxevents));
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(maxmem));
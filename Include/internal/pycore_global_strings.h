@@ -356,6 +356,7 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(digest_size)
         STRUCT_FOR_ID(digestmod)
         STRUCT_FOR_ID(dir_fd)
+        STRUCT_FOR_ID(dirname)
         STRUCT_FOR_ID(discard)
         STRUCT_FOR_ID(dispatch_table)
         STRUCT_FOR_ID(displayhook)
@@ -368,6 +369,7 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(e)
         STRUCT_FOR_ID(effective_ids)
         STRUCT_FOR_ID(element_factory)
+        STRUCT_FOR_ID(enabled)
         STRUCT_FOR_ID(encode)
         STRUCT_FOR_ID(encoding)
         STRUCT_FOR_ID(end)
@@ -500,6 +502,8 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(mapping)
         STRUCT_FOR_ID(match)
         STRUCT_FOR_ID(max_length)
+        STRUCT_FOR_ID(max_objects)
+        STRUCT_FOR_ID(max_usec)
         STRUCT_FOR_ID(maxdigits)
         STRUCT_FOR_ID(maxevents)
         STRUCT_FOR_ID(maxmem)
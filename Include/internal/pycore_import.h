@@ -21,6 +21,9 @@ struct _import_runtime_state {
        This is initialized lazily in _PyImport_FixupExtensionObject().
        Modules are added there and looked up in _imp.find_extension(). */
     PyObject *extensions;
+    /* Guards "extensions" and "last_module_index", which are shared
+       by interpreters that do not share a GIL. */
+    PyThread_type_lock extensions_mutex;
     /* The global import lock. */
     struct {
         PyThread_type_lock mutex;
@@ -41,6 +44,7 @@ struct _import_runtime_state {
 extern PyStatus _PyImport_ReInitLock(void);
 #endif
 extern PyObject* _PyImport_BootstrapImp(PyThreadState *tstate);
+extern int _PyImport_CheckLegacyExtensionAllowed(PyObject *name);
 
 struct _module_alias {
     const char *name;                 /* ASCII encoded string */
@@ -0,0 +1,117 @@
+#ifndef Py_INTERNAL_INSTRUMENTS_H
+#define Py_INTERNAL_INSTRUMENTS_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef Py_BUILD_CORE
+#  error "this header requires Py_BUILD_CORE define"
+#endif
+
+#include "pycore_frame.h"         // _PyInterpreterFrame
+
+/* sys.monitoring
+ *
+ * Tools register callables for events, either for all code or for single
+ * code objects. Python/instrumentation.c raises the events by replacing
+ * the instructions that cause them with INSTRUMENTED_* instructions in
+ * the bytecode itself, so code that nothing monitors runs exactly as it
+ * would without sys.monitoring. A code object records the interpreter's
+ * monitoring version it was last instrumented for; RESUME instruments it
+ * again when that is out of date.
+ */
+
+#define PY_MONITORING_TOOL_IDS 8
+
+/* Events, as bit numbers in the sets of sys.monitoring.events */
+#define PY_MONITORING_EVENT_PY_START 0
+#define PY_MONITORING_EVENT_PY_RETURN 1
+#define PY_MONITORING_EVENT_LINE 2
+#define PY_MONITORING_EVENT_JUMP 3
+#define PY_MONITORING_EVENT_BRANCH 4
+#define PY_MONITORING_EVENT_RAISE 5
+
+#define PY_MONITORING_EVENTS 6
+
+/* Tool ids that sys.monitoring reserves for particular kinds of tool */
+#define PY_MONITORING_DEBUGGER_ID 0
+#define PY_MONITORING_COVERAGE_ID 1
+#define PY_MONITORING_PROFILER_ID 2
+#define PY_MONITORING_OPTIMIZER_ID 5
+
+/* The set of tools monitoring each event */
+typedef struct {
+    uint8_t tools[PY_MONITORING_EVENTS];
+} _Py_Monitors;
+
+typedef struct {
+    /* The instruction that the position held before it was instrumented */
+    uint8_t original_opcode;
+    /* The tools monitoring the event of the position's own instruction */
+    uint8_t tools;
+    /* The tools monitoring LINE events at the position */
+    uint8_t line_tools;
+    /* Whether a LINE event can happen at the position */
+    uint8_t line_point;
+    /* The position's line number, or -1 if it has none */
+    int line;
+} _PyCoMonitoringPosition;
+
+struct _PyCoMonitoringData {
+    /* Events set for the code object with set_local_events() */
+    _Py_Monitors local_monitors;
+    /* Events (global and local) that the code was last instrumented for */
+    _Py_Monitors active_monitors;
+    /* The interpreter's restart version at that time */
+    uint32_t restart_version;
+    /* One for each code unit of the bytecode */
+    _PyCoMonitoringPosition positions[1];
+};
+
+struct _Py_monitoring_state {
+    /* Events set for all code with set_events() */
+    _Py_Monitors monitors;
+    /* Bumped whenever instrumentation must be brought up to date */
+    uint32_t version;
+    /* Bumped by restart_events() */
+    uint32_t restart_version;
+    PyObject *tool_names[PY_MONITORING_TOOL_IDS];
+    PyObject *callables[PY_MONITORING_TOOL_IDS][PY_MONITORING_EVENTS];
+};
+
+/* Brings the instrumentation of code up to date with the monitoring state
+   of interp. Returns 0, or -1 with an exception set. */
+extern int _Py_Instrument(PyCodeObject *code, PyInterpreterState *interp);
+
+/* Call the tools monitoring the event of instr. Each returns 0, or -1 with
+   an exception set. */
+extern int _Py_call_instrumentation(PyThreadState *tstate, int event,
+    _PyInterpreterFrame *frame, _Py_CODEUNIT *instr);
+extern int _Py_call_instrumentation_arg(PyThreadState *tstate, int event,
+    _PyInterpreterFrame *frame, _Py_CODEUNIT *instr, PyObject *arg);
+extern int _Py_call_instrumentation_jump(PyThreadState *tstate, int event,
+    _PyInterpreterFrame *frame, _Py_CODEUNIT *src, _Py_CODEUNIT *dest);
+
+/* Called by INSTRUMENTED_LINE at here, having come from prev. Returns the
+   opcode to run in place of INSTRUMENTED_LINE, or -1 with an exception
+   set. */
+extern int _Py_call_instrumentation_line(PyThreadState *tstate,
+    _PyInterpreterFrame *frame, _Py_CODEUNIT *here, _Py_CODEUNIT *prev);
+
+/* Raises RAISE for the exception being handled in frame. If a tool fails,
+   its exception replaces that one. */
+extern void _Py_call_instrumentation_exc(PyThreadState *tstate,
+    _PyInterpreterFrame *frame);
+
+/* The instruction at offset (in code units) as it was before being
+   instrumented: still specialized, or deoptimized to its base opcode. */
+extern int _Py_GetOriginalOpcode(PyCodeObject *code, int offset);
+extern int _Py_GetBaseOpcode(PyCodeObject *code, int offset);
+
+extern PyObject *_Py_CreateMonitoringObject(void);
+extern void _Py_ClearMonitoring(PyInterpreterState *interp);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* !Py_INTERNAL_INSTRUMENTS_H */
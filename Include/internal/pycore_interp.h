@@ -21,6 +21,7 @@ extern "C" {
 #include "pycore_function.h"      // FUNC_MAX_WATCHERS
 #include "pycore_genobject.h"     // struct _Py_async_gen_state
 #include "pycore_gc.h"            // struct _gc_runtime_state
+#include "pycore_instruments.h"   // struct _Py_monitoring_state
 #include "pycore_list.h"          // struct _Py_list_state
 #include "pycore_global_objects.h"  // struct _Py_interp_static_objects
 #include "pycore_tuple.h"         // struct _Py_tuple_state
@@ -92,6 +93,11 @@ struct _is {
     struct _ceval_state ceval;
     struct _gc_runtime_state gc;
 
+    /* The small-object allocator used while this interpreter holds
+       its GIL.  Interpreters that share the main interpreter's GIL
+       share its allocator too (_PyRuntime.obmalloc). */
+    struct _obmalloc_state *obmalloc;
+
     // sys.modules dictionary
     PyObject *modules;
     /* This is the list of module objects for all legacy (single-phase init)
@@ -175,6 +181,7 @@ struct _is {
     struct _Py_tuple_state tuple;
     struct _Py_list_state list;
     struct _Py_dict_state dict_state;
+    struct _py_func_state func_state;
     struct _Py_async_gen_state async_gen;
     struct _Py_context_state context;
     struct _Py_exc_state exc_state;
@@ -182,7 +189,12 @@ struct _is {
     struct ast_state ast;
     struct types_state types;
     struct callable_cache callable_cache;
+    struct _Py_specialization_profile_state specialization_profile;
+    struct _Py_specialization_telemetry_state specialization_telemetry;
+    struct _Py_monitoring_state monitoring;
     PyCodeObject *interpreter_trampoline;
+    PyCodeObject *init_cleanup;
+    PyCodeObject *setter_cleanup;
 
     struct _Py_interp_cached_objects cached_objects;
     struct _Py_interp_static_objects static_objects;
@@ -201,6 +213,8 @@ struct _is {
 
     /* the initial PyInterpreterState.threads.head */
     PyThreadState _initial_thread;
+    /* storage for ceval.gil, if the interpreter has its own GIL */
+    struct _gil_runtime_state _gil;
 };
 
 
@@ -0,0 +1,39 @@
+#ifndef Py_INTERNAL_JIT_H
+#define Py_INTERNAL_JIT_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef Py_BUILD_CORE
+#  error "this header requires Py_BUILD_CORE define"
+#endif
+
+#include "pycore_uops.h"          // _PyUOpExecutor
+
+/* The experimental copy-and-patch JIT compiler (configure with
+ * --enable-experimental-jit).
+ *
+ * Python/jit.c compiles tier-2 traces to machine code by copying and
+ * patching stencils that Tools/jit/build.py builds from the micro-op cases
+ * when CPython itself is built.
+ */
+
+/* Compiled traces have the same contract as _PyUopExecute(). */
+typedef _Py_CODEUNIT *(*_PyJITFunction)(_PyInterpreterFrame *frame,
+                                        PyObject **stack_pointer,
+                                        PyThreadState *tstate);
+
+#ifdef _Py_JIT
+
+/* Sets executor->jit_code to the machine code for its trace. The executor
+   is left to be interpreted if the trace can't be compiled. */
+extern void _PyJIT_Compile(_PyUOpExecutor *executor, PyCodeObject *code);
+
+extern void _PyJIT_Free(_PyUOpExecutor *executor);
+
+#endif  // _Py_JIT
+
+#ifdef __cplusplus
+}
+#endif
+#endif   /* !Py_INTERNAL_JIT_H */
@@ -14,14 +14,9 @@ extern "C" {
 #include "pycore_pystate.h"       // _PyInterpreterState_GET()
 #include "pycore_runtime.h"       // _PyRuntime
 
-/* This value provides *effective* immortality, meaning the object should never
-    be deallocated (until runtime finalization).  See PEP 683 for more details about
-    immortality, as well as a proposed mechanism for proper immortality. */
-#define _PyObject_IMMORTAL_REFCNT 999999999
-
 #define _PyObject_IMMORTAL_INIT(type) \
     { \
-        .ob_refcnt = _PyObject_IMMORTAL_REFCNT, \
+        .ob_refcnt = _Py_IMMORTAL_REFCNT, \
         .ob_type = (type), \
     }
 #define _PyVarObject_IMMORTAL_INIT(type, size) \
@@ -40,6 +35,9 @@ PyAPI_FUNC(void) _Py_NO_RETURN _Py_FatalRefcountErrorFunc(
 // Increment reference count by n
 static inline void _Py_RefcntAdd(PyObject* op, Py_ssize_t n)
 {
+    if (_Py_IsImmortal(op)) {
+        return;
+    }
 #ifdef Py_REF_DEBUG
     _Py_RefTotal += n;
 #endif
@@ -47,9 +45,28 @@ static inline void _Py_RefcntAdd(PyObject* op, Py_ssize_t n)
 }
 #define _Py_RefcntAdd(op, n) _Py_RefcntAdd(_PyObject_CAST(op), n)
 
+// Make op immortal.  References to it that have been counted are no longer
+// needed, and may be dropped or not.
+static inline void _Py_SetImmortal(PyObject *op)
+{
+    if (op != NULL) {
+#ifdef Py_REF_DEBUG
+        if (!_Py_IsImmortal(op)) {
+            // Dropping the counted references won't be counted.
+            _Py_RefTotal -= Py_REFCNT(op);
+        }
+#endif
+        op->ob_refcnt = _Py_IMMORTAL_REFCNT;
+    }
+}
+#define _Py_SetImmortal(op) _Py_SetImmortal(_PyObject_CAST(op))
+
 static inline void
 _Py_DECREF_SPECIALIZED(PyObject *op, const destructor destruct)
 {
+    if (_Py_IsImmortal(op)) {
+        return;
+    }
     _Py_DECREF_STAT_INC();
 #ifdef Py_REF_DEBUG
     _Py_RefTotal--;
@@ -68,6 +85,9 @@ _Py_DECREF_SPECIALIZED(PyObject *op, const destructor destruct)
 static inline void
 _Py_DECREF_NO_DEALLOC(PyObject *op)
 {
+    if (_Py_IsImmortal(op)) {
+        return;
+    }
     _Py_DECREF_STAT_INC();
 #ifdef Py_REF_DEBUG
     _Py_RefTotal--;
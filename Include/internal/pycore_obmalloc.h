@@ -677,6 +677,12 @@ void _PyObject_VirtualFree(void *, size_t size);
 /* This function returns the number of allocated memory blocks, regardless of size */
 PyAPI_FUNC(Py_ssize_t) _Py_GetAllocatedBlocks(void);
 
+/* Give an interpreter that has its own GIL its own allocator state
+   (PyInterpreterState.obmalloc), and release it again when the
+   interpreter is deleted. */
+extern PyStatus _PyObject_InitState(PyInterpreterState *interp);
+extern void _PyObject_FiniState(PyInterpreterState *interp);
+
 
 #ifdef WITH_PYMALLOC
 // Export the symbol for the 3rd party guppy3 project
@@ -64,25 +64,34 @@ _Py_ThreadCanHandlePendingCalls(void)
 /* Variable and macro for in-line access to current thread
    and interpreter state */
 
-static inline PyThreadState*
-_PyRuntimeState_GetThreadState(_PyRuntimeState *runtime)
-{
-    return (PyThreadState*)_Py_atomic_load_relaxed(&runtime->gilstate.tstate_current);
-}
+#if defined(HAVE_THREAD_LOCAL) && !defined(Py_BUILD_CORE_MODULE)
+extern _Py_thread_local PyThreadState *_Py_tss_tstate;
+#endif
+PyAPI_FUNC(PyThreadState *) _PyThreadState_GetCurrent(void);
 
 /* Get the current Python thread state.
 
-   Efficient macro reading directly the 'gilstate.tstate_current' atomic
+   Efficient macro reading directly the thread-local '_Py_tss_tstate'
    variable. The macro is unsafe: it does not check for error and it can
    return NULL.
 
-   The caller must hold the GIL.
+   The caller must hold the GIL of the thread state's interpreter.
 
    See also PyThreadState_Get() and _PyThreadState_UncheckedGet(). */
 static inline PyThreadState*
 _PyThreadState_GET(void)
 {
-    return _PyRuntimeState_GetThreadState(&_PyRuntime);
+#if defined(HAVE_THREAD_LOCAL) && !defined(Py_BUILD_CORE_MODULE)
+    return _Py_tss_tstate;
+#else
+    return _PyThreadState_GetCurrent();
+#endif
+}
+
+static inline PyThreadState*
+_PyRuntimeState_GetThreadState(_PyRuntimeState *Py_UNUSED(runtime))
+{
+    return _PyThreadState_GET();
 }
 
 static inline void
@@ -117,6 +126,21 @@ static inline PyInterpreterState* _PyInterpreterState_GET(void) {
     return tstate->interp;
 }
 
+/* The version counters of types, dicts and functions must be unique among
+   interpreters that may share code objects (and their inline caches), as
+   all the interpreters sharing the main GIL do, e.g. for deepfrozen code.
+   These use the main interpreter's counters; an interpreter with its own
+   GIL has its own. */
+static inline PyInterpreterState *
+_PyInterpreterState_GetVersionsOwner(void)
+{
+    PyInterpreterState *interp = _PyInterpreterState_GET();
+    if (interp->feature_flags & Py_RTFLAGS_OWN_GIL) {
+        return interp;
+    }
+    return _PyInterpreterState_Main();
+}
+
 
 // PyThreadState functions
 
@@ -147,6 +171,9 @@ PyAPI_FUNC(PyThreadState *) _PyThreadState_Swap(
 
 PyAPI_FUNC(PyStatus) _PyInterpreterState_Enable(_PyRuntimeState *runtime);
 
+extern PyThreadState * _PyThreadState_SwapToMain(void);
+extern void _PyThreadState_SwapFromMain(PyThreadState *tstate);
+
 #ifdef HAVE_FORK
 extern PyStatus _PyInterpreterState_DeleteExceptMain(_PyRuntimeState *runtime);
 extern PyStatus _PyGILState_Reinit(_PyRuntimeState *runtime);
@@ -10,10 +10,8 @@ extern "C" {
 
 #include "pycore_atomic.h"          /* _Py_atomic_address */
 #include "pycore_ceval_state.h"     // struct _ceval_runtime_state
-#include "pycore_dict_state.h"      // struct _Py_dict_runtime_state
 #include "pycore_dtoa.h"            // struct _dtoa_runtime_state
 #include "pycore_floatobject.h"     // struct _Py_float_runtime_state
-#include "pycore_function.h"        // struct _func_runtime_state
 #include "pycore_global_objects.h"  // struct _Py_global_objects
 #include "pycore_import.h"          // struct _import_runtime_state
 #include "pycore_interp.h"          // PyInterpreterState
@@ -38,9 +36,6 @@ struct _gilstate_runtime_state {
     /* bpo-26558: Flag to disable PyGILState_Check().
        If set to non-zero, PyGILState_Check() always return 1. */
     int check_enabled;
-    /* Assuming the current thread holds the GIL, this is the
-       PyThreadState for the current thread. */
-    _Py_atomic_address tstate_current;
     /* The single PyInterpreterState used by this process'
        GILState implementation
     */
@@ -153,14 +148,15 @@ typedef struct pyruntimestate {
 
     struct _Py_float_runtime_state float_state;
     struct _Py_unicode_runtime_state unicode_state;
-    struct _Py_dict_runtime_state dict_state;
-    struct _py_func_runtime_state func_state;
 
     struct {
-        /* Used to set PyTypeObject.tp_version_tag */
+        /* Used to set PyTypeObject.tp_version_tag of static types */
         // bpo-42745: next_version_tag remains shared by all interpreters
         // because of static types.
         unsigned int next_version_tag;
+        /* Set once an interpreter with its own GIL may use the static
+           types (see _PyStaticType_ShareAll()). */
+        int static_types_shared;
     } types;
 
     /* All the objects that are shared by the runtime's interpreters. */
@@ -61,12 +61,6 @@ extern "C" {
             .float_format = _py_float_format_unknown, \
             .double_format = _py_float_format_unknown, \
         }, \
-        .dict_state = { \
-            .next_keys_version = 2, \
-        }, \
-        .func_state = { \
-            .next_version = 1, \
-        }, \
         .types = { \
             .next_version_tag = 1, \
         }, \
@@ -123,6 +117,13 @@ extern "C" {
                 { .threshold = 10, }, \
                 { .threshold = 10, }, \
             }, \
+            .increment_size = 10000, \
+        }, \
+        .dict_state = { \
+            .next_keys_version = 2, \
+        }, \
+        .func_state = { \
+            .next_version = 1, \
         }, \
         .static_objects = { \
             .singletons = { \
@@ -862,6 +862,7 @@ extern "C" {
     INIT_ID(digest_size), \
     INIT_ID(digestmod), \
     INIT_ID(dir_fd), \
+    INIT_ID(dirname), \
     INIT_ID(discard), \
     INIT_ID(dispatch_table), \
     INIT_ID(displayhook), \
@@ -874,6 +875,7 @@ extern "C" {
     INIT_ID(e), \
     INIT_ID(effective_ids), \
     INIT_ID(element_factory), \
+    INIT_ID(enabled), \
     INIT_ID(encode), \
     INIT_ID(encoding), \
     INIT_ID(end), \
@@ -1006,6 +1008,8 @@ extern "C" {
     INIT_ID(mapping), \
     INIT_ID(match), \
     INIT_ID(max_length), \
+    INIT_ID(max_objects), \
+    INIT_ID(max_usec), \
     INIT_ID(maxdigits), \
     INIT_ID(maxevents), \
     INIT_ID(maxmem), \
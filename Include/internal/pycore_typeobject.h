@@ -51,6 +51,13 @@ struct type_cache {
    all the static builtin types will fit (for all builds). */
 #define _Py_MAX_STATIC_BUILTIN_TYPES 200
 
+/* Static types are shared by all interpreters, so they take their version
+   tags from a global range below _Py_TYPE_BASE_VERSION_TAG.  Heap types
+   are owned by one interpreter and take theirs from a per-interpreter
+   counter starting at _Py_TYPE_BASE_VERSION_TAG. */
+#define _Py_TYPE_BASE_VERSION_TAG (2<<16)
+#define _Py_MAX_GLOBAL_TYPE_VERSION_TAG (_Py_TYPE_BASE_VERSION_TAG - 1)
+
 typedef struct {
     PyTypeObject *type;
     PyObject *tp_subclasses;
@@ -69,6 +76,8 @@ _PyStaticType_GET_WEAKREFS_LISTPTR(static_builtin_state *state)
 }
 
 struct types_state {
+    /* Used to set PyTypeObject.tp_version_tag of heap types. */
+    unsigned int next_version_tag;
     struct type_cache type_cache;
     size_t num_builtins_initialized;
     static_builtin_state builtins[_Py_MAX_STATIC_BUILTIN_TYPES];
@@ -76,6 +85,7 @@ struct types_state {
 
 
 extern int _PyStaticType_InitBuiltin(PyTypeObject *type);
+extern void _PyStaticType_ShareAll(void);
 extern static_builtin_state * _PyStaticType_GetState(PyTypeObject *);
 extern void _PyStaticType_ClearWeakRefs(PyTypeObject *type);
 extern void _PyStaticType_Dealloc(PyTypeObject *type);
@@ -84,6 +94,12 @@ extern void _PyStaticType_Dealloc(PyTypeObject *type);
 PyObject *_Py_slot_tp_getattro(PyObject *self, PyObject *name);
 PyObject *_Py_slot_tp_getattr_hook(PyObject *self, PyObject *name);
 
+extern PyObject *_PySuper_Lookup(PyTypeObject *su_type, PyObject *su_obj,
+                                 PyObject *name, int *method);
+extern PyObject *_PySuper_LookupDescr(PyTypeObject *su_type,
+                                      PyTypeObject *su_obj_type,
+                                      PyObject *name);
+
 #ifdef __cplusplus
 }
 #endif
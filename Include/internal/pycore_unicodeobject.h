@@ -13,6 +13,10 @@ extern "C" {
 
 void _PyUnicode_ExactDealloc(PyObject *op);
 
+/* Concatenate an array of str objects, as done by f-strings */
+extern PyObject* _PyUnicode_BuildString(PyObject *const *items,
+                                        Py_ssize_t nitems);
+
 /* runtime lifecycle */
 
 extern void _PyUnicode_InitState(PyInterpreterState *);
@@ -57,8 +61,14 @@ struct _Py_unicode_state {
 
     // Unicode identifiers (_Py_Identifier): see _PyUnicode_FromId()
     struct _Py_unicode_ids ids;
+
+    // Interned strings of an interpreter with its own GIL
+    // (Py_RTFLAGS_OWN_GIL).  Other interpreters share
+    // _PyRuntime.global_objects.interned.
+    PyObject *interned;
 };
 
+extern void _PyUnicode_InternStatic(PyInterpreterState *interp, PyObject **p);
 extern void _PyUnicode_ClearInterned(PyInterpreterState *interp);
 
 
@@ -10,1324 +10,1332 @@ extern "C" {
 
 /* The following is auto-generated by Tools/build/generate_global_objects.py. */
 static inline void
-_PyUnicode_InitStaticStrings(void) {
+_PyUnicode_InitStaticStrings(PyInterpreterState *interp) {
     PyObject *string;
     string = &_Py_ID(CANCELLED);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(FINISHED);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(False);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(JSONDecodeError);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(PENDING);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(Py_Repr);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(TextIOWrapper);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(True);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(WarningMessage);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(_);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__IOBase_closed);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__abc_tpflags__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__abs__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__abstractmethods__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__add__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__aenter__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__aexit__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__aiter__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__all__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__and__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__anext__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__annotations__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__args__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__asyncio_running_event_loop__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__await__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__bases__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__bool__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__build_class__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__builtins__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__bytes__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__call__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__cantrace__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__class__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__class_getitem__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__classcell__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__complex__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__contains__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__copy__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__ctypes_from_outparam__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__del__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__delattr__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__delete__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__delitem__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__dict__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__dictoffset__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__dir__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__divmod__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__doc__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__enter__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__eq__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__exit__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__file__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__float__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__floordiv__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__format__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__fspath__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__ge__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__get__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__getattr__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__getattribute__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__getinitargs__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__getitem__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__getnewargs__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__getnewargs_ex__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__getstate__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__gt__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__hash__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__iadd__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__iand__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__ifloordiv__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__ilshift__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__imatmul__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__imod__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__import__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__imul__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__index__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__init__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__init_subclass__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__instancecheck__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__int__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__invert__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__ior__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__ipow__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__irshift__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__isabstractmethod__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__isub__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__iter__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__itruediv__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__ixor__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__le__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__len__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__length_hint__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__lltrace__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__loader__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__lshift__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__lt__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__main__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__matmul__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__missing__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__mod__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__module__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__mro_entries__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__mul__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__name__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__ne__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__neg__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__new__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__newobj__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__newobj_ex__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__next__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__notes__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__or__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__orig_class__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__origin__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__package__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__parameters__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__path__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__pos__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__pow__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__prepare__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__qualname__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__radd__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__rand__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__rdivmod__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__reduce__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__reduce_ex__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__repr__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__reversed__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__rfloordiv__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__rlshift__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__rmatmul__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__rmod__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__rmul__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__ror__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__round__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__rpow__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__rrshift__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__rshift__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__rsub__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__rtruediv__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__rxor__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__set__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__set_name__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__setattr__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__setitem__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__setstate__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__sizeof__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__slotnames__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__slots__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__spec__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__str__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__sub__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__subclasscheck__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__subclasshook__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__truediv__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__trunc__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__typing_is_unpacked_typevartuple__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__typing_prepare_subst__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__typing_subst__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__typing_unpacked_tuple_args__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__warningregistry__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__weaklistoffset__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__weakref__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(__xor__);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(_abc_impl);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(_abstract_);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(_annotation);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(_anonymous_);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(_argtypes_);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(_as_parameter_);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(_asyncio_future_blocking);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(_blksize);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(_bootstrap);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(_check_retval_);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(_dealloc_warn);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(_feature_version);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(_fields_);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(_finalizing);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(_find_and_load);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(_fix_up_module);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(_flags_);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(_get_sourcefile);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(_handle_fromlist);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(_initializing);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(_is_text_encoding);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(_length_);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(_lock_unlock_module);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(_loop);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(_needs_com_addref_);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(_pack_);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(_restype_);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(_showwarnmsg);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(_shutdown);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(_slotnames);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(_strptime_datetime);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(_swappedbytes_);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(_type_);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(_uninitialized_submodules);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(_warn_unawaited_coroutine);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(_xoptions);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(a);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(abs_tol);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(access);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(add);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(add_done_callback);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(after_in_child);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(after_in_parent);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(aggregate_class);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(append);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(argdefs);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(arguments);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(argv);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(as_integer_ratio);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(ast);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(attribute);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(authorizer_callback);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(autocommit);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(b);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(backtick);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(base);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(before);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(big);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(binary_form);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(block);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(buffer);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(buffer_callback);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(buffer_size);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(buffering);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(buffers);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(bufsize);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(builtins);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(byteorder);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(bytes);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(bytes_per_sep);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(c);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(c_call);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(c_exception);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(c_return);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(cached_statements);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(cadata);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(cafile);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(call);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(call_exception_handler);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(call_soon);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(cancel);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(capath);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(category);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(cb_type);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(certfile);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(check_same_thread);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(clear);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(close);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(closed);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(closefd);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(closure);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(co_argcount);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(co_cellvars);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(co_code);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(co_consts);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(co_exceptiontable);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(co_filename);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(co_firstlineno);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(co_flags);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(co_freevars);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(co_kwonlyargcount);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(co_linetable);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(co_name);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(co_names);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(co_nlocals);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(co_posonlyargcount);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(co_qualname);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(co_stacksize);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(co_varnames);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(code);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(command);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(comment_factory);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(consts);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(context);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(cookie);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(copy);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(copyreg);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(coro);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(count);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(cwd);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(d);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(data);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(database);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(decode);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(decoder);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(default);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(defaultaction);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(delete);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(depth);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(detect_types);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(deterministic);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(device);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(dict);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(dictcomp);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(difference_update);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(digest);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(digest_size);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(digestmod);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(dir_fd);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
+    string = &_Py_ID(dirname);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(discard);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(dispatch_table);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(displayhook);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(dklen);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(doc);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(dont_inherit);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(dst);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(dst_dir_fd);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(duration);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(e);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(effective_ids);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(element_factory);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
+    string = &_Py_ID(enabled);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(encode);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(encoding);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(end);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(end_lineno);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(end_offset);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(endpos);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(env);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(errors);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(event);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(eventmask);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(exc_type);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(exc_value);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(excepthook);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(exception);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(exp);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(extend);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(facility);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(factory);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(false);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(family);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(fanout);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(fd);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(fd2);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(fdel);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(fget);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(file);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(file_actions);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(filename);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(fileno);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(filepath);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(fillvalue);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(filters);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(final);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(find_class);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(fix_imports);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(flags);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(flush);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(follow_symlinks);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(format);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(frequency);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(from_param);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(fromlist);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(fromtimestamp);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(fromutc);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(fset);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(func);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(future);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(generation);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(genexpr);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(get);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(get_debug);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(get_event_loop);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(get_loop);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(get_source);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(getattr);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(getstate);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(gid);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(globals);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(groupindex);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(groups);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(handle);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(hash_name);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(header);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(headers);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(hi);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(hook);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(id);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(ident);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(ignore);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(imag);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(importlib);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(in_fd);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(incoming);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(indexgroup);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(inf);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(inheritable);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(initial);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(initial_bytes);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(initial_value);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(initval);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(inner_size);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(input);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(insert_comments);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(insert_pis);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(instructions);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(intern);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(intersection);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(isatty);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(isinstance);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(isoformat);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(isolation_level);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(istext);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(item);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(items);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(iter);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(iterable);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(iterations);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(join);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(jump);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(keepends);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(key);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(keyfile);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(keys);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(kind);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(kw);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(kw1);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(kw2);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(lambda);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(last);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(last_node);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(last_traceback);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(last_type);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(last_value);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(latin1);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(leaf_size);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(len);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(length);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(level);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(limit);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(line);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(line_buffering);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(lineno);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(listcomp);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(little);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(lo);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(locale);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(locals);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(logoption);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(loop);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(mapping);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(match);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(max_length);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
+    string = &_Py_ID(max_objects);
+    _PyUnicode_InternStatic(interp, &string);
+    string = &_Py_ID(max_usec);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(maxdigits);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(maxevents);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(maxmem);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(maxsplit);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(maxvalue);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(memLevel);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(memlimit);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(message);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(metaclass);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(method);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(mod);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(mode);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(module);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(module_globals);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(modules);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(mro);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(msg);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(mycmp);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(n);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(n_arg);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(n_fields);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(n_sequence_fields);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(n_unnamed_fields);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(name);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(name_from);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(namespace_separator);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(namespaces);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(narg);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(ndigits);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(new_limit);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(newline);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(newlines);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(next);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(node_depth);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(node_offset);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(ns);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(nstype);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(nt);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(null);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(number);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(obj);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(object);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(offset);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(offset_dst);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(offset_src);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(on_type_read);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(onceregistry);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(only_keys);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(oparg);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(opcode);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(open);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(opener);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(operation);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(optimize);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(options);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(order);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(out_fd);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(outgoing);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(overlapped);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(owner);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(p);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(pages);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(parent);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(password);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(path);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(pattern);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(peek);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(persistent_id);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(persistent_load);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(person);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(pi_factory);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(pid);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(policy);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(pos);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(pos1);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(pos2);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(posix);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(print_file_and_line);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(priority);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(progress);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(progress_handler);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(proto);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(protocol);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(ps1);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(ps2);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(query);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(quotetabs);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(r);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(raw);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(read);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(read1);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(readable);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(readall);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(readinto);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(readinto1);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(readline);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(readonly);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(real);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(reducer_override);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(registry);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(rel_tol);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(reload);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(repl);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(replace);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(reserved);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(reset);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(resetids);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(return);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(reverse);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(reversed);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(s);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(salt);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(sched_priority);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(scheduler);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(seek);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(seekable);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(selectors);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(self);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(send);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(sep);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(sequence);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(server_hostname);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(server_side);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(session);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(setcomp);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(setpgroup);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(setsid);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(setsigdef);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(setsigmask);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(setstate);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(shape);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(show_cmd);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(signed);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(size);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(sizehint);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(sleep);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(sock);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(sort);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(sound);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(source);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(source_traceback);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(src);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(src_dir_fd);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(stacklevel);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(start);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(statement);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(status);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(stderr);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(stdin);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(stdout);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(step);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(store_name);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(strategy);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(strftime);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(strict);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(strict_mode);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(string);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(sub_key);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(symmetric_difference_update);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(tabsize);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(tag);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(target);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(target_is_directory);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(task);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(tb_frame);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(tb_lasti);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(tb_lineno);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(tb_next);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(tell);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(template);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(term);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(text);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(threading);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(throw);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(timeout);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(times);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(timetuple);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(top);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(trace_callback);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(traceback);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(trailers);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(translate);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(true);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(truncate);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(twice);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(txt);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(type);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(tz);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(tzname);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(uid);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(unlink);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(unraisablehook);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(uri);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(usedforsecurity);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(value);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(values);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(version);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(warnings);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(warnoptions);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(wbits);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(week);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(weekday);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(which);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(who);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(withdata);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(writable);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(write);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(write_through);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(x);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(year);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
     string = &_Py_ID(zdict);
-    PyUnicode_InternInPlace(&string);
+    _PyUnicode_InternStatic(interp, &string);
 }
 /* End auto-generated code */
 #ifdef __cplusplus
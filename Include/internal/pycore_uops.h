@@ -0,0 +1,74 @@
+#ifndef Py_INTERNAL_UOPS_H
+#define Py_INTERNAL_UOPS_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef Py_BUILD_CORE
+#  error "this header requires Py_BUILD_CORE define"
+#endif
+
+#include "pycore_frame.h"         // _PyInterpreterFrame
+
+/* Tier-2 micro-op traces.
+ *
+ * When the back edge of a loop gets hot, Python/optimizer.c projects a
+ * linear trace of micro-ops ("uops") from the loop head, following the
+ * expansions that Tools/cases_generator derives from Python/bytecodes.c.
+ * The trace replaces the JUMP_BACKWARD with JUMP_BACKWARD_INTO_TRACE, which
+ * runs it with _PyUopExecute() in Python/ceval.c.
+ */
+
+#define _Py_UOP_MAX_TRACE_LENGTH 64
+
+// Executors per code object; the index must fit in a JUMP_BACKWARD counter.
+#define _Py_MAX_EXECUTORS_PER_CODE 256
+
+typedef struct {
+    uint16_t opcode;
+    // The oparg of the instruction, or the index of the exit stub to jump to
+    uint16_t oparg;
+    // Index of the tier-1 instruction to resume at on leaving the trace
+    uint32_t target;
+    // The instruction's cache entry, if it has one
+    uint64_t operand;
+} _PyUOpInstruction;
+
+typedef struct {
+    int length;
+    // Machine code for the trace (a _PyJITFunction), or NULL to interpret it
+    void *jit_code;
+    size_t jit_size;
+    _PyUOpInstruction trace[1];
+} _PyUOpExecutor;
+
+struct _PyExecutorArray {
+    int size;
+    int capacity;
+    _PyUOpExecutor *executors[1];
+};
+
+/* Called by JUMP_BACKWARD when its counter reaches zero. Returns 1 if src
+   was specialized to JUMP_BACKWARD_INTO_TRACE, 0 if no trace was worth
+   projecting (and the counter was backed off), or -1 with an exception set. */
+extern int _PyOptimizer_BackEdge(_PyInterpreterFrame *frame,
+                                 _Py_CODEUNIT *src, _Py_CODEUNIT *dest);
+
+/* Runs the trace until it exits. Returns the next tier-1 instruction to
+   execute, or NULL with an exception set and frame->prev_instr pointing
+   at the instruction that raised. The frame's stack pointer is saved in
+   either case. */
+extern _Py_CODEUNIT *_PyUopExecute(PyThreadState *tstate,
+                                   _PyUOpExecutor *executor,
+                                   _PyInterpreterFrame *frame,
+                                   PyObject **stack_pointer);
+
+extern void _PyExecutorArray_Free(_PyExecutorArray *array);
+
+// Used by the _testinternalcapi extension which is built as a shared library
+PyAPI_FUNC(PyObject *) _PyOptimizer_GetExecutors(PyCodeObject *code);
+
+#ifdef __cplusplus
+}
+#endif
+#endif   /* !Py_INTERNAL_UOPS_H */
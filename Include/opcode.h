@@ -13,6 +13,9 @@ extern "C" {
 #define PUSH_NULL                                2
 #define INTERPRETER_EXIT                         3
 #define END_FOR                                  4
+#define END_SEND                                 5
+#define EXIT_INIT_CHECK                          6
+#define RETURN_DISCARD                           7
 #define NOP                                      9
 #define UNARY_POSITIVE                          10
 #define UNARY_NEGATIVE                          11
@@ -101,7 +104,9 @@ extern "C" {
 #define STORE_DEREF                            138
 #define DELETE_DEREF                           139
 #define JUMP_BACKWARD                          140
+#define LOAD_SUPER_ATTR                        141
 #define CALL_FUNCTION_EX                       142
+#define LOAD_FAST_AND_CLEAR                    143
 #define EXTENDED_ARG                           144
 #define LIST_APPEND                            145
 #define SET_ADD                                146
@@ -120,6 +125,18 @@ extern "C" {
 #define DICT_UPDATE                            165
 #define CALL                                   171
 #define KW_NAMES                               172
+#define MIN_INSTRUMENTED_OPCODE                244
+#define INSTRUMENTED_RESUME                    244
+#define INSTRUMENTED_RETURN_VALUE              245
+#define INSTRUMENTED_JUMP_FORWARD              246
+#define INSTRUMENTED_JUMP_BACKWARD             247
+#define INSTRUMENTED_POP_JUMP_IF_FALSE         248
+#define INSTRUMENTED_POP_JUMP_IF_TRUE          249
+#define INSTRUMENTED_POP_JUMP_IF_NONE          250
+#define INSTRUMENTED_POP_JUMP_IF_NOT_NONE      251
+#define INSTRUMENTED_JUMP_IF_FALSE_OR_POP      252
+#define INSTRUMENTED_JUMP_IF_TRUE_OR_POP       253
+#define INSTRUMENTED_LINE                      254
 #define MIN_PSEUDO_OPCODE                      256
 #define SETUP_FINALLY                          256
 #define SETUP_CLEANUP                          257
@@ -128,75 +145,109 @@ extern "C" {
 #define JUMP                                   260
 #define JUMP_NO_INTERRUPT                      261
 #define LOAD_METHOD                            262
-#define MAX_PSEUDO_OPCODE                      262
-#define BINARY_OP_ADD_FLOAT                      5
-#define BINARY_OP_ADD_INT                        6
-#define BINARY_OP_ADD_UNICODE                    7
-#define BINARY_OP_INPLACE_ADD_UNICODE            8
-#define BINARY_OP_MULTIPLY_FLOAT                13
-#define BINARY_OP_MULTIPLY_INT                  14
-#define BINARY_OP_SUBTRACT_FLOAT                16
-#define BINARY_OP_SUBTRACT_INT                  17
-#define BINARY_SUBSCR_DICT                      18
-#define BINARY_SUBSCR_GETITEM                   19
-#define BINARY_SUBSCR_LIST_INT                  20
-#define BINARY_SUBSCR_TUPLE_INT                 21
-#define CALL_PY_EXACT_ARGS                      22
-#define CALL_PY_WITH_DEFAULTS                   23
-#define CALL_BOUND_METHOD_EXACT_ARGS            24
-#define CALL_BUILTIN_CLASS                      28
-#define CALL_BUILTIN_FAST_WITH_KEYWORDS         29
-#define CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS  34
-#define CALL_NO_KW_BUILTIN_FAST                 38
-#define CALL_NO_KW_BUILTIN_O                    39
-#define CALL_NO_KW_ISINSTANCE                   40
-#define CALL_NO_KW_LEN                          41
-#define CALL_NO_KW_LIST_APPEND                  42
-#define CALL_NO_KW_METHOD_DESCRIPTOR_FAST       43
-#define CALL_NO_KW_METHOD_DESCRIPTOR_NOARGS     44
-#define CALL_NO_KW_METHOD_DESCRIPTOR_O          45
-#define CALL_NO_KW_STR_1                        46
-#define CALL_NO_KW_TUPLE_1                      47
-#define CALL_NO_KW_TYPE_1                       48
-#define COMPARE_OP_FLOAT_JUMP                   56
-#define COMPARE_OP_INT_JUMP                     57
-#define COMPARE_OP_STR_JUMP                     58
-#define FOR_ITER_LIST                           59
-#define FOR_ITER_TUPLE                          62
-#define FOR_ITER_RANGE                          64
-#define FOR_ITER_GEN                            65
-#define LOAD_ATTR_CLASS                         66
-#define LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN       67
-#define LOAD_ATTR_INSTANCE_VALUE                72
-#define LOAD_ATTR_MODULE                        73
-#define LOAD_ATTR_PROPERTY                      76
-#define LOAD_ATTR_SLOT                          77
-#define LOAD_ATTR_WITH_HINT                     78
-#define LOAD_ATTR_METHOD_LAZY_DICT              79
-#define LOAD_ATTR_METHOD_NO_DICT                80
-#define LOAD_ATTR_METHOD_WITH_DICT              81
-#define LOAD_ATTR_METHOD_WITH_VALUES            86
-#define LOAD_CONST__LOAD_FAST                  113
-#define LOAD_FAST__LOAD_CONST                  121
-#define LOAD_FAST__LOAD_FAST                   141
-#define LOAD_GLOBAL_BUILTIN                    143
-#define LOAD_GLOBAL_MODULE                     153
-#define STORE_ATTR_INSTANCE_VALUE              154
-#define STORE_ATTR_SLOT                        158
-#define STORE_ATTR_WITH_HINT                   159
-#define STORE_FAST__LOAD_FAST                  160
-#define STORE_FAST__STORE_FAST                 161
-#define STORE_SUBSCR_DICT                      166
-#define STORE_SUBSCR_LIST_INT                  167
-#define UNPACK_SEQUENCE_LIST                   168
-#define UNPACK_SEQUENCE_TUPLE                  169
-#define UNPACK_SEQUENCE_TWO_TUPLE              170
+#define LOAD_SUPER_METHOD                      263
+#define LOAD_ZERO_SUPER_METHOD                 264
+#define LOAD_ZERO_SUPER_ATTR                   265
+#define STORE_FAST_MAYBE_NULL                  266
+#define MAX_PSEUDO_OPCODE                      266
+#define BINARY_OP_ADD_FLOAT                      8
+#define BINARY_OP_ADD_INT                       13
+#define BINARY_OP_ADD_UNICODE                   14
+#define BINARY_OP_INPLACE_ADD_UNICODE           16
+#define BINARY_OP_MULTIPLY_FLOAT                17
+#define BINARY_OP_MULTIPLY_INT                  18
+#define BINARY_OP_SUBTRACT_FLOAT                19
+#define BINARY_OP_SUBTRACT_INT                  20
+#define BINARY_SLICE_BYTEARRAY                  21
+#define BINARY_SLICE_BYTES                      22
+#define BINARY_SLICE_STR                        23
+#define BINARY_SUBSCR_BYTEARRAY_INT             24
+#define BINARY_SUBSCR_BYTES_INT                 28
+#define BINARY_SUBSCR_DICT                      29
+#define BINARY_SUBSCR_GETITEM                   34
+#define BINARY_SUBSCR_LIST_INT                  38
+#define BINARY_SUBSCR_STR_INT                   39
+#define BINARY_SUBSCR_TUPLE_INT                 40
+#define CALL_PY_EXACT_ARGS                      41
+#define CALL_PY_WITH_DEFAULTS                   42
+#define CALL_BOUND_METHOD_EXACT_ARGS            43
+#define CALL_BUILTIN_CLASS                      44
+#define CALL_BUILTIN_FAST_WITH_KEYWORDS         45
+#define CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS  46
+#define CALL_NO_KW_ALLOC_AND_ENTER_INIT         47
+#define CALL_NO_KW_BUILTIN_FAST                 48
+#define CALL_NO_KW_BUILTIN_O                    56
+#define CALL_NO_KW_ISINSTANCE                   57
+#define CALL_NO_KW_LEN                          58
+#define CALL_NO_KW_LIST_APPEND                  59
+#define CALL_NO_KW_METHOD_DESCRIPTOR_FAST       62
+#define CALL_NO_KW_METHOD_DESCRIPTOR_NOARGS     64
+#define CALL_NO_KW_METHOD_DESCRIPTOR_O          65
+#define CALL_NO_KW_STR_1                        66
+#define CALL_NO_KW_TUPLE_1                      67
+#define CALL_NO_KW_TYPE_1                       72
+#define CALL_FUNCTION_EX_PY                     73
+#define COMPARE_OP_FLOAT_JUMP                   76
+#define COMPARE_OP_INT_JUMP                     77
+#define COMPARE_OP_STR_JUMP                     78
+#define SEND_GEN                                79
+#define CONTAINS_OP_DICT                        80
+#define CONTAINS_OP_SET                         81
+#define CONTAINS_OP_STR                         86
+#define CONTAINS_OP_TUPLE                      113
+#define FORMAT_VALUE_FLOAT                     121
+#define FORMAT_VALUE_INT                       153
+#define FORMAT_VALUE_STR                       154
+#define FOR_ITER_LIST                          158
+#define FOR_ITER_TUPLE                         159
+#define FOR_ITER_RANGE                         160
+#define FOR_ITER_GEN                           161
+#define FOR_ITER_DICT_KEYS                     166
+#define FOR_ITER_DICT_VALUES                   167
+#define FOR_ITER_DICT_ITEMS                    168
+#define FOR_ITER_ENUMERATE                     169
+#define JUMP_BACKWARD_INTO_TRACE               170
+#define LOAD_ATTR_CLASS                        173
+#define LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN      174
+#define LOAD_ATTR_INSTANCE_VALUE               175
+#define LOAD_ATTR_MODULE                       176
+#define LOAD_ATTR_PROPERTY                     177
+#define LOAD_ATTR_SLOT                         178
+#define LOAD_ATTR_WITH_HINT                    179
+#define LOAD_ATTR_METHOD_LAZY_DICT             180
+#define LOAD_ATTR_METHOD_NO_DICT               181
+#define LOAD_ATTR_METHOD_WITH_DICT             182
+#define LOAD_ATTR_METHOD_WITH_VALUES           183
+#define LOAD_GLOBAL_BUILTIN                    184
+#define LOAD_GLOBAL_MODULE                     185
+#define LOAD_SUPER_ATTR_ATTR                   186
+#define LOAD_SUPER_ATTR_METHOD                 187
+#define STORE_ATTR_CLASS                       188
+#define STORE_ATTR_INSTANCE_VALUE              189
+#define STORE_ATTR_MODULE                      190
+#define STORE_ATTR_PROPERTY                    191
+#define STORE_ATTR_SLOT                        192
+#define STORE_ATTR_WITH_HINT                   193
+#define STORE_SUBSCR_DICT                      194
+#define STORE_SUBSCR_LIST_INT                  195
+#define UNPACK_SEQUENCE_LIST                   196
+#define UNPACK_SEQUENCE_TUPLE                  197
+#define UNPACK_SEQUENCE_TWO_TUPLE              198
+#define LOAD_CONST__LOAD_FAST                  199
+#define LOAD_FAST__LOAD_CONST                  200
+#define LOAD_FAST__LOAD_FAST                   201
+#define STORE_FAST__LOAD_FAST                  202
+#define STORE_FAST__STORE_FAST                 203
 #define DO_TRACING                             255
 
 #define HAS_ARG(op) ((((op) >= HAVE_ARGUMENT) && (!IS_PSEUDO_OPCODE(op)))\
     || ((op) == JUMP) \
     || ((op) == JUMP_NO_INTERRUPT) \
     || ((op) == LOAD_METHOD) \
+    || ((op) == LOAD_SUPER_METHOD) \
+    || ((op) == LOAD_ZERO_SUPER_METHOD) \
+    || ((op) == LOAD_ZERO_SUPER_ATTR) \
+    || ((op) == STORE_FAST_MAYBE_NULL) \
     )
 
 #define HAS_CONST(op) (false\
@@ -726,4 +726,26 @@ extern char * _getpty(int *, int, mode_t, int);
 #  endif
 #endif
 
+
+/* Storage class for thread-local variables.  The runtime keeps the
+   current thread state in one, which is what lets interpreters with
+   their own GIL run in parallel. */
+#ifdef Py_BUILD_CORE
+#  ifdef HAVE_THREAD_LOCAL
+#    error "HAVE_THREAD_LOCAL is already defined"
+#  endif
+#  define HAVE_THREAD_LOCAL 1
+#  ifdef thread_local
+#    define _Py_thread_local thread_local
+#  elif __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_THREADS__)
+#    define _Py_thread_local _Thread_local
+#  elif defined(_MSC_VER)  /* AKA NT_THREADS */
+#    define _Py_thread_local __declspec(thread)
+#  elif defined(__GNUC__)  /* includes clang */
+#    define _Py_thread_local __thread
+#  else
+#    undef HAVE_THREAD_LOCAL
+#  endif
+#endif
+
 #endif /* Py_PYPORT_H */
@@ -6,9 +6,9 @@
 extern "C" {
 #endif
 
-#ifdef Py_STATS
+#define SPECIALIZATION_FAILURE_KINDS 36
 
-#define SPECIALIZATION_FAILURE_KINDS 32
+#ifdef Py_STATS
 
 /* Stats for determining who is calling PyEval_EvalFrame */
 #define EVAL_CALL_TOTAL 0
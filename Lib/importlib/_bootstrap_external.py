@@ -426,6 +426,15 @@ def _write_atomic(path, data, mode=0o666):
 #     Python 3.12a1 3510 (FOR_ITER leaves iterator on the stack)
 #     Python 3.12a1 3511 (Add STOPITERATION_ERROR instruction)
 #     Python 3.12a1 3512 (Remove all unused consts from code objects)
+#     Python 3.12a1 3513 (Add CONTAINS_OP inline cache and specializations)
+#     Python 3.12a1 3514 (Add END_SEND and an inline cache for SEND)
+#     Python 3.12a1 3515 (Add LOAD_SUPER_ATTR)
+#     Python 3.12a1 3516 (Grow the STORE_ATTR inline cache for property setters)
+#     Python 3.12a1 3517 (Inline list/dict/set comprehensions)
+#     Python 3.12a1 3518 (Add inline cache to BINARY_SLICE)
+#     Python 3.12a1 3519 (Add inline cache to FORMAT_VALUE)
+#     Python 3.12a1 3520 (Add inline cache to CALL_FUNCTION_EX)
+#     Python 3.12a1 3521 (Add inline cache to JUMP_BACKWARD)
 
 #     Python 3.13 will start with 3550
 
@@ -438,7 +447,7 @@ def _write_atomic(path, data, mode=0o666):
 # Whenever MAGIC_NUMBER is changed, the ranges in the magic_values array
 # in PC/launcher.c must also be updated.
 
-MAGIC_NUMBER = (3512).to_bytes(2, 'little') + b'\r\n'
+MAGIC_NUMBER = (3521).to_bytes(2, 'little') + b'\r\n'
 
 _RAW_MAGIC_NUMBER = int.from_bytes(MAGIC_NUMBER, 'little')  # For import.c
 
@@ -80,6 +80,9 @@ def pseudo_op(name, op, real_ops):
 def_op('INTERPRETER_EXIT', 3)
 
 def_op('END_FOR', 4)
+def_op('END_SEND', 5)
+def_op('EXIT_INIT_CHECK', 6)
+def_op('RETURN_DISCARD', 7)
 
 def_op('NOP', 9)
 def_op('UNARY_POSITIVE', 10)
@@ -193,8 +196,11 @@ def pseudo_op(name, op, real_ops):
 def_op('DELETE_DEREF', 139)
 hasfree.append(139)
 jrel_op('JUMP_BACKWARD', 140)    # Number of words to skip (backwards)
+name_op('LOAD_SUPER_ATTR', 141)
 
 def_op('CALL_FUNCTION_EX', 142)  # Flags
+def_op('LOAD_FAST_AND_CLEAR', 143)
+haslocal.append(143)
 
 def_op('EXTENDED_ARG', 144)
 EXTENDED_ARG = 144
@@ -221,6 +227,22 @@ def pseudo_op(name, op, real_ops):
 def_op('KW_NAMES', 172)
 hasconst.append(172)
 
+# Instrumented instructions, which sys.monitoring substitutes in place of
+# the instructions above (see Python/instrumentation.c).
+MIN_INSTRUMENTED_OPCODE = 244
+
+def_op('INSTRUMENTED_RESUME', 244)
+def_op('INSTRUMENTED_RETURN_VALUE', 245)
+jrel_op('INSTRUMENTED_JUMP_FORWARD', 246)
+jrel_op('INSTRUMENTED_JUMP_BACKWARD', 247)
+jrel_op('INSTRUMENTED_POP_JUMP_IF_FALSE', 248)
+jrel_op('INSTRUMENTED_POP_JUMP_IF_TRUE', 249)
+jrel_op('INSTRUMENTED_POP_JUMP_IF_NONE', 250)
+jrel_op('INSTRUMENTED_POP_JUMP_IF_NOT_NONE', 251)
+jrel_op('INSTRUMENTED_JUMP_IF_FALSE_OR_POP', 252)
+jrel_op('INSTRUMENTED_JUMP_IF_TRUE_OR_POP', 253)
+def_op('INSTRUMENTED_LINE', 254)
+
 
 hasarg.extend([op for op in opmap.values() if op >= HAVE_ARGUMENT])
 
@@ -238,6 +260,11 @@ def pseudo_op(name, op, real_ops):
 pseudo_op('JUMP_NO_INTERRUPT', 261, ['JUMP_FORWARD', 'JUMP_BACKWARD_NO_INTERRUPT'])
 
 pseudo_op('LOAD_METHOD', 262, ['LOAD_ATTR'])
+pseudo_op('LOAD_SUPER_METHOD', 263, ['LOAD_SUPER_ATTR'])
+pseudo_op('LOAD_ZERO_SUPER_METHOD', 264, ['LOAD_SUPER_ATTR'])
+pseudo_op('LOAD_ZERO_SUPER_ATTR', 265, ['LOAD_SUPER_ATTR'])
+
+pseudo_op('STORE_FAST_MAYBE_NULL', 266, ['STORE_FAST'])
 
 MAX_PSEUDO_OPCODE = MIN_PSEUDO_OPCODE + len(_pseudo_ops) - 1
 
@@ -288,10 +315,18 @@ def pseudo_op(name, op, real_ops):
         "BINARY_OP_SUBTRACT_FLOAT",
         "BINARY_OP_SUBTRACT_INT",
     ],
+    "BINARY_SLICE": [
+        "BINARY_SLICE_BYTEARRAY",
+        "BINARY_SLICE_BYTES",
+        "BINARY_SLICE_STR",
+    ],
     "BINARY_SUBSCR": [
+        "BINARY_SUBSCR_BYTEARRAY_INT",
+        "BINARY_SUBSCR_BYTES_INT",
         "BINARY_SUBSCR_DICT",
         "BINARY_SUBSCR_GETITEM",
         "BINARY_SUBSCR_LIST_INT",
+        "BINARY_SUBSCR_STR_INT",
         "BINARY_SUBSCR_TUPLE_INT",
     ],
     "CALL": [
@@ -301,6 +336,7 @@ def pseudo_op(name, op, real_ops):
         "CALL_BUILTIN_CLASS",
         "CALL_BUILTIN_FAST_WITH_KEYWORDS",
         "CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS",
+        "CALL_NO_KW_ALLOC_AND_ENTER_INIT",
         "CALL_NO_KW_BUILTIN_FAST",
         "CALL_NO_KW_BUILTIN_O",
         "CALL_NO_KW_ISINSTANCE",
@@ -313,16 +349,40 @@ def pseudo_op(name, op, real_ops):
         "CALL_NO_KW_TUPLE_1",
         "CALL_NO_KW_TYPE_1",
     ],
+    "CALL_FUNCTION_EX": [
+        "CALL_FUNCTION_EX_PY",
+    ],
     "COMPARE_OP": [
         "COMPARE_OP_FLOAT_JUMP",
         "COMPARE_OP_INT_JUMP",
         "COMPARE_OP_STR_JUMP",
     ],
+    "SEND": [
+        "SEND_GEN",
+    ],
+    "CONTAINS_OP": [
+        "CONTAINS_OP_DICT",
+        "CONTAINS_OP_SET",
+        "CONTAINS_OP_STR",
+        "CONTAINS_OP_TUPLE",
+    ],
+    "FORMAT_VALUE": [
+        "FORMAT_VALUE_FLOAT",
+        "FORMAT_VALUE_INT",
+        "FORMAT_VALUE_STR",
+    ],
     "FOR_ITER": [
         "FOR_ITER_LIST",
         "FOR_ITER_TUPLE",
         "FOR_ITER_RANGE",
         "FOR_ITER_GEN",
+        "FOR_ITER_DICT_KEYS",
+        "FOR_ITER_DICT_VALUES",
+        "FOR_ITER_DICT_ITEMS",
+        "FOR_ITER_ENUMERATE",
+    ],
+    "JUMP_BACKWARD": [
+        "JUMP_BACKWARD_INTO_TRACE",
     ],
     "LOAD_ATTR": [
         # These potentially push [NULL, bound method] onto the stack.
@@ -339,26 +399,22 @@ def pseudo_op(name, op, real_ops):
         "LOAD_ATTR_METHOD_WITH_DICT",
         "LOAD_ATTR_METHOD_WITH_VALUES",
     ],
-    "LOAD_CONST": [
-        "LOAD_CONST__LOAD_FAST",
-    ],
-    "LOAD_FAST": [
-        "LOAD_FAST__LOAD_CONST",
-        "LOAD_FAST__LOAD_FAST",
-    ],
     "LOAD_GLOBAL": [
         "LOAD_GLOBAL_BUILTIN",
         "LOAD_GLOBAL_MODULE",
     ],
+    "LOAD_SUPER_ATTR": [
+        "LOAD_SUPER_ATTR_ATTR",
+        "LOAD_SUPER_ATTR_METHOD",
+    ],
     "STORE_ATTR": [
+        "STORE_ATTR_CLASS",
         "STORE_ATTR_INSTANCE_VALUE",
+        "STORE_ATTR_MODULE",
+        "STORE_ATTR_PROPERTY",
         "STORE_ATTR_SLOT",
         "STORE_ATTR_WITH_HINT",
     ],
-    "STORE_FAST": [
-        "STORE_FAST__LOAD_FAST",
-        "STORE_FAST__STORE_FAST",
-    ],
     "STORE_SUBSCR": [
         "STORE_SUBSCR_DICT",
         "STORE_SUBSCR_LIST_INT",
@@ -369,6 +425,23 @@ def pseudo_op(name, op, real_ops):
         "UNPACK_SEQUENCE_TWO_TUPLE",
     ],
 }
+
+# Pairs of instructions that _PyCode_Quicken() replaces the first of with a
+# superinstruction, FIRST__SECOND, which runs both. Generated by
+# Tools/cases_generator/generate_cases.py; "make regen-superinstructions"
+# chooses them for the workload in a Py_STATS profile.
+# BEGIN SUPERINSTRUCTIONS
+_superinstructions = [
+    ("LOAD_CONST", "LOAD_FAST"),
+    ("LOAD_FAST", "LOAD_CONST"),
+    ("LOAD_FAST", "LOAD_FAST"),
+    ("STORE_FAST", "LOAD_FAST"),
+    ("STORE_FAST", "STORE_FAST"),
+]
+# END SUPERINSTRUCTIONS
+for _first, _second in _superinstructions:
+    _specializations.setdefault(_first, []).append(f"{_first}__{_second}")
+
 _specialized_instructions = [
     opcode for family in _specializations.values() for opcode in family
 ]
@@ -403,6 +476,9 @@ def pseudo_op(name, op, real_ops):
         "type_version": 2,
         "func_version": 1,
     },
+    "BINARY_SLICE": {
+        "counter": 1,
+    },
     "FOR_ITER": {
         "counter": 1,
     },
@@ -415,7 +491,8 @@ def pseudo_op(name, op, real_ops):
     "STORE_ATTR": {
         "counter": 1,
         "version": 2,
-        "index": 1,
+        "keys_version": 2,
+        "descr": 4,
     },
     "CALL": {
         "counter": 1,
@@ -425,6 +502,30 @@ def pseudo_op(name, op, real_ops):
     "STORE_SUBSCR": {
         "counter": 1,
     },
+    "CONTAINS_OP": {
+        "counter": 1,
+    },
+    "FORMAT_VALUE": {
+        "counter": 1,
+    },
+    "CALL_FUNCTION_EX": {
+        "counter": 1,
+    },
+    "SEND": {
+        "counter": 1,
+    },
+    "LOAD_SUPER_ATTR": {
+        "counter": 1,
+        "class_version": 2,
+        "self_type_version": 2,
+        "descr": 4,
+    },
+    "JUMP_BACKWARD": {
+        "counter": 1,
+    },
+    "INSTRUMENTED_JUMP_BACKWARD": {
+        "counter": 1,
+    },
 }
 
 _inline_cache_entries = [
@@ -0,0 +1,7 @@
+class super:
+    msg = "truly super"
+
+
+class C:
+    def method(self):
+        return super().msg
@@ -6,7 +6,7 @@
 # aliases:
 from _xxsubinterpreters import (
     ChannelError, ChannelNotFoundError, ChannelEmptyError,
-    is_shareable,
+    SharedBuffer, is_shareable,
 )
 
 
@@ -14,7 +14,7 @@
     'Interpreter', 'get_current', 'get_main', 'create', 'list_all',
     'SendChannel', 'RecvChannel',
     'create_channel', 'list_all_channels', 'is_shareable',
-    'ChannelError', 'ChannelNotFoundError',
+    'SharedBuffer', 'ChannelError', 'ChannelNotFoundError',
     'ChannelEmptyError',
     ]
 
@@ -146,17 +146,15 @@ def id(self):
 class RecvChannel(_ChannelEnd):
     """The receiving end of a cross-interpreter channel."""
 
-    def recv(self, *, _sentinel=object(), _delay=10 / 1000):  # 10 milliseconds
+    def recv(self, timeout=None):
         """Return the next object from the channel.
 
         This blocks until an object has been sent, if none have been
-        sent already.
+        sent already.  If a timeout (in seconds) is given and it expires
+        first then fail with ChannelEmptyError.
         """
-        obj = _interpreters.channel_recv(self._id, _sentinel)
-        while obj is _sentinel:
-            time.sleep(_delay)
-            obj = _interpreters.channel_recv(self._id, _sentinel)
-        return obj
+        return _interpreters.channel_recv(self._id, block=True,
+                                          timeout=timeout)
 
     def recv_nowait(self, default=_NOT_SET):
         """Return the next object from the channel.
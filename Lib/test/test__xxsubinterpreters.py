@@ -411,6 +411,82 @@ def test_non_shareable_int(self):
                     interpreters.channel_send(self.cid, i)
 
 
+class SharedBufferTests(TestBase):
+
+    def test_new(self):
+        buf = interpreters.SharedBuffer(5)
+        self.assertEqual(len(buf), 5)
+        self.assertEqual(bytes(buf), bytes(5))
+        self.assertEqual(repr(buf), 'SharedBuffer(5)')
+        self.assertTrue(interpreters.is_shareable(buf))
+
+        with self.assertRaises(ValueError):
+            interpreters.SharedBuffer(-1)
+        with self.assertRaises(TypeError):
+            interpreters.SharedBuffer(1.0)
+
+    def test_memoryview(self):
+        buf = interpreters.SharedBuffer(4)
+        view = memoryview(buf)
+        self.assertFalse(view.readonly)
+        view[:] = b'spam'
+        self.assertEqual(bytes(buf), b'spam')
+        self.assertEqual(bytes(memoryview(buf)), b'spam')
+
+    def test_send_recv_same_interpreter(self):
+        cid = interpreters.channel_create()
+        buf = interpreters.SharedBuffer(4)
+        interpreters.channel_send(cid, buf)
+        got = interpreters.channel_recv(cid)
+
+        self.assertIsNot(got, buf)
+        self.assertIs(type(got), type(buf))
+        memoryview(got)[:] = b'eggs'
+        self.assertEqual(bytes(buf), b'eggs')
+
+    def test_send_recv_different_interpreters(self):
+        cid = interpreters.channel_create()
+        buf = interpreters.SharedBuffer(4)
+        memoryview(buf)[:] = b'spam'
+        interpreters.channel_send(cid, buf)
+        interp = interpreters.create()
+        out = _run_output(interp, dedent(f"""
+            import _xxsubinterpreters as _interpreters
+            buf = _interpreters.channel_recv({cid})
+            view = memoryview(buf)
+            print(bytes(view).decode(), end='')
+            view[:] = b'eggs'
+            _interpreters.channel_send({cid}, buf)
+            """))
+        got = interpreters.channel_recv(cid)
+
+        self.assertEqual(out, 'spam')
+        self.assertEqual(bytes(buf), b'eggs')
+        self.assertEqual(bytes(got), b'eggs')
+
+    def test_outlives_sender(self):
+        cid = interpreters.channel_create()
+        interp = interpreters.create()
+        interpreters.run_string(interp, dedent(f"""
+            import _xxsubinterpreters as _interpreters
+            buf = _interpreters.SharedBuffer(4)
+            memoryview(buf)[:] = b'spam'
+            _interpreters.channel_send({cid}, buf)
+            buf = _interpreters.channel_recv({cid})
+            _interpreters.channel_send({cid}, buf)
+            del buf
+            """))
+        got = interpreters.channel_recv(cid)
+        interpreters.destroy(interp)
+
+        self.assertEqual(bytes(got), b'spam')
+
+    def test_released_with_channel(self):
+        cid = interpreters.channel_create()
+        interpreters.channel_send(cid, interpreters.SharedBuffer(10))
+        interpreters.channel_destroy(cid)
+
+
 class ModuleTests(TestBase):
 
     def test_import_in_interpreter(self):
@@ -1565,6 +1641,89 @@ def test_recv_default(self):
         self.assertEqual(obj5, b'eggs')
         self.assertIs(obj6, default)
 
+    def test_recv_block_timeout(self):
+        cid = interpreters.channel_create()
+        default = object()
+        start = time.monotonic()
+        obj = interpreters.channel_recv(cid, default, block=True, timeout=0.1)
+        elapsed = time.monotonic() - start
+
+        self.assertIs(obj, default)
+        self.assertGreaterEqual(elapsed, 0.09)
+        with self.assertRaises(interpreters.ChannelEmptyError):
+            interpreters.channel_recv(cid, block=True, timeout=0)
+
+    def test_recv_block_bad_timeout(self):
+        cid = interpreters.channel_create()
+        with self.assertRaises(ValueError):
+            interpreters.channel_recv(cid, timeout=1)
+        with self.assertRaises(ValueError):
+            interpreters.channel_recv(cid, block=True, timeout=-1)
+
+    def test_recv_block_already_sent(self):
+        cid = interpreters.channel_create()
+        interpreters.channel_send(cid, b'spam')
+        obj = interpreters.channel_recv(cid, block=True)
+
+        self.assertEqual(obj, b'spam')
+
+    def test_recv_block_different_threads(self):
+        cid = interpreters.channel_create()
+        objs = []
+
+        def f():
+            for _ in range(3):
+                objs.append(interpreters.channel_recv(cid, block=True,
+                                                      timeout=support.SHORT_TIMEOUT))
+        t = threading.Thread(target=f)
+        t.start()
+        for obj in (b'spam', b'eggs', b'ham'):
+            time.sleep(0.01)
+            interpreters.channel_send(cid, obj)
+        t.join()
+
+        self.assertEqual(objs, [b'spam', b'eggs', b'ham'])
+
+    def test_recv_block_different_interpreters(self):
+        cid = interpreters.channel_create()
+        interp = interpreters.create()
+        out = None
+
+        def f():
+            nonlocal out
+            out = _run_output(interp, dedent(f"""
+                import _xxsubinterpreters as _interpreters
+                obj = _interpreters.channel_recv({cid}, block=True,
+                                                 timeout={support.SHORT_TIMEOUT})
+                print(obj.decode(), end='')
+                """))
+        t = threading.Thread(target=f)
+        t.start()
+        time.sleep(0.1)
+        interpreters.channel_send(cid, b'spam')
+        t.join()
+
+        self.assertEqual(out, 'spam')
+
+    def test_recv_block_closed(self):
+        cid = interpreters.channel_create()
+        errors = []
+
+        def f():
+            try:
+                interpreters.channel_recv(cid, block=True,
+                                          timeout=support.SHORT_TIMEOUT)
+            except Exception as exc:
+                errors.append(exc)
+        t = threading.Thread(target=f)
+        t.start()
+        time.sleep(0.1)
+        interpreters.channel_close(cid)
+        t.join()
+
+        self.assertEqual(len(errors), 1)
+        self.assertIsInstance(errors[0], interpreters.ChannelClosedError)
+
     def test_recv_sending_interp_destroyed(self):
         cid = interpreters.channel_create()
         interp = interpreters.create()
@@ -1574,8 +1733,8 @@ def test_recv_sending_interp_destroyed(self):
             """))
         interpreters.destroy(interp)
 
-        with self.assertRaisesRegex(RuntimeError,
-                                    'unrecognized interpreter ID'):
+        # The objects sent by an interpreter are dropped with it.
+        with self.assertRaises(interpreters.ChannelEmptyError):
             interpreters.channel_recv(cid)
 
     def test_run_string_arg_unresolved(self):
@@ -1364,6 +1364,69 @@ def test_configured_settings(self):
 
                 self.assertEqual(settings, expected)
 
+    def run_with_own_gil(self, code):
+        return support.run_in_subinterp_with_config(
+            code,
+            allow_fork=False,
+            allow_exec=False,
+            allow_threads=True,
+            allow_daemon_threads=False,
+            own_gil=True,
+        )
+
+    def test_own_gil(self):
+        code = textwrap.dedent('''
+            import json, re, collections
+
+            class Point(collections.namedtuple('Point', 'x y')):
+                pass
+
+            points = [Point(i, -i) for i in range(1000)]
+            data = json.loads(json.dumps(points))
+            assert data[999] == [999, -999], data[999]
+            assert re.fullmatch(r'\\w+', 'spam')
+            ''')
+        # Run it twice: the first interpreter with its own GIL shares
+        # the static types, the second one reuses them.
+        for _ in range(2):
+            self.assertEqual(self.run_with_own_gil(code), 0)
+
+    @threading_helper.requires_working_threading()
+    def test_own_gil_in_parallel(self):
+        code = textwrap.dedent('''
+            total = 0
+            for i in range(100_000):
+                total += i
+            assert total == 4999950000, total
+            ''')
+        results = []
+        def run():
+            results.append(self.run_with_own_gil(code))
+        threads = [threading.Thread(target=run) for _ in range(4)]
+        with threading_helper.start_threads(threads):
+            pass
+        self.assertEqual(results, [0] * 4)
+
+    def test_own_gil_single_phase_init_extension(self):
+        # Single-phase init extension modules keep their state in globals,
+        # which interpreters with their own GIL can't share.
+        r, w = os.pipe()
+        code = textwrap.dedent(f'''
+            import os
+            try:
+                import _testcapi
+            except ImportError as exc:
+                result = str(exc)
+            else:
+                result = 'imported'
+            with os.fdopen({w}, 'w') as stdout:
+                stdout.write(result)
+            ''')
+        with os.fdopen(r) as stdout:
+            self.assertEqual(self.run_with_own_gil(code), 0)
+            out = stdout.read()
+        self.assertIn('does not support loading in subinterpreters', out)
+
     def test_mutate_exception(self):
         """
         Exceptions saved in global module state get shared between
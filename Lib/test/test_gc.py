@@ -1388,6 +1388,72 @@ def __del__(self):
             self.assertEqual(x, None)
 
 
+class IncrementalGCTests(unittest.TestCase):
+    def setUp(self):
+        self.addCleanup(gc.set_incremental, *gc.get_incremental())
+        self.addCleanup(gc.set_threshold, *gc.get_threshold())
+        gc.collect()
+
+    def test_settings(self):
+        gc.set_incremental(True, max_objects=123, max_usec=456)
+        self.assertEqual(gc.get_incremental(), (True, 123, 456))
+        gc.set_incremental(False)
+        self.assertEqual(gc.get_incremental(), (False, 10000, 0))
+        self.assertRaises(ValueError, gc.set_incremental, True, 0, 0)
+        self.assertRaises(ValueError, gc.set_incremental, True, -1)
+        self.assertRaises(ValueError, gc.set_incremental, True, 10, -1)
+
+    def run_increments(self, until):
+        gc.set_threshold(100, 2, 2)
+        # Enough long-lived objects to start a pass over the oldest
+        # generation.
+        keep = [[] for _ in range(len(gc.get_objects()))]
+        gc.collect(1)
+        collections = gc.get_stats()[2]["collections"]
+        gc.enable()
+        try:
+            for i in range(10**6):
+                if until():
+                    break
+                # Cyclic garbage, so that allocations are not offset by
+                # deallocations in the generation counts.
+                x = []
+                x.append(x)
+            else:
+                self.fail("increments didn't happen")
+        finally:
+            gc.disable()
+        del keep
+        self.assertGreater(gc.get_stats()[2]["collections"], collections)
+
+    def test_collects_old_cycle(self):
+        gc.set_incremental(True, max_objects=1000)
+        a = C1055820(1)
+        a.loop = a
+        wr = weakref.ref(a)
+        gc.collect(1)
+        del a
+        self.run_increments(lambda: wr() is None)
+
+    def test_frozen_objects_are_skipped(self):
+        l = []
+        l.append(l)
+        gc.freeze()
+        self.addCleanup(gc.unfreeze)
+        frozen = gc.get_freeze_count()
+        gc.collect()
+        gc.set_incremental(True, max_objects=1000)
+        a = C1055820(1)
+        a.loop = a
+        a.frozen = l
+        wr = weakref.ref(a)
+        gc.collect(1)
+        del a
+        self.run_increments(lambda: wr() is None)
+        self.assertEqual(gc.get_freeze_count(), frozen)
+        self.assertFalse(any(x is l for x in gc.get_objects()))
+
+
 class PythonFinalizationTests(unittest.TestCase):
     def test_ast_fini(self):
         # bpo-44184: Regression test for subtype_dealloc() when deallocating
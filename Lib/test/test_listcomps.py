@@ -146,6 +146,144 @@
 """
 
 
+
+class ListComprehensionTest(unittest.TestCase):
+    # List, set and dict comprehensions in functions are inlined into the
+    # enclosing frame; their semantics must not change.
+
+    def test_inlined(self):
+        def f(a):
+            return [x * 2 for x in a]
+        self.assertNotIn("<listcomp>",
+                         [getattr(c, "co_name", None)
+                          for c in f.__code__.co_consts])
+        self.assertEqual(f([1, 2]), [2, 4])
+
+    def test_iteration_var_isolated(self):
+        def f():
+            x = "outer"
+            y = [x for x in range(3)]
+            return x, y
+        self.assertEqual(f(), ("outer", [0, 1, 2]))
+
+    def test_iteration_var_unbound_after(self):
+        def f():
+            [x for x in range(3)]
+            return x
+        self.assertRaises(NameError, f)
+
+    def test_iteration_var_restored_on_error(self):
+        def f(a):
+            x = "outer"
+            try:
+                [1 / x for x in a]
+            except ZeroDivisionError:
+                return x
+        self.assertEqual(f([1, 0]), "outer")
+
+    def test_iteration_var_shadows_param(self):
+        def f(x):
+            return [x for x in range(x)], x
+        self.assertEqual(f(3), ([0, 1, 2], 3))
+
+    def test_iteration_var_shadows_global(self):
+        def f():
+            return [len for len in range(2)], len("abc")
+        self.assertEqual(f(), ([0, 1], 3))
+
+    def test_free_var_of_sibling(self):
+        y = "enclosing"
+        def f():
+            a = [y for y in range(2)]
+            b = [y for _ in range(2)]
+            return a, b
+        self.assertEqual(f(), ([0, 1], ["enclosing", "enclosing"]))
+
+    def test_global_of_sibling(self):
+        def f():
+            a = [len for len in range(2)]
+            b = [len("ab") for _ in range(2)]
+            return a, b
+        self.assertEqual(f(), ([0, 1], [2, 2]))
+
+    def test_closure_over_iteration_var(self):
+        def f():
+            return [lambda: x for x in range(3)]
+        self.assertEqual([g() for g in f()], [2, 2, 2])
+
+    def test_closure_over_outer_local(self):
+        def f():
+            y = 1
+            fs = [lambda: y + x for x in range(3)]
+            y = 10
+            return [g() for g in fs]
+        self.assertEqual(f(), [12, 12, 12])
+
+    def test_cell_local_in_outer(self):
+        def f():
+            x = 1
+            g = lambda: x
+            return [x for x in range(3)], g()
+        self.assertEqual(f(), ([0, 1, 2], 1))
+
+    def test_walrus(self):
+        def f(a):
+            r = [y := v * 2 for v in a]
+            return r, y
+        self.assertEqual(f([1, 2]), ([2, 4], 4))
+
+    def test_nested(self):
+        def f(a):
+            return [[i * j for j in a] for i in a], {i: {j for j in a} for i in a}
+        self.assertEqual(f([1, 2]),
+                         ([[1, 2], [2, 4]], {1: {1, 2}, 2: {1, 2}}))
+
+    def test_nested_in_genexp(self):
+        def f(a):
+            return list([x + y for y in a] for x in a)
+        self.assertEqual(f([1, 2]), [[2, 3], [3, 4]])
+
+    def test_locals(self):
+        def f():
+            z = 1
+            return [sorted(locals()) for x in range(1)], sorted(locals())
+        inner, outer = f()
+        self.assertEqual(inner, [["x", "z"]])
+        self.assertEqual(outer, ["z"])
+
+    def test_zero_arg_super(self):
+        class C:
+            def m(self):
+                return "C"
+        class D(C):
+            def m(self):
+                return [super().m() for _ in range(2)]
+        self.assertEqual(D().m(), ["C", "C"])
+
+    def test_async(self):
+        async def agen():
+            for i in range(3):
+                yield i
+        async def f():
+            x = "outer"
+            r = [x async for x in agen()]
+            return r, x
+        coro = f()
+        with self.assertRaises(StopIteration) as cm:
+            coro.send(None)
+        self.assertEqual(cm.exception.value, ([0, 1, 2], "outer"))
+
+    def test_class_and_module_scope_not_inlined(self):
+        ns = {}
+        exec("r = [x for x in range(3)]\n"
+             "class C:\n"
+             "    y = 5\n"
+             "    r = [x + 1 for x in range(3)]\n", ns)
+        self.assertEqual(ns["r"], [0, 1, 2])
+        self.assertEqual(ns["C"].r, [1, 2, 3])
+        self.assertNotIn("x", ns)
+
+
 __test__ = {'doctests' : doctests}
 
 def load_tests(loader, tests, pattern):
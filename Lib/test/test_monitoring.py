@@ -0,0 +1,314 @@
+"""Test suite for the sys.monitoring."""
+
+import dis
+import sys
+import unittest
+
+from test.support import cpython_only
+
+
+TEST_TOOL = 3
+TEST_TOOL2 = 4
+
+E = sys.monitoring.events
+
+
+def f1():
+    pass
+
+def f2():
+    len([])
+    sys.getsizeof(0)
+
+def loop(n):
+    total = 0
+    for i in range(n):
+        if i % 2:
+            total += i
+    return total
+
+def raises():
+    try:
+        raise KeyError(1)
+    except KeyError:
+        return 2
+
+
+class MonitoringTestBase:
+
+    def setUp(self):
+        sys.monitoring.use_tool_id(TEST_TOOL, "test " + self.__class__.__name__)
+
+    def tearDown(self):
+        sys.monitoring.set_local_events(TEST_TOOL, loop.__code__, 0)
+        sys.monitoring.free_tool_id(TEST_TOOL)
+        sys.monitoring.restart_events()
+
+
+class RecordingTestBase(MonitoringTestBase):
+
+    def record(self, func, events, *args):
+        log = []
+        event_names = {
+            E.PY_START: "start", E.PY_RETURN: "return", E.LINE: "line",
+            E.JUMP: "jump", E.BRANCH: "branch", E.RAISE: "raise",
+        }
+        for event, name in event_names.items():
+            def callback(*args, name=name):
+                log.append((name, *args[1:]))
+            sys.monitoring.register_callback(TEST_TOOL, event, callback)
+        sys.monitoring.set_local_events(TEST_TOOL, func.__code__, events)
+        try:
+            func(*args)
+        finally:
+            sys.monitoring.set_local_events(TEST_TOOL, func.__code__, 0)
+        return log
+
+
+class MonitoringBasicTest(unittest.TestCase):
+
+    def test_has_objects(self):
+        m = sys.monitoring
+        m.events
+        m.use_tool_id
+        m.free_tool_id
+        m.get_tool
+        m.get_events
+        m.set_events
+        m.get_local_events
+        m.set_local_events
+        m.register_callback
+        m.restart_events
+        m.DISABLE
+
+    def test_tool(self):
+        sys.monitoring.use_tool_id(TEST_TOOL, "MonitoringTest.Tool")
+        self.assertEqual(sys.monitoring.get_tool(TEST_TOOL),
+                         "MonitoringTest.Tool")
+        self.assertRaises(ValueError, sys.monitoring.use_tool_id,
+                          TEST_TOOL, "other")
+        sys.monitoring.set_events(TEST_TOOL, E.PY_START)
+        self.assertEqual(sys.monitoring.get_events(TEST_TOOL), E.PY_START)
+        sys.monitoring.set_events(TEST_TOOL, 0)
+        sys.monitoring.free_tool_id(TEST_TOOL)
+        self.assertIsNone(sys.monitoring.get_tool(TEST_TOOL))
+        with self.assertRaises(ValueError):
+            sys.monitoring.set_events(TEST_TOOL, E.PY_START)
+
+    def test_invalid_arguments(self):
+        self.assertRaises(ValueError, sys.monitoring.use_tool_id, -1, "x")
+        self.assertRaises(ValueError, sys.monitoring.use_tool_id, 8, "x")
+        sys.monitoring.use_tool_id(TEST_TOOL, "x")
+        try:
+            self.assertRaises(ValueError, sys.monitoring.set_events,
+                              TEST_TOOL, 1 << 20)
+            self.assertRaises(ValueError, sys.monitoring.register_callback,
+                              TEST_TOOL, E.PY_START | E.LINE, f1)
+            self.assertRaises(TypeError, sys.monitoring.set_local_events,
+                              TEST_TOOL, f1, E.LINE)
+        finally:
+            sys.monitoring.free_tool_id(TEST_TOOL)
+
+    def test_register_callback(self):
+        sys.monitoring.use_tool_id(TEST_TOOL, "x")
+        try:
+            def cb(*args):
+                pass
+            self.assertIsNone(
+                sys.monitoring.register_callback(TEST_TOOL, E.PY_START, cb))
+            self.assertIs(
+                sys.monitoring.register_callback(TEST_TOOL, E.PY_START, None),
+                cb)
+        finally:
+            sys.monitoring.free_tool_id(TEST_TOOL)
+
+    def test_events_namespace(self):
+        self.assertEqual(E.NO_EVENTS, 0)
+        events = [E.PY_START, E.PY_RETURN, E.LINE, E.JUMP, E.BRANCH, E.RAISE]
+        for i, event in enumerate(events):
+            self.assertEqual(event, 1 << i)
+
+
+class MonitoringEventsTest(RecordingTestBase, unittest.TestCase):
+
+    def test_start_and_return(self):
+        log = self.record(f1, E.PY_START | E.PY_RETURN)
+        self.assertEqual([entry[0] for entry in log], ["start", "return"])
+        self.assertEqual(log[-1][-1], None)
+
+    def test_global_events(self):
+        counts = [0]
+        def callback(code, offset):
+            if code is f1.__code__:
+                counts[0] += 1
+        sys.monitoring.register_callback(TEST_TOOL, E.PY_START, callback)
+        sys.monitoring.set_events(TEST_TOOL, E.PY_START)
+        try:
+            f1()
+            f1()
+        finally:
+            sys.monitoring.set_events(TEST_TOOL, 0)
+        f1()
+        self.assertEqual(counts[0], 2)
+
+    def test_lines(self):
+        log = self.record(f2, E.LINE)
+        first = f2.__code__.co_firstlineno
+        self.assertEqual(log, [("line", first + 1), ("line", first + 2)])
+
+    def test_loop_lines(self):
+        log = self.record(loop, E.LINE, 3)
+        first = loop.__code__.co_firstlineno
+        lines = [entry[1] - first for entry in log]
+        self.assertEqual(lines, [1, 2, 3, 2, 3, 4, 2, 3, 2, 5])
+
+    def test_jumps_and_branches(self):
+        log = self.record(loop, E.JUMP | E.BRANCH, 3)
+        names = [entry[0] for entry in log]
+        self.assertEqual(names.count("branch"), 3)
+        self.assertEqual(names.count("jump"), 3)
+        for name, src, dest in log:
+            self.assertEqual(src % 2, 0)
+            self.assertEqual(dest % 2, 0)
+            if name == "jump":
+                self.assertLess(dest, src)
+
+    def test_raise(self):
+        log = self.record(raises, E.RAISE)
+        self.assertEqual(len(log), 1)
+        name, offset, exc = log[0]
+        self.assertEqual(name, "raise")
+        self.assertIsInstance(exc, KeyError)
+
+    def test_cannot_disable_raise(self):
+        sys.monitoring.register_callback(
+            TEST_TOOL, E.RAISE, lambda *args: sys.monitoring.DISABLE)
+        sys.monitoring.set_local_events(TEST_TOOL, raises.__code__, E.RAISE)
+        try:
+            with self.assertRaises(ValueError):
+                raises()
+        finally:
+            sys.monitoring.set_local_events(TEST_TOOL, raises.__code__, 0)
+
+    def test_callback_error_propagates(self):
+        def callback(*args):
+            raise ZeroDivisionError
+        for event in (E.PY_START, E.PY_RETURN, E.LINE):
+            with self.subTest(event=event):
+                sys.monitoring.register_callback(TEST_TOOL, event, callback)
+                sys.monitoring.set_local_events(TEST_TOOL, f2.__code__, event)
+                try:
+                    self.assertRaises(ZeroDivisionError, f2)
+                finally:
+                    sys.monitoring.set_local_events(TEST_TOOL, f2.__code__, 0)
+                    sys.monitoring.register_callback(TEST_TOOL, event, None)
+
+    def test_generator(self):
+        def gen():
+            for i in range(3):
+                yield i
+        log = self.record(lambda: list(gen()), E.PY_START)
+        self.assertEqual(len(log), 1)
+        g = gen()
+        log = []
+        sys.monitoring.register_callback(
+            TEST_TOOL, E.LINE, lambda code, line: log.append(line))
+        sys.monitoring.set_local_events(TEST_TOOL, gen.__code__, E.LINE)
+        try:
+            self.assertEqual(list(g), [0, 1, 2])
+        finally:
+            sys.monitoring.set_local_events(TEST_TOOL, gen.__code__, 0)
+        first = gen.__code__.co_firstlineno
+        self.assertEqual([line - first for line in log],
+                         [1, 2, 1, 2, 1, 2, 1])
+
+    def test_two_tools(self):
+        sys.monitoring.use_tool_id(TEST_TOOL2, "second")
+        try:
+            log = []
+            sys.monitoring.register_callback(
+                TEST_TOOL, E.PY_START, lambda *args: log.append(1))
+            sys.monitoring.register_callback(
+                TEST_TOOL2, E.PY_START, lambda *args: log.append(2))
+            sys.monitoring.set_local_events(TEST_TOOL, f1.__code__, E.PY_START)
+            sys.monitoring.set_local_events(TEST_TOOL2, f1.__code__, E.PY_START)
+            f1()
+            sys.monitoring.set_local_events(TEST_TOOL, f1.__code__, 0)
+            f1()
+            sys.monitoring.set_local_events(TEST_TOOL2, f1.__code__, 0)
+            f1()
+            self.assertEqual(log, [1, 2, 2])
+        finally:
+            sys.monitoring.free_tool_id(TEST_TOOL2)
+
+
+class DisableTest(MonitoringTestBase, unittest.TestCase):
+
+    def test_disable_line(self):
+        log = []
+        def callback(code, line):
+            log.append(line)
+            return sys.monitoring.DISABLE
+        sys.monitoring.register_callback(TEST_TOOL, E.LINE, callback)
+        sys.monitoring.set_local_events(TEST_TOOL, loop.__code__, E.LINE)
+        loop(5)
+        first = loop.__code__.co_firstlineno
+        # DISABLE turns off the location, not the line: the loop header is
+        # reported again when it is reached by the backward jump.
+        expected = [1, 2, 3, 2, 4, 5]
+        self.assertEqual([line - first for line in log], expected)
+        log.clear()
+        loop(5)
+        self.assertEqual(log, [])
+        sys.monitoring.restart_events()
+        loop(5)
+        self.assertEqual([line - first for line in log], expected)
+        self.assertEqual(sys.monitoring.get_local_events(TEST_TOOL,
+                                                         loop.__code__),
+                         E.LINE)
+
+
+@cpython_only
+class InstrumentationTest(MonitoringTestBase, unittest.TestCase):
+
+    def opnames(self, func):
+        return [instr.opname for instr in
+                dis.get_instructions(func, adaptive=True)]
+
+    def test_instrumentation_is_removed(self):
+        log = []
+        sys.monitoring.register_callback(TEST_TOOL, E.LINE,
+                                         lambda code, line: log.append(line))
+        sys.monitoring.set_local_events(TEST_TOOL, loop.__code__, E.LINE)
+        loop(3)
+        self.assertTrue(log)
+        sys.monitoring.set_local_events(TEST_TOOL, loop.__code__, 0)
+        log.clear()
+        loop(3)
+        self.assertEqual(log, [])
+
+    def test_specialization_is_kept(self):
+        for _ in range(100):
+            loop(10)
+        specialized = self.opnames(loop)
+        self.assertIn("BINARY_OP_ADD_INT", specialized)
+        sys.monitoring.register_callback(TEST_TOOL, E.LINE,
+                                         lambda code, line: None)
+        sys.monitoring.set_local_events(TEST_TOOL, loop.__code__, E.LINE)
+        loop(10)
+        self.assertIn("BINARY_OP_ADD_INT", self.opnames(loop))
+        self.assertEqual(self.opnames(loop), specialized)
+
+    def test_co_code_is_not_instrumented(self):
+        before = loop.__code__.co_code
+        sys.monitoring.register_callback(TEST_TOOL, E.LINE,
+                                         lambda code, line: None)
+        sys.monitoring.set_local_events(TEST_TOOL, loop.__code__,
+                                        E.LINE | E.PY_START | E.BRANCH)
+        loop(3)
+        self.assertEqual(loop.__code__.co_code, before)
+        self.assertNotIn("INSTRUMENTED_LINE", self.opnames(loop))
+
+
+if __name__ == "__main__":
+    unittest.main()
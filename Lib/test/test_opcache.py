@@ -1,5 +1,13 @@
+import collections
+import sys
+import traceback
 import unittest
 
+try:
+    import _testinternalcapi
+except ImportError:
+    _testinternalcapi = None
+
 
 class TestLoadAttrCache(unittest.TestCase):
     def test_descriptor_added_after_optimization(self):
@@ -429,6 +437,908 @@ def f():
             self.assertFalse(f())
 
 
+class TestContainsOpCache(unittest.TestCase):
+    def test_set_contains_unhashable_set(self):
+        def f(x, s):
+            return x in s
+
+        s = {frozenset({1})}
+        for _ in range(1025):
+            self.assertTrue(f({1}, s))
+            self.assertFalse(f({2}, s))
+        for _ in range(1025):
+            with self.assertRaises(TypeError):
+                f([], s)
+
+    def test_str_contains_non_str(self):
+        def f(x, s):
+            return x in s
+
+        for _ in range(1025):
+            self.assertTrue(f("b", "abc"))
+            self.assertFalse(f("d", "abc"))
+        for _ in range(1025):
+            with self.assertRaises(TypeError):
+                f(1, "abc")
+
+    def test_tuple_contains_identity_and_equality(self):
+        class AlwaysEqual:
+            def __eq__(self, other):
+                return True
+
+        class Unequal:
+            def __eq__(self, other):
+                return False
+
+        def f(x, t):
+            return x not in t
+
+        nan = float("nan")
+        for _ in range(1025):
+            self.assertFalse(f(nan, (1, nan)))
+            self.assertTrue(f(float("nan"), (1, nan)))
+            self.assertFalse(f(1, (AlwaysEqual(),)))
+            self.assertTrue(f(Unequal(), (1, 2)))
+
+    def test_container_type_change(self):
+        def f(x, c):
+            return x in c
+
+        class MyDict(dict):
+            def __contains__(self, key):
+                return True
+
+        for _ in range(1025):
+            self.assertTrue(f(1, {1: 2}))
+        for container in (MyDict(), [1], range(2), {1: 2}.keys(), b"\x01"):
+            for _ in range(1025):
+                self.assertTrue(f(1, container))
+
+
+class TestForIterCache(unittest.TestCase):
+    def test_dict_items_unpacked(self):
+        def f(d):
+            return [(v, k) for k, v in d.items()]
+
+        d = dict(zip("abc", range(3)))
+        for _ in range(1025):
+            self.assertEqual(f(d), [(0, "a"), (1, "b"), (2, "c")])
+        self.assertEqual(f({}), [])
+        self.assertEqual(f({1: 2}), [(2, 1)])
+        # Deoptimizes to FOR_ITER, which unpacks the items itself:
+        self.assertEqual(f(collections.OrderedDict(d)), [(0, "a"), (1, "b"), (2, "c")])
+
+    def test_dict_views_changed_during_iteration(self):
+        def f(d, view):
+            for x in view(d):
+                d[x + 1] = x
+
+        def g(d):
+            for k, v in d.items():
+                del d[k]
+                d[k + 1] = v
+
+        for view in (dict.keys, dict.values):
+            for _ in range(1025):
+                with self.assertRaises(RuntimeError):
+                    f({0: 0}, view)
+        for _ in range(1025):
+            with self.assertRaises(RuntimeError):
+                g({0: 0})
+
+    def test_enumerate_unpacked(self):
+        def f(it, start=0):
+            return [(x, i) for i, x in enumerate(it, start)]
+
+        for _ in range(1025):
+            self.assertEqual(f(["a", "b"]), [("a", 0), ("b", 1)])
+            self.assertEqual(f(iter("ab"), 5), [("a", 5), ("b", 6)])
+        self.assertEqual(f([]), [])
+        self.assertEqual(f(["a", "b"], sys.maxsize),
+                         [("a", sys.maxsize), ("b", sys.maxsize + 1)])
+
+        def gen():
+            yield 1
+            raise ZeroDivisionError
+        with self.assertRaises(ZeroDivisionError):
+            f(gen())
+
+    def test_enumerate_list_mutated(self):
+        def f(lst):
+            for i, x in enumerate(lst):
+                if i < 3:
+                    lst.append(x)
+            return lst
+
+        for _ in range(1025):
+            self.assertEqual(f([1, 2]), [1, 2, 1, 2, 1])
+            self.assertEqual(f([]), [])
+
+
+class TestSendCache(unittest.TestCase):
+    def test_yield_from_send_and_return(self):
+        def inner():
+            x = yield 1
+            y = yield x + 1
+            return x + y
+
+        def outer():
+            r = yield from inner()
+            yield r
+
+        for _ in range(1025):
+            g = outer()
+            self.assertEqual(next(g), 1)
+            self.assertEqual(g.send(10), 11)
+            self.assertEqual(g.send(20), 30)
+            with self.assertRaises(StopIteration):
+                next(g)
+
+    def test_yield_from_throw(self):
+        def inner():
+            try:
+                yield 1
+            except KeyError:
+                return "caught"
+
+        def outer():
+            r = yield from inner()
+            yield r
+
+        for _ in range(1025):
+            g = outer()
+            next(g)
+            self.assertEqual(g.throw(KeyError), "caught")
+
+    def test_yield_from_exception(self):
+        def inner():
+            yield 1
+            1/0
+
+        def outer():
+            yield from inner()
+
+        for _ in range(1025):
+            with self.assertRaises(ZeroDivisionError):
+                list(outer())
+
+    def test_await_chain(self):
+        async def leaf(i):
+            return i
+
+        async def middle(i):
+            return await leaf(i) + await leaf(1)
+
+        async def top(n):
+            return [await middle(i) for i in range(n)]
+
+        coro = top(1025)
+        with self.assertRaises(StopIteration) as cm:
+            coro.send(None)
+        self.assertEqual(cm.exception.value, list(range(1, 1026)))
+
+
+class TestCallInitCache(unittest.TestCase):
+    def test_init_returns_non_none(self):
+        class C:
+            def __init__(self):
+                return 1
+
+        def f():
+            return C()
+
+        for _ in range(1025):
+            with self.assertRaisesRegex(TypeError, "should return None"):
+                f()
+
+    def test_init_raises(self):
+        class C:
+            def __init__(self, fail):
+                if fail:
+                    raise ValueError
+                self.fail = fail
+
+        def f(fail):
+            return C(fail)
+
+        for _ in range(1025):
+            self.assertFalse(f(False).fail)
+        try:
+            f(True)
+        except ValueError as e:
+            tb = traceback.extract_tb(e.__traceback__)
+        self.assertEqual([fs.name for fs in tb][-2:], ["f", "__init__"])
+
+    def test_init_caller_frame(self):
+        class C:
+            def __init__(self):
+                self.caller = sys._getframe(1).f_code.co_name
+
+        def f():
+            return C()
+
+        for _ in range(1025):
+            self.assertEqual(f().caller, "f")
+
+    def test_init_changed_after_optimization(self):
+        class C:
+            def __init__(self, x):
+                self.x = x
+
+        def f(x):
+            return C(x)
+
+        for i in range(1025):
+            self.assertEqual(f(i).x, i)
+
+        def __init__(self, x):
+            self.x = -x
+        C.__init__ = __init__
+        self.assertEqual(f(1).x, -1)
+
+        del C.__init__
+        with self.assertRaises(TypeError):
+            f(1)
+
+    def test_init_code_changed_after_optimization(self):
+        class C:
+            def __init__(self, x):
+                self.x = x
+
+        def f(x):
+            return C(x)
+
+        for i in range(1025):
+            self.assertEqual(f(i).x, i)
+
+        def new_init(self, *args):
+            self.x = args
+        C.__init__.__code__ = new_init.__code__
+        self.assertEqual(f(1).x, (1,))
+
+    def test_init_in_base_class(self):
+        class Base:
+            def __init__(self, x):
+                self.x = x
+
+        class Sub(Base):
+            pass
+
+        def f(cls, x):
+            return cls(x)
+
+        for i in range(1025):
+            self.assertIs(type(f(Sub, i)), Sub)
+
+        def __init__(self, x):
+            self.x = x * 2
+        Base.__init__ = __init__
+        self.assertEqual(f(Sub, 2).x, 4)
+
+    def test_class_made_abstract(self):
+        class C:
+            def __init__(self):
+                pass
+
+        def f():
+            return C()
+
+        for _ in range(1025):
+            f()
+        C.__abstractmethods__ = frozenset({"m"})
+        with self.assertRaises(TypeError):
+            f()
+
+    def test_deep_recursion_in_init(self):
+        class C:
+            def __init__(self):
+                C()
+
+        def f():
+            return C()
+
+        for _ in range(3):
+            with self.assertRaises(RecursionError):
+                f()
+
+    def test_tracing_enabled_in_init(self):
+        events = []
+        def tracer(frame, event, arg):
+            events.append((frame.f_code.co_name, event))
+            return tracer
+
+        class C:
+            def __init__(self, trace):
+                if trace:
+                    sys.settrace(tracer)
+
+        def f(trace):
+            return C(trace)
+
+        for _ in range(1025):
+            f(False)
+        try:
+            self.assertIs(type(f(True)), C)
+        finally:
+            sys.settrace(None)
+        self.assertNotIn("<init cleanup>", [name for name, _ in events])
+
+
+class TestStoreAttrCache(unittest.TestCase):
+    def test_property_setter(self):
+        class C:
+            def __init__(self):
+                self.calls = []
+            @property
+            def x(self):
+                return self.calls[-1]
+            @x.setter
+            def x(self, value):
+                self.calls.append(value)
+                return "ignored"
+
+        def f(c, n):
+            for i in range(n):
+                c.x = i
+
+        c = C()
+        f(c, 1025)
+        self.assertEqual(c.calls, list(range(1025)))
+        self.assertEqual(c.x, 1024)
+
+    def test_property_setter_raises(self):
+        class C:
+            @property
+            def x(self):
+                return 0
+            @x.setter
+            def x(self, value):
+                if value < 0:
+                    raise ValueError(value)
+
+        def f(c, value):
+            c.x = value
+
+        c = C()
+        for i in range(1025):
+            f(c, i)
+        try:
+            f(c, -1)
+        except ValueError as exc:
+            names = [fs.name for fs in traceback.extract_tb(exc.__traceback__)]
+        else:
+            self.fail("ValueError not raised")
+        self.assertEqual(names[-2:], ["f", "x"])
+        self.assertNotIn("<setter cleanup>", names)
+
+    def test_property_setter_changed_after_optimization(self):
+        class C:
+            x = property(lambda self: 0)
+
+        values = []
+        C.x = C.x.setter(lambda self, value: values.append(value))
+
+        def f(c, value):
+            c.x = value
+
+        c = C()
+        for i in range(1025):
+            f(c, i)
+        C.x = C.x.setter(lambda self, value: values.append(-value))
+        f(c, 5)
+        self.assertEqual(values[-1], -5)
+        del C.x
+        f(c, 6)
+        self.assertEqual(c.__dict__["x"], 6)
+
+    def test_setattr_added_after_optimization(self):
+        values = []
+        class C:
+            @property
+            def x(self):
+                return 0
+            @x.setter
+            def x(self, value):
+                values.append(value)
+
+        def f(c, value):
+            c.x = value
+
+        c = C()
+        for i in range(1025):
+            f(c, i)
+        C.__setattr__ = lambda self, name, value: values.append((name, value))
+        f(c, 7)
+        self.assertEqual(values[-1], ("x", 7))
+
+    def test_deep_recursion_in_setter(self):
+        class C:
+            @property
+            def x(self):
+                return 0
+            @x.setter
+            def x(self, value):
+                self.x = value
+
+        c = C()
+        self.assertRaises(RecursionError, setattr, c, "x", 1)
+        with self.assertRaises(RecursionError):
+            c.x = 1
+
+    def test_module_attribute(self):
+        import types
+        mod = types.ModuleType("mod")
+        mod.x = None
+
+        def f(value):
+            mod.x = value
+
+        for i in range(1025):
+            f(i)
+        self.assertEqual(mod.x, 1024)
+        del mod.x
+        f(1)
+        self.assertEqual(mod.x, 1)
+        mod.y = 2
+        f(3)
+        self.assertEqual(mod.x, 3)
+
+    def test_class_attribute(self):
+        class C:
+            x = 0
+
+        class D(C):
+            pass
+
+        def f(cls, value):
+            cls.x = value
+
+        for i in range(1025):
+            f(C, i)
+            self.assertEqual(D.x, i)
+        self.assertEqual(C.x, 1024)
+        self.assertRaises(TypeError, f, int, 1)
+
+    def test_metaclass_descriptor_added_after_optimization(self):
+        class Meta(type):
+            pass
+
+        class C(metaclass=Meta):
+            pass
+
+        def f(cls, value):
+            cls.x = value
+
+        for i in range(1025):
+            f(C, i)
+        values = []
+        Meta.x = property(lambda cls: 0, lambda cls, value: values.append(value))
+        f(C, 5)
+        self.assertEqual(values, [5])
+        self.assertEqual(C.__dict__["x"], 1024)
+
+
+class TestLoadSuperAttrCache(unittest.TestCase):
+    def test_method_changed_after_optimization(self):
+        class A:
+            def f(self):
+                return 1
+
+        class B(A):
+            def f(self):
+                return super().f()
+
+        b = B()
+        for _ in range(1025):
+            self.assertEqual(b.f(), 1)
+        A.f = lambda self: 2
+        self.assertEqual(b.f(), 2)
+        del A.f
+        self.assertRaises(AttributeError, b.f)
+
+    def test_attribute_changed_after_optimization(self):
+        class A:
+            x = 1
+
+        class B(A):
+            def get(self):
+                return super().x
+
+        b = B()
+        for _ in range(1025):
+            self.assertEqual(b.get(), 1)
+        A.x = property(lambda self: 2)
+        self.assertEqual(b.get(), 2)
+
+    def test_mro_changed_after_optimization(self):
+        class A:
+            def f(self):
+                return 'A'
+
+        class A2:
+            def f(self):
+                return 'A2'
+
+        class B(A):
+            def f(self):
+                return super().f()
+
+        b = B()
+        for _ in range(1025):
+            self.assertEqual(b.f(), 'A')
+        B.__bases__ = (A2,)
+        self.assertEqual(b.f(), 'A2')
+
+    def test_self_type_changed_after_optimization(self):
+        class A:
+            def f(self):
+                return 'A'
+
+        class B(A):
+            def f(self):
+                return super().f()
+
+        class C(B):
+            def f(self):
+                return 'C'
+
+        class D(B):
+            pass
+
+        def f(obj):
+            return B.f(obj)
+
+        for _ in range(1025):
+            self.assertEqual(f(D()), 'A')
+        # super(B, C()) must now skip C.f and still find A.f
+        self.assertEqual(f(C()), 'A')
+        with self.assertRaises(TypeError):
+            f(A())
+
+    def test_global_super_rebound_after_optimization(self):
+        class A:
+            msg = 'A'
+
+        class B(A):
+            def get(self):
+                return super().msg
+
+        b = B()
+        for _ in range(1025):
+            self.assertEqual(b.get(), 'A')
+
+        class MySuper:
+            msg = 'MySuper'
+        import builtins
+        orig_super = builtins.super
+        builtins.super = MySuper
+        try:
+            self.assertEqual(b.get(), 'MySuper')
+        finally:
+            builtins.super = orig_super
+
+
+class TestBinarySubscrCache(unittest.TestCase):
+    def test_str_int(self):
+        def f(s, i):
+            return s[i]
+
+        for _ in range(1025):
+            self.assertEqual(f("abc", 1), "b")
+            self.assertIs(f("a\xe9", 1), "\xe9")
+        # Out of range, negative and non-latin-1 subscripts deoptimize:
+        self.assertEqual(f("abc", -1), "c")
+        self.assertEqual(f("a\u20ac", 1), "\u20ac")
+        self.assertEqual(f("\u20aca", 1), "a")
+        with self.assertRaises(IndexError):
+            f("abc", 3)
+        with self.assertRaises(IndexError):
+            f("", 0)
+        self.assertEqual(f("abc", True), "b")
+        self.assertEqual(f(["a", "b"], 1), "b")
+
+    def test_bytes_int(self):
+        def f(b, i):
+            return b[i]
+
+        for _ in range(1025):
+            self.assertEqual(f(b"ab\xff", 1), 98)
+            self.assertEqual(f(b"ab\xff", 2), 255)
+            self.assertEqual(f(bytearray(b"ab\xff"), 2), 255)
+        self.assertEqual(f(b"abc", -1), 99)
+        with self.assertRaises(IndexError):
+            f(b"abc", 3)
+        with self.assertRaises(IndexError):
+            f(bytearray(), 0)
+        self.assertEqual(f(memoryview(b"abc"), 0), 97)
+
+    def test_bytearray_mutated(self):
+        def f(b, i):
+            return b[i]
+
+        b = bytearray(b"abc")
+        for _ in range(1025):
+            self.assertEqual(f(b, 2), 99)
+        b.pop()
+        with self.assertRaises(IndexError):
+            f(b, 2)
+        b[0] = 0
+        self.assertEqual(f(b, 0), 0)
+
+
+class TestBinarySliceCache(unittest.TestCase):
+    def test_str(self):
+        def f(s, start, stop):
+            return s[start:stop]
+
+        for _ in range(1025):
+            self.assertEqual(f("hello", 1, 3), "el")
+            self.assertEqual(f("hello", None, -1), "hell")
+            self.assertEqual(f("h\u20acllo", 1, None), "\u20acllo")
+            self.assertEqual(f("hello", 10, 20), "")
+            self.assertEqual(f("hello", -(2**100), 2**100), "hello")
+        class Index:
+            def __index__(self):
+                return 1
+        self.assertEqual(f("hello", Index(), None), "ello")
+        self.assertEqual(f(["h", "i"], 1, None), ["i"])
+        with self.assertRaises(TypeError):
+            f("hello", "a", None)
+
+    def test_bytes_and_bytearray(self):
+        def f(b, start, stop):
+            return b[start:stop]
+
+        data = b"\x00\x01\x02\x03"
+        for _ in range(1025):
+            self.assertEqual(f(data, 1, 3), b"\x01\x02")
+            self.assertIs(f(data, None, None), data)
+            self.assertEqual(f(data, -1, None), b"\x03")
+        for _ in range(1025):
+            b = bytearray(data)
+            res = f(b, None, 2)
+            self.assertEqual(res, bytearray(b"\x00\x01"))
+            self.assertIs(type(res), bytearray)
+            self.assertIsNot(f(b, None, None), b)
+        self.assertEqual(f(memoryview(data), 1, 2).tobytes(), b"\x01")
+
+
+class TestFormatValueCache(unittest.TestCase):
+    def test_str_int_float(self):
+        def f(x):
+            return f"<{x}>"
+
+        def g(x):
+            return f"<{x!r}>"
+
+        for _ in range(1025):
+            self.assertEqual(f("a"), "<a>")
+            self.assertEqual(f(-12), "<-12>")
+            self.assertEqual(f(1.5), "<1.5>")
+            self.assertEqual(g(2**70), f"<{2**70}>")
+            self.assertEqual(g(1e300), "<1e+300>")
+        # Other types, and subclasses with their own __format__, deoptimize
+        class MyStr(str):
+            def __format__(self, spec):
+                return "mystr"
+        class MyInt(int):
+            def __format__(self, spec):
+                return "myint"
+        self.assertEqual(f(MyStr("a")), "<mystr>")
+        self.assertEqual(f(MyInt(1)), "<myint>")
+        self.assertEqual(f(True), "<True>")
+        self.assertEqual(f(None), "<None>")
+        self.assertEqual(g("a"), "<'a'>")
+
+    def test_int_max_str_digits(self):
+        def f(x):
+            return f"{x}"
+
+        for _ in range(1025):
+            self.assertEqual(f(7), "7")
+        with self.assertRaises(ValueError):
+            f(10 ** 10000)
+
+    def test_build_string_mixed_kinds(self):
+        def f(a, b, c):
+            return f"{a}-{b}-{c}"
+
+        for _ in range(1025):
+            self.assertEqual(f("a", "\xe9", "\u20ac"), "a-\xe9-\u20ac")
+            self.assertEqual(f("\U0001f600", 1, ""), "\U0001f600-1-")
+            self.assertEqual(f("", "", ""), "--")
+
+
+class TestCallFunctionExCache(unittest.TestCase):
+    def test_forwarding(self):
+        def wrapper(func, *args, **kwargs):
+            return func(*args, **kwargs)
+
+        def f(a, b=2, *rest, c=3, **kw):
+            return a, b, rest, c, kw
+
+        def g():
+            yield 1
+
+        for _ in range(1025):
+            self.assertEqual(wrapper(f, 1), (1, 2, (), 3, {}))
+            self.assertEqual(wrapper(f, 1, 4, 5, c=6, d=7),
+                             (1, 4, (5,), 6, {"d": 7}))
+            self.assertEqual(wrapper(f, b=1, a=0), (0, 1, (), 3, {}))
+            self.assertEqual(list(wrapper(g)), [1])
+        # Other callables deoptimize
+        self.assertEqual(wrapper(max, 1, 2), 2)
+        self.assertEqual(wrapper(dict, a=1), {"a": 1})
+        self.assertEqual(wrapper(f.__get__(0), 1), (0, 1, (), 3, {}))
+
+    def test_positional_only(self):
+        def f(*args):
+            return args
+
+        def g(a, b):
+            return a - b
+
+        for _ in range(1025):
+            self.assertEqual(f(*(1, 2)), (1, 2))
+            self.assertEqual(g(*(3, 1)), 2)
+            self.assertEqual(g(*[3, 1]), 2)
+
+    def test_errors(self):
+        def wrapper(func, *args, **kwargs):
+            return func(*args, **kwargs)
+
+        def f(a):
+            return a
+
+        for _ in range(1025):
+            self.assertEqual(wrapper(f, 1), 1)
+        with self.assertRaises(TypeError):
+            wrapper(f)
+        with self.assertRaises(TypeError):
+            wrapper(f, 1, a=1)
+        with self.assertRaises(TypeError):
+            wrapper(f, 1, 2)
+        with self.assertRaises(TypeError):
+            f(**{1: 2})
+        with self.assertRaisesRegex(TypeError, "keywords must be strings"):
+            f(*(), **{1: 2})
+
+    def test_traceback_has_callee_frame(self):
+        def wrapper(func, *args):
+            return func(*args)
+
+        def f(x):
+            return 1 / x
+
+        for _ in range(1025):
+            wrapper(f, 1)
+        try:
+            wrapper(f, 0)
+        except ZeroDivisionError as e:
+            tb = e.__traceback__
+        names = []
+        while tb is not None:
+            names.append(tb.tb_frame.f_code.co_name)
+            tb = tb.tb_next
+        self.assertEqual(names[-2:], ["wrapper", "f"])
+
+
+@unittest.skipIf(_testinternalcapi is None, "requires _testinternalcapi")
+class TestTier2(unittest.TestCase):
+    def get_executors(self, func):
+        return _testinternalcapi.get_executors(func.__code__)
+
+    def test_range_loop_gets_trace(self):
+        def f(n):
+            total = 0
+            for i in range(n):
+                total = total + i
+            return total
+
+        self.assertEqual(f(1000), 499500)
+        executors = self.get_executors(f)
+        self.assertEqual(len(executors), 1)
+        uops = executors[0][1]
+        self.assertEqual(uops[0], "_FOR_ITER_RANGE")
+        self.assertEqual(uops[-1], "JUMP_TO_TOP")
+        self.assertEqual(f(1000), 499500)
+
+    def test_redundant_guard_removed(self):
+        def f(n):
+            total = 0
+            for i in range(n):
+                total = total + i * 2
+            return total
+
+        self.assertEqual(f(1000), 999000)
+        [(_, uops)] = self.get_executors(f)
+        # i comes from range() and 2 is a constant, so only the addition
+        # to total needs a guard.
+        self.assertEqual(uops.count("_GUARD_BOTH_INT"), 1)
+        self.assertIn("_BINARY_OP_MULTIPLY_INT", uops)
+
+    def test_types_change_in_loop(self):
+        def f(items):
+            total = 0
+            for x in items:
+                total = total + x
+            return total
+
+        self.assertEqual(f([1] * 1000), 1000)
+        self.assertTrue(self.get_executors(f))
+        self.assertEqual(f([1] * 100 + [0.5] * 100), 150.0)
+        self.assertEqual(f([1] * 100 + [True, 2**100]), 100 + 1 + 2**100)
+        self.assertEqual(f(tuple(range(100))), 4950)
+
+    def test_exception_in_trace(self):
+        def f(items):
+            total = 0
+            for x in items:
+                total = total + x
+            return total
+
+        f([1] * 1000)
+        self.assertTrue(self.get_executors(f))
+        try:
+            f([1] * 100 + [None])
+        except TypeError as e:
+            tb = e.__traceback__
+        else:
+            self.fail("TypeError not raised")
+        while tb.tb_next is not None:
+            tb = tb.tb_next
+        self.assertEqual(tb.tb_frame.f_code, f.__code__)
+        self.assertEqual(tb.tb_lineno, f.__code__.co_firstlineno + 3)
+
+    def test_exception_handled_in_loop(self):
+        def f(n):
+            total = 0
+            for i in range(n):
+                try:
+                    total = total + (i if i != 500 else None)
+                except TypeError:
+                    total = -total
+            return total
+
+        self.assertEqual(f(100), 4950)
+        self.assertEqual(f(1000), -sum(range(500)) + sum(range(501, 1000)))
+
+    def test_branches(self):
+        def f(n):
+            i = 0
+            odd = 0
+            while i < n:
+                if i % 2 == 1:
+                    odd = odd + 1
+                i = i + 1
+            return odd
+
+        for _ in range(3):
+            self.assertEqual(f(1000), 500)
+
+    def test_settrace_during_loop(self):
+        events = []
+
+        def tracer(frame, event, arg):
+            if event == "line" and frame.f_code is f.__code__:
+                events.append(frame.f_lineno)
+            return tracer
+
+        def f(n):
+            total = 0
+            for i in range(n):
+                total = total + i
+                if i == n - 3:
+                    sys.settrace(tracer)
+                    sys._getframe().f_trace = tracer
+            sys.settrace(None)
+            return total
+
+        self.addCleanup(sys.settrace, sys.gettrace())
+        self.assertEqual(f(1000), 499500)
+        self.assertIn(f.__code__.co_firstlineno + 3, events)
+
+
 if __name__ == "__main__":
     import unittest
     unittest.main()
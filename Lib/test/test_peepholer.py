@@ -655,6 +655,55 @@ def test_static_swaps_match_sequence(self):
                     else:
                         self.assertNotInBytecode(code, "SWAP")
 
+    def test_dead_store_same_line(self):
+        def f(a, b):
+            x = a; x = b
+            y, y = a, b
+            return x, y
+        self.assertEqual(f(1, 2), (2, 2))
+        self.assertEqual(count_instr_recursively(f, 'STORE_FAST'), 2)
+        self.assertInBytecode(f, 'STORE_FAST', 'x')
+        self.assertInBytecode(f, 'STORE_FAST', 'y')
+
+    def test_dead_store_other_line(self):
+        def f(a, b):
+            x = a
+            x = b
+            return x
+        self.assertEqual(f(1, 2), 2)
+        self.assertEqual(count_instr_recursively(f, 'STORE_FAST'), 2)
+
+    def test_dead_store_observable(self):
+        def f(a, b):
+            x = a; g(); x = b
+        def g():
+            return sys._getframe(1).f_locals['x']
+        self.assertEqual(count_instr_recursively(f, 'STORE_FAST'), 2)
+
+    def test_store_forwarded_to_load(self):
+        def f(a):
+            x = a; y = x; x = None
+            return x, y
+        self.assertEqual(f(1), (None, 1))
+        self.assertEqual(count_instr_recursively(f, 'STORE_FAST'), 2)
+        self.assertInBytecode(f, 'STORE_FAST', 'y')
+        self.assertEqual(count_instr_recursively(f, 'LOAD_FAST'), 3)
+
+    def test_self_assignment(self):
+        def f(x):
+            x = x; y = 1; y = y
+            return x, y
+        self.assertEqual(f(3), (3, 1))
+        self.assertEqual(count_instr_recursively(f, 'STORE_FAST'), 1)
+        self.assertInBytecode(f, 'STORE_FAST', 'y')
+
+    def test_self_assignment_keeps_line(self):
+        def f(x):
+            x = x
+            return x
+        self.assertNotInBytecode(f, 'STORE_FAST')
+        self.assertInBytecode(f, 'NOP')
+
 
 class TestBuglets(unittest.TestCase):
 
@@ -776,10 +825,8 @@ def f():
         self.assertInBytecode(f, 'LOAD_FAST_CHECK')
         self.assertNotInBytecode(f, 'LOAD_FAST')
 
-    def test_load_fast_too_many_locals(self):
-        # When there get to be too many locals to analyze completely,
-        # later locals are all converted to LOAD_FAST_CHECK, except
-        # when a store or prior load occurred in the same basicblock.
+    def test_load_fast_many_locals(self):
+        # Locals beyond the first 64 are analyzed completely too.
         def f():
             a00 = a01 = a02 = a03 = a04 = a05 = a06 = a07 = a08 = a09 = 1
             a10 = a11 = a12 = a13 = a14 = a15 = a16 = a17 = a18 = a19 = 1
@@ -789,31 +836,56 @@ def f():
             a50 = a51 = a52 = a53 = a54 = a55 = a56 = a57 = a58 = a59 = 1
             a60 = a61 = a62 = a63 = a64 = a65 = a66 = a67 = a68 = a69 = 1
             a70 = a71 = a72 = a73 = a74 = a75 = a76 = a77 = a78 = a79 = 1
-            del a72, a73
-            print(a73)
-            print(a70, a71, a72, a73)
+            del a72
             while True:
                 print(a00, a01, a62, a63)
                 print(a64, a65, a78, a79)
+                print(a72)
 
-        for i in 0, 1, 62, 63:
-            # First 64 locals: analyze completely
+        for i in 0, 1, 62, 63, 64, 65, 78, 79:
             self.assertInBytecode(f, 'LOAD_FAST', f"a{i:02}")
             self.assertNotInBytecode(f, 'LOAD_FAST_CHECK', f"a{i:02}")
-        for i in 64, 65, 78, 79:
-            # Locals >=64 not in the same basicblock
-            self.assertInBytecode(f, 'LOAD_FAST_CHECK', f"a{i:02}")
-            self.assertNotInBytecode(f, 'LOAD_FAST', f"a{i:02}")
-        for i in 70, 71:
-            # Locals >=64 in the same basicblock
-            self.assertInBytecode(f, 'LOAD_FAST', f"a{i:02}")
-            self.assertNotInBytecode(f, 'LOAD_FAST_CHECK', f"a{i:02}")
-        # del statements should invalidate within basicblocks.
         self.assertInBytecode(f, 'LOAD_FAST_CHECK', "a72")
         self.assertNotInBytecode(f, 'LOAD_FAST', "a72")
+
+    def test_load_fast_too_many_locals(self):
+        # When there get to be too many locals to analyze completely,
+        # later locals are all converted to LOAD_FAST_CHECK, except
+        # when a store or prior load occurred in the same basicblock.
+        n = 520
+        names = [f"a{i:03}" for i in range(n)]
+        source = textwrap.dedent(f"""\
+            def f():
+                {" = ".join(names)} = 1
+                del a516, a517
+                print(a517)
+                print(a514, a515, a516, a517)
+                while True:
+                    print(a000, a001, a510, a511)
+                    print(a512, a513, a518, a519)
+        """)
+        ns = {}
+        exec(source, ns)
+        f = ns["f"]
+
+        for i in 0, 1, 510, 511:
+            # First 512 locals: analyze completely
+            self.assertInBytecode(f, 'LOAD_FAST', f"a{i:03}")
+            self.assertNotInBytecode(f, 'LOAD_FAST_CHECK', f"a{i:03}")
+        for i in 512, 513, 518, 519:
+            # Locals >=512 not in the same basicblock
+            self.assertInBytecode(f, 'LOAD_FAST_CHECK', f"a{i:03}")
+            self.assertNotInBytecode(f, 'LOAD_FAST', f"a{i:03}")
+        for i in 514, 515:
+            # Locals >=512 in the same basicblock
+            self.assertInBytecode(f, 'LOAD_FAST', f"a{i:03}")
+            self.assertNotInBytecode(f, 'LOAD_FAST_CHECK', f"a{i:03}")
+        # del statements should invalidate within basicblocks.
+        self.assertInBytecode(f, 'LOAD_FAST_CHECK', "a516")
+        self.assertNotInBytecode(f, 'LOAD_FAST', "a516")
         # previous checked loads within a basicblock enable unchecked loads
-        self.assertInBytecode(f, 'LOAD_FAST_CHECK', "a73")
-        self.assertInBytecode(f, 'LOAD_FAST', "a73")
+        self.assertInBytecode(f, 'LOAD_FAST_CHECK', "a517")
+        self.assertInBytecode(f, 'LOAD_FAST', "a517")
 
     def test_setting_lineno_no_undefined(self):
         code = textwrap.dedent(f"""\
@@ -1,6 +1,8 @@
 """Unit tests for zero-argument super() & related machinery."""
 
 import unittest
+from unittest.mock import patch
+from test import shadowing_super
 
 
 class A:
@@ -325,6 +327,127 @@ def test_super_argtype(self):
         with self.assertRaisesRegex(TypeError, "argument 1 must be a type"):
             super(1, int)
 
+    def test_shadowed_global(self):
+        self.assertEqual(shadowing_super.C().method(), "truly super")
+
+    def test_shadowed_local(self):
+        class super:
+            msg = "quite super"
+
+        class C(A):
+            def method(self):
+                return super().msg
+
+        self.assertEqual(C().method(), "quite super")
+
+    def test_shadowed_dynamic(self):
+        class MySuper:
+            msg = "super super"
+
+        class C(A):
+            def method(self):
+                return super().msg
+
+        with patch(f"{__name__}.super", MySuper, create=True):
+            self.assertEqual(C().method(), "super super")
+
+    def test_shadowed_dynamic_two_arg(self):
+        call_args = []
+        class MySuper:
+            def __init__(self, *args):
+                call_args.append(args)
+            msg = "super super"
+
+        class C(A):
+            def method(self):
+                return super(1, 2).msg
+
+        with patch(f"{__name__}.super", MySuper, create=True):
+            self.assertEqual(C().method(), "super super")
+            self.assertEqual(call_args, [(1, 2)])
+
+    def test_attribute_error(self):
+        class C:
+            def method(self):
+                return super().msg
+
+        with self.assertRaisesRegex(AttributeError, "'super' object has no attribute 'msg'"):
+            C().method()
+
+    def test_bad_first_arg(self):
+        class C:
+            def method(self):
+                return super(1, self).method()
+
+        with self.assertRaisesRegex(TypeError, "argument 1 must be a type"):
+            C().method()
+
+    def test_super___class__(self):
+        class C:
+            def method(self):
+                return super().__class__
+
+        self.assertEqual(C().method(), super)
+
+    def test_super_subclass___class__(self):
+        class mysuper(super):
+            pass
+
+        class C:
+            def method(self):
+                return mysuper(C, self).__class__
+
+        self.assertEqual(C().method(), mysuper)
+
+    def test_super_attr_and_method_loops(self):
+        # Run enough iterations for the lookups to be specialized
+        class B(A):
+            x = 'B.x'
+            @property
+            def p(self):
+                return 'B.p'
+            def f(self):
+                return 'B' + super().f()
+
+        class C(B):
+            def attrs(self):
+                return super().x, super().p, super(B, self).f()
+            def f(self):
+                return 'C' + super().f()
+
+        c = C()
+        for _ in range(100):
+            self.assertEqual(c.f(), 'CBA')
+            self.assertEqual(c.attrs(), ('B.x', 'B.p', 'A'))
+
+    def test_super_getattribute_overridden(self):
+        class B:
+            def f(self):
+                return 'B'
+
+        class C(B):
+            def __getattribute__(self, name):
+                return object.__getattribute__(self, name)
+            def f(self):
+                return super().f()
+
+        c = C()
+        for _ in range(100):
+            self.assertEqual(c.f(), 'B')
+
+    def test_super_classmethod_loop(self):
+        class C(A):
+            @classmethod
+            def cm(cls):
+                return super().cm()
+
+        class D(C):
+            pass
+
+        for _ in range(100):
+            self.assertEqual(C.cm(), (C, 'A'))
+            self.assertEqual(D.cm(), (D, 'A'))
+
 
 if __name__ == "__main__":
     unittest.main()
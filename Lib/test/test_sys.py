@@ -1,5 +1,6 @@
 import builtins
 import codecs
+import dis
 import gc
 import locale
 import operator
@@ -383,14 +384,30 @@ def test_refcount(self):
         # the reference count to increase by 2 instead of 1.
         global n
         self.assertRaises(TypeError, sys.getrefcount)
-        c = sys.getrefcount(None)
-        n = None
-        self.assertEqual(sys.getrefcount(None), c+1)
+        # None is immortal, use an ordinary object.
+        obj = object()
+        c = sys.getrefcount(obj)
+        n = obj
+        self.assertEqual(sys.getrefcount(obj), c+1)
         del n
-        self.assertEqual(sys.getrefcount(None), c)
+        self.assertEqual(sys.getrefcount(obj), c)
         if hasattr(sys, "gettotalrefcount"):
             self.assertIsInstance(sys.gettotalrefcount(), int)
 
+    @test.support.refcount_test
+    def test_immortal_refcount(self):
+        # Singletons, small ints, interned strings and static types are
+        # immortal: references to them don't change their reference count.
+        s = sys.intern(''.join(['immortal', '_string']))
+        for obj in (None, True, False, Ellipsis, NotImplemented, 0, 256,
+                    (), '', 'a', s, int):
+            with self.subTest(obj=obj):
+                c = sys.getrefcount(obj)
+                refs = [obj] * 10
+                self.assertEqual(sys.getrefcount(obj), c)
+                del refs
+                self.assertEqual(sys.getrefcount(obj), c)
+
     def test_getframe(self):
         self.assertRaises(TypeError, sys._getframe, 42, 42)
         self.assertRaises(ValueError, sys._getframe, 2000000000)
@@ -1533,7 +1550,7 @@ def delx(self): del self.__x
                   '10P'                 # PySequenceMethods
                   '2P'                  # PyBufferProcs
                   '6P'
-                  '1P'                  # Specializer cache
+                  '2P'                  # Specializer cache
                   )
         class newstyleclass(object): pass
         # Separate block for PyDictKeysObject with 8 keys and 5 entries
@@ -1678,5 +1695,138 @@ def write(self, s):
         self.assertEqual(out, b"")
         self.assertEqual(err, b"")
 
+@test.support.cpython_only
+class SpecializationProfileTest(unittest.TestCase):
+    code = textwrap.dedent("""
+        import dis, sys
+        def f(a, b):
+            return a + b
+        for _ in range(int(sys.argv[1])):
+            f(1, 2)
+        print(*[i.opname for i in dis.get_instructions(f, adaptive=True)
+                if i.opname.startswith("BINARY_OP")])
+    """)
+
+    def setUp(self):
+        self.profile = os_helper.TESTFN
+        self.addCleanup(os_helper.unlink, self.profile)
+
+    def run_code(self, calls, code=None, **env_vars):
+        rc, out, err = assert_python_ok('-c', code or self.code, str(calls),
+                                        **env_vars)
+        self.assertEqual(err, b'')
+        return out.decode().split()
+
+    def test_environment_variable(self):
+        env = {'PYTHONSPECIALIZATIONPROFILE': self.profile}
+        self.assertEqual(self.run_code(1), ['BINARY_OP'])
+        self.assertEqual(self.run_code(1, **env), ['BINARY_OP'])
+        self.assertEqual(self.run_code(5, **env), ['BINARY_OP_ADD_INT'])
+        self.assertTrue(os.path.exists(self.profile))
+        self.assertEqual(self.run_code(1, **env), ['BINARY_OP_ADD_INT'])
+        self.assertEqual(self.run_code(1), ['BINARY_OP'])
+
+    def test_load_and_dump(self):
+        env = {'PYTHONSPECIALIZATIONPROFILE': self.profile}
+        self.run_code(5, **env)
+        code = textwrap.dedent(f"""
+            import sys
+            sys._load_specialization_profile({self.profile!r})
+            exec({self.code!r})
+            sys._dump_specialization_profile({self.profile!r})
+            sys._load_specialization_profile({self.profile!r})
+        """)
+        self.assertEqual(self.run_code(1, code), ['BINARY_OP_ADD_INT'])
+
+    def test_errors(self):
+        code = textwrap.dedent(f"""
+            import sys
+            try:
+                sys._dump_specialization_profile({self.profile!r})
+            except RuntimeError:
+                print('RuntimeError')
+            try:
+                sys._load_specialization_profile({self.profile!r})
+            except FileNotFoundError:
+                print('FileNotFoundError')
+            with open({self.profile!r}, 'wb') as f:
+                f.write(b'xyz')
+            try:
+                sys._load_specialization_profile({self.profile!r})
+            except (EOFError, ValueError):
+                print('ValueError')
+        """)
+        self.assertEqual(self.run_code(0, code),
+                         ['RuntimeError', 'FileNotFoundError', 'ValueError'])
+        self.assertRaises(TypeError, sys._load_specialization_profile, None)
+
+
+class SpecializationTelemetryTest(unittest.TestCase):
+
+    def setUp(self):
+        sys._specialization_telemetry_clear()
+        sys._specialization_telemetry_on()
+        self.addCleanup(sys._specialization_telemetry_clear)
+        self.addCleanup(sys._specialization_telemetry_off)
+
+    def polymorphic_add(self):
+        def f(a, b):
+            return a + b
+        for args in [(1, 2), ('a', 'b'), ([], [])]:
+            for _ in range(100):
+                f(*args)
+        [add] = [i.offset for i in dis.get_instructions(f)
+                 if i.opname == 'BINARY_OP']
+        return f.__code__, add
+
+    def test_counts(self):
+        code, add = self.polymorphic_add()
+        counts = sys._get_specialization_telemetry(code)
+        self.assertEqual(list(counts), [add])
+        # Specialized for ints, then deoptimized and specialized for strs,
+        # then deoptimized and failed to specialize for lists.
+        self.assertEqual(counts[add]['success'], 2)
+        self.assertGreaterEqual(counts[add]['failure'], 1)
+        self.assertGreaterEqual(counts[add]['miss'], 100)
+        self.assertEqual(counts[add]['deopt'], 2)
+        self.assertEqual(len(counts[add]['failure_kinds']), 1)
+
+    def test_off_and_clear(self):
+        sys._specialization_telemetry_off()
+        code, add = self.polymorphic_add()
+        self.assertEqual(sys._get_specialization_telemetry(code), {})
+        sys._specialization_telemetry_on()
+        code, add = self.polymorphic_add()
+        self.assertNotEqual(sys._get_specialization_telemetry(code), {})
+        sys._specialization_telemetry_clear()
+        self.assertEqual(sys._get_specialization_telemetry(code), {})
+
+    def test_dump(self):
+        code, add = self.polymorphic_add()
+        with os_helper.temp_dir() as dirname:
+            path = sys._specialization_telemetry_dump(dirname)
+            self.assertEqual(os.path.dirname(path), dirname)
+            with open(path) as f:
+                lines = f.read().splitlines()
+        self.assertEqual(sys._get_specialization_telemetry(code), {})
+        binary_op = dis.opmap['BINARY_OP']
+        self.assertIn(f'opcode[{binary_op}].specializable : 1', lines)
+        self.assertIn(f'    opcode[{binary_op}].specialization.deopt : 2',
+                      lines)
+        prefix = (f'code[{code.co_qualname} ({code.co_filename}:'
+                  f'{code.co_firstlineno})].offset[{add}].opcode[{binary_op}]'
+                  f'.specialization.')
+        self.assertIn(prefix + 'success : 2', lines)
+        self.assertIn(prefix + 'deopt : 2', lines)
+
+    def test_errors(self):
+        self.assertRaises(TypeError, sys._specialization_telemetry_dump, b'.')
+        with os_helper.temp_dir() as dirname:
+            self.assertRaises(FileNotFoundError,
+                              sys._specialization_telemetry_dump,
+                              os.path.join(dirname, 'missing'))
+        self.assertRaises(TypeError, sys._get_specialization_telemetry, None)
+
+
 if __name__ == "__main__":
     unittest.main()
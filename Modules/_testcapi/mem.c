@@ -554,7 +554,7 @@ check_pyobject_uninitialized_is_freed(PyObject *self,
         return NULL;
     }
     /* Initialize reference count to avoid early crash in ceval or GC */
-    Py_SET_REFCNT(op, 1);
+    op->ob_refcnt = 1;
     /* object fields like ob_type are uninitialized! */
     return test_pyobject_is_freed("check_pyobject_uninitialized_is_freed", op);
 }
@@ -570,7 +570,7 @@ check_pyobject_forbidden_bytes_is_freed(PyObject *self,
         return NULL;
     }
     /* Initialize reference count to avoid early crash in ceval or GC */
-    Py_SET_REFCNT(op, 1);
+    op->ob_refcnt = 1;
     /* ob_type field is after the memory block: part of "forbidden bytes"
        when using debug hooks on memory allocators! */
     return test_pyobject_is_freed("check_pyobject_forbidden_bytes_is_freed", op);
@@ -590,7 +590,7 @@ check_pyobject_freed_is_freed(PyObject *self, PyObject *Py_UNUSED(args))
     }
     Py_TYPE(op)->tp_dealloc(op);
     /* Reset reference count to avoid early crash in ceval or GC */
-    Py_SET_REFCNT(op, 1);
+    op->ob_refcnt = 1;
     /* object memory is freed! */
     return test_pyobject_is_freed("check_pyobject_freed_is_freed", op);
 #endif
@@ -24,6 +24,7 @@
 #include "pycore_interp.h"       // _PyInterpreterState_GetConfigCopy()
 #include "pycore_pyerrors.h"     // _Py_UTF8_Edit_Cost()
 #include "pycore_pystate.h"      // _PyThreadState_GET()
+#include "pycore_uops.h"         // _PyOptimizer_GetExecutors()
 #include "osdefs.h"              // MAXPATHLEN
 
 #include "clinic/_testinternalcapi.c.h"
@@ -613,6 +614,17 @@ get_interp_settings(PyObject *self, PyObject *args)
 }
 
 
+static PyObject *
+get_executors(PyObject *self, PyObject *code)
+{
+    if (!PyCode_Check(code)) {
+        PyErr_SetString(PyExc_TypeError, "argument must be a code object");
+        return NULL;
+    }
+    return _PyOptimizer_GetExecutors((PyCodeObject *)code);
+}
+
+
 static PyMethodDef TestMethods[] = {
     {"get_configs", get_configs, METH_NOARGS},
     {"get_recursion_depth", get_recursion_depth, METH_NOARGS},
@@ -634,6 +646,7 @@ static PyMethodDef TestMethods[] = {
     _TESTINTERNALCAPI_COMPILER_CODEGEN_METHODDEF
     _TESTINTERNALCAPI_OPTIMIZE_CFG_METHODDEF
     {"get_interp_settings", get_interp_settings, METH_VARARGS, NULL},
+    {"get_executors", get_executors, METH_O, NULL},
     {NULL, NULL} /* sentinel */
 };
 
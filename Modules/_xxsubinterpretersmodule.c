@@ -14,6 +14,14 @@
 
 #define MODULE_NAME "_xxsubinterpreters"
 
+/* The channels and the data passed between interpreters are used by
+   interpreters that may not share a GIL, nor an object allocator, so
+   they are allocated with the raw allocator. */
+#define GLOBAL_NEW(TYPE, n) \
+    ((TYPE *)PyMem_RawCalloc((n), sizeof(TYPE)))
+#define GLOBAL_MALLOC(n) PyMem_RawMalloc(n)
+#define GLOBAL_FREE(p) PyMem_RawFree(p)
+
 
 static char *
 _copy_raw_string(PyObject *strobj)
@@ -22,7 +30,7 @@ _copy_raw_string(PyObject *strobj)
     if (str == NULL) {
         return NULL;
     }
-    char *copied = PyMem_Malloc(strlen(str)+1);
+    char *copied = GLOBAL_MALLOC(strlen(str)+1);
     if (copied == NULL) {
         PyErr_NoMemory();
         return NULL;
@@ -154,6 +162,7 @@ _release_xid_data(_PyCrossInterpreterData *data, int ignoreexc)
 
 typedef struct {
     PyTypeObject *ChannelIDType;
+    PyTypeObject *SharedBufferType;
 
     /* interpreter exceptions */
     PyObject *RunFailedError;
@@ -180,6 +189,7 @@ traverse_module_state(module_state *state, visitproc visit, void *arg)
 {
     /* heap types */
     Py_VISIT(state->ChannelIDType);
+    Py_VISIT(state->SharedBufferType);
 
     /* interpreter exceptions */
     Py_VISIT(state->RunFailedError);
@@ -199,6 +209,8 @@ clear_module_state(module_state *state)
     /* heap types */
     (void)_PyCrossInterpreterData_UnregisterClass(state->ChannelIDType);
     Py_CLEAR(state->ChannelIDType);
+    (void)_PyCrossInterpreterData_UnregisterClass(state->SharedBufferType);
+    Py_CLEAR(state->SharedBufferType);
 
     /* interpreter exceptions */
     Py_CLEAR(state->RunFailedError);
@@ -240,7 +252,7 @@ static void
 _sharednsitem_clear(struct _sharednsitem *item)
 {
     if (item->name != NULL) {
-        PyMem_Free(item->name);
+        GLOBAL_FREE(item->name);
         item->name = NULL;
     }
     (void)_release_xid_data(&item->data, 1);
@@ -272,16 +284,16 @@ typedef struct _sharedns {
 static _sharedns *
 _sharedns_new(Py_ssize_t len)
 {
-    _sharedns *shared = PyMem_NEW(_sharedns, 1);
+    _sharedns *shared = GLOBAL_NEW(_sharedns, 1);
     if (shared == NULL) {
         PyErr_NoMemory();
         return NULL;
     }
     shared->len = len;
-    shared->items = PyMem_NEW(struct _sharednsitem, len);
+    shared->items = GLOBAL_NEW(struct _sharednsitem, len);
     if (shared->items == NULL) {
         PyErr_NoMemory();
-        PyMem_Free(shared);
+        GLOBAL_FREE(shared);
         return NULL;
     }
     return shared;
@@ -293,8 +305,8 @@ _sharedns_free(_sharedns *shared)
     for (Py_ssize_t i=0; i < shared->len; i++) {
         _sharednsitem_clear(&shared->items[i]);
     }
-    PyMem_Free(shared->items);
-    PyMem_Free(shared);
+    GLOBAL_FREE(shared->items);
+    GLOBAL_FREE(shared);
 }
 
 static _sharedns *
@@ -358,7 +370,7 @@ typedef struct _sharedexception {
 static _sharedexception *
 _sharedexception_new(void)
 {
-    _sharedexception *err = PyMem_NEW(_sharedexception, 1);
+    _sharedexception *err = GLOBAL_NEW(_sharedexception, 1);
     if (err == NULL) {
         PyErr_NoMemory();
         return NULL;
@@ -372,10 +384,10 @@ static void
 _sharedexception_clear(_sharedexception *exc)
 {
     if (exc->name != NULL) {
-        PyMem_Free(exc->name);
+        GLOBAL_FREE(exc->name);
     }
     if (exc->msg != NULL) {
-        PyMem_Free(exc->msg);
+        GLOBAL_FREE(exc->msg);
     }
 }
 
@@ -383,7 +395,7 @@ static void
 _sharedexception_free(_sharedexception *exc)
 {
     _sharedexception_clear(exc);
-    PyMem_Free(exc);
+    GLOBAL_FREE(exc);
 }
 
 static _sharedexception *
@@ -435,7 +447,7 @@ _sharedexception_bind(PyObject *exctype, PyObject *exc, PyObject *tb)
     if (failure != NULL) {
         PyErr_Clear();
         if (err->name != NULL) {
-            PyMem_Free(err->name);
+            GLOBAL_FREE(err->name);
             err->name = NULL;
         }
         err->msg = failure;
@@ -574,7 +586,7 @@ typedef struct _channelitem {
 static _channelitem *
 _channelitem_new(void)
 {
-    _channelitem *item = PyMem_NEW(_channelitem, 1);
+    _channelitem *item = GLOBAL_NEW(_channelitem, 1);
     if (item == NULL) {
         PyErr_NoMemory();
         return NULL;
@@ -589,7 +601,7 @@ _channelitem_clear(_channelitem *item)
 {
     if (item->data != NULL) {
         (void)_release_xid_data(item->data, 1);
-        PyMem_Free(item->data);
+        GLOBAL_FREE(item->data);
         item->data = NULL;
     }
     item->next = NULL;
@@ -599,7 +611,7 @@ static void
 _channelitem_free(_channelitem *item)
 {
     _channelitem_clear(item);
-    PyMem_Free(item);
+    GLOBAL_FREE(item);
 }
 
 static void
@@ -630,7 +642,7 @@ typedef struct _channelqueue {
 static _channelqueue *
 _channelqueue_new(void)
 {
-    _channelqueue *queue = PyMem_NEW(_channelqueue, 1);
+    _channelqueue *queue = GLOBAL_NEW(_channelqueue, 1);
     if (queue == NULL) {
         PyErr_NoMemory();
         return NULL;
@@ -654,7 +666,7 @@ static void
 _channelqueue_free(_channelqueue *queue)
 {
     _channelqueue_clear(queue);
-    PyMem_Free(queue);
+    GLOBAL_FREE(queue);
 }
 
 static int
@@ -693,6 +705,32 @@ _channelqueue_get(_channelqueue *queue)
     return _channelitem_popped(item);
 }
 
+static void
+_channelqueue_drop_interpreter(_channelqueue *queue, int64_t interp)
+{
+    _channelitem *prev = NULL;
+    _channelitem *next = queue->first;
+    while (next != NULL) {
+        _channelitem *item = next;
+        next = item->next;
+        if (item->data->interp != interp) {
+            prev = item;
+            continue;
+        }
+        if (prev == NULL) {
+            queue->first = next;
+        }
+        else {
+            prev->next = next;
+        }
+        if (queue->last == item) {
+            queue->last = prev;
+        }
+        queue->count -= 1;
+        _channelitem_free(item);
+    }
+}
+
 /* channel-interpreter associations */
 
 struct _channelend;
@@ -706,7 +744,7 @@ typedef struct _channelend {
 static _channelend *
 _channelend_new(int64_t interp)
 {
-    _channelend *end = PyMem_NEW(_channelend, 1);
+    _channelend *end = GLOBAL_NEW(_channelend, 1);
     if (end == NULL) {
         PyErr_NoMemory();
         return NULL;
@@ -720,7 +758,7 @@ _channelend_new(int64_t interp)
 static void
 _channelend_free(_channelend *end)
 {
-    PyMem_Free(end);
+    GLOBAL_FREE(end);
 }
 
 static void
@@ -765,7 +803,7 @@ typedef struct _channelassociations {
 static _channelends *
 _channelends_new(void)
 {
-    _channelends *ends = PyMem_NEW(_channelends, 1);
+    _channelends *ends = GLOBAL_NEW(_channelends, 1);
     if (ends== NULL) {
         return NULL;
     }
@@ -792,7 +830,7 @@ static void
 _channelends_free(_channelends *ends)
 {
     _channelends_clear(ends);
-    PyMem_Free(ends);
+    GLOBAL_FREE(ends);
 }
 
 static _channelend *
@@ -933,20 +971,20 @@ typedef struct _channel {
 static _PyChannelState *
 _channel_new(PyThread_type_lock mutex)
 {
-    _PyChannelState *chan = PyMem_NEW(_PyChannelState, 1);
+    _PyChannelState *chan = GLOBAL_NEW(_PyChannelState, 1);
     if (chan == NULL) {
         return NULL;
     }
     chan->mutex = mutex;
     chan->queue = _channelqueue_new();
     if (chan->queue == NULL) {
-        PyMem_Free(chan);
+        GLOBAL_FREE(chan);
         return NULL;
     }
     chan->ends = _channelends_new();
     if (chan->ends == NULL) {
         _channelqueue_free(chan->queue);
-        PyMem_Free(chan);
+        GLOBAL_FREE(chan);
         return NULL;
     }
     chan->open = 1;
@@ -964,7 +1002,7 @@ _channel_free(_PyChannelState *chan)
     PyThread_release_lock(chan->mutex);
 
     PyThread_free_lock(chan->mutex);
-    PyMem_Free(chan);
+    GLOBAL_FREE(chan);
 }
 
 static int
@@ -1087,7 +1125,7 @@ typedef struct _channelref {
 static _channelref *
 _channelref_new(int64_t id, _PyChannelState *chan)
 {
-    _channelref *ref = PyMem_NEW(_channelref, 1);
+    _channelref *ref = GLOBAL_NEW(_channelref, 1);
     if (ref == NULL) {
         return NULL;
     }
@@ -1114,7 +1152,7 @@ _channelref_free(_channelref *ref)
         _channel_clear_closing(ref->chan);
     }
     //_channelref_clear(ref);
-    PyMem_Free(ref);
+    GLOBAL_FREE(ref);
 }
 
 static _channelref *
@@ -1135,11 +1173,24 @@ _channelref_find(_channelref *first, int64_t id, _channelref **pprev)
     return ref;
 }
 
+/* A thread blocked in channel_recv() waits on its own lock, which is
+   released when something happens to the channel (see
+   _channels_notify_waiters()).  The waiters live on the stack of the
+   blocked threads and are tracked independently of the channels, which
+   may be destroyed while they wait. */
+typedef struct _channelwaiter {
+    int64_t cid;
+    PyThread_type_lock lock;
+    int notified;
+    struct _channelwaiter *next;
+} _channelwaiter;
+
 typedef struct _channels {
     PyThread_type_lock mutex;
     _channelref *head;
     int64_t numopen;
     int64_t next_id;
+    _channelwaiter *waiters;
 } _channels;
 
 static void
@@ -1149,6 +1200,7 @@ _channels_init(_channels *channels, PyThread_type_lock mutex)
     channels->head = NULL;
     channels->numopen = 0;
     channels->next_id = 0;
+    channels->waiters = NULL;
 }
 
 static void
@@ -1156,6 +1208,7 @@ _channels_fini(_channels *channels)
 {
     assert(channels->numopen == 0);
     assert(channels->head == NULL);
+    assert(channels->waiters == NULL);
     if (channels->mutex != NULL) {
         PyThread_free_lock(channels->mutex);
         channels->mutex = NULL;
@@ -1401,7 +1454,7 @@ _channels_list_all(_channels *channels, int64_t *count)
 {
     int64_t *cids = NULL;
     PyThread_acquire_lock(channels->mutex, WAIT_LOCK);
-    int64_t *ids = PyMem_NEW(int64_t, (Py_ssize_t)(channels->numopen));
+    int64_t *ids = GLOBAL_NEW(int64_t, (Py_ssize_t)(channels->numopen));
     if (ids == NULL) {
         goto done;
     }
@@ -1417,6 +1470,90 @@ _channels_list_all(_channels *channels, int64_t *count)
     return cids;
 }
 
+/* Release the data sent by the interpreter, which must be the current one
+   (e.g. just before it is destroyed).  Its objects can't outlive it, as
+   interpreters that don't share a GIL don't share an allocator either. */
+static void
+_channels_drop_interpreter(_channels *channels, int64_t interp)
+{
+    PyThread_acquire_lock(channels->mutex, WAIT_LOCK);
+    for (_channelref *ref = channels->head; ref != NULL; ref = ref->next) {
+        _PyChannelState *chan = ref->chan;
+        if (chan == NULL) {
+            continue;
+        }
+        PyThread_acquire_lock(chan->mutex, WAIT_LOCK);
+        _channelqueue_drop_interpreter(chan->queue, interp);
+        PyThread_release_lock(chan->mutex);
+    }
+    PyThread_release_lock(channels->mutex);
+}
+
+static void
+_channels_add_waiter(_channels *channels, _channelwaiter *waiter)
+{
+    PyThread_acquire_lock(channels->mutex, WAIT_LOCK);
+    assert(!waiter->notified);
+    waiter->next = channels->waiters;
+    channels->waiters = waiter;
+    PyThread_release_lock(channels->mutex);
+}
+
+/* The waiter's lock is held by its thread while it is registered.  If
+   the waiter was notified then the lock was released, so we take it
+   back here, unless the waiting thread already did ("acquired"). */
+static void
+_channels_remove_waiter(_channels *channels, _channelwaiter *waiter,
+                        int acquired)
+{
+    PyThread_acquire_lock(channels->mutex, WAIT_LOCK);
+    if (waiter->notified) {
+        // It was already unlinked by _channels_notify_waiters().
+        if (!acquired) {
+            int res = PyThread_acquire_lock(waiter->lock, NOWAIT_LOCK);
+            assert(res);
+            (void)res;
+        }
+        waiter->notified = 0;
+    }
+    else {
+        assert(!acquired);
+        _channelwaiter **pnext = &channels->waiters;
+        while (*pnext != waiter) {
+            assert(*pnext != NULL);
+            pnext = &(*pnext)->next;
+        }
+        *pnext = waiter->next;
+    }
+    waiter->next = NULL;
+    PyThread_release_lock(channels->mutex);
+}
+
+static void
+_channels_notify_waiters(_channels *channels, int64_t cid)  // needs lock
+{
+    _channelwaiter **pnext = &channels->waiters;
+    while (*pnext != NULL) {
+        _channelwaiter *waiter = *pnext;
+        if (waiter->cid != cid) {
+            pnext = &waiter->next;
+            continue;
+        }
+        *pnext = waiter->next;
+        waiter->next = NULL;
+        waiter->notified = 1;
+        PyThread_release_lock(waiter->lock);
+    }
+}
+
+static void
+_channels_wake(_channels *channels, int64_t cid)
+{
+    PyThread_acquire_lock(channels->mutex, WAIT_LOCK);
+    _channels_notify_waiters(channels, cid);
+    PyThread_release_lock(channels->mutex);
+}
+
 /* support for closing non-empty channels */
 
 struct _channel_closing {
@@ -1436,7 +1573,7 @@ _channel_set_closing(struct _channelref *ref, PyThread_type_lock mutex) {
         res = ERR_CHANNEL_CLOSED;
         goto done;
     }
-    chan->closing = PyMem_NEW(struct _channel_closing, 1);
+    chan->closing = GLOBAL_NEW(struct _channel_closing, 1);
     if (chan->closing == NULL) {
         goto done;
     }
@@ -1452,7 +1589,7 @@ static void
 _channel_clear_closing(struct _channel *chan) {
     PyThread_acquire_lock(chan->mutex, WAIT_LOCK);
     if (chan->closing != NULL) {
-        PyMem_Free(chan->closing);
+        GLOBAL_FREE(chan->closing);
         chan->closing = NULL;
     }
     PyThread_release_lock(chan->mutex);
@@ -1503,6 +1640,7 @@ _channel_destroy(_channels *channels, int64_t id)
     if (chan != NULL) {
         _channel_free(chan);
     }
+    _channels_wake(channels, id);
     return 0;
 }
 
@@ -1530,24 +1668,27 @@ _channel_send(_channels *channels, int64_t id, PyObject *obj)
     }
 
     // Convert the object to cross-interpreter data.
-    _PyCrossInterpreterData *data = PyMem_NEW(_PyCrossInterpreterData, 1);
+    _PyCrossInterpreterData *data = GLOBAL_NEW(_PyCrossInterpreterData, 1);
     if (data == NULL) {
         PyThread_release_lock(mutex);
         return -1;
     }
     if (_PyObject_GetCrossInterpreterData(obj, data) != 0) {
         PyThread_release_lock(mutex);
-        PyMem_Free(data);
+        GLOBAL_FREE(data);
         return -1;
     }
 
     // Add the data to the channel.
     int res = _channel_add(chan, PyInterpreterState_GetID(interp), data);
+    if (res == 0) {
+        _channels_notify_waiters(channels, id);
+    }
     PyThread_release_lock(mutex);
     if (res != 0) {
         // We may chain an exception here:
         (void)_release_xid_data(data, 0);
-        PyMem_Free(data);
+        GLOBAL_FREE(data);
         return res;
     }
 
@@ -1596,11 +1737,11 @@ _channel_recv(_channels *channels, int64_t id, PyObject **res)
     if (obj == NULL) {
         assert(PyErr_Occurred());
         (void)_release_xid_data(data, 1);
-        PyMem_Free(data);
+        GLOBAL_FREE(data);
         return -1;
     }
     int release_res = _release_xid_data(data, 0);
-    PyMem_Free(data);
+    GLOBAL_FREE(data);
     if (release_res < 0) {
         // The source interpreter has been destroyed already.
         assert(PyErr_Occurred());
@@ -1612,6 +1753,75 @@ _channel_recv(_channels *channels, int64_t id, PyObject **res)
     return 0;
 }
 
+/* Like _channel_recv() but wait for an item to be sent if the channel
+   is empty.  A negative timeout means wait forever.  If the timeout
+   expires then *res is left NULL, as for an empty channel. */
+static int
+_channel_recv_wait(_channels *channels, int64_t id, _PyTime_t timeout,
+                   PyObject **res)
+{
+    *res = NULL;
+    _PyTime_t deadline = 0;
+    if (timeout > 0) {
+        deadline = _PyDeadline_Init(timeout);
+    }
+
+    _channelwaiter waiter = {
+        .cid = id,
+        .lock = PyThread_allocate_lock(),
+    };
+    if (waiter.lock == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    // The lock is held by us except while notified.
+    PyThread_acquire_lock(waiter.lock, WAIT_LOCK);
+
+    int err;
+    while (1) {
+        // Register first so that we do not miss a send that happens
+        // right after we found the channel empty.
+        _channels_add_waiter(channels, &waiter);
+        err = _channel_recv(channels, id, res);
+        if (err != 0 || *res != NULL) {
+            _channels_remove_waiter(channels, &waiter, 0);
+            break;
+        }
+
+        PY_TIMEOUT_T microseconds = -1;
+        if (timeout >= 0) {
+            _PyTime_t remaining = timeout > 0 ? _PyDeadline_Get(deadline) : 0;
+            if (remaining <= 0) {
+                _channels_remove_waiter(channels, &waiter, 0);
+                break;
+            }
+            microseconds = _PyTime_AsMicroseconds(remaining,
+                                                  _PyTime_ROUND_TIMEOUT);
+            if (microseconds > PY_TIMEOUT_MAX) {
+                microseconds = PY_TIMEOUT_MAX;
+            }
+        }
+
+        PyLockStatus r;
+        Py_BEGIN_ALLOW_THREADS
+        r = PyThread_acquire_lock_timed(waiter.lock, microseconds, 1);
+        Py_END_ALLOW_THREADS
+        _channels_remove_waiter(channels, &waiter, r == PY_LOCK_ACQUIRED);
+
+        if (r == PY_LOCK_INTR) {
+            // Run signal handlers if we were interrupted.
+            if (Py_MakePendingCalls() < 0) {
+                err = -1;
+                break;
+            }
+        }
+    }
+
+    PyThread_release_lock(waiter.lock);
+    PyThread_free_lock(waiter.lock);
+    return err;
+}
+
 static int
 _channel_drop(_channels *channels, int64_t id, int send, int recv)
 {
@@ -1631,6 +1841,9 @@ _channel_drop(_channels *channels, int64_t id, int send, int recv)
 
     // Close one or both of the two ends.
     int res = _channel_close_interpreter(chan, PyInterpreterState_GetID(interp), send-recv);
+    if (res == 0) {
+        _channels_notify_waiters(channels, id);
+    }
     PyThread_release_lock(mutex);
     return res;
 }
@@ -1638,7 +1851,11 @@ _channel_drop(_channels *channels, int64_t id, int send, int recv)
 static int
 _channel_close(_channels *channels, int64_t id, int end, int force)
 {
-    return _channels_close(channels, id, NULL, end, force);
+    int res = _channels_close(channels, id, NULL, end, force);
+    if (res == 0) {
+        _channels_wake(channels, id);
+    }
+    return res;
 }
 
 static int
@@ -2085,6 +2302,192 @@ static PyType_Spec ChannelIDType_spec = {
 };
 
 
+/* SharedBuffer class */
+
+/* The memory of a shared buffer is allocated with the raw allocator and
+   is refcounted independently of any interpreter.  Each interpreter
+   that receives the buffer wraps the same memory in its own object, so
+   no copy is made. */
+typedef struct _sharedbuffer {
+    PyThread_type_lock mutex;
+    Py_ssize_t refcount;
+    Py_ssize_t len;
+    char data[1];
+} _sharedbuffer;
+
+static _sharedbuffer *
+_sharedbuffer_new(Py_ssize_t len)
+{
+    if (len > PY_SSIZE_T_MAX - (Py_ssize_t)sizeof(_sharedbuffer)) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+    _sharedbuffer *shared = PyMem_RawCalloc(1, sizeof(_sharedbuffer) + len);
+    if (shared == NULL) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+    shared->mutex = PyThread_allocate_lock();
+    if (shared->mutex == NULL) {
+        GLOBAL_FREE(shared);
+        PyErr_NoMemory();
+        return NULL;
+    }
+    shared->refcount = 1;
+    shared->len = len;
+    return shared;
+}
+
+static void
+_sharedbuffer_incref(_sharedbuffer *shared)
+{
+    PyThread_acquire_lock(shared->mutex, WAIT_LOCK);
+    assert(shared->refcount > 0);
+    shared->refcount += 1;
+    PyThread_release_lock(shared->mutex);
+}
+
+static void
+_sharedbuffer_decref(void *ptr)
+{
+    _sharedbuffer *shared = (_sharedbuffer *)ptr;
+    PyThread_acquire_lock(shared->mutex, WAIT_LOCK);
+    assert(shared->refcount > 0);
+    Py_ssize_t refcount = --shared->refcount;
+    PyThread_release_lock(shared->mutex);
+    if (refcount == 0) {
+        PyThread_free_lock(shared->mutex);
+        GLOBAL_FREE(shared);
+    }
+}
+
+typedef struct sharedbufferobject {
+    PyObject_HEAD
+    _sharedbuffer *shared;
+} sharedbufferobject;
+
+static PyObject *
+newsharedbuffer(PyTypeObject *cls, _sharedbuffer *shared)
+{
+    sharedbufferobject *self = PyObject_New(sharedbufferobject, cls);
+    if (self == NULL) {
+        return NULL;
+    }
+    _sharedbuffer_incref(shared);
+    self->shared = shared;
+    return (PyObject *)self;
+}
+
+static PyObject *
+sharedbuffer_new(PyTypeObject *cls, PyObject *args, PyObject *kwds)
+{
+    static char *kwlist[] = {"size", NULL};
+    Py_ssize_t size;
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "n:SharedBuffer", kwlist,
+                                     &size)) {
+        return NULL;
+    }
+    if (size < 0) {
+        PyErr_SetString(PyExc_ValueError, "size must be non-negative");
+        return NULL;
+    }
+
+    _sharedbuffer *shared = _sharedbuffer_new(size);
+    if (shared == NULL) {
+        return NULL;
+    }
+    PyObject *self = newsharedbuffer(cls, shared);
+    _sharedbuffer_decref(shared);
+    return self;
+}
+
+static void
+sharedbuffer_dealloc(PyObject *self)
+{
+    _sharedbuffer *shared = ((sharedbufferobject *)self)->shared;
+
+    PyTypeObject *tp = Py_TYPE(self);
+    tp->tp_free(self);
+    Py_DECREF(tp);
+
+    _sharedbuffer_decref(shared);
+}
+
+static PyObject *
+sharedbuffer_repr(PyObject *self)
+{
+    _sharedbuffer *shared = ((sharedbufferobject *)self)->shared;
+    return PyUnicode_FromFormat("%s(%zd)",
+                                _PyType_Name(Py_TYPE(self)), shared->len);
+}
+
+static Py_ssize_t
+sharedbuffer_length(PyObject *self)
+{
+    return ((sharedbufferobject *)self)->shared->len;
+}
+
+static int
+sharedbuffer_getbuffer(PyObject *self, Py_buffer *view, int flags)
+{
+    _sharedbuffer *shared = ((sharedbufferobject *)self)->shared;
+    return PyBuffer_FillInfo(view, self, shared->data, shared->len, 0, flags);
+}
+
+static PyObject *
+_sharedbuffer_from_xid(_PyCrossInterpreterData *data)
+{
+    PyObject *mod = _get_current_module();
+    if (mod == NULL) {
+        return NULL;
+    }
+    module_state *state = get_module_state(mod);
+    PyObject *self = newsharedbuffer(state->SharedBufferType,
+                                     (_sharedbuffer *)data->data);
+    Py_DECREF(mod);
+    return self;
+}
+
+static int
+_sharedbuffer_shared(PyThreadState *tstate, PyObject *obj,
+                     _PyCrossInterpreterData *data)
+{
+    // The data holds its own reference to the memory rather than to
+    // the object, so it does not depend on the sending interpreter.
+    _sharedbuffer *shared = ((sharedbufferobject *)obj)->shared;
+    _sharedbuffer_incref(shared);
+    _PyCrossInterpreterData_Init(data, tstate->interp, shared, NULL,
+                                 _sharedbuffer_from_xid);
+    data->free = _sharedbuffer_decref;
+    return 0;
+}
+
+PyDoc_STRVAR(sharedbuffer_doc,
+"SharedBuffer(size)\n\
+\n\
+A zero-initialized, writable block of memory that may be sent through\n\
+a channel without being copied.  Every interpreter that receives it\n\
+sees the same memory, e.g. through memoryview(buf).  The memory is\n\
+freed once no interpreter holds a reference to it.");
+
+static PyType_Slot SharedBufferType_slots[] = {
+    {Py_tp_new, sharedbuffer_new},
+    {Py_tp_dealloc, (destructor)sharedbuffer_dealloc},
+    {Py_tp_doc, (void *)sharedbuffer_doc},
+    {Py_tp_repr, (reprfunc)sharedbuffer_repr},
+    {Py_sq_length, (lenfunc)sharedbuffer_length},
+    {Py_bf_getbuffer, (getbufferproc)sharedbuffer_getbuffer},
+    {0, NULL},
+};
+
+static PyType_Spec SharedBufferType_spec = {
+    .name = "_xxsubinterpreters.SharedBuffer",
+    .basicsize = sizeof(sharedbufferobject),
+    .flags = (Py_TPFLAGS_DEFAULT | Py_TPFLAGS_IMMUTABLETYPE),
+    .slots = SharedBufferType_slots,
+};
+
+
 /* interpreter-specific code ************************************************/
 
 static int
@@ -2397,6 +2800,8 @@ interp_destroy(PyObject *self, PyObject *args, PyObject *kwds)
     PyThreadState *tstate = PyInterpreterState_ThreadHead(interp);
     // XXX Possible GILState issues?
     PyThreadState *save_tstate = PyThreadState_Swap(tstate);
+    _channels_drop_interpreter(&_globals.channels,
+                               PyInterpreterState_GetID(interp));
     Py_EndInterpreter(tstate);
     PyThreadState_Swap(save_tstate);
 
@@ -2676,7 +3081,7 @@ channel_list_all(PyObject *self, PyObject *Py_UNUSED(ignored))
     }
 
 finally:
-    PyMem_Free(cids);
+    GLOBAL_FREE(cids);
     return ids;
 }
 
@@ -2781,20 +3186,47 @@ Add the object's data to the channel's queue.");
 static PyObject *
 channel_recv(PyObject *self, PyObject *args, PyObject *kwds)
 {
-    static char *kwlist[] = {"cid", "default", NULL};
+    static char *kwlist[] = {"cid", "default", "block", "timeout", NULL};
     int64_t cid;
     struct channel_id_converter_data cid_data = {
         .module = self,
     };
     PyObject *dflt = NULL;
-    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O&|O:channel_recv", kwlist,
-                                     channel_id_converter, &cid_data, &dflt)) {
+    int block = 0;
+    PyObject *timeout_obj = Py_None;
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O&|O$pO:channel_recv",
+                                     kwlist, channel_id_converter, &cid_data,
+                                     &dflt, &block, &timeout_obj)) {
         return NULL;
     }
     cid = cid_data.cid;
 
+    _PyTime_t timeout = -1;
+    if (timeout_obj != Py_None) {
+        if (!block) {
+            PyErr_SetString(PyExc_ValueError,
+                            "can't specify a timeout for a non-blocking call");
+            return NULL;
+        }
+        if (_PyTime_FromSecondsObject(&timeout, timeout_obj,
+                                      _PyTime_ROUND_TIMEOUT) < 0) {
+            return NULL;
+        }
+        if (timeout < 0) {
+            PyErr_SetString(PyExc_ValueError,
+                            "timeout value must be positive");
+            return NULL;
+        }
+    }
+
     PyObject *obj = NULL;
-    int err = _channel_recv(&_globals.channels, cid, &obj);
+    int err;
+    if (block) {
+        err = _channel_recv_wait(&_globals.channels, cid, timeout, &obj);
+    }
+    else {
+        err = _channel_recv(&_globals.channels, cid, &obj);
+    }
     if (handle_channel_error(err, self, cid)) {
         return NULL;
     }
@@ -2812,10 +3244,14 @@ channel_recv(PyObject *self, PyObject *args, PyObject *kwds)
 }
 
 PyDoc_STRVAR(channel_recv_doc,
-"channel_recv(cid, [default]) -> obj\n\
+"channel_recv(cid, [default], *, block=False, timeout=None) -> obj\n\
 \n\
 Return a new object from the data at the front of the channel's queue.\n\
 \n\
+If 'block' is true and the channel is empty then wait until an object\n\
+is sent, for at most 'timeout' seconds if it is not None.  The wait\n\
+ends early if the channel is closed.\n\
+\n\
 If there is nothing to receive then raise ChannelEmptyError, unless\n\
 a default value is provided.  In that case return it.");
 
@@ -3007,6 +3443,13 @@ module_exec(PyObject *mod)
         goto error;
     }
 
+    // SharedBuffer
+    state->SharedBufferType = add_new_type(
+            mod, &SharedBufferType_spec, _sharedbuffer_shared);
+    if (state->SharedBufferType == NULL) {
+        goto error;
+    }
+
     // PyInterpreterID
     if (PyModule_AddType(mod, &_PyInterpreterID_Type) < 0) {
         goto error;
@@ -3015,6 +3458,7 @@ module_exec(PyObject *mod)
     return 0;
 
 error:
+    (void)_PyCrossInterpreterData_UnregisterClass(state->SharedBufferType);
     (void)_PyCrossInterpreterData_UnregisterClass(state->ChannelIDType);
     _globals_fini();
     return -1;
@@ -424,4 +424,125 @@ gc_get_freeze_count(PyObject *module, PyObject *Py_UNUSED(ignored))
 exit:
     return return_value;
 }
-/*[clinic end generated code: output=66432ac0e17fd04f input=a9049054013a1b77]*/
+
+PyDoc_STRVAR(gc_set_incremental__doc__,
+"set_incremental($module, /, enabled, max_objects=10000, max_usec=0)\n"
+"--\n"
+"\n"
+"Enable or disable incremental collection of the oldest generation.\n"
+"\n"
+"When enabled, a collection of the oldest generation is spread over several\n"
+"increments, each done in place of a collection of the middle generation.\n"
+"An increment stops taking old objects once it has taken max_objects of\n"
+"them, or once max_usec microseconds have elapsed.  A limit of zero is\n"
+"ignored, but at least one limit must be set.");
+
+#define GC_SET_INCREMENTAL_METHODDEF    \
+    {"set_incremental", _PyCFunction_CAST(gc_set_incremental), METH_FASTCALL|METH_KEYWORDS, gc_set_incremental__doc__},
+
+static PyObject *
+gc_set_incremental_impl(PyObject *module, int enabled,
+                        Py_ssize_t max_objects, Py_ssize_t max_usec);
+
+static PyObject *
+gc_set_incremental(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 3
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_item = { &_Py_ID(enabled), &_Py_ID(max_objects), &_Py_ID(max_usec), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"enabled", "max_objects", "max_usec", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "set_incremental",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[3];
+    Py_ssize_t noptargs = nargs + (kwnames ? PyTuple_GET_SIZE(kwnames) : 0) - 1;
+    int enabled;
+    Py_ssize_t max_objects = 10000;
+    Py_ssize_t max_usec = 0;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser, 1, 3, 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    enabled = PyObject_IsTrue(args[0]);
+    if (enabled < 0) {
+        goto exit;
+    }
+    if (!noptargs) {
+        goto skip_optional_pos;
+    }
+    if (args[1]) {
+        {
+            Py_ssize_t ival = -1;
+            PyObject *iobj = _PyNumber_Index(args[1]);
+            if (iobj != NULL) {
+                ival = PyLong_AsSsize_t(iobj);
+                Py_DECREF(iobj);
+            }
+            if (ival == -1 && PyErr_Occurred()) {
+                goto exit;
+            }
+            max_objects = ival;
+        }
+        if (!--noptargs) {
+            goto skip_optional_pos;
+        }
+    }
+    {
+        Py_ssize_t ival = -1;
+        PyObject *iobj = _PyNumber_Index(args[2]);
+        if (iobj != NULL) {
+            ival = PyLong_AsSsize_t(iobj);
+            Py_DECREF(iobj);
+        }
+        if (ival == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        max_usec = ival;
+    }
+skip_optional_pos:
+    return_value = gc_set_incremental_impl(module, enabled, max_objects, max_usec);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(gc_get_incremental__doc__,
+"get_incremental($module, /)\n"
+"--\n"
+"\n"
+"Return a three-tuple (enabled, max_objects, max_usec).\n"
+"\n"
+"See set_incremental() for the meaning of the values.");
+
+#define GC_GET_INCREMENTAL_METHODDEF    \
+    {"get_incremental", (PyCFunction)gc_get_incremental, METH_NOARGS, gc_get_incremental__doc__},
+
+static PyObject *
+gc_get_incremental_impl(PyObject *module);
+
+static PyObject *
+gc_get_incremental(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    return gc_get_incremental_impl(module);
+}
+/*[clinic end generated code: output=7eb2392b636b04ab input=a9049054013a1b77]*/
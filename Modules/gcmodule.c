@@ -102,7 +102,8 @@ gc_set_refs(PyGC_Head *g, Py_ssize_t refs)
 static inline void
 gc_reset_refs(PyGC_Head *g, Py_ssize_t refs)
 {
-    g->_gc_prev = (g->_gc_prev & _PyGC_PREV_MASK_FINALIZED)
+    g->_gc_prev = (g->_gc_prev & (_PyGC_PREV_MASK_FINALIZED |
+                                  _PyGC_PREV_MASK_OLD_SPACE))
         | PREV_MASK_COLLECTING
         | ((uintptr_t)(refs) << _PyGC_PREV_SHIFT);
 }
@@ -116,6 +117,23 @@ gc_decref(PyGC_Head *g)
     g->_gc_prev -= 1 << _PyGC_PREV_SHIFT;
 }
 
+static inline int
+gc_old_space(PyGC_Head *g)
+{
+    return (g->_gc_prev & _PyGC_PREV_MASK_OLD_SPACE) != 0;
+}
+
+static inline void
+gc_set_old_space(PyGC_Head *g, int space)
+{
+    if (space) {
+        g->_gc_prev |= _PyGC_PREV_MASK_OLD_SPACE;
+    }
+    else {
+        g->_gc_prev &= ~_PyGC_PREV_MASK_OLD_SPACE;
+    }
+}
+
 /* set for debugging information */
 #define DEBUG_STATS             (1<<0) /* print collection statistics */
 #define DEBUG_COLLECTABLE       (1<<1) /* print collectable objects */
@@ -181,9 +199,10 @@ _gc_prev values
 
 Between collections, _gc_prev is used for doubly linked list.
 
-Lowest two bits of _gc_prev are used for flags.
+Lowest three bits of _gc_prev are used for flags.
 PREV_MASK_COLLECTING is used only while collecting and cleared before GC ends
-or _PyObject_GC_UNTRACK() is called.
+or _PyObject_GC_UNTRACK() is called.  _PyGC_PREV_MASK_OLD_SPACE is kept
+through collections; see "Incremental collection" below.
 
 During a collection, _gc_prev is temporary used for gc_refs, and the gc list
 is singly linked until _gc_prev is restored.
@@ -335,6 +354,16 @@ gc_list_clear_collecting(PyGC_Head *collectable)
     }
 }
 
+/* Walk the list and put all objects in the given old space */
+static void
+gc_list_set_space(PyGC_Head *list, int space)
+{
+    PyGC_Head *gc;
+    for (gc = GC_NEXT(list); gc != list; gc = GC_NEXT(gc)) {
+        gc_set_old_space(gc, space);
+    }
+}
+
 /* Append objects in a GC list to a Python list.
  * Return 0 if all OK, < 0 if error (out of memory for list)
  */
@@ -1175,10 +1204,123 @@ handle_resurrected_objects(PyGC_Head *unreachable, PyGC_Head* still_unreachable,
     gc_list_merge(resurrected, old_generation);
 }
 
+/* Incremental collection
+   ----------------------
+
+In incremental mode, when gc_collect_generations() would collect the oldest
+generation, it starts a "pass" over it instead: the next collections of the
+middle generation are replaced by increments, each of which also collects a
+slice of the oldest generation, until all of it has been scanned.
+
+An increment is an ordinary collection of a set of objects: the young
+generations, plus objects taken from the head of the oldest generation
+together with every unscanned old object reachable from them.  As in any
+collection, objects referenced from outside the set are treated as reachable.
+So nothing carries over from one increment to the next, and the mutator needs
+no write barrier: a garbage cycle is found by the increment that takes its
+first old member, or, if part of it had already been scanned, in the next
+pass.  The closure of the young objects is not taken, as they often reach
+most of the heap through module globals.
+
+Objects scanned by the current pass have their _PyGC_PREV_MASK_OLD_SPACE bit
+equal to gcstate->visited_space, and are not taken again.  Survivors of an
+increment go to the tail of the oldest generation, so the pass is over when
+the object at its head has been visited.  So that all old objects are visited
+between passes, objects promoted to the oldest generation outside increments
+are marked visited too, and a pass starts by flipping visited_space.  The
+exception is while there are frozen objects: those stay "visited" so that
+increments never take them, and the bits of the old objects are reset one by
+one instead.
+
+The increment budget limits the old objects taken from the head, but the
+closure of the last one is always completed, so an increment can exceed the
+budget when it reaches many unscanned objects.
+*/
+
+struct increment {
+    PyGC_Head *list;
+    int visited;
+};
+
+/* A traversal callback for gather_increment. */
+static int
+visit_add_to_increment(PyObject *op, struct increment *inc)
+{
+    if (_PyObject_IS_GC(op) && _PyObject_GC_IS_TRACKED(op)) {
+        PyGC_Head *gc = AS_GC(op);
+        if (gc_old_space(gc) != inc->visited) {
+            gc_set_old_space(gc, inc->visited);
+            gc_list_move(gc, inc->list);
+        }
+    }
+    return 0;
+}
+
+/* Move the young generations and the next slice of the oldest generation to
+ * increment, marking them all visited.  Start is when the collection began.
+ */
+static void
+gather_increment(GCState *gcstate, PyGC_Head *increment, _PyTime_t start)
+{
+    PyGC_Head *old = GEN_HEAD(gcstate, NUM_GENERATIONS - 1);
+    struct increment inc = {increment, gcstate->visited_space};
+
+    gc_list_init(increment);
+    for (int i = 0; i < NUM_GENERATIONS - 1; i++) {
+        gc_list_merge(GEN_HEAD(gcstate, i), increment);
+    }
+    gc_list_set_space(increment, inc.visited);
+
+    Py_ssize_t taken = 0;
+    while (!gc_list_is_empty(old)) {
+        PyGC_Head *gc = GC_NEXT(old);
+        if (gc_old_space(gc) == inc.visited) {
+            /* The pass is over */
+            break;
+        }
+        gc_set_old_space(gc, inc.visited);
+        gc_list_move(gc, increment);
+        /* Objects taken by the traversal are appended to the list, so
+           this loop ends once the closure of gc has been taken. */
+        for (; gc != increment; gc = GC_NEXT(gc)) {
+            PyObject *op = FROM_GC(gc);
+            (void) Py_TYPE(op)->tp_traverse(op,
+                                            (visitproc)visit_add_to_increment,
+                                            &inc);
+            taken++;
+        }
+        if (gcstate->increment_size > 0 && taken >= gcstate->increment_size) {
+            break;
+        }
+        if (gcstate->increment_duration > 0 &&
+            _PyTime_GetPerfCounter() - start >= gcstate->increment_duration)
+        {
+            break;
+        }
+    }
+}
+
+/* Start a pass of increments over the oldest generation. */
+static void
+gc_start_old_pass(GCState *gcstate)
+{
+    if (gc_list_is_empty(&gcstate->permanent_generation.head)) {
+        gcstate->visited_space = !gcstate->visited_space;
+    }
+    else {
+        gc_list_set_space(GEN_HEAD(gcstate, NUM_GENERATIONS - 1),
+                          !gcstate->visited_space);
+    }
+    gcstate->scanning_old = 1;
+    /* Counted afresh by the increments */
+    gcstate->long_lived_total = 0;
+}
+
 /* This is the main function.  Read this to understand how the
- * collection process works. */
+ * collection process works.  If increment is true, only the next increment
+ * of the collection of the oldest generation is done. */
 static Py_ssize_t
-gc_collect_main(PyThreadState *tstate, int generation,
+gc_collect_main(PyThreadState *tstate, int generation, int increment,
                 Py_ssize_t *n_collected, Py_ssize_t *n_uncollectable,
                 int nofail)
 {
@@ -1187,6 +1329,7 @@ gc_collect_main(PyThreadState *tstate, int generation,
     Py_ssize_t n = 0; /* # unreachable objects that couldn't be collected */
     PyGC_Head *young; /* the generation we are examining */
     PyGC_Head *old; /* next older generation */
+    PyGC_Head increment_head; /* the objects of an increment */
     PyGC_Head unreachable; /* non-problematic unreachable trash */
     PyGC_Head finalizers;  /* objects with, & reachable from, __del__ */
     PyGC_Head *gc;
@@ -1197,10 +1340,15 @@ gc_collect_main(PyThreadState *tstate, int generation,
     // or after _PyGC_Fini()
     assert(gcstate->garbage != NULL);
     assert(!_PyErr_Occurred(tstate));
+    assert(!increment || (generation == NUM_GENERATIONS - 1 &&
+                          gcstate->scanning_old));
 
     if (gcstate->debug & DEBUG_STATS) {
-        PySys_WriteStderr("gc: collecting generation %d...\n", generation);
+        PySys_WriteStderr("gc: collecting %sgeneration %d...\n",
+                          increment ? "an increment of " : "", generation);
         show_stats_each_generations(gcstate);
+    }
+    if ((gcstate->debug & DEBUG_STATS) || increment) {
         t1 = _PyTime_GetPerfCounter();
     }
 
@@ -1213,17 +1361,24 @@ gc_collect_main(PyThreadState *tstate, int generation,
     for (i = 0; i <= generation; i++)
         gcstate->generations[i].count = 0;
 
-    /* merge younger generations with one we are currently collecting */
-    for (i = 0; i < generation; i++) {
-        gc_list_merge(GEN_HEAD(gcstate, i), GEN_HEAD(gcstate, generation));
+    if (increment) {
+        young = &increment_head;
+        old = GEN_HEAD(gcstate, generation);
+        gather_increment(gcstate, young, t1);
     }
+    else {
+        /* merge younger generations with one we are currently collecting */
+        for (i = 0; i < generation; i++) {
+            gc_list_merge(GEN_HEAD(gcstate, i), GEN_HEAD(gcstate, generation));
+        }
 
-    /* handy references */
-    young = GEN_HEAD(gcstate, generation);
-    if (generation < NUM_GENERATIONS-1)
-        old = GEN_HEAD(gcstate, generation+1);
-    else
-        old = young;
+        /* handy references */
+        young = GEN_HEAD(gcstate, generation);
+        if (generation < NUM_GENERATIONS-1)
+            old = GEN_HEAD(gcstate, generation+1);
+        else
+            old = young;
+    }
     validate_list(old, collecting_clear_unreachable_clear);
 
     deduce_unreachable(young, &unreachable);
@@ -1231,8 +1386,14 @@ gc_collect_main(PyThreadState *tstate, int generation,
     untrack_tuples(young);
     /* Move reachable objects to next generation. */
     if (young != old) {
-        if (generation == NUM_GENERATIONS - 2) {
+        if (increment) {
+            gcstate->long_lived_total += gc_list_size(young);
+        }
+        else if (generation == NUM_GENERATIONS - 2) {
             gcstate->long_lived_pending += gc_list_size(young);
+            if (gcstate->incremental) {
+                gc_list_set_space(young, gcstate->visited_space);
+            }
         }
         gc_list_merge(young, old);
     }
@@ -1242,6 +1403,11 @@ gc_collect_main(PyThreadState *tstate, int generation,
         untrack_dicts(young);
         gcstate->long_lived_pending = 0;
         gcstate->long_lived_total = gc_list_size(young);
+        if (gcstate->incremental) {
+            /* This also ends any pass of increments */
+            gc_list_set_space(young, gcstate->visited_space);
+            gcstate->scanning_old = 0;
+        }
     }
 
     /* All objects in unreachable are trash, but objects reachable from
@@ -1312,10 +1478,19 @@ gc_collect_main(PyThreadState *tstate, int generation,
 
     /* Clear free list only during the collection of the highest
      * generation */
-    if (generation == NUM_GENERATIONS-1) {
+    if (generation == NUM_GENERATIONS-1 && !increment) {
         clear_freelists(tstate->interp);
     }
 
+    if (increment) {
+        gc = GC_NEXT(old);
+        if (gc == old || gc_old_space(gc) == gcstate->visited_space) {
+            /* Every old object has been scanned */
+            gcstate->scanning_old = 0;
+            gcstate->long_lived_pending = 0;
+        }
+    }
+
     if (_PyErr_Occurred(tstate)) {
         if (nofail) {
             _PyErr_Clear(tstate);
@@ -1391,16 +1566,17 @@ invoke_gc_callback(PyThreadState *tstate, const char *phase,
     assert(!_PyErr_Occurred(tstate));
 }
 
-/* Perform garbage collection of a generation and invoke
- * progress callbacks.
+/* Perform garbage collection of a generation, or an increment of it, and
+ * invoke progress callbacks.
  */
 static Py_ssize_t
-gc_collect_with_callback(PyThreadState *tstate, int generation)
+gc_collect_with_callback(PyThreadState *tstate, int generation, int increment)
 {
     assert(!_PyErr_Occurred(tstate));
     Py_ssize_t result, collected, uncollectable;
     invoke_gc_callback(tstate, "start", generation, 0, 0);
-    result = gc_collect_main(tstate, generation, &collected, &uncollectable, 0);
+    result = gc_collect_main(tstate, generation, increment,
+                             &collected, &uncollectable, 0);
     invoke_gc_callback(tstate, "stop", generation, collected, uncollectable);
     assert(!_PyErr_Occurred(tstate));
     return result;
@@ -1455,7 +1631,18 @@ gc_collect_generations(PyThreadState *tstate)
             if (i == NUM_GENERATIONS - 1
                 && gcstate->long_lived_pending < gcstate->long_lived_total / 4)
                 continue;
-            n = gc_collect_with_callback(tstate, i);
+            if (gcstate->incremental && i >= NUM_GENERATIONS - 2) {
+                /* A full collection becomes a pass of increments, each in
+                   place of a collection of the middle generation. */
+                if (i == NUM_GENERATIONS - 1 && !gcstate->scanning_old) {
+                    gc_start_old_pass(gcstate);
+                }
+                if (gcstate->scanning_old) {
+                    n = gc_collect_with_callback(tstate, NUM_GENERATIONS - 1, 1);
+                    break;
+                }
+            }
+            n = gc_collect_with_callback(tstate, i, 0);
             break;
         }
     }
@@ -1538,7 +1725,7 @@ gc_collect_impl(PyObject *module, int generation)
     }
     else {
         gcstate->collecting = 1;
-        n = gc_collect_with_callback(tstate, generation);
+        n = gc_collect_with_callback(tstate, generation, 0);
         gcstate->collecting = 0;
     }
     return n;
@@ -1908,6 +2095,10 @@ gc_freeze_impl(PyObject *module)
 {
     GCState *gcstate = get_gc_state();
     for (int i = 0; i < NUM_GENERATIONS; ++i) {
+        if (gcstate->incremental) {
+            /* Frozen objects must never be taken by an increment */
+            gc_list_set_space(GEN_HEAD(gcstate, i), gcstate->visited_space);
+        }
         gc_list_merge(GEN_HEAD(gcstate, i), &gcstate->permanent_generation.head);
         gcstate->generations[i].count = 0;
     }
@@ -1946,6 +2137,72 @@ gc_get_freeze_count_impl(PyObject *module)
     return gc_list_size(&gcstate->permanent_generation.head);
 }
 
+/*[clinic input]
+gc.set_incremental
+
+    enabled: bool
+    max_objects: Py_ssize_t = 10000
+    max_usec: Py_ssize_t = 0
+
+Enable or disable incremental collection of the oldest generation.
+
+When enabled, a collection of the oldest generation is spread over several
+increments, each done in place of a collection of the middle generation.
+An increment stops taking old objects once it has taken max_objects of
+them, or once max_usec microseconds have elapsed.  A limit of zero is
+ignored, but at least one limit must be set.
+[clinic start generated code]*/
+
+static PyObject *
+gc_set_incremental_impl(PyObject *module, int enabled,
+                        Py_ssize_t max_objects, Py_ssize_t max_usec)
+/*[clinic end generated code: output=495f2277773bcbac input=00f6fb68348bdb54]*/
+{
+    GCState *gcstate = get_gc_state();
+    if (max_objects < 0 || max_usec < 0) {
+        PyErr_SetString(PyExc_ValueError,
+                        "increment limits must not be negative");
+        return NULL;
+    }
+    if (max_objects == 0 && max_usec == 0) {
+        PyErr_SetString(PyExc_ValueError,
+                        "at least one increment limit must be set");
+        return NULL;
+    }
+    gcstate->increment_size = max_objects;
+    gcstate->increment_duration = _PyTime_FromMicrosecondsClamp(max_usec);
+    if (enabled && !gcstate->incremental) {
+        /* Every old object counts as visited between passes */
+        gc_list_set_space(GEN_HEAD(gcstate, NUM_GENERATIONS - 1),
+                          gcstate->visited_space);
+        gc_list_set_space(&gcstate->permanent_generation.head,
+                          gcstate->visited_space);
+    }
+    gcstate->incremental = enabled;
+    gcstate->scanning_old = 0;
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+gc.get_incremental
+
+Return a three-tuple (enabled, max_objects, max_usec).
+
+See set_incremental() for the meaning of the values.
+[clinic start generated code]*/
+
+static PyObject *
+gc_get_incremental_impl(PyObject *module)
+/*[clinic end generated code: output=7dd3078b18c0e4ba input=60bc0e7bd3b56210]*/
+{
+    GCState *gcstate = get_gc_state();
+    return Py_BuildValue("(Onn)",
+                         gcstate->incremental ? Py_True : Py_False,
+                         gcstate->increment_size,
+                         (Py_ssize_t)_PyTime_AsMicroseconds(
+                             gcstate->increment_duration, _PyTime_ROUND_CEILING));
+}
+
 
 PyDoc_STRVAR(gc__doc__,
 "This module provides access to the garbage collector for reference cycles.\n"
@@ -1967,7 +2224,9 @@ PyDoc_STRVAR(gc__doc__,
 "get_referents() -- Return the list of objects that an object refers to.\n"
 "freeze() -- Freeze all tracked objects and ignore them for future collections.\n"
 "unfreeze() -- Unfreeze all objects in the permanent generation.\n"
-"get_freeze_count() -- Return the number of objects in the permanent generation.\n");
+"get_freeze_count() -- Return the number of objects in the permanent generation.\n"
+"set_incremental() -- Enable or disable incremental collection.\n"
+"get_incremental() -- Return the incremental collection settings.\n");
 
 static PyMethodDef GcMethods[] = {
     GC_ENABLE_METHODDEF
@@ -1990,6 +2249,8 @@ static PyMethodDef GcMethods[] = {
     GC_FREEZE_METHODDEF
     GC_UNFREEZE_METHODDEF
     GC_GET_FREEZE_COUNT_METHODDEF
+    GC_SET_INCREMENTAL_METHODDEF
+    GC_GET_INCREMENTAL_METHODDEF
     {NULL,      NULL}           /* Sentinel */
 };
 
@@ -2085,7 +2346,7 @@ PyGC_Collect(void)
         PyObject *exc, *value, *tb;
         gcstate->collecting = 1;
         _PyErr_Fetch(tstate, &exc, &value, &tb);
-        n = gc_collect_with_callback(tstate, NUM_GENERATIONS - 1);
+        n = gc_collect_with_callback(tstate, NUM_GENERATIONS - 1, 0);
         _PyErr_Restore(tstate, exc, value, tb);
         gcstate->collecting = 0;
     }
@@ -2109,7 +2370,7 @@ _PyGC_CollectNoFail(PyThreadState *tstate)
 
     Py_ssize_t n;
     gcstate->collecting = 1;
-    n = gc_collect_main(tstate, NUM_GENERATIONS - 1, NULL, NULL, 1);
+    n = gc_collect_main(tstate, NUM_GENERATIONS - 1, 0, NULL, NULL, 1);
     gcstate->collecting = 0;
     return n;
 }
@@ -5,10 +5,12 @@
 #include "structmember.h"         // PyMemberDef
 #include "pycore_code.h"          // _PyCodeConstructor
 #include "pycore_frame.h"         // FRAME_SPECIALS_SIZE
+#include "pycore_instruments.h"   // _Py_GetBaseOpcode()
 #include "pycore_interp.h"        // PyInterpreterState.co_extra_freefuncs
 #include "pycore_opcode.h"        // _PyOpcode_Deopt
 #include "pycore_pystate.h"       // _PyInterpreterState_GET()
 #include "pycore_tuple.h"         // _PyTuple_ITEMS()
+#include "pycore_uops.h"          // _PyExecutorArray_Free()
 #include "clinic/codeobject.c.h"
 
 static void
@@ -408,6 +410,9 @@ init_code(PyCodeObject *co, struct _PyCodeConstructor *con)
 
     co->_co_linearray_entry_size = 0;
     co->_co_linearray = NULL;
+    co->_co_executors = NULL;
+    co->_co_monitoring = NULL;
+    co->_co_instrumentation_version = 0;
     memcpy(_PyCode_CODE(co), PyBytes_AS_STRING(con->code),
            PyBytes_GET_SIZE(con->code));
     int entry_point = 0;
@@ -417,6 +422,10 @@ init_code(PyCodeObject *co, struct _PyCodeConstructor *con)
     }
     co->_co_firsttraceable = entry_point;
     _PyCode_Quicken(co);
+    PyInterpreterState *interp = _PyInterpreterState_GET();
+    if (interp->specialization_profile.codes != NULL) {
+        _PySpecializationProfile_CodeCreated(interp, co);
+    }
     notify_code_watchers(PY_CODE_EVENT_CREATE, co);
 }
 
@@ -1513,12 +1522,14 @@ PyCode_GetFreevars(PyCodeObject *code)
     return _PyCode_GetFreevars(code);
 }
 
+/* Write the bytecode of co into instructions (which may be co's own)
+ * without specialization or instrumentation. */
 static void
-deopt_code(_Py_CODEUNIT *instructions, Py_ssize_t len)
+deopt_code(PyCodeObject *co, _Py_CODEUNIT *instructions)
 {
-    for (int i = 0; i < len; i++) {
+    for (int i = 0; i < Py_SIZE(co); i++) {
         _Py_CODEUNIT instruction = instructions[i];
-        int opcode = _PyOpcode_Deopt[_Py_OPCODE(instruction)];
+        int opcode = _Py_GetBaseOpcode(co, i);
         int caches = _PyOpcode_Caches[opcode];
         instructions[i] = _Py_MAKECODEUNIT(opcode, _Py_OPARG(instruction));
         while (caches--) {
@@ -1541,7 +1552,7 @@ _PyCode_GetCode(PyCodeObject *co)
     if (code == NULL) {
         return NULL;
     }
-    deopt_code((_Py_CODEUNIT *)PyBytes_AS_STRING(code), Py_SIZE(co));
+    deopt_code(co, (_Py_CODEUNIT *)PyBytes_AS_STRING(code));
     assert(co->_co_cached->_co_code == NULL);
     co->_co_cached->_co_code = Py_NewRef(code);
     return code;
@@ -1680,8 +1691,15 @@ code_dealloc(PyCodeObject *co)
 {
     notify_code_watchers(PY_CODE_EVENT_DESTROY, co);
 
+    PyInterpreterState *interp = _PyInterpreterState_GET();
+    if (interp->specialization_profile.codes != NULL) {
+        _PySpecializationProfile_CodeDestroyed(interp, co);
+    }
+    if (interp->specialization_telemetry.codes != NULL) {
+        _PySpecializationTelemetry_CodeDestroyed(interp, co);
+    }
+
     if (co->co_extra != NULL) {
-        PyInterpreterState *interp = _PyInterpreterState_GET();
         _PyCodeObjectExtra *co_extra = co->co_extra;
 
         for (Py_ssize_t i = 0; i < co_extra->ce_size; i++) {
@@ -1717,6 +1735,12 @@ code_dealloc(PyCodeObject *co)
     if (co->_co_linearray) {
         PyMem_Free(co->_co_linearray);
     }
+    if (co->_co_executors) {
+        _PyExecutorArray_Free(co->_co_executors);
+    }
+    if (co->_co_monitoring) {
+        PyMem_Free(co->_co_monitoring);
+    }
     PyObject_Free(co);
 }
 
@@ -1775,8 +1799,8 @@ code_richcompare(PyObject *self, PyObject *other, int op)
     for (int i = 0; i < Py_SIZE(co); i++) {
         _Py_CODEUNIT co_instr = _PyCode_CODE(co)[i];
         _Py_CODEUNIT cp_instr = _PyCode_CODE(cp)[i];
-        _Py_SET_OPCODE(co_instr, _PyOpcode_Deopt[_Py_OPCODE(co_instr)]);
-        _Py_SET_OPCODE(cp_instr, _PyOpcode_Deopt[_Py_OPCODE(cp_instr)]);
+        _Py_SET_OPCODE(co_instr, _Py_GetBaseOpcode(co, i));
+        _Py_SET_OPCODE(cp_instr, _Py_GetBaseOpcode(cp, i));
         eq = co_instr == cp_instr;
         if (!eq) {
             goto unequal;
@@ -1907,8 +1931,19 @@ code_getfreevars(PyCodeObject *code, void *closure)
 static PyObject *
 code_getcodeadaptive(PyCodeObject *code, void *closure)
 {
-    return PyBytes_FromStringAndSize(code->co_code_adaptive,
-                                     _PyCode_NBYTES(code));
+    PyObject *res = PyBytes_FromStringAndSize(code->co_code_adaptive,
+                                              _PyCode_NBYTES(code));
+    if (res == NULL || code->_co_monitoring == NULL) {
+        return res;
+    }
+    /* Show the specialized instructions underneath any instrumentation */
+    _Py_CODEUNIT *instructions = (_Py_CODEUNIT *)PyBytes_AS_STRING(res);
+    for (int i = 0; i < Py_SIZE(code); i++) {
+        int opcode = _Py_GetOriginalOpcode(code, i);
+        instructions[i] = _Py_MAKECODEUNIT(opcode, _Py_OPARG(instructions[i]));
+        i += _PyOpcode_Caches[_PyOpcode_Deopt[opcode]];
+    }
+    return res;
 }
 
 static PyObject *
@@ -2271,7 +2306,7 @@ _PyCode_ConstantKey(PyObject *op)
 void
 _PyStaticCode_Fini(PyCodeObject *co)
 {
-    deopt_code(_PyCode_CODE(co), Py_SIZE(co));
+    deopt_code(co, _PyCode_CODE(co));
     PyMem_Free(co->co_extra);
     if (co->_co_cached != NULL) {
         Py_CLEAR(co->_co_cached->_co_code);
@@ -2290,6 +2325,15 @@ _PyStaticCode_Fini(PyCodeObject *co)
         PyMem_Free(co->_co_linearray);
         co->_co_linearray = NULL;
     }
+    if (co->_co_executors) {
+        _PyExecutorArray_Free(co->_co_executors);
+        co->_co_executors = NULL;
+    }
+    if (co->_co_monitoring) {
+        PyMem_Free(co->_co_monitoring);
+        co->_co_monitoring = NULL;
+    }
+    co->_co_instrumentation_version = 0;
 }
 
 int
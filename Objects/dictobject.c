@@ -3974,39 +3974,42 @@ static PyMethodDef dictiter_methods[] = {
     {NULL,              NULL}           /* sentinel */
 };
 
-static PyObject*
-dictiter_iternextkey(dictiterobject *di)
+/* Advance a forward dict iterator.  On success, return 1 and store borrowed
+   references to the next key and value in *pkey and *pvalue (either may be
+   NULL if the caller does not need it).  Return 0 when the iterator is
+   exhausted and -1 with an exception set on error. */
+static inline int
+dictiter_iternext_entry(dictiterobject *di, PyObject **pkey, PyObject **pvalue)
 {
-    PyObject *key;
+    PyObject *key, *value;
     Py_ssize_t i;
-    PyDictKeysObject *k;
     PyDictObject *d = di->di_dict;
 
     if (d == NULL)
-        return NULL;
+        return 0;
     assert (PyDict_Check(d));
 
     if (di->di_used != d->ma_used) {
         PyErr_SetString(PyExc_RuntimeError,
                         "dictionary changed size during iteration");
         di->di_used = -1; /* Make this state sticky */
-        return NULL;
+        return -1;
     }
 
     i = di->di_pos;
-    k = d->ma_keys;
     assert(i >= 0);
     if (d->ma_values) {
         if (i >= d->ma_used)
             goto fail;
         int index = get_index_from_order(d, i);
-        key = DK_UNICODE_ENTRIES(k)[index].me_key;
-        assert(d->ma_values->values[index] != NULL);
+        key = DK_UNICODE_ENTRIES(d->ma_keys)[index].me_key;
+        value = d->ma_values->values[index];
+        assert(value != NULL);
     }
     else {
-        Py_ssize_t n = k->dk_nentries;
-        if (DK_IS_UNICODE(k)) {
-            PyDictUnicodeEntry *entry_ptr = &DK_UNICODE_ENTRIES(k)[i];
+        Py_ssize_t n = d->ma_keys->dk_nentries;
+        if (DK_IS_UNICODE(d->ma_keys)) {
+            PyDictUnicodeEntry *entry_ptr = &DK_UNICODE_ENTRIES(d->ma_keys)[i];
             while (i < n && entry_ptr->me_value == NULL) {
                 entry_ptr++;
                 i++;
@@ -4014,9 +4017,10 @@ dictiter_iternextkey(dictiterobject *di)
             if (i >= n)
                 goto fail;
             key = entry_ptr->me_key;
+            value = entry_ptr->me_value;
         }
         else {
-            PyDictKeyEntry *entry_ptr = &DK_ENTRIES(k)[i];
+            PyDictKeyEntry *entry_ptr = &DK_ENTRIES(d->ma_keys)[i];
             while (i < n && entry_ptr->me_value == NULL) {
                 entry_ptr++;
                 i++;
@@ -4024,22 +4028,41 @@ dictiter_iternextkey(dictiterobject *di)
             if (i >= n)
                 goto fail;
             key = entry_ptr->me_key;
+            value = entry_ptr->me_value;
         }
     }
-    // We found an element (key), but did not expect it
+    // We found an element, but did not expect it
     if (di->len == 0) {
         PyErr_SetString(PyExc_RuntimeError,
                         "dictionary keys changed during iteration");
-        goto fail;
+        di->di_dict = NULL;
+        Py_DECREF(d);
+        return -1;
     }
     di->di_pos = i+1;
     di->len--;
-    return Py_NewRef(key);
+    if (pkey != NULL) {
+        *pkey = key;
+    }
+    if (pvalue != NULL) {
+        *pvalue = value;
+    }
+    return 1;
 
 fail:
     di->di_dict = NULL;
     Py_DECREF(d);
-    return NULL;
+    return 0;
+}
+
+static PyObject*
+dictiter_iternextkey(dictiterobject *di)
+{
+    PyObject *key;
+    if (dictiter_iternext_entry(di, &key, NULL) <= 0) {
+        return NULL;
+    }
+    return Py_NewRef(key);
 }
 
 PyTypeObject PyDictIterKey_Type = {
@@ -4079,66 +4102,10 @@ static PyObject *
 dictiter_iternextvalue(dictiterobject *di)
 {
     PyObject *value;
-    Py_ssize_t i;
-    PyDictObject *d = di->di_dict;
-
-    if (d == NULL)
-        return NULL;
-    assert (PyDict_Check(d));
-
-    if (di->di_used != d->ma_used) {
-        PyErr_SetString(PyExc_RuntimeError,
-                        "dictionary changed size during iteration");
-        di->di_used = -1; /* Make this state sticky */
+    if (dictiter_iternext_entry(di, NULL, &value) <= 0) {
         return NULL;
     }
-
-    i = di->di_pos;
-    assert(i >= 0);
-    if (d->ma_values) {
-        if (i >= d->ma_used)
-            goto fail;
-        int index = get_index_from_order(d, i);
-        value = d->ma_values->values[index];
-        assert(value != NULL);
-    }
-    else {
-        Py_ssize_t n = d->ma_keys->dk_nentries;
-        if (DK_IS_UNICODE(d->ma_keys)) {
-            PyDictUnicodeEntry *entry_ptr = &DK_UNICODE_ENTRIES(d->ma_keys)[i];
-            while (i < n && entry_ptr->me_value == NULL) {
-                entry_ptr++;
-                i++;
-            }
-            if (i >= n)
-                goto fail;
-            value = entry_ptr->me_value;
-        }
-        else {
-            PyDictKeyEntry *entry_ptr = &DK_ENTRIES(d->ma_keys)[i];
-            while (i < n && entry_ptr->me_value == NULL) {
-                entry_ptr++;
-                i++;
-            }
-            if (i >= n)
-                goto fail;
-            value = entry_ptr->me_value;
-        }
-    }
-    // We found an element, but did not expect it
-    if (di->len == 0) {
-        PyErr_SetString(PyExc_RuntimeError,
-                        "dictionary keys changed during iteration");
-        goto fail;
-    }
-    di->di_pos = i+1;
-    di->len--;
     return Py_NewRef(value);
-
-fail:
-    di->di_dict = NULL;
-    Py_DECREF(d);
-    return NULL;
 }
 
 PyTypeObject PyDictIterValue_Type = {
@@ -4178,63 +4145,9 @@ static PyObject *
 dictiter_iternextitem(dictiterobject *di)
 {
     PyObject *key, *value, *result;
-    Py_ssize_t i;
-    PyDictObject *d = di->di_dict;
-
-    if (d == NULL)
-        return NULL;
-    assert (PyDict_Check(d));
-
-    if (di->di_used != d->ma_used) {
-        PyErr_SetString(PyExc_RuntimeError,
-                        "dictionary changed size during iteration");
-        di->di_used = -1; /* Make this state sticky */
+    if (dictiter_iternext_entry(di, &key, &value) <= 0) {
         return NULL;
     }
-
-    i = di->di_pos;
-    assert(i >= 0);
-    if (d->ma_values) {
-        if (i >= d->ma_used)
-            goto fail;
-        int index = get_index_from_order(d, i);
-        key = DK_UNICODE_ENTRIES(d->ma_keys)[index].me_key;
-        value = d->ma_values->values[index];
-        assert(value != NULL);
-    }
-    else {
-        Py_ssize_t n = d->ma_keys->dk_nentries;
-        if (DK_IS_UNICODE(d->ma_keys)) {
-            PyDictUnicodeEntry *entry_ptr = &DK_UNICODE_ENTRIES(d->ma_keys)[i];
-            while (i < n && entry_ptr->me_value == NULL) {
-                entry_ptr++;
-                i++;
-            }
-            if (i >= n)
-                goto fail;
-            key = entry_ptr->me_key;
-            value = entry_ptr->me_value;
-        }
-        else {
-            PyDictKeyEntry *entry_ptr = &DK_ENTRIES(d->ma_keys)[i];
-            while (i < n && entry_ptr->me_value == NULL) {
-                entry_ptr++;
-                i++;
-            }
-            if (i >= n)
-                goto fail;
-            key = entry_ptr->me_key;
-            value = entry_ptr->me_value;
-        }
-    }
-    // We found an element, but did not expect it
-    if (di->len == 0) {
-        PyErr_SetString(PyExc_RuntimeError,
-                        "dictionary keys changed during iteration");
-        goto fail;
-    }
-    di->di_pos = i+1;
-    di->len--;
     result = di->di_result;
     if (Py_REFCNT(result) == 1) {
         PyObject *oldkey = PyTuple_GET_ITEM(result, 0);
@@ -4258,11 +4171,6 @@ dictiter_iternextitem(dictiterobject *di)
         PyTuple_SET_ITEM(result, 1, Py_NewRef(value));
     }
     return result;
-
-fail:
-    di->di_dict = NULL;
-    Py_DECREF(d);
-    return NULL;
 }
 
 PyTypeObject PyDictIterItem_Type = {
@@ -4298,6 +4206,28 @@ PyTypeObject PyDictIterItem_Type = {
     0,
 };
 
+/* Used by the FOR_ITER_DICT_* specializations: like tp_iternext of the
+   forward key, value and item iterators, but without building a result
+   tuple for items.  *pkey and *pvalue receive new references. */
+int
+_PyDictIter_Next(PyObject *self, PyObject **pkey, PyObject **pvalue)
+{
+    assert(Py_IS_TYPE(self, &PyDictIterKey_Type) ||
+           Py_IS_TYPE(self, &PyDictIterValue_Type) ||
+           Py_IS_TYPE(self, &PyDictIterItem_Type));
+    PyObject *key, *value;
+    int res = dictiter_iternext_entry((dictiterobject *)self, &key, &value);
+    if (res > 0) {
+        if (pkey != NULL) {
+            *pkey = Py_NewRef(key);
+        }
+        if (pvalue != NULL) {
+            *pvalue = Py_NewRef(value);
+        }
+    }
+    return res;
+}
+
 
 /* dictreviter */
 
@@ -5653,10 +5583,11 @@ uint32_t _PyDictKeys_GetVersionForCurrentState(PyDictKeysObject *dictkeys)
     if (dictkeys->dk_version != 0) {
         return dictkeys->dk_version;
     }
-    if (_PyRuntime.dict_state.next_keys_version == 0) {
+    PyInterpreterState *interp = _PyInterpreterState_GetVersionsOwner();
+    if (interp->dict_state.next_keys_version == 0) {
         return 0;
     }
-    uint32_t v = _PyRuntime.dict_state.next_keys_version++;
+    uint32_t v = interp->dict_state.next_keys_version++;
     dictkeys->dk_version = v;
     return v;
 }
@@ -2,6 +2,8 @@
 
 #include "Python.h"
 #include "pycore_call.h"          // _PyObject_CallNoArgs()
+#include "pycore_enumobject.h"    // _PyEnum_NextPair()
+#include "pycore_list.h"          // _PyListIterObject
 #include "pycore_long.h"          // _PyLong_GetOne()
 #include "pycore_object.h"        // _PyObject_GC_TRACK()
 
@@ -268,6 +270,65 @@ enum_next(enumobject *en)
     return result;
 }
 
+/* Used by FOR_ITER_ENUMERATE: the loop unpacks each pair straight away, so
+   hand back the index and item instead of filling in en_result.  Iteration
+   over a list is inlined. */
+int
+_PyEnum_NextPair(PyObject *self, PyObject **pindex, PyObject **pitem)
+{
+    assert(Py_IS_TYPE(self, &PyEnum_Type));
+    enumobject *en = (enumobject *)self;
+    PyObject *it = en->en_sit;
+    PyObject *next_item;
+
+    if (en->en_index == PY_SSIZE_T_MAX) {
+        PyObject *result = enum_next(en);
+        if (result == NULL) {
+            goto exhausted;
+        }
+        *pindex = Py_NewRef(PyTuple_GET_ITEM(result, 0));
+        *pitem = Py_NewRef(PyTuple_GET_ITEM(result, 1));
+        Py_DECREF(result);
+        return 1;
+    }
+    if (Py_IS_TYPE(it, &PyListIter_Type)) {
+        _PyListIterObject *lit = (_PyListIterObject *)it;
+        PyListObject *seq = lit->it_seq;
+        if (seq == NULL) {
+            return 0;
+        }
+        if (lit->it_index >= PyList_GET_SIZE(seq)) {
+            lit->it_seq = NULL;
+            Py_DECREF(seq);
+            return 0;
+        }
+        next_item = Py_NewRef(PyList_GET_ITEM(seq, lit->it_index++));
+    }
+    else {
+        next_item = (*Py_TYPE(it)->tp_iternext)(it);
+        if (next_item == NULL) {
+            goto exhausted;
+        }
+    }
+    *pindex = PyLong_FromSsize_t(en->en_index);
+    if (*pindex == NULL) {
+        Py_DECREF(next_item);
+        return -1;
+    }
+    en->en_index++;
+    *pitem = next_item;
+    return 1;
+
+exhausted:
+    if (PyErr_Occurred()) {
+        if (!PyErr_ExceptionMatches(PyExc_StopIteration)) {
+            return -1;
+        }
+        PyErr_Clear();
+    }
+    return 0;
+}
+
 static PyObject *
 enum_reduce(enumobject *en, PyObject *Py_UNUSED(ignored))
 {
@@ -334,10 +334,10 @@ mark_stacks(PyCodeObject *code_obj, int len)
                     break;
                 }
                 case SEND:
-                    j = get_arg(code, i) + i + 1;
+                    j = get_arg(code, i) + 1 + INLINE_CACHE_ENTRIES_SEND + i;
                     assert(j < len);
-                    assert(stacks[j] == UNINITIALIZED || stacks[j] == pop_value(next_stack));
-                    stacks[j] = pop_value(next_stack);
+                    assert(stacks[j] == UNINITIALIZED || stacks[j] == next_stack);
+                    stacks[j] = next_stack;
                     stacks[i+1] = next_stack;
                     break;
                 case JUMP_FORWARD:
@@ -349,6 +349,9 @@ mark_stacks(PyCodeObject *code_obj, int len)
                 case JUMP_BACKWARD:
                 case JUMP_BACKWARD_NO_INTERRUPT:
                     j = i + 1 - get_arg(code, i);
+                    if (opcode == JUMP_BACKWARD) {
+                        j += INLINE_CACHE_ENTRIES_JUMP_BACKWARD;
+                    }
                     assert(j >= 0);
                     assert(j < len);
                     if (stacks[j] == UNINITIALIZED && j < i) {
@@ -396,6 +399,7 @@ mark_stacks(PyCodeObject *code_obj, int len)
                     /* End of block */
                     break;
                 case PUSH_NULL:
+                case LOAD_FAST_AND_CLEAR:
                     next_stack = push_value(next_stack, Null);
                     stacks[i+1] = next_stack;
                     break;
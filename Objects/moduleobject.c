@@ -42,10 +42,14 @@ PyModuleDef_Init(PyModuleDef* def)
 {
     assert(PyModuleDef_Type.tp_flags & Py_TPFLAGS_READY);
     if (def->m_base.m_index == 0) {
-        _PyRuntime.imports.last_module_index++;
-        Py_SET_REFCNT(def, 1);
-        Py_SET_TYPE(def, &PyModuleDef_Type);
-        def->m_base.m_index = _PyRuntime.imports.last_module_index;
+        PyThread_type_lock mutex = _PyRuntime.imports.extensions_mutex;
+        PyThread_acquire_lock(mutex, WAIT_LOCK);
+        if (def->m_base.m_index == 0) {
+            _PyRuntime.imports.last_module_index++;
+            Py_SET_TYPE(def, &PyModuleDef_Type);
+            def->m_base.m_index = _PyRuntime.imports.last_module_index;
+        }
+        PyThread_release_lock(mutex);
     }
     return (PyObject*)def;
 }
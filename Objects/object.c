@@ -1721,7 +1721,7 @@ PyTypeObject _PyNone_Type = {
 
 PyObject _Py_NoneStruct = {
   _PyObject_EXTRA_INIT
-  1, &_PyNone_Type
+  _Py_IMMORTAL_REFCNT, &_PyNone_Type
 };
 
 /* NotImplemented is an object that can be used to signal that an
@@ -1822,7 +1822,7 @@ PyTypeObject _PyNotImplemented_Type = {
 
 PyObject _Py_NotImplementedStruct = {
     _PyObject_EXTRA_INIT
-    1, &_PyNotImplemented_Type
+    _Py_IMMORTAL_REFCNT, &_PyNotImplemented_Type
 };
 
 #ifdef MS_WINDOWS
@@ -2010,7 +2010,9 @@ _Py_NewReference(PyObject *op)
 #ifdef Py_REF_DEBUG
     _Py_RefTotal++;
 #endif
-    Py_SET_REFCNT(op, 1);
+    // Don't use Py_SET_REFCNT(): the memory is uninitialized and may look
+    // like an immortal object.
+    op->ob_refcnt = 1;
 #ifdef Py_TRACE_REFS
     _Py_AddToAllObjects(op, 1);
 #endif
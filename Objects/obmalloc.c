@@ -1,5 +1,6 @@
 #include "Python.h"
 #include "pycore_code.h"          // stats
+#include "pycore_initconfig.h"    // _PyStatus_NO_MEMORY()
 #include "pycore_pystate.h"       // _PyInterpreterState_GET
 
 #include "pycore_obmalloc.h"
@@ -727,18 +728,36 @@ static int running_on_valgrind = -1;
 #endif
 
 
-#define allarenas (_PyRuntime.obmalloc.mgmt.arenas)
-#define maxarenas (_PyRuntime.obmalloc.mgmt.maxarenas)
-#define unused_arena_objects (_PyRuntime.obmalloc.mgmt.unused_arena_objects)
-#define usable_arenas (_PyRuntime.obmalloc.mgmt.usable_arenas)
-#define nfp2lasta (_PyRuntime.obmalloc.mgmt.nfp2lasta)
-#define narenas_currently_allocated (_PyRuntime.obmalloc.mgmt.narenas_currently_allocated)
-#define ntimes_arena_allocated (_PyRuntime.obmalloc.mgmt.ntimes_arena_allocated)
-#define narenas_highwater (_PyRuntime.obmalloc.mgmt.narenas_highwater)
-#define raw_allocated_blocks (_PyRuntime.obmalloc.mgmt.raw_allocated_blocks)
+typedef struct _obmalloc_state OMState;
 
-Py_ssize_t
-_Py_GetAllocatedBlocks(void)
+/* Return the allocator state of the current interpreter.  Interpreters
+   that share the main interpreter's GIL also share its state.  Before the
+   main interpreter exists, and once no thread state is current during
+   finalization, the runtime's state is used. */
+static inline OMState *
+get_state(void)
+{
+    PyThreadState *tstate = _PyThreadState_GET();
+    if (tstate == NULL) {
+        return &_PyRuntime.obmalloc;
+    }
+    OMState *state = tstate->interp->obmalloc;
+    assert(state != NULL);
+    return state;
+}
+
+#define allarenas (state->mgmt.arenas)
+#define maxarenas (state->mgmt.maxarenas)
+#define unused_arena_objects (state->mgmt.unused_arena_objects)
+#define usable_arenas (state->mgmt.usable_arenas)
+#define nfp2lasta (state->mgmt.nfp2lasta)
+#define narenas_currently_allocated (state->mgmt.narenas_currently_allocated)
+#define ntimes_arena_allocated (state->mgmt.ntimes_arena_allocated)
+#define narenas_highwater (state->mgmt.narenas_highwater)
+#define raw_allocated_blocks (state->mgmt.raw_allocated_blocks)
+
+static Py_ssize_t
+get_num_allocated_blocks(OMState *state)
 {
     Py_ssize_t n = raw_allocated_blocks;
     /* add up allocated blocks for used pools */
@@ -760,20 +779,26 @@ _Py_GetAllocatedBlocks(void)
     return n;
 }
 
+Py_ssize_t
+_Py_GetAllocatedBlocks(void)
+{
+    return get_num_allocated_blocks(get_state());
+}
+
 #if WITH_PYMALLOC_RADIX_TREE
 /*==========================================================================*/
 /* radix tree for tracking arena usage. */
 
-#define arena_map_root (_PyRuntime.obmalloc.usage.arena_map_root)
+#define arena_map_root (state->usage.arena_map_root)
 #ifdef USE_INTERIOR_NODES
-#define arena_map_mid_count (_PyRuntime.obmalloc.usage.arena_map_mid_count)
-#define arena_map_bot_count (_PyRuntime.obmalloc.usage.arena_map_bot_count)
+#define arena_map_mid_count (state->usage.arena_map_mid_count)
+#define arena_map_bot_count (state->usage.arena_map_bot_count)
 #endif
 
 /* Return a pointer to a bottom tree node, return NULL if it doesn't exist or
  * it cannot be created */
 static Py_ALWAYS_INLINE arena_map_bot_t *
-arena_map_get(pymem_block *p, int create)
+arena_map_get(OMState *state, pymem_block *p, int create)
 {
 #ifdef USE_INTERIOR_NODES
     /* sanity check that IGNORE_BITS is correct */
@@ -834,11 +859,11 @@ arena_map_get(pymem_block *p, int create)
 
 /* mark or unmark addresses covered by arena */
 static int
-arena_map_mark_used(uintptr_t arena_base, int is_used)
+arena_map_mark_used(OMState *state, uintptr_t arena_base, int is_used)
 {
     /* sanity check that IGNORE_BITS is correct */
     assert(HIGH_BITS(arena_base) == HIGH_BITS(&arena_map_root));
-    arena_map_bot_t *n_hi = arena_map_get((pymem_block *)arena_base, is_used);
+    arena_map_bot_t *n_hi = arena_map_get(state, (pymem_block *)arena_base, is_used);
     if (n_hi == NULL) {
         assert(is_used); /* otherwise node should already exist */
         return 0; /* failed to allocate space for node */
@@ -863,7 +888,7 @@ arena_map_mark_used(uintptr_t arena_base, int is_used)
          * must overflow to 0.  However, that would mean arena_base was
          * "ideal" and we should not be in this case. */
         assert(arena_base < arena_base_next);
-        arena_map_bot_t *n_lo = arena_map_get((pymem_block *)arena_base_next, is_used);
+        arena_map_bot_t *n_lo = arena_map_get(state, (pymem_block *)arena_base_next, is_used);
         if (n_lo == NULL) {
             assert(is_used); /* otherwise should already exist */
             n_hi->arenas[i3].tail_hi = 0;
@@ -878,9 +903,9 @@ arena_map_mark_used(uintptr_t arena_base, int is_used)
 /* Return true if 'p' is a pointer inside an obmalloc arena.
  * _PyObject_Free() calls this so it needs to be very fast. */
 static int
-arena_map_is_used(pymem_block *p)
+arena_map_is_used(OMState *state, pymem_block *p)
 {
-    arena_map_bot_t *n = arena_map_get(p, 0);
+    arena_map_bot_t *n = arena_map_get(state, p, 0);
     if (n == NULL) {
         return 0;
     }
@@ -903,7 +928,7 @@ arena_map_is_used(pymem_block *p)
  * `usable_arenas` to the return value.
  */
 static struct arena_object*
-new_arena(void)
+new_arena(OMState *state)
 {
     struct arena_object* arenaobj;
     uint excess;        /* number of bytes above pool alignment */
@@ -969,7 +994,7 @@ new_arena(void)
     address = _PyObject_Arena.alloc(_PyObject_Arena.ctx, ARENA_SIZE);
 #if WITH_PYMALLOC_RADIX_TREE
     if (address != NULL) {
-        if (!arena_map_mark_used((uintptr_t)address, 1)) {
+        if (!arena_map_mark_used(state, (uintptr_t)address, 1)) {
             /* marking arena in radix tree failed, abort */
             _PyObject_Arena.free(_PyObject_Arena.ctx, address, ARENA_SIZE);
             address = NULL;
@@ -1012,9 +1037,9 @@ new_arena(void)
    pymalloc.  When the radix tree is used, 'poolp' is unused.
  */
 static bool
-address_in_range(void *p, poolp Py_UNUSED(pool))
+address_in_range(OMState *state, void *p, poolp Py_UNUSED(pool))
 {
-    return arena_map_is_used(p);
+    return arena_map_is_used(state, p);
 }
 #else
 /*
@@ -1095,7 +1120,7 @@ extremely desirable that it be this fast.
 static bool _Py_NO_SANITIZE_ADDRESS
             _Py_NO_SANITIZE_THREAD
             _Py_NO_SANITIZE_MEMORY
-address_in_range(void *p, poolp pool)
+address_in_range(OMState *state, void *p, poolp pool)
 {
     // Since address_in_range may be reading from memory which was not allocated
     // by Python, it is important that pool->arenaindex is read only once, as
@@ -1112,12 +1137,12 @@ address_in_range(void *p, poolp pool)
 
 /*==========================================================================*/
 
-#define usedpools (_PyRuntime.obmalloc.pools.used)
+#define usedpools (state->pools.used)
 
 // Called when freelist is exhausted.  Extend the freelist if there is
 // space for a block.  Otherwise, remove this pool from usedpools.
 static void
-pymalloc_pool_extend(poolp pool, uint size)
+pymalloc_pool_extend(OMState *state, poolp pool, uint size)
 {
     if (UNLIKELY(pool->nextoffset <= pool->maxnextoffset)) {
         /* There is room for another block. */
@@ -1139,7 +1164,7 @@ pymalloc_pool_extend(poolp pool, uint size)
  * This function takes new pool and allocate a block from it.
  */
 static void*
-allocate_from_new_pool(uint size)
+allocate_from_new_pool(OMState *state, uint size)
 {
     /* There isn't a pool of the right size class immediately
      * available:  use a free pool.
@@ -1151,7 +1176,7 @@ allocate_from_new_pool(uint size)
             return NULL;
         }
 #endif
-        usable_arenas = new_arena();
+        usable_arenas = new_arena(state);
         if (usable_arenas == NULL) {
             return NULL;
         }
@@ -1275,7 +1300,7 @@ allocate_from_new_pool(uint size)
    or when the max memory limit has been reached.
 */
 static inline void*
-pymalloc_alloc(void *Py_UNUSED(ctx), size_t nbytes)
+pymalloc_alloc(OMState *state, void *Py_UNUSED(ctx), size_t nbytes)
 {
 #ifdef WITH_VALGRIND
     if (UNLIKELY(running_on_valgrind == -1)) {
@@ -1308,14 +1333,14 @@ pymalloc_alloc(void *Py_UNUSED(ctx), size_t nbytes)
 
         if (UNLIKELY((pool->freeblock = *(pymem_block **)bp) == NULL)) {
             // Reached the end of the free list, try to extend it.
-            pymalloc_pool_extend(pool, size);
+            pymalloc_pool_extend(state, pool, size);
         }
     }
     else {
         /* There isn't a pool of the right size class immediately
          * available:  use a free pool.
          */
-        bp = allocate_from_new_pool(size);
+        bp = allocate_from_new_pool(state, size);
     }
 
     return (void *)bp;
@@ -1325,7 +1350,8 @@ pymalloc_alloc(void *Py_UNUSED(ctx), size_t nbytes)
 void *
 _PyObject_Malloc(void *ctx, size_t nbytes)
 {
-    void* ptr = pymalloc_alloc(ctx, nbytes);
+    OMState *state = get_state();
+    void* ptr = pymalloc_alloc(state, ctx, nbytes);
     if (LIKELY(ptr != NULL)) {
         return ptr;
     }
@@ -1344,7 +1370,8 @@ _PyObject_Calloc(void *ctx, size_t nelem, size_t elsize)
     assert(elsize == 0 || nelem <= (size_t)PY_SSIZE_T_MAX / elsize);
     size_t nbytes = nelem * elsize;
 
-    void* ptr = pymalloc_alloc(ctx, nbytes);
+    OMState *state = get_state();
+    void* ptr = pymalloc_alloc(state, ctx, nbytes);
     if (LIKELY(ptr != NULL)) {
         memset(ptr, 0, nbytes);
         return ptr;
@@ -1359,7 +1386,7 @@ _PyObject_Calloc(void *ctx, size_t nelem, size_t elsize)
 
 
 static void
-insert_to_usedpool(poolp pool)
+insert_to_usedpool(OMState *state, poolp pool)
 {
     assert(pool->ref.count > 0);            /* else the pool is empty */
 
@@ -1375,7 +1402,7 @@ insert_to_usedpool(poolp pool)
 }
 
 static void
-insert_to_freepool(poolp pool)
+insert_to_freepool(OMState *state, poolp pool)
 {
     poolp next = pool->nextpool;
     poolp prev = pool->prevpool;
@@ -1458,7 +1485,7 @@ insert_to_freepool(poolp pool)
 
 #if WITH_PYMALLOC_RADIX_TREE
         /* mark arena region as not under control of obmalloc */
-        arena_map_mark_used(ao->address, 0);
+        arena_map_mark_used(state, ao->address, 0);
 #endif
 
         /* Free the entire arena. */
@@ -1545,7 +1572,7 @@ insert_to_freepool(poolp pool)
    Return 1 if it was freed.
    Return 0 if the block was not allocated by pymalloc_alloc(). */
 static inline int
-pymalloc_free(void *Py_UNUSED(ctx), void *p)
+pymalloc_free(OMState *state, void *Py_UNUSED(ctx), void *p)
 {
     assert(p != NULL);
 
@@ -1556,7 +1583,7 @@ pymalloc_free(void *Py_UNUSED(ctx), void *p)
 #endif
 
     poolp pool = POOL_ADDR(p);
-    if (UNLIKELY(!address_in_range(p, pool))) {
+    if (UNLIKELY(!address_in_range(state, p, pool))) {
         return 0;
     }
     /* We allocated this address. */
@@ -1580,7 +1607,7 @@ pymalloc_free(void *Py_UNUSED(ctx), void *p)
          * targets optimal filling when several pools contain
          * blocks of the same size class.
          */
-        insert_to_usedpool(pool);
+        insert_to_usedpool(state, pool);
         return 1;
     }
 
@@ -1597,7 +1624,7 @@ pymalloc_free(void *Py_UNUSED(ctx), void *p)
      * previously freed pools will be allocated later
      * (being not referenced, they are perhaps paged out).
      */
-    insert_to_freepool(pool);
+    insert_to_freepool(state, pool);
     return 1;
 }
 
@@ -1610,7 +1637,8 @@ _PyObject_Free(void *ctx, void *p)
         return;
     }
 
-    if (UNLIKELY(!pymalloc_free(ctx, p))) {
+    OMState *state = get_state();
+    if (UNLIKELY(!pymalloc_free(state, ctx, p))) {
         /* pymalloc didn't allocate this address */
         PyMem_RawFree(p);
         raw_allocated_blocks--;
@@ -1628,7 +1656,8 @@ _PyObject_Free(void *ctx, void *p)
 
    Return 0 if pymalloc didn't allocated p. */
 static int
-pymalloc_realloc(void *ctx, void **newptr_p, void *p, size_t nbytes)
+pymalloc_realloc(OMState *state, void *ctx,
+                 void **newptr_p, void *p, size_t nbytes)
 {
     void *bp;
     poolp pool;
@@ -1644,7 +1673,7 @@ pymalloc_realloc(void *ctx, void **newptr_p, void *p, size_t nbytes)
 #endif
 
     pool = POOL_ADDR(p);
-    if (!address_in_range(p, pool)) {
+    if (!address_in_range(state, p, pool)) {
         /* pymalloc is not managing this block.
 
            If nbytes <= SMALL_REQUEST_THRESHOLD, it's tempting to try to take
@@ -1697,13 +1726,72 @@ _PyObject_Realloc(void *ctx, void *ptr, size_t nbytes)
         return _PyObject_Malloc(ctx, nbytes);
     }
 
-    if (pymalloc_realloc(ctx, &ptr2, ptr, nbytes)) {
+    OMState *state = get_state();
+    if (pymalloc_realloc(state, ctx, &ptr2, ptr, nbytes)) {
         return ptr2;
     }
 
     return PyMem_RawRealloc(ptr, nbytes);
 }
 
+PyStatus
+_PyObject_InitState(PyInterpreterState *interp)
+{
+    assert(!_Py_IsMainInterpreter(interp));
+    OMState *state = PyMem_RawCalloc(1, sizeof(OMState));
+    if (state == NULL) {
+        return _PyStatus_NO_MEMORY();
+    }
+    state->dump_debug_stats = -1;
+    /* Same layout as _obmalloc_pools_INIT(): each usedpools[] pair is
+       the header of an empty circular list. */
+    for (uint i = 0; i < OBMALLOC_USED_POOLS_SIZE / 2; i++) {
+        poolp head = (poolp)((uint8_t *)&usedpools[2*i]
+                             - 2*sizeof(pymem_block *));
+        usedpools[2*i] = head;
+        usedpools[2*i + 1] = head;
+    }
+    interp->obmalloc = state;
+    return _PyStatus_OK();
+}
+
+void
+_PyObject_FiniState(PyInterpreterState *interp)
+{
+    OMState *state = interp->obmalloc;
+    interp->obmalloc = NULL;
+    if (state == NULL || state == &_PyRuntime.obmalloc) {
+        return;
+    }
+    if (get_num_allocated_blocks(state) != 0) {
+        /* Some objects outlived the interpreter (they were leaked).
+           Freeing the arenas would leave them dangling, so the whole
+           state is leaked instead. */
+        return;
+    }
+
+    for (uint i = 0; i < maxarenas; ++i) {
+        if (allarenas[i].address != 0) {
+            _PyObject_Arena.free(_PyObject_Arena.ctx,
+                                 (void *)allarenas[i].address, ARENA_SIZE);
+        }
+    }
+    PyMem_RawFree(allarenas);
+#if WITH_PYMALLOC_RADIX_TREE && defined(USE_INTERIOR_NODES)
+    for (int i1 = 0; i1 < MAP_TOP_LENGTH; i1++) {
+        arena_map_mid_t *mid = arena_map_root.ptrs[i1];
+        if (mid == NULL) {
+            continue;
+        }
+        for (int i2 = 0; i2 < MAP_MID_LENGTH; i2++) {
+            PyMem_RawFree(mid->ptrs[i2]);
+        }
+        PyMem_RawFree(mid);
+    }
+#endif
+    PyMem_RawFree(state);
+}
+
 #else   /* ! WITH_PYMALLOC */
 
 /*==========================================================================*/
@@ -1716,6 +1804,19 @@ _Py_GetAllocatedBlocks(void)
     return 0;
 }
 
+PyStatus
+_PyObject_InitState(PyInterpreterState *Py_UNUSED(interp))
+{
+    /* Nothing to do: every interpreter uses the system allocator. */
+    return _PyStatus_OK();
+}
+
+void
+_PyObject_FiniState(PyInterpreterState *interp)
+{
+    interp->obmalloc = NULL;
+}
+
 #endif /* WITH_PYMALLOC */
 
 
@@ -2290,6 +2391,7 @@ _PyObject_DebugMallocStats(FILE *out)
     if (!_PyMem_PymallocEnabled()) {
         return 0;
     }
+    OMState *state = get_state();
 
     uint i;
     const uint numclasses = SMALL_REQUEST_THRESHOLD >> ALIGNMENT_SHIFT;
@@ -1859,6 +1859,12 @@ set_contains(PySetObject *so, PyObject *key)
     return rv;
 }
 
+int
+_PySet_Contains(PySetObject *so, PyObject *key)
+{
+    return set_contains(so, key);
+}
+
 static PyObject *
 set_direct_contains(PySetObject *so, PyObject *key)
 {
@@ -2544,5 +2550,5 @@ static PyTypeObject _PySetDummy_Type = {
 
 static PyObject _dummy_struct = {
   _PyObject_EXTRA_INIT
-  2, &_PySetDummy_Type
+  _Py_IMMORTAL_REFCNT, &_PySetDummy_Type
 };
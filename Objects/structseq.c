@@ -587,7 +587,9 @@ _PyStructSequence_FiniType(PyTypeObject *type)
     PyMem_Free(type->tp_members);
 
     _PyStaticType_Dealloc(type);
-    assert(Py_REFCNT(type) == 1);
+    // The immortal descriptors of a type shared with interpreters having
+    // their own GIL keep their reference to it.
+    assert(Py_REFCNT(type) == 1 || _PyRuntime.types.static_types_shared);
     // Undo Py_INCREF(type) of _PyStructSequence_InitType().
     // Don't use Py_DECREF(): static type must not be deallocated
     Py_SET_REFCNT(type, 0);
@@ -44,7 +44,7 @@ class object "PyObject *" "&PyBaseObject_Type"
         PyUnicode_IS_READY(name) &&                             \
         (PyUnicode_GET_LENGTH(name) <= MCACHE_MAX_ATTR_SIZE)
 
-#define next_version_tag (_PyRuntime.types.next_version_tag)
+#define NEXT_GLOBAL_VERSION_TAG _PyRuntime.types.next_version_tag
 
 typedef struct PySlot_Offset {
     short subslot_offset;
@@ -309,6 +309,8 @@ type_cache_clear(struct type_cache *cache, PyObject *value)
 void
 _PyType_InitCache(PyInterpreterState *interp)
 {
+    interp->types.next_version_tag = _Py_TYPE_BASE_VERSION_TAG;
+
     struct type_cache *cache = &interp->types.type_cache;
     for (Py_ssize_t i = 0; i < (1 << MCACHE_SIZE_EXP); i++) {
         struct type_cache_entry *entry = &cache->hashtable[i];
@@ -343,7 +345,7 @@ _PyType_ClearCache(PyInterpreterState *interp)
     // use Py_SETREF() rather than using slower Py_XSETREF().
     type_cache_clear(cache, Py_None);
 
-    return next_version_tag - 1;
+    return interp->types.next_version_tag - 1;
 }
 
 
@@ -370,6 +372,7 @@ _PyTypes_Fini(PyInterpreterState *interp)
 
 
 static PyObject * lookup_subclasses(PyTypeObject *);
+static void share_static_type(PyTypeObject *type);
 
 int
 PyType_AddWatcher(PyType_WatchCallback callback)
@@ -574,11 +577,25 @@ assign_version_tag(PyTypeObject *type)
         return 0;
     }
 
-    if (next_version_tag == 0) {
-        /* We have run out of version numbers */
-        return 0;
+    if (!(type->tp_flags & Py_TPFLAGS_HEAPTYPE)) {
+        /* Interpreters with their own GIL can't touch the global counter;
+           the static types they use were tagged up front. */
+        PyInterpreterState *interp = _PyInterpreterState_GET();
+        if (NEXT_GLOBAL_VERSION_TAG > _Py_MAX_GLOBAL_TYPE_VERSION_TAG
+            || _PyInterpreterState_HasFeature(interp, Py_RTFLAGS_OWN_GIL))
+        {
+            return 0;
+        }
+        type->tp_version_tag = NEXT_GLOBAL_VERSION_TAG++;
+    }
+    else {
+        PyInterpreterState *interp = _PyInterpreterState_GetVersionsOwner();
+        if (interp->types.next_version_tag == 0) {
+            /* We have run out of version numbers */
+            return 0;
+        }
+        type->tp_version_tag = interp->types.next_version_tag++;
     }
-    type->tp_version_tag = next_version_tag++;
     assert (type->tp_version_tag != 0);
 
     PyObject *bases = type->tp_bases;
@@ -4507,6 +4524,19 @@ type_dealloc(PyTypeObject *type)
 }
 
 
+/* Unlike the static builtin types, other static types keep their
+   subclasses in tp_subclasses, which belongs to the main interpreter.
+   Interpreters with their own GIL neither see nor update it. */
+static inline int
+subclasses_not_owned(PyTypeObject *self)
+{
+    if (self->tp_flags & (Py_TPFLAGS_HEAPTYPE | _Py_TPFLAGS_STATIC_BUILTIN)) {
+        return 0;
+    }
+    PyInterpreterState *interp = _PyInterpreterState_GET();
+    return _PyInterpreterState_HasFeature(interp, Py_RTFLAGS_OWN_GIL);
+}
+
 static PyObject *
 lookup_subclasses(PyTypeObject *self)
 {
@@ -4515,6 +4545,9 @@ lookup_subclasses(PyTypeObject *self)
         assert(state != NULL);
         return state->tp_subclasses;
     }
+    if (subclasses_not_owned(self)) {
+        return NULL;
+    }
     return (PyObject *)self->tp_subclasses;
 }
 
@@ -6949,6 +6982,20 @@ PyType_Ready(PyTypeObject *type)
         assert(_PyType_CheckConsistency(type));
         return 0;
     }
+    if (!(type->tp_flags & Py_TPFLAGS_HEAPTYPE)
+        && _PyInterpreterState_HasFeature(_PyInterpreterState_GET(),
+                                          Py_RTFLAGS_OWN_GIL))
+    {
+        /* Static types are shared by all interpreters: let the main
+           interpreter create their dict, MRO, etc. */
+        PyThreadState *tstate = _PyThreadState_SwapToMain();
+        if (tstate == NULL) {
+            return -1;
+        }
+        int res = PyType_Ready(type);
+        _PyThreadState_SwapFromMain(tstate);
+        return res;
+    }
     _PyObject_ASSERT((PyObject *)type,
                      (type->tp_flags & Py_TPFLAGS_READYING) == 0);
 
@@ -6963,6 +7010,11 @@ PyType_Ready(PyTypeObject *type)
         type->tp_flags &= ~Py_TPFLAGS_READYING;
         return -1;
     }
+    if (!(type->tp_flags & Py_TPFLAGS_HEAPTYPE)
+        && _PyRuntime.types.static_types_shared)
+    {
+        share_static_type(type);
+    }
 
     /* All done -- set the ready flag */
     type->tp_flags = (type->tp_flags & ~Py_TPFLAGS_READYING) | Py_TPFLAGS_READY;
@@ -6985,6 +7037,101 @@ _PyStaticType_InitBuiltin(PyTypeObject *self)
 }
 
 
+/* Interpreters with their own GIL use the static types concurrently with
+   the main interpreter, which owns the objects the types refer to.  So
+   that none of them is ever incref'ed or decref'ed concurrently, they are
+   all made immortal, and the types get their version tag up front. */
+
+static void
+share_static_object(PyObject *op)
+{
+    /* Static types are never deallocated, but some of them are
+       finalized with a sanity check of their refcount. */
+    if (op == NULL || PyType_Check(op)) {
+        return;
+    }
+    _Py_SetImmortal(op);
+    if (PyTuple_CheckExact(op)) {
+        for (Py_ssize_t i = 0; i < PyTuple_GET_SIZE(op); i++) {
+            share_static_object(PyTuple_GET_ITEM(op, i));
+        }
+    }
+}
+
+static void
+share_static_type(PyTypeObject *type)
+{
+    assert(!(type->tp_flags & Py_TPFLAGS_HEAPTYPE));
+    PyObject *dict = type->tp_dict;
+    if (dict != NULL) {
+        share_static_object(dict);
+        Py_ssize_t i = 0;
+        PyObject *key, *value;
+        while (PyDict_Next(dict, &i, &key, &value)) {
+            share_static_object(key);
+            share_static_object(value);
+        }
+    }
+    share_static_object(type->tp_bases);
+    share_static_object(type->tp_mro);
+    (void)assign_version_tag(type);
+}
+
+static void
+share_static_subclasses(PyInterpreterState *interp, PyTypeObject *type)
+{
+    PyObject *subclasses;
+    if (type->tp_flags & _Py_TPFLAGS_STATIC_BUILTIN) {
+        subclasses = static_builtin_state_get(interp, type)->tp_subclasses;
+    }
+    else {
+        subclasses = type->tp_subclasses;
+    }
+    if (subclasses == NULL) {
+        return;
+    }
+    Py_ssize_t i = 0;
+    PyObject *key, *ref;  // borrowed refs
+    while (PyDict_Next(subclasses, &i, &key, &ref)) {
+        PyTypeObject *subclass = subclass_from_ref(ref);  // borrowed
+        if (subclass == NULL || subclass->tp_flags & Py_TPFLAGS_HEAPTYPE) {
+            continue;
+        }
+        share_static_type(subclass);
+        share_static_subclasses(interp, subclass);
+    }
+}
+
+/* Called before the first interpreter with its own GIL is created, so all
+   the existing interpreters share the main GIL.  Static types readied
+   later on are shared by PyType_Ready(). */
+void
+_PyStaticType_ShareAll(void)
+{
+    if (_PyRuntime.types.static_types_shared) {
+        return;
+    }
+    /* Only interpreters sharing the main GIL exist at this point. */
+    PyThreadState *tstate = _PyThreadState_GET();
+    PyGILState_STATE gilstate = PyGILState_LOCKED;
+    if (tstate == NULL) {
+        gilstate = PyGILState_Ensure();
+    }
+    if (!_PyRuntime.types.static_types_shared) {
+        _PyRuntime.types.static_types_shared = 1;
+
+        share_static_type(&PyBaseObject_Type);
+        PyInterpreterState *interp = PyInterpreterState_Head();
+        for (; interp != NULL; interp = PyInterpreterState_Next(interp)) {
+            share_static_subclasses(interp, &PyBaseObject_Type);
+        }
+    }
+    if (tstate == NULL) {
+        PyGILState_Release(gilstate);
+    }
+}
+
+
 static PyObject *
 init_subclasses(PyTypeObject *self)
 {
@@ -7018,6 +7165,10 @@ clear_subclasses(PyTypeObject *self)
 static int
 add_subclass(PyTypeObject *base, PyTypeObject *type)
 {
+    if (subclasses_not_owned(base)) {
+        return 0;
+    }
+
     PyObject *key = PyLong_FromVoidPtr((void *) type);
     if (key == NULL)
         return -1;
@@ -9318,42 +9469,33 @@ super_repr(PyObject *self)
             su->type ? su->type->tp_name : "NULL");
 }
 
-static PyObject *
-super_getattro(PyObject *self, PyObject *name)
+/* Look up name in the MRO of su_obj_type, starting after su_type.
+   Returns a new reference to the raw (unbound) class attribute,
+   or NULL, with an exception set only if the lookup failed. */
+PyObject *
+_PySuper_LookupDescr(PyTypeObject *su_type, PyTypeObject *su_obj_type,
+                     PyObject *name)
 {
-    superobject *su = (superobject *)self;
-    PyTypeObject *starttype;
-    PyObject *mro;
+    PyObject *mro, *res;
     Py_ssize_t i, n;
 
-    starttype = su->obj_type;
-    if (starttype == NULL)
-        goto skip;
-
-    /* We want __class__ to return the class of the super object
-       (i.e. super, or a subclass), not the class of su->obj. */
-    if (PyUnicode_Check(name) &&
-        PyUnicode_GET_LENGTH(name) == 9 &&
-        _PyUnicode_Equal(name, &_Py_ID(__class__)))
-        goto skip;
-
-    mro = starttype->tp_mro;
+    mro = su_obj_type->tp_mro;
     if (mro == NULL)
-        goto skip;
+        return NULL;
 
     assert(PyTuple_Check(mro));
     n = PyTuple_GET_SIZE(mro);
 
     /* No need to check the last one: it's gonna be skipped anyway.  */
     for (i = 0; i+1 < n; i++) {
-        if ((PyObject *)(su->type) == PyTuple_GET_ITEM(mro, i))
+        if ((PyObject *)(su_type) == PyTuple_GET_ITEM(mro, i))
             break;
     }
     i++;  /* skip su->type (if any)  */
     if (i >= n)
-        goto skip;
+        return NULL;
 
-    /* keep a strong reference to mro because starttype->tp_mro can be
+    /* keep a strong reference to mro because su_obj_type->tp_mro can be
        replaced during PyDict_GetItemWithError(dict, name)  */
     Py_INCREF(mro);
     do {
@@ -9361,35 +9503,92 @@ super_getattro(PyObject *self, PyObject *name)
         PyObject *dict = _PyType_CAST(obj)->tp_dict;
         assert(dict != NULL && PyDict_Check(dict));
 
-        PyObject *res = PyDict_GetItemWithError(dict, name);
+        res = PyDict_GetItemWithError(dict, name);
         if (res != NULL) {
             Py_INCREF(res);
+            Py_DECREF(mro);
+            return res;
+        }
+        else if (PyErr_Occurred()) {
+            Py_DECREF(mro);
+            return NULL;
+        }
 
+        i++;
+    } while (i < n);
+    Py_DECREF(mro);
+    return NULL;
+}
+
+/* If method is not NULL and the attribute found is a method descriptor,
+   return it unbound and set *method to 1, like _PyObject_GetMethod().
+   su may be NULL, in which case a temporary super object is only created
+   if the attribute is not found in the MRO. */
+static PyObject *
+do_super_lookup(superobject *su, PyTypeObject *su_type, PyObject *su_obj,
+                PyTypeObject *su_obj_type, PyObject *name, int *method)
+{
+    PyObject *res;
+    int temp_su = 0;
+
+    if (su_obj_type == NULL) {
+        goto skip;
+    }
+
+    res = _PySuper_LookupDescr(su_type, su_obj_type, name);
+    if (res != NULL) {
+        if (method && _PyType_HasFeature(Py_TYPE(res),
+                                         Py_TPFLAGS_METHOD_DESCRIPTOR)) {
+            *method = 1;
+        }
+        else {
             descrgetfunc f = Py_TYPE(res)->tp_descr_get;
             if (f != NULL) {
                 PyObject *res2;
                 res2 = f(res,
                     /* Only pass 'obj' param if this is instance-mode super
                        (See SF ID #743627)  */
-                    (su->obj == (PyObject *)starttype) ? NULL : su->obj,
-                    (PyObject *)starttype);
+                    (su_obj == (PyObject *)su_obj_type) ? NULL : su_obj,
+                    (PyObject *)su_obj_type);
                 Py_SETREF(res, res2);
             }
-
-            Py_DECREF(mro);
-            return res;
         }
-        else if (PyErr_Occurred()) {
-            Py_DECREF(mro);
+        return res;
+    }
+    else if (PyErr_Occurred()) {
+        return NULL;
+    }
+
+  skip:
+    if (su == NULL) {
+        PyObject *args[] = {(PyObject *)su_type, su_obj};
+        su = (superobject *)PyObject_Vectorcall((PyObject *)&PySuper_Type,
+                                                args, 2, NULL);
+        if (su == NULL) {
             return NULL;
         }
+        temp_su = 1;
+    }
+    res = PyObject_GenericGetAttr((PyObject *)su, name);
+    if (temp_su) {
+        Py_DECREF(su);
+    }
+    return res;
+}
 
-        i++;
-    } while (i < n);
-    Py_DECREF(mro);
+static PyObject *
+super_getattro(PyObject *self, PyObject *name)
+{
+    superobject *su = (superobject *)self;
 
-  skip:
-    return PyObject_GenericGetAttr(self, name);
+    /* We want __class__ to return the class of the super object
+       (i.e. super, or a subclass), not the class of su->obj. */
+    if (PyUnicode_Check(name) &&
+        PyUnicode_GET_LENGTH(name) == 9 &&
+        _PyUnicode_Equal(name, &_Py_ID(__class__)))
+        return PyObject_GenericGetAttr(self, name);
+
+    return do_super_lookup(su, su->type, su->obj, su->obj_type, name, NULL);
 }
 
 static PyTypeObject *
@@ -9445,6 +9644,22 @@ supercheck(PyTypeObject *type, PyObject *obj)
     return NULL;
 }
 
+/* Equivalent to getattr(super(su_type, su_obj), name), without creating
+   the super object. See do_super_lookup() for the meaning of method. */
+PyObject *
+_PySuper_Lookup(PyTypeObject *su_type, PyObject *su_obj, PyObject *name,
+                int *method)
+{
+    PyTypeObject *su_obj_type = supercheck(su_type, su_obj);
+    if (su_obj_type == NULL) {
+        return NULL;
+    }
+    PyObject *res = do_super_lookup(NULL, su_type, su_obj, su_obj_type,
+                                    name, method);
+    Py_DECREF(su_obj_type);
+    return res;
+}
+
 static PyObject *
 super_descr_get(PyObject *self, PyObject *obj, PyObject *type)
 {
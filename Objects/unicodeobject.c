@@ -224,20 +224,32 @@ static inline PyObject* unicode_new_empty(void)
     return Py_NewRef(empty);
 }
 
-/* This dictionary holds all interned unicode strings.  Note that references
-   to strings in this dictionary are *not* counted in the string's ob_refcnt.
-   When the interned string reaches a refcnt of 0 the string deallocation
-   function will delete the reference from this dictionary.
-   Another way to look at this is that to say that the actual reference
-   count of a string is:  s->ob_refcnt + (s->state ? 2 : 0)
+/* This dictionary holds all interned unicode strings.  Interned strings
+   are immortal (see _Py_IsImmortal()), so the references held by the
+   dictionary are never released while the interpreter runs.  Strings which
+   were made immortal by PyUnicode_InternInPlace() are SSTATE_INTERNED_IMMORTAL;
+   statically allocated strings, which are immortal from the start, are
+   SSTATE_INTERNED_IMMORTAL_STATIC.  _PyUnicode_ClearInterned() makes the
+   former mortal again at exit.
+
+   An interpreter with its own GIL has its own dictionary, which also holds
+   the statically allocated strings (see _PyUnicode_InternStatic()).
 */
-static inline PyObject *get_interned_dict(void)
+static inline PyObject *get_interned_dict(PyInterpreterState *interp)
 {
+    if (_PyInterpreterState_HasFeature(interp, Py_RTFLAGS_OWN_GIL)) {
+        return interp->unicode.interned;
+    }
     return _PyRuntime.global_objects.interned;
 }
 
-static inline void set_interned_dict(PyObject *dict)
+static inline void set_interned_dict(PyInterpreterState *interp,
+                                     PyObject *dict)
 {
+    if (_PyInterpreterState_HasFeature(interp, Py_RTFLAGS_OWN_GIL)) {
+        interp->unicode.interned = dict;
+        return;
+    }
     _PyRuntime.global_objects.interned = dict;
 }
 
@@ -1528,21 +1540,10 @@ unicode_dealloc(PyObject *unicode)
         _Py_FatalRefcountError("deallocating an Unicode singleton");
     }
 #endif
-    PyObject *interned = get_interned_dict();
+    /* Interned strings are immortal until _PyUnicode_ClearInterned()
+       resets their state, so they can never be deallocated here. */
     if (PyUnicode_CHECK_INTERNED(unicode)) {
-        /* Revive the dead object temporarily. PyDict_DelItem() removes two
-           references (key and value) which were ignored by
-           PyUnicode_InternInPlace(). Use refcnt=3 rather than refcnt=2
-           to prevent calling unicode_dealloc() again. Adjust refcnt after
-           PyDict_DelItem(). */
-        assert(Py_REFCNT(unicode) == 0);
-        Py_SET_REFCNT(unicode, 3);
-        if (PyDict_DelItem(interned, unicode) != 0) {
-            _PyErr_WriteUnraisableMsg("deletion of interned string failed",
-                                      NULL);
-        }
-        assert(Py_REFCNT(unicode) == 1);
-        Py_SET_REFCNT(unicode, 0);
+        _Py_FatalRefcountError("deallocating an interned string");
     }
 
     if (_PyUnicode_HAS_UTF8_MEMORY(unicode)) {
@@ -9556,6 +9557,56 @@ _PyUnicode_JoinArray(PyObject *separator, PyObject *const *items, Py_ssize_t seq
     return NULL;
 }
 
+/* Like _PyUnicode_JoinArray() with an empty separator, but sized in a
+   single pass and copying each item with memcpy() when its kind matches
+   the kind of the result, instead of requiring all kinds to match. */
+PyObject *
+_PyUnicode_BuildString(PyObject *const *items, Py_ssize_t nitems)
+{
+    if (nitems == 1 && PyUnicode_CheckExact(items[0])) {
+        return Py_NewRef(items[0]);
+    }
+
+    Py_ssize_t length = 0;
+    Py_UCS4 maxchar = 0;
+    for (Py_ssize_t i = 0; i < nitems; i++) {
+        PyObject *item = items[i];
+        if (!PyUnicode_Check(item) ||
+            PyUnicode_GET_LENGTH(item) > PY_SSIZE_T_MAX - length)
+        {
+            /* Let the general implementation raise the error */
+            return _PyUnicode_JoinArray(&_Py_STR(empty), items, nitems);
+        }
+        length += PyUnicode_GET_LENGTH(item);
+        maxchar = Py_MAX(maxchar, PyUnicode_MAX_CHAR_VALUE(item));
+    }
+
+    PyObject *res = PyUnicode_New(length, maxchar);
+    if (res == NULL) {
+        return NULL;
+    }
+    int kind = PyUnicode_KIND(res);
+    char *data = PyUnicode_DATA(res);
+    Py_ssize_t pos = 0;
+    for (Py_ssize_t i = 0; i < nitems; i++) {
+        PyObject *item = items[i];
+        Py_ssize_t itemlen = PyUnicode_GET_LENGTH(item);
+        if (itemlen == 0) {
+            continue;
+        }
+        if (PyUnicode_KIND(item) == kind) {
+            memcpy(data + kind * pos, PyUnicode_DATA(item), kind * itemlen);
+        }
+        else {
+            _PyUnicode_FastCopyCharacters(res, pos, item, 0, itemlen);
+        }
+        pos += itemlen;
+    }
+    assert(pos == length);
+    assert(_PyUnicode_CheckConsistency(res, 1));
+    return res;
+}
+
 void
 _PyUnicode_FastFill(PyObject *unicode, Py_ssize_t start, Py_ssize_t length,
                     Py_UCS4 fill_char)
@@ -14532,6 +14583,17 @@ _PyUnicode_InitState(PyInterpreterState *interp)
 PyStatus
 _PyUnicode_InitGlobalObjects(PyInterpreterState *interp)
 {
+    if (_PyInterpreterState_HasFeature(interp, Py_RTFLAGS_OWN_GIL)) {
+        /* The static strings are already initialized and interned by
+           the main interpreter; add them to our own interned dict. */
+        PyObject *interned = PyDict_New();
+        if (interned == NULL) {
+            return _PyStatus_NO_MEMORY();
+        }
+        set_interned_dict(interp, interned);
+        _PyUnicode_InitStaticStrings(interp);
+        return _PyStatus_OK();
+    }
     if (!_Py_IsMainInterpreter(interp)) {
         return _PyStatus_OK();
     }
@@ -14542,7 +14604,7 @@ _PyUnicode_InitGlobalObjects(PyInterpreterState *interp)
      * Deepfreeze uses the interned identifiers if present to save space
      * else generates them and they are interned to speed up dict lookups.
     */
-    _PyUnicode_InitStaticStrings();
+    _PyUnicode_InitStaticStrings(interp);
 
 #ifdef Py_DEBUG
     assert(_PyUnicode_CheckConsistency(&_Py_STR(empty), 1));
@@ -14602,14 +14664,15 @@ PyUnicode_InternInPlace(PyObject **p)
         return;
     }
 
-    PyObject *interned = get_interned_dict();
+    PyInterpreterState *interp = _PyInterpreterState_GET();
+    PyObject *interned = get_interned_dict(interp);
     if (interned == NULL) {
         interned = PyDict_New();
         if (interned == NULL) {
             PyErr_Clear(); /* Don't leave an exception */
             return;
         }
-        set_interned_dict(interned);
+        set_interned_dict(interp, interned);
     }
 
     PyObject *t = PyDict_SetDefault(interned, s, s);
@@ -14623,11 +14686,36 @@ PyUnicode_InternInPlace(PyObject **p)
         return;
     }
 
-    /* The two references in interned dict (key and value) are not counted by
-       refcnt. unicode_dealloc() and _PyUnicode_ClearInterned() take care of
-       this. */
-    Py_SET_REFCNT(s, Py_REFCNT(s) - 2);
-    _PyUnicode_STATE(s).interned = 1;
+    /* Interned strings live until the interned dict is cleared, so make them
+       immortal: the two references in the interned dict (key and value) and
+       every reference taken afterwards no longer touch ob_refcnt.
+       _PyUnicode_ClearInterned() makes them mortal again. */
+    if (_Py_IsImmortal(s)) {
+        _PyUnicode_STATE(s).interned = SSTATE_INTERNED_IMMORTAL_STATIC;
+        return;
+    }
+    _Py_SetImmortal(s);
+    _PyUnicode_STATE(s).interned = SSTATE_INTERNED_IMMORTAL;
+}
+
+/* Intern a statically allocated string.  Unlike PyUnicode_InternInPlace(),
+   this adds the string to the interned dict of an interpreter with its own
+   GIL even though the main interpreter interned it already. */
+void
+_PyUnicode_InternStatic(PyInterpreterState *interp, PyObject **p)
+{
+    PyObject *s = *p;
+    assert(_Py_IsImmortal(s));
+    if (!_PyInterpreterState_HasFeature(interp, Py_RTFLAGS_OWN_GIL)) {
+        PyUnicode_InternInPlace(p);
+        return;
+    }
+    assert(PyUnicode_CHECK_INTERNED(s) == SSTATE_INTERNED_IMMORTAL_STATIC);
+    PyObject *interned = get_interned_dict(interp);
+    assert(interned != NULL);
+    if (PyDict_SetDefault(interned, s, s) == NULL) {
+        PyErr_Clear();
+    }
 }
 
 // Function kept for the stable ABI.
@@ -14654,20 +14742,27 @@ PyUnicode_InternFromString(const char *cp)
 void
 _PyUnicode_ClearInterned(PyInterpreterState *interp)
 {
-    if (!_Py_IsMainInterpreter(interp)) {
-        // interned dict is shared by all interpreters
+    int own_interned = _PyInterpreterState_HasFeature(interp,
+                                                      Py_RTFLAGS_OWN_GIL);
+    if (!_Py_IsMainInterpreter(interp) && !own_interned) {
+        // the interned dict is shared with the main interpreter
         return;
     }
 
-    PyObject *interned = get_interned_dict();
+    // Identifiers are interned: release them while they are still immortal,
+    // before the interned strings are deallocated below.
+    unicode_clear_identifiers(&interp->unicode);
+
+    PyObject *interned = get_interned_dict(interp);
     if (interned == NULL) {
         return;
     }
     assert(PyDict_CheckExact(interned));
 
-    /* Interned unicode strings are not forcibly deallocated; rather, we give
-       them their stolen references back, and then clear and DECREF the
-       interned dict. */
+    /* Interned unicode strings are not forcibly deallocated; rather, we make
+       them mortal again, owning only the two references (key and value) of
+       the interned dict, and then clear and DECREF the interned dict.
+       Statically allocated strings stay immortal. */
 
 #ifdef INTERNED_STATS
     fprintf(stderr, "releasing %zd interned strings\n",
@@ -14678,10 +14773,23 @@ _PyUnicode_ClearInterned(PyInterpreterState *interp)
     Py_ssize_t pos = 0;
     PyObject *s, *ignored_value;
     while (PyDict_Next(interned, &pos, &s, &ignored_value)) {
-        assert(PyUnicode_CHECK_INTERNED(s));
-        // Restore the two references (key and value) ignored
-        // by PyUnicode_InternInPlace().
-        Py_SET_REFCNT(s, Py_REFCNT(s) + 2);
+        switch (PyUnicode_CHECK_INTERNED(s)) {
+        case SSTATE_INTERNED_IMMORTAL:
+            // Py_SET_REFCNT() ignores immortal objects.
+            s->ob_refcnt = 2;
+#ifdef Py_REF_DEBUG
+            _Py_RefTotal += 2;
+#endif
+            break;
+        case SSTATE_INTERNED_IMMORTAL_STATIC:
+            if (own_interned) {
+                // still interned by the main interpreter
+                continue;
+            }
+            break;
+        default:
+            Py_UNREACHABLE();
+        }
 #ifdef INTERNED_STATS
         total_length += PyUnicode_GET_LENGTH(s);
 #endif
@@ -14696,7 +14804,7 @@ _PyUnicode_ClearInterned(PyInterpreterState *interp)
 
     PyDict_Clear(interned);
     Py_DECREF(interned);
-    set_interned_dict(NULL);
+    set_interned_dict(interp, NULL);
 }
 
 
@@ -15102,7 +15210,7 @@ _PyUnicode_EnableLegacyWindowsFSEncoding(void)
 static inline int
 unicode_is_finalizing(void)
 {
-    return (get_interned_dict() == NULL);
+    return (_PyRuntime.global_objects.interned == NULL);
 }
 #endif
 
@@ -15127,7 +15235,7 @@ _PyUnicode_Fini(PyInterpreterState *interp)
 
     if (_Py_IsMainInterpreter(interp)) {
         // _PyUnicode_ClearInterned() must be called before _PyUnicode_Fini()
-        assert(get_interned_dict() == NULL);
+        assert(get_interned_dict(interp) == NULL);
         // bpo-47182: force a unicodedata CAPI capsule re-import on
         // subsequent initialization of main interpreter.
     }
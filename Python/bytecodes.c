@@ -11,7 +11,9 @@
 #include "pycore_call.h"          // _PyObject_FastCallDictTstate()
 #include "pycore_ceval.h"         // _PyEval_SignalAsyncExc()
 #include "pycore_code.h"
+#include "pycore_enumobject.h"    // _PyEnum_NextPair()
 #include "pycore_function.h"
+#include "pycore_instruments.h"   // _Py_call_instrumentation()
 #include "pycore_long.h"          // _PyLong_GetZero()
 #include "pycore_object.h"        // _PyObject_GC_TRACK()
 #include "pycore_moduleobject.h"  // PyModuleObject
@@ -23,6 +25,8 @@
 #include "pycore_sliceobject.h"   // _PyBuildSlice_ConsumeRefs
 #include "pycore_sysmodule.h"     // _PySys_Audit()
 #include "pycore_tuple.h"         // _PyTuple_ITEMS()
+#include "pycore_jit.h"           // _PyJITFunction
+#include "pycore_uops.h"          // _PyUopExecute()
 #include "pycore_emscripten_signal.h"  // _Py_CHECK_EMSCRIPTEN_SIGNALS
 
 #include "pycore_dict.h"
@@ -68,6 +72,7 @@ do { \
 #define JUMPBY(offset) ((void)0)
 #define GO_TO_INSTRUCTION(instname) ((void)0)
 #define DISPATCH_SAME_OPARG() ((void)0)
+#define JUMP_TO_UOP(index) ((void)0)
 
 #define inst(name, ...) case name:
 #define op(name, ...) /* NAME is ignored */
@@ -82,7 +87,7 @@ do { \
 static PyObject *value, *value1, *value2, *left, *right, *res, *sum, *prod, *sub;
 static PyObject *container, *start, *stop, *v, *lhs, *rhs;
 static PyObject *list, *tuple, *dict, *owner;
-static PyObject *exit_func, *lasti, *val, *retval, *obj, *iter;
+static PyObject *exit_func, *lasti, *val, *retval, *obj, *iter, *cond, *next;
 static size_t jump;
 // Dummy variables for cache effects
 static _Py_CODEUNIT when_to_jump_mask, invert, counter, index, hint;
@@ -92,6 +97,17 @@ static uint32_t type_version;
 #define _COMPARE_OP_INT 1004
 #define _COMPARE_OP_STR 1005
 #define _JUMP_IF 1006
+#define _GUARD_BOTH_INT 1007
+#define _BINARY_OP_MULTIPLY_INT 1008
+#define _BINARY_OP_ADD_INT 1009
+#define _BINARY_OP_SUBTRACT_INT 1010
+#define _GUARD_BOTH_FLOAT 1011
+#define _BINARY_OP_MULTIPLY_FLOAT 1012
+#define _BINARY_OP_ADD_FLOAT 1013
+#define _BINARY_OP_SUBTRACT_FLOAT 1014
+#define _GUARD_BOTH_UNICODE 1015
+#define _BINARY_OP_ADD_UNICODE 1016
+static int unused;
 
 static PyObject *
 dummy_func(
@@ -121,6 +137,35 @@ dummy_func(
         inst(RESUME, (--)) {
             assert(tstate->cframe == &cframe);
             assert(frame == cframe.current_frame);
+            if (frame->f_code->_co_instrumentation_version !=
+                tstate->interp->monitoring.version)
+            {
+                int err = _Py_Instrument(frame->f_code, tstate->interp);
+                ERROR_IF(err, error);
+                if (_Py_OPCODE(next_instr[-1]) == INSTRUMENTED_RESUME) {
+                    GO_TO_INSTRUCTION(INSTRUMENTED_RESUME);
+                }
+            }
+            if (_Py_atomic_load_relaxed_int32(eval_breaker) && oparg < 2) {
+                goto handle_eval_breaker;
+            }
+        }
+
+        inst(INSTRUMENTED_RESUME, (--)) {
+            if (frame->f_code->_co_instrumentation_version !=
+                tstate->interp->monitoring.version)
+            {
+                int err = _Py_Instrument(frame->f_code, tstate->interp);
+                ERROR_IF(err, error);
+                if (_Py_OPCODE(next_instr[-1]) == RESUME) {
+                    GO_TO_INSTRUCTION(RESUME);
+                }
+            }
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            int err = _Py_call_instrumentation(
+                tstate, PY_MONITORING_EVENT_PY_START, frame, next_instr - 1);
+            stack_pointer = _PyFrame_GetStackPointer(frame);
+            ERROR_IF(err, error);
             if (_Py_atomic_load_relaxed_int32(eval_breaker) && oparg < 2) {
                 goto handle_eval_breaker;
             }
@@ -145,6 +190,12 @@ dummy_func(
             Py_INCREF(value);
         }
 
+        inst(LOAD_FAST_AND_CLEAR, (-- value)) {
+            value = GETLOCAL(oparg);
+            // do not use SETLOCAL here, it decrefs the old value
+            GETLOCAL(oparg) = NULL;
+        }
+
         inst(LOAD_CONST, (-- value)) {
             value = GETITEM(consts, oparg);
             Py_INCREF(value);
@@ -154,11 +205,8 @@ dummy_func(
             SETLOCAL(oparg, value);
         }
 
-        super(LOAD_FAST__LOAD_FAST) = LOAD_FAST + LOAD_FAST;
-        super(LOAD_FAST__LOAD_CONST) = LOAD_FAST + LOAD_CONST;
-        super(STORE_FAST__LOAD_FAST)  = STORE_FAST + LOAD_FAST;
-        super(STORE_FAST__STORE_FAST) = STORE_FAST + STORE_FAST;
-        super(LOAD_CONST__LOAD_FAST) = LOAD_CONST + LOAD_FAST;
+        // The superinstructions for pairs of simple instructions like these
+        // (LOAD_FAST__LOAD_FAST and so on) are listed in Lib/opcode.py.
 
         inst(POP_TOP, (value --)) {
             Py_DECREF(value);
@@ -170,6 +218,10 @@ dummy_func(
 
         macro(END_FOR) = POP_TOP + POP_TOP;
 
+        inst(END_SEND, (receiver, value -- value)) {
+            Py_DECREF(receiver);
+        }
+
         inst(UNARY_POSITIVE, (value -- res)) {
             res = PyNumber_Positive(value);
             Py_DECREF(value);
@@ -214,10 +266,13 @@ dummy_func(
         };
 
 
-        inst(BINARY_OP_MULTIPLY_INT, (unused/1, left, right -- prod)) {
+        op(_GUARD_BOTH_INT, (left, right -- left, right)) {
             assert(cframe.use_tracing == 0);
             DEOPT_IF(!PyLong_CheckExact(left), BINARY_OP);
             DEOPT_IF(!PyLong_CheckExact(right), BINARY_OP);
+        }
+
+        op(_BINARY_OP_MULTIPLY_INT, (left, right -- prod)) {
             STAT_INC(BINARY_OP, hit);
             prod = _PyLong_Multiply((PyLongObject *)left, (PyLongObject *)right);
             _Py_DECREF_SPECIALIZED(right, (destructor)PyObject_Free);
@@ -225,10 +280,39 @@ dummy_func(
             ERROR_IF(prod == NULL, error);
         }
 
-        inst(BINARY_OP_MULTIPLY_FLOAT, (unused/1, left, right -- prod)) {
+        op(_BINARY_OP_ADD_INT, (left, right -- sum)) {
+            STAT_INC(BINARY_OP, hit);
+            sum = _PyLong_Add((PyLongObject *)left, (PyLongObject *)right);
+            _Py_DECREF_SPECIALIZED(right, (destructor)PyObject_Free);
+            _Py_DECREF_SPECIALIZED(left, (destructor)PyObject_Free);
+            ERROR_IF(sum == NULL, error);
+        }
+
+        op(_BINARY_OP_SUBTRACT_INT, (left, right -- sub)) {
+            STAT_INC(BINARY_OP, hit);
+            sub = _PyLong_Subtract((PyLongObject *)left, (PyLongObject *)right);
+            _Py_DECREF_SPECIALIZED(right, (destructor)PyObject_Free);
+            _Py_DECREF_SPECIALIZED(left, (destructor)PyObject_Free);
+            ERROR_IF(sub == NULL, error);
+        }
+
+        // The type guards are separate ops so that the tier-2 optimizer
+        // can drop the ones that an earlier guard in a trace already made
+        // redundant (see Python/optimizer.c).
+        macro(BINARY_OP_MULTIPLY_INT) =
+            _GUARD_BOTH_INT + unused/1 + _BINARY_OP_MULTIPLY_INT;
+        macro(BINARY_OP_ADD_INT) =
+            _GUARD_BOTH_INT + unused/1 + _BINARY_OP_ADD_INT;
+        macro(BINARY_OP_SUBTRACT_INT) =
+            _GUARD_BOTH_INT + unused/1 + _BINARY_OP_SUBTRACT_INT;
+
+        op(_GUARD_BOTH_FLOAT, (left, right -- left, right)) {
             assert(cframe.use_tracing == 0);
             DEOPT_IF(!PyFloat_CheckExact(left), BINARY_OP);
             DEOPT_IF(!PyFloat_CheckExact(right), BINARY_OP);
+        }
+
+        op(_BINARY_OP_MULTIPLY_FLOAT, (left, right -- prod)) {
             STAT_INC(BINARY_OP, hit);
             double dprod = ((PyFloatObject *)left)->ob_fval *
                 ((PyFloatObject *)right)->ob_fval;
@@ -238,21 +322,17 @@ dummy_func(
             ERROR_IF(prod == NULL, error);
         }
 
-        inst(BINARY_OP_SUBTRACT_INT, (unused/1, left, right -- sub)) {
-            assert(cframe.use_tracing == 0);
-            DEOPT_IF(!PyLong_CheckExact(left), BINARY_OP);
-            DEOPT_IF(!PyLong_CheckExact(right), BINARY_OP);
+        op(_BINARY_OP_ADD_FLOAT, (left, right -- sum)) {
             STAT_INC(BINARY_OP, hit);
-            sub = _PyLong_Subtract((PyLongObject *)left, (PyLongObject *)right);
-            _Py_DECREF_SPECIALIZED(right, (destructor)PyObject_Free);
-            _Py_DECREF_SPECIALIZED(left, (destructor)PyObject_Free);
-            ERROR_IF(sub == NULL, error);
+            double dsum = ((PyFloatObject *)left)->ob_fval +
+                ((PyFloatObject *)right)->ob_fval;
+            sum = PyFloat_FromDouble(dsum);
+            _Py_DECREF_SPECIALIZED(right, _PyFloat_ExactDealloc);
+            _Py_DECREF_SPECIALIZED(left, _PyFloat_ExactDealloc);
+            ERROR_IF(sum == NULL, error);
         }
 
-        inst(BINARY_OP_SUBTRACT_FLOAT, (unused/1, left, right -- sub)) {
-            assert(cframe.use_tracing == 0);
-            DEOPT_IF(!PyFloat_CheckExact(left), BINARY_OP);
-            DEOPT_IF(!PyFloat_CheckExact(right), BINARY_OP);
+        op(_BINARY_OP_SUBTRACT_FLOAT, (left, right -- sub)) {
             STAT_INC(BINARY_OP, hit);
             double dsub = ((PyFloatObject *)left)->ob_fval - ((PyFloatObject *)right)->ob_fval;
             sub = PyFloat_FromDouble(dsub);
@@ -261,10 +341,20 @@ dummy_func(
             ERROR_IF(sub == NULL, error);
         }
 
-        inst(BINARY_OP_ADD_UNICODE, (unused/1, left, right -- res)) {
+        macro(BINARY_OP_MULTIPLY_FLOAT) =
+            _GUARD_BOTH_FLOAT + unused/1 + _BINARY_OP_MULTIPLY_FLOAT;
+        macro(BINARY_OP_ADD_FLOAT) =
+            _GUARD_BOTH_FLOAT + unused/1 + _BINARY_OP_ADD_FLOAT;
+        macro(BINARY_OP_SUBTRACT_FLOAT) =
+            _GUARD_BOTH_FLOAT + unused/1 + _BINARY_OP_SUBTRACT_FLOAT;
+
+        op(_GUARD_BOTH_UNICODE, (left, right -- left, right)) {
             assert(cframe.use_tracing == 0);
             DEOPT_IF(!PyUnicode_CheckExact(left), BINARY_OP);
-            DEOPT_IF(Py_TYPE(right) != Py_TYPE(left), BINARY_OP);
+            DEOPT_IF(!PyUnicode_CheckExact(right), BINARY_OP);
+        }
+
+        op(_BINARY_OP_ADD_UNICODE, (left, right -- res)) {
             STAT_INC(BINARY_OP, hit);
             res = PyUnicode_Concat(left, right);
             _Py_DECREF_SPECIALIZED(left, _PyUnicode_ExactDealloc);
@@ -272,6 +362,9 @@ dummy_func(
             ERROR_IF(res == NULL, error);
         }
 
+        macro(BINARY_OP_ADD_UNICODE) =
+            _GUARD_BOTH_UNICODE + unused/1 + _BINARY_OP_ADD_UNICODE;
+
         // This is a subtle one. It's a super-instruction for
         // BINARY_OP_ADD_UNICODE followed by STORE_FAST
         // where the store goes into the left argument.
@@ -283,8 +376,7 @@ dummy_func(
             DEOPT_IF(!PyUnicode_CheckExact(left), BINARY_OP);
             DEOPT_IF(Py_TYPE(right) != Py_TYPE(left), BINARY_OP);
             _Py_CODEUNIT true_next = next_instr[INLINE_CACHE_ENTRIES_BINARY_OP];
-            assert(_Py_OPCODE(true_next) == STORE_FAST ||
-                   _Py_OPCODE(true_next) == STORE_FAST__LOAD_FAST);
+            assert(_PyOpcode_Deopt[_Py_OPCODE(true_next)] == STORE_FAST);
             PyObject **target_local = &GETLOCAL(_Py_OPARG(true_next));
             DEOPT_IF(*target_local != left, BINARY_OP);
             STAT_INC(BINARY_OP, hit);
@@ -308,35 +400,14 @@ dummy_func(
             JUMPBY(INLINE_CACHE_ENTRIES_BINARY_OP + 1);
         }
 
-        inst(BINARY_OP_ADD_FLOAT, (unused/1, left, right -- sum)) {
-            assert(cframe.use_tracing == 0);
-            DEOPT_IF(!PyFloat_CheckExact(left), BINARY_OP);
-            DEOPT_IF(Py_TYPE(right) != Py_TYPE(left), BINARY_OP);
-            STAT_INC(BINARY_OP, hit);
-            double dsum = ((PyFloatObject *)left)->ob_fval +
-                ((PyFloatObject *)right)->ob_fval;
-            sum = PyFloat_FromDouble(dsum);
-            _Py_DECREF_SPECIALIZED(right, _PyFloat_ExactDealloc);
-            _Py_DECREF_SPECIALIZED(left, _PyFloat_ExactDealloc);
-            ERROR_IF(sum == NULL, error);
-        }
-
-        inst(BINARY_OP_ADD_INT, (unused/1, left, right -- sum)) {
-            assert(cframe.use_tracing == 0);
-            DEOPT_IF(!PyLong_CheckExact(left), BINARY_OP);
-            DEOPT_IF(Py_TYPE(right) != Py_TYPE(left), BINARY_OP);
-            STAT_INC(BINARY_OP, hit);
-            sum = _PyLong_Add((PyLongObject *)left, (PyLongObject *)right);
-            _Py_DECREF_SPECIALIZED(right, (destructor)PyObject_Free);
-            _Py_DECREF_SPECIALIZED(left, (destructor)PyObject_Free);
-            ERROR_IF(sum == NULL, error);
-        }
-
         family(binary_subscr, INLINE_CACHE_ENTRIES_BINARY_SUBSCR) = {
             BINARY_SUBSCR,
+            BINARY_SUBSCR_BYTEARRAY_INT,
+            BINARY_SUBSCR_BYTES_INT,
             BINARY_SUBSCR_DICT,
             BINARY_SUBSCR_GETITEM,
             BINARY_SUBSCR_LIST_INT,
+            BINARY_SUBSCR_STR_INT,
             BINARY_SUBSCR_TUPLE_INT,
         };
 
@@ -356,7 +427,23 @@ dummy_func(
             ERROR_IF(res == NULL, error);
         }
 
-        inst(BINARY_SLICE, (container, start, stop -- res)) {
+        family(binary_slice, INLINE_CACHE_ENTRIES_BINARY_SLICE) = {
+            BINARY_SLICE,
+            BINARY_SLICE_BYTEARRAY,
+            BINARY_SLICE_BYTES,
+            BINARY_SLICE_STR,
+        };
+
+        inst(BINARY_SLICE, (unused/1, container, start, stop -- res)) {
+            _PyBinarySliceCache *cache = (_PyBinarySliceCache *)next_instr;
+            if (ADAPTIVE_COUNTER_IS_ZERO(cache->counter)) {
+                assert(cframe.use_tracing == 0);
+                next_instr--;
+                _Py_Specialize_BinarySlice(container, start, stop, next_instr);
+                DISPATCH_SAME_OPARG();
+            }
+            STAT_INC(BINARY_SLICE, deferred);
+            DECREMENT_ADAPTIVE_COUNTER(cache->counter);
             PyObject *slice = _PyBuildSlice_ConsumeRefs(start, stop);
             // Can't use ERROR_IF() here, because we haven't
             // DECREF'ed container yet, and we still own slice.
@@ -371,6 +458,58 @@ dummy_func(
             ERROR_IF(res == NULL, error);
         }
 
+        inst(BINARY_SLICE_STR, (unused/1, container, start, stop -- res)) {
+            assert(cframe.use_tracing == 0);
+            DEOPT_IF(!PyUnicode_CheckExact(container), BINARY_SLICE);
+            Py_ssize_t istart;
+            Py_ssize_t len = simple_slice_bounds(
+                start, stop, PyUnicode_GET_LENGTH(container), &istart);
+            DEOPT_IF(len < 0, BINARY_SLICE);
+            STAT_INC(BINARY_SLICE, hit);
+            res = PyUnicode_Substring(container, istart, istart + len);
+            Py_DECREF(container);
+            Py_DECREF(start);
+            Py_DECREF(stop);
+            ERROR_IF(res == NULL, error);
+        }
+
+        inst(BINARY_SLICE_BYTES, (unused/1, container, start, stop -- res)) {
+            assert(cframe.use_tracing == 0);
+            DEOPT_IF(!PyBytes_CheckExact(container), BINARY_SLICE);
+            Py_ssize_t istart;
+            Py_ssize_t size = PyBytes_GET_SIZE(container);
+            Py_ssize_t len = simple_slice_bounds(start, stop, size, &istart);
+            DEOPT_IF(len < 0, BINARY_SLICE);
+            STAT_INC(BINARY_SLICE, hit);
+            if (len == size) {
+                res = Py_NewRef(container);
+            }
+            else {
+                res = PyBytes_FromStringAndSize(
+                    PyBytes_AS_STRING(container) + istart, len);
+            }
+            Py_DECREF(container);
+            Py_DECREF(start);
+            Py_DECREF(stop);
+            ERROR_IF(res == NULL, error);
+        }
+
+        inst(BINARY_SLICE_BYTEARRAY, (unused/1, container, start, stop -- res)) {
+            assert(cframe.use_tracing == 0);
+            DEOPT_IF(!PyByteArray_CheckExact(container), BINARY_SLICE);
+            Py_ssize_t istart;
+            Py_ssize_t len = simple_slice_bounds(
+                start, stop, PyByteArray_GET_SIZE(container), &istart);
+            DEOPT_IF(len < 0, BINARY_SLICE);
+            STAT_INC(BINARY_SLICE, hit);
+            res = PyByteArray_FromStringAndSize(
+                PyByteArray_AS_STRING(container) + istart, len);
+            Py_DECREF(container);
+            Py_DECREF(start);
+            Py_DECREF(stop);
+            ERROR_IF(res == NULL, error);
+        }
+
         inst(STORE_SLICE, (v, container, start, stop -- )) {
             PyObject *slice = _PyBuildSlice_ConsumeRefs(start, stop);
             int err;
@@ -424,6 +563,62 @@ dummy_func(
             Py_DECREF(tuple);
         }
 
+        inst(BINARY_SUBSCR_STR_INT, (unused/4, str, sub -- res)) {
+            assert(cframe.use_tracing == 0);
+            DEOPT_IF(!PyLong_CheckExact(sub), BINARY_SUBSCR);
+            DEOPT_IF(!PyUnicode_CheckExact(str), BINARY_SUBSCR);
+            Py_ssize_t signed_magnitude = Py_SIZE(sub);
+            DEOPT_IF(((size_t)signed_magnitude) > 1, BINARY_SUBSCR);
+            assert(((PyLongObject *)_PyLong_GetZero())->ob_digit[0] == 0);
+            Py_ssize_t index = ((PyLongObject*)sub)->ob_digit[0];
+            DEOPT_IF(index >= PyUnicode_GET_LENGTH(str), BINARY_SUBSCR);
+            // Only Latin-1 characters have a cached 1-character string
+            Py_UCS4 c = PyUnicode_READ_CHAR(str, index);
+            DEOPT_IF(c > 0xff, BINARY_SUBSCR);
+            STAT_INC(BINARY_SUBSCR, hit);
+            if (c < 128) {
+                res = (PyObject *)&_Py_SINGLETON(strings).ascii[c];
+            }
+            else {
+                res = (PyObject *)&_Py_SINGLETON(strings).latin1[c - 128];
+            }
+            Py_INCREF(res);
+            _Py_DECREF_SPECIALIZED(sub, (destructor)PyObject_Free);
+            Py_DECREF(str);
+        }
+
+        inst(BINARY_SUBSCR_BYTES_INT, (unused/4, bytes, sub -- res)) {
+            assert(cframe.use_tracing == 0);
+            DEOPT_IF(!PyLong_CheckExact(sub), BINARY_SUBSCR);
+            DEOPT_IF(!PyBytes_CheckExact(bytes), BINARY_SUBSCR);
+            Py_ssize_t signed_magnitude = Py_SIZE(sub);
+            DEOPT_IF(((size_t)signed_magnitude) > 1, BINARY_SUBSCR);
+            assert(((PyLongObject *)_PyLong_GetZero())->ob_digit[0] == 0);
+            Py_ssize_t index = ((PyLongObject*)sub)->ob_digit[0];
+            DEOPT_IF(index >= PyBytes_GET_SIZE(bytes), BINARY_SUBSCR);
+            STAT_INC(BINARY_SUBSCR, hit);
+            res = _PyLong_FromUnsignedChar(
+                (unsigned char)PyBytes_AS_STRING(bytes)[index]);
+            _Py_DECREF_SPECIALIZED(sub, (destructor)PyObject_Free);
+            Py_DECREF(bytes);
+        }
+
+        inst(BINARY_SUBSCR_BYTEARRAY_INT, (unused/4, bytearray, sub -- res)) {
+            assert(cframe.use_tracing == 0);
+            DEOPT_IF(!PyLong_CheckExact(sub), BINARY_SUBSCR);
+            DEOPT_IF(!PyByteArray_CheckExact(bytearray), BINARY_SUBSCR);
+            Py_ssize_t signed_magnitude = Py_SIZE(sub);
+            DEOPT_IF(((size_t)signed_magnitude) > 1, BINARY_SUBSCR);
+            assert(((PyLongObject *)_PyLong_GetZero())->ob_digit[0] == 0);
+            Py_ssize_t index = ((PyLongObject*)sub)->ob_digit[0];
+            DEOPT_IF(index >= PyByteArray_GET_SIZE(bytearray), BINARY_SUBSCR);
+            STAT_INC(BINARY_SUBSCR, hit);
+            res = _PyLong_FromUnsignedChar(
+                (unsigned char)PyByteArray_AS_STRING(bytearray)[index]);
+            _Py_DECREF_SPECIALIZED(sub, (destructor)PyObject_Free);
+            Py_DECREF(bytearray);
+        }
+
         inst(BINARY_SUBSCR_DICT, (unused/4, dict, sub -- res)) {
             assert(cframe.use_tracing == 0);
             DEOPT_IF(!PyDict_CheckExact(dict), BINARY_SUBSCR);
@@ -612,6 +807,47 @@ dummy_func(
             goto resume_frame;
         }
 
+        inst(INSTRUMENTED_RETURN_VALUE, (retval --)) {
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            int err = _Py_call_instrumentation_arg(
+                tstate, PY_MONITORING_EVENT_PY_RETURN,
+                frame, next_instr - 1, retval);
+            stack_pointer = _PyFrame_GetStackPointer(frame);
+            if (err) {
+                Py_DECREF(retval);
+            }
+            ERROR_IF(err, error);
+            STACK_SHRINK(1);
+            assert(EMPTY());
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            TRACE_FUNCTION_EXIT();
+            DTRACE_FUNCTION_EXIT();
+            _Py_LeaveRecursiveCallPy(tstate);
+            assert(frame != &entry_frame);
+            _PyInterpreterFrame *dying = frame;
+            frame = cframe.current_frame = dying->previous;
+            _PyEvalFrameClearAndPop(tstate, dying);
+            _PyFrame_StackPush(frame, retval);
+            goto resume_frame;
+        }
+
+        inst(RETURN_DISCARD, (retval --)) {
+            /* Like RETURN_VALUE, but does not push retval to the caller.
+             * Only used by the shim that cleans up after property setters. */
+            Py_DECREF(retval);
+            STACK_SHRINK(1);
+            assert(EMPTY());
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            TRACE_FUNCTION_EXIT();
+            DTRACE_FUNCTION_EXIT();
+            _Py_LeaveRecursiveCallPy(tstate);
+            assert(frame != &entry_frame);
+            _PyInterpreterFrame *dying = frame;
+            frame = cframe.current_frame = dying->previous;
+            _PyEvalFrameClearAndPop(tstate, dying);
+            goto resume_frame;
+        }
+
         inst(GET_AITER, (obj -- iter)) {
             unaryfunc getter = NULL;
             PyTypeObject *type = Py_TYPE(obj);
@@ -730,10 +966,19 @@ dummy_func(
             PREDICT(LOAD_CONST);
         }
 
-        // error: SEND stack effect depends on jump flag
+        // stack effect: (__0 -- )
         inst(SEND) {
             assert(frame != &entry_frame);
             assert(STACK_LEVEL() >= 2);
+            _PySendCache *cache = (_PySendCache *)next_instr;
+            if (ADAPTIVE_COUNTER_IS_ZERO(cache->counter)) {
+                assert(cframe.use_tracing == 0);
+                next_instr--;
+                _Py_Specialize_Send(SECOND(), next_instr, oparg);
+                DISPATCH_SAME_OPARG();
+            }
+            STAT_INC(SEND, deferred);
+            DECREMENT_ADAPTIVE_COUNTER(cache->counter);
             PyObject *v = POP();
             PyObject *receiver = TOP();
             PySendResult gen_status;
@@ -767,19 +1012,42 @@ dummy_func(
                 assert(retval == NULL);
                 goto error;
             }
+            assert(retval != NULL);
+            PUSH(retval);
             if (gen_status == PYGEN_RETURN) {
-                assert(retval != NULL);
-                Py_DECREF(receiver);
-                SET_TOP(retval);
-                JUMPBY(oparg);
+                /* The receiver is popped by the END_SEND at the target */
+                JUMPBY(INLINE_CACHE_ENTRIES_SEND + oparg);
             }
             else {
                 assert(gen_status == PYGEN_NEXT);
-                assert(retval != NULL);
-                PUSH(retval);
+                JUMPBY(INLINE_CACHE_ENTRIES_SEND);
             }
         }
 
+        inst(SEND_GEN) {
+            assert(cframe.use_tracing == 0);
+            PyGenObject *gen = (PyGenObject *)SECOND();
+            DEOPT_IF(Py_TYPE(gen) != &PyGen_Type &&
+                     Py_TYPE(gen) != &PyCoro_Type, SEND);
+            DEOPT_IF(gen->gi_frame_state >= FRAME_EXECUTING, SEND);
+            PyObject *v = TOP();
+            // gen_send_ex2() rejects this case with a TypeError:
+            DEOPT_IF(gen->gi_frame_state == FRAME_CREATED && !Py_IsNone(v), SEND);
+            STAT_INC(SEND, hit);
+            STACK_SHRINK(1);
+            _PyInterpreterFrame *gen_frame = (_PyInterpreterFrame *)gen->gi_iframe;
+            frame->yield_offset = oparg;
+            _PyFrame_StackPush(gen_frame, v);
+            gen->gi_frame_state = FRAME_EXECUTING;
+            gen->gi_exc_state.previous_item = tstate->exc_info;
+            tstate->exc_info = &gen->gi_exc_state;
+            /* Returning resumes at the END_SEND; yielding moves back to just
+               after this instruction (see YIELD_VALUE) */
+            JUMPBY(INLINE_CACHE_ENTRIES_SEND + oparg);
+            assert(_PyOpcode_Deopt[_Py_OPCODE(*next_instr)] == END_SEND);
+            DISPATCH_INLINED(gen_frame);
+        }
+
         // stack effect: ( -- )
         inst(ASYNC_GEN_WRAP) {
             PyObject *v = TOP();
@@ -889,7 +1157,7 @@ dummy_func(
                 Py_INCREF(value);
                 Py_DECREF(POP());  // The StopIteration.
                 Py_DECREF(POP());  // The last sent value.
-                Py_DECREF(POP());  // The delegated sub-iterator.
+                // The delegated sub-iterator is popped by END_SEND.
                 PUSH(value);
             }
             else {
@@ -1008,9 +1276,9 @@ dummy_func(
             err = PyObject_DelItem(ns, name);
             // Can't use ERROR_IF here.
             if (err != 0) {
-                format_exc_check_arg(tstate, PyExc_NameError,
-                                     NAME_ERROR_MSG,
-                                     name);
+                _PyEval_FormatExcCheckArg(tstate, PyExc_NameError,
+                                          NAME_ERROR_MSG,
+                                          name);
                 goto error;
             }
         }
@@ -1095,12 +1363,15 @@ dummy_func(
 
         family(store_attr) = {
             STORE_ATTR,
+            STORE_ATTR_CLASS,
             STORE_ATTR_INSTANCE_VALUE,
+            STORE_ATTR_MODULE,
+            STORE_ATTR_PROPERTY,
             STORE_ATTR_SLOT,
             STORE_ATTR_WITH_HINT,
         };
 
-        inst(STORE_ATTR, (counter/1, unused/3, v, owner --)) {
+        inst(STORE_ATTR, (counter/1, unused/8, v, owner --)) {
             if (ADAPTIVE_COUNTER_IS_ZERO(counter)) {
                 assert(cframe.use_tracing == 0);
                 PyObject *name = GETITEM(names, oparg);
@@ -1139,8 +1410,8 @@ dummy_func(
             // Can't use ERROR_IF here.
             if (err != 0) {
                 if (_PyErr_ExceptionMatches(tstate, PyExc_KeyError)) {
-                    format_exc_check_arg(tstate, PyExc_NameError,
-                                         NAME_ERROR_MSG, name);
+                    _PyEval_FormatExcCheckArg(tstate, PyExc_NameError,
+                                              NAME_ERROR_MSG, name);
                 }
                 goto error;
             }
@@ -1186,7 +1457,7 @@ dummy_func(
                         v = PyDict_GetItemWithError(BUILTINS(), name);
                         if (v == NULL) {
                             if (!_PyErr_Occurred(tstate)) {
-                                format_exc_check_arg(
+                                _PyEval_FormatExcCheckArg(
                                         tstate, PyExc_NameError,
                                         NAME_ERROR_MSG, name);
                             }
@@ -1198,7 +1469,7 @@ dummy_func(
                         v = PyObject_GetItem(BUILTINS(), name);
                         if (v == NULL) {
                             if (_PyErr_ExceptionMatches(tstate, PyExc_KeyError)) {
-                                format_exc_check_arg(
+                                _PyEval_FormatExcCheckArg(
                                             tstate, PyExc_NameError,
                                             NAME_ERROR_MSG, name);
                             }
@@ -1236,8 +1507,8 @@ dummy_func(
                     if (!_PyErr_Occurred(tstate)) {
                         /* _PyDict_LoadGlobal() returns NULL without raising
                          * an exception if the key doesn't exist */
-                        format_exc_check_arg(tstate, PyExc_NameError,
-                                             NAME_ERROR_MSG, name);
+                        _PyEval_FormatExcCheckArg(tstate, PyExc_NameError,
+                                                  NAME_ERROR_MSG, name);
                     }
                     goto error;
                 }
@@ -1258,7 +1529,7 @@ dummy_func(
                     v = PyObject_GetItem(BUILTINS(), name);
                     if (v == NULL) {
                         if (_PyErr_ExceptionMatches(tstate, PyExc_KeyError)) {
-                            format_exc_check_arg(
+                            _PyEval_FormatExcCheckArg(
                                         tstate, PyExc_NameError,
                                         NAME_ERROR_MSG, name);
                         }
@@ -1339,7 +1610,7 @@ dummy_func(
             // Can't use ERROR_IF here.
             // Fortunately we don't need its superpower.
             if (oldobj == NULL) {
-                format_exc_unbound(tstate, frame->f_code, oparg);
+                _PyEval_FormatExcUnbound(tstate, frame->f_code, oparg);
                 goto error;
             }
             PyCell_SET(cell, NULL);
@@ -1374,7 +1645,7 @@ dummy_func(
                 PyObject *cell = GETLOCAL(oparg);
                 value = PyCell_GET(cell);
                 if (value == NULL) {
-                    format_exc_unbound(tstate, frame->f_code, oparg);
+                    _PyEval_FormatExcUnbound(tstate, frame->f_code, oparg);
                     goto error;
                 }
                 Py_INCREF(value);
@@ -1387,7 +1658,7 @@ dummy_func(
             PyObject *cell = GETLOCAL(oparg);
             PyObject *value = PyCell_GET(cell);
             if (value == NULL) {
-                format_exc_unbound(tstate, frame->f_code, oparg);
+                _PyEval_FormatExcUnbound(tstate, frame->f_code, oparg);
                 goto error;
             }
             PUSH(Py_NewRef(value));
@@ -1419,8 +1690,7 @@ dummy_func(
         // stack effect: (__array[oparg] -- __0)
         inst(BUILD_STRING) {
             PyObject *str;
-            str = _PyUnicode_JoinArray(&_Py_STR(empty),
-                                       stack_pointer - oparg, oparg);
+            str = _PyUnicode_BuildString(stack_pointer - oparg, oparg);
             if (str == NULL)
                 goto error;
             while (--oparg >= 0) {
@@ -1656,6 +1926,118 @@ dummy_func(
         }
 
         // error: LOAD_ATTR has irregular stack effect
+        // error: LOAD_SUPER_ATTR has irregular stack effect
+        inst(LOAD_SUPER_ATTR) {
+            _PySuperAttrCache *cache = (_PySuperAttrCache *)next_instr;
+            PyObject *self = TOP();
+            PyObject *class = SECOND();
+            PyObject *global_super = THIRD();
+            PyObject *name = GETITEM(names, oparg >> 2);
+            if (ADAPTIVE_COUNTER_IS_ZERO(cache->counter)) {
+                assert(cframe.use_tracing == 0);
+                next_instr--;
+                _Py_Specialize_LoadSuperAttr(global_super, class, self,
+                                             next_instr, name, oparg & 1);
+                DISPATCH_SAME_OPARG();
+            }
+            STAT_INC(LOAD_SUPER_ATTR, deferred);
+            DECREMENT_ADAPTIVE_COUNTER(cache->counter);
+            PyObject *res;
+            int method_found = 0;
+            if (global_super == (PyObject *)&PySuper_Type &&
+                PyType_Check(class))
+            {
+                /* Avoid creating the super object */
+                int *method = NULL;
+                if ((oparg & 1) &&
+                    Py_TYPE(self)->tp_getattro == PyObject_GenericGetAttr)
+                {
+                    method = &method_found;
+                }
+                res = _PySuper_Lookup((PyTypeObject *)class, self, name,
+                                      method);
+            }
+            else {
+                PyObject *stack[] = {class, self};
+                PyObject *super = PyObject_Vectorcall(
+                    global_super, (oparg & 2) ? stack : NULL,
+                    (oparg & 2) ? 2 : 0, NULL);
+                if (super == NULL) {
+                    goto error;
+                }
+                res = PyObject_GetAttr(super, name);
+                Py_DECREF(super);
+            }
+            if (res == NULL) {
+                goto error;
+            }
+            STACK_SHRINK(2);
+            Py_DECREF(global_super);
+            Py_DECREF(class);
+            if (oparg & 1) {
+                if (method_found) {
+                    /* meth | self | arg1 | ... | argN */
+                    SET_TOP(res);
+                    PUSH(self);
+                }
+                else {
+                    /* NULL | meth | arg1 | ... | argN */
+                    SET_TOP(NULL);
+                    Py_DECREF(self);
+                    PUSH(res);
+                }
+            }
+            else {
+                Py_DECREF(self);
+                SET_TOP(res);
+            }
+            JUMPBY(INLINE_CACHE_ENTRIES_LOAD_SUPER_ATTR);
+        }
+
+        inst(LOAD_SUPER_ATTR_ATTR, (unused/1, class_version/2, self_type_version/2, descr/4, global_super, class, self -- res)) {
+            assert(cframe.use_tracing == 0);
+            assert((oparg & 1) == 0);
+            DEOPT_IF(global_super != (PyObject *)&PySuper_Type, LOAD_SUPER_ATTR);
+            DEOPT_IF(!PyType_Check(class), LOAD_SUPER_ATTR);
+            PyTypeObject *self_type = Py_TYPE(self);
+            DEOPT_IF(((PyTypeObject *)class)->tp_version_tag != class_version,
+                     LOAD_SUPER_ATTR);
+            DEOPT_IF(self_type->tp_version_tag != self_type_version,
+                     LOAD_SUPER_ATTR);
+            STAT_INC(LOAD_SUPER_ATTR, hit);
+            descrgetfunc f = Py_TYPE(descr)->tp_descr_get;
+            if (f != NULL) {
+                res = f(descr, self, (PyObject *)self_type);
+            }
+            else {
+                res = Py_NewRef(descr);
+            }
+            Py_DECREF(global_super);
+            Py_DECREF(class);
+            Py_DECREF(self);
+            ERROR_IF(res == NULL, error);
+        }
+
+        inst(LOAD_SUPER_ATTR_METHOD, (unused/1, class_version/2, self_type_version/2, descr/4, global_super, class, self -- res2, res)) {
+            assert(cframe.use_tracing == 0);
+            assert(oparg & 1);
+            DEOPT_IF(global_super != (PyObject *)&PySuper_Type, LOAD_SUPER_ATTR);
+            DEOPT_IF(!PyType_Check(class), LOAD_SUPER_ATTR);
+            PyTypeObject *self_type = Py_TYPE(self);
+            DEOPT_IF(((PyTypeObject *)class)->tp_version_tag != class_version,
+                     LOAD_SUPER_ATTR);
+            DEOPT_IF(self_type->tp_version_tag != self_type_version,
+                     LOAD_SUPER_ATTR);
+            STAT_INC(LOAD_SUPER_ATTR, hit);
+            assert(descr != NULL);
+            assert(_PyType_HasFeature(Py_TYPE(descr),
+                                      Py_TPFLAGS_METHOD_DESCRIPTOR));
+            res2 = Py_NewRef(descr);
+            res = self;
+            Py_DECREF(global_super);
+            Py_DECREF(class);
+        }
+
         inst(LOAD_ATTR) {
             _PyAttrCache *cache = (_PyAttrCache *)next_instr;
             if (ADAPTIVE_COUNTER_IS_ZERO(cache->counter)) {
@@ -1918,7 +2300,7 @@ dummy_func(
             DISPATCH_INLINED(new_frame);
         }
 
-        inst(STORE_ATTR_INSTANCE_VALUE, (unused/1, type_version/2, index/1, value, owner --)) {
+        inst(STORE_ATTR_INSTANCE_VALUE, (unused/1, type_version/2, index/1, unused/5, value, owner --)) {
             assert(cframe.use_tracing == 0);
             PyTypeObject *tp = Py_TYPE(owner);
             assert(type_version != 0);
@@ -1939,7 +2321,7 @@ dummy_func(
             Py_DECREF(owner);
         }
 
-        inst(STORE_ATTR_WITH_HINT, (unused/1, type_version/2, hint/1, value, owner --)) {
+        inst(STORE_ATTR_WITH_HINT, (unused/1, type_version/2, hint/1, unused/5, value, owner --)) {
             assert(cframe.use_tracing == 0);
             PyTypeObject *tp = Py_TYPE(owner);
             assert(type_version != 0);
@@ -1981,7 +2363,7 @@ dummy_func(
             Py_DECREF(owner);
         }
 
-        inst(STORE_ATTR_SLOT, (unused/1, type_version/2, index/1, value, owner --)) {
+        inst(STORE_ATTR_SLOT, (unused/1, type_version/2, index/1, unused/5, value, owner --)) {
             assert(cframe.use_tracing == 0);
             PyTypeObject *tp = Py_TYPE(owner);
             assert(type_version != 0);
@@ -1994,25 +2376,113 @@ dummy_func(
             Py_DECREF(owner);
         }
 
-        family(compare_op) = {
-            COMPARE_OP,
-            _COMPARE_OP_FLOAT,
-            _COMPARE_OP_INT,
-            _COMPARE_OP_STR,
-        };
-
-        inst(COMPARE_OP, (unused/2, left, right -- res)) {
-            _PyCompareOpCache *cache = (_PyCompareOpCache *)next_instr;
-            if (ADAPTIVE_COUNTER_IS_ZERO(cache->counter)) {
-                assert(cframe.use_tracing == 0);
-                next_instr--;
-                _Py_Specialize_CompareOp(left, right, next_instr, oparg);
-                DISPATCH_SAME_OPARG();
-            }
-            STAT_INC(COMPARE_OP, deferred);
-            DECREMENT_ADAPTIVE_COUNTER(cache->counter);
-            assert(oparg <= Py_GE);
-            res = PyObject_RichCompare(left, right, oparg);
+        inst(STORE_ATTR_MODULE, (unused/1, version/2, index/1, unused/5, value, owner --)) {
+            assert(cframe.use_tracing == 0);
+            DEOPT_IF(!PyModule_CheckExact(owner), STORE_ATTR);
+            PyDictObject *dict = (PyDictObject *)((PyModuleObject *)owner)->md_dict;
+            assert(dict != NULL);
+            DEOPT_IF(dict->ma_keys->dk_version != version, STORE_ATTR);
+            assert(dict->ma_keys->dk_kind == DICT_KEYS_UNICODE);
+            assert(index < dict->ma_keys->dk_nentries);
+            PyDictUnicodeEntry *ep = DK_UNICODE_ENTRIES(dict->ma_keys) + index;
+            PyObject *old_value = ep->me_value;
+            DEOPT_IF(old_value == NULL, STORE_ATTR);
+            STAT_INC(STORE_ATTR, hit);
+            uint64_t new_version = _PyDict_NotifyEvent(PyDict_EVENT_MODIFIED, dict, ep->me_key, value);
+            ep->me_value = value;
+            Py_DECREF(old_value);
+            /* Ensure dict is GC tracked if it needs to be */
+            if (!_PyObject_GC_IS_TRACKED(dict) && _PyObject_GC_MAY_BE_TRACKED(value)) {
+                _PyObject_GC_TRACK(dict);
+            }
+            /* PEP 509 */
+            dict->ma_version_tag = new_version;
+            Py_DECREF(owner);
+        }
+
+        inst(STORE_ATTR_CLASS, (unused/1, type_version/2, unused/6, value, owner --)) {
+            assert(cframe.use_tracing == 0);
+            /* type_version is the version of the metaclass, which guards
+             * against __setattr__ or a data descriptor being added to it */
+            DEOPT_IF(Py_TYPE(owner)->tp_version_tag != type_version, STORE_ATTR);
+            assert(PyType_Check(owner));
+            PyTypeObject *cls = (PyTypeObject *)owner;
+            DEOPT_IF(cls->tp_flags & Py_TPFLAGS_IMMUTABLETYPE, STORE_ATTR);
+            STAT_INC(STORE_ATTR, hit);
+            PyObject *name = GETITEM(names, oparg);
+            /* Same as type_setattro(), minus the checks done by the specializer */
+            int err = PyDict_SetItem(cls->tp_dict, name, value);
+            if (err == 0) {
+                PyType_Modified(cls);
+            }
+            Py_DECREF(value);
+            Py_DECREF(owner);
+            ERROR_IF(err, error);
+        }
+
+        inst(STORE_ATTR_PROPERTY, (unused/1, type_version/2, func_version/2, fset/4, value, owner --)) {
+            /* This instruction does the following:
+             * 1. Pushes a shim frame that discards the result of the setter.
+             * 2. Pushes the frame for the setter on top of the shim.
+             */
+            assert(cframe.use_tracing == 0);
+            DEOPT_IF(tstate->interp->eval_frame, STORE_ATTR);
+            PyTypeObject *tp = Py_TYPE(owner);
+            assert(type_version != 0);
+            DEOPT_IF(tp->tp_version_tag != type_version, STORE_ATTR);
+            assert(Py_IS_TYPE(fset, &PyFunction_Type));
+            PyFunctionObject *f = (PyFunctionObject *)fset;
+            assert(func_version != 0);
+            DEOPT_IF(f->func_version != func_version, STORE_ATTR);
+            PyCodeObject *code = (PyCodeObject *)f->func_code;
+            assert(code->co_argcount == 2);
+            PyCodeObject *shim_code = tstate->interp->setter_cleanup;
+            DEOPT_IF(!_PyThreadState_HasStackSpace(tstate,
+                code->co_framesize + shim_code->co_framesize), STORE_ATTR);
+            STAT_INC(STORE_ATTR, hit);
+            _PyInterpreterFrame *shim = _PyFrame_PushTrampolineUnchecked(
+                tstate, (PyFunctionObject *)Py_NewRef(fset), shim_code, 0);
+            _PyInterpreterFrame *new_frame = _PyFrame_PushUnchecked(
+                tstate, (PyFunctionObject *)Py_NewRef(fset));
+            new_frame->localsplus[0] = owner;
+            new_frame->localsplus[1] = value;
+            for (int i = 2; i < code->co_nlocalsplus; i++) {
+                new_frame->localsplus[i] = NULL;
+            }
+            STACK_SHRINK(2);
+            JUMPBY(INLINE_CACHE_ENTRIES_STORE_ATTR);
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            frame->prev_instr = next_instr - 1;
+            /* Link frames */
+            shim->previous = frame;
+            new_frame->previous = shim;
+            frame = cframe.current_frame = new_frame;
+            CALL_STAT_INC(inlined_py_calls);
+            /* Account for pushing the shim frame. The recursion limit is
+             * checked for the setter frame at start_frame */
+            tstate->py_recursion_remaining--;
+            goto start_frame;
+        }
+
+        family(compare_op) = {
+            COMPARE_OP,
+            _COMPARE_OP_FLOAT,
+            _COMPARE_OP_INT,
+            _COMPARE_OP_STR,
+        };
+
+        inst(COMPARE_OP, (unused/2, left, right -- res)) {
+            _PyCompareOpCache *cache = (_PyCompareOpCache *)next_instr;
+            if (ADAPTIVE_COUNTER_IS_ZERO(cache->counter)) {
+                assert(cframe.use_tracing == 0);
+                next_instr--;
+                _Py_Specialize_CompareOp(left, right, next_instr, oparg);
+                DISPATCH_SAME_OPARG();
+            }
+            STAT_INC(COMPARE_OP, deferred);
+            DECREMENT_ADAPTIVE_COUNTER(cache->counter);
+            assert(oparg <= Py_GE);
+            res = PyObject_RichCompare(left, right, oparg);
             Py_DECREF(left);
             Py_DECREF(right);
             ERROR_IF(res == NULL, error);
@@ -2042,6 +2512,12 @@ dummy_func(
                 JUMPBY(oparg);
             }
         }
+        // Tier-2 form of _JUMP_IF; oparg is the index of an exit stub.
+        op(_JUMP_TO_STUB_IF, (jump: size_t --)) {
+            if (jump) {
+                JUMP_TO_UOP(oparg);
+            }
+        }
         // We're praying that the compiler optimizes the flags manipuations.
         super(COMPARE_OP_FLOAT_JUMP) = _COMPARE_OP_FLOAT + _JUMP_IF;
 
@@ -2082,29 +2558,86 @@ dummy_func(
         }
         super(COMPARE_OP_STR_JUMP) = _COMPARE_OP_STR + _JUMP_IF;
 
-        // stack effect: (__0 -- )
-        inst(IS_OP) {
-            PyObject *right = POP();
-            PyObject *left = TOP();
+        inst(IS_OP, (left, right -- b)) {
             int res = Py_Is(left, right) ^ oparg;
-            PyObject *b = res ? Py_True : Py_False;
-            SET_TOP(Py_NewRef(b));
             Py_DECREF(left);
             Py_DECREF(right);
+            b = Py_NewRef(res ? Py_True : Py_False);
         }
 
-        // stack effect: (__0 -- )
-        inst(CONTAINS_OP) {
-            PyObject *right = POP();
-            PyObject *left = POP();
+        family(contains_op, INLINE_CACHE_ENTRIES_CONTAINS_OP) = {
+            CONTAINS_OP,
+            CONTAINS_OP_DICT,
+            CONTAINS_OP_SET,
+            CONTAINS_OP_STR,
+            CONTAINS_OP_TUPLE,
+        };
+
+        inst(CONTAINS_OP, (unused/1, left, right -- b)) {
+            _PyContainsOpCache *cache = (_PyContainsOpCache *)next_instr;
+            if (ADAPTIVE_COUNTER_IS_ZERO(cache->counter)) {
+                assert(cframe.use_tracing == 0);
+                next_instr--;
+                _Py_Specialize_ContainsOp(left, right, next_instr);
+                DISPATCH_SAME_OPARG();
+            }
+            STAT_INC(CONTAINS_OP, deferred);
+            DECREMENT_ADAPTIVE_COUNTER(cache->counter);
             int res = PySequence_Contains(right, left);
             Py_DECREF(left);
             Py_DECREF(right);
-            if (res < 0) {
-                goto error;
+            ERROR_IF(res < 0, error);
+            b = Py_NewRef((res^oparg) ? Py_True : Py_False);
+        }
+
+        inst(CONTAINS_OP_DICT, (unused/1, left, right -- b)) {
+            assert(cframe.use_tracing == 0);
+            DEOPT_IF(!PyDict_CheckExact(right), CONTAINS_OP);
+            STAT_INC(CONTAINS_OP, hit);
+            int res = PyDict_Contains(right, left);
+            Py_DECREF(left);
+            Py_DECREF(right);
+            ERROR_IF(res < 0, error);
+            b = Py_NewRef((res^oparg) ? Py_True : Py_False);
+        }
+
+        inst(CONTAINS_OP_SET, (unused/1, left, right -- b)) {
+            assert(cframe.use_tracing == 0);
+            DEOPT_IF(!PyAnySet_CheckExact(right), CONTAINS_OP);
+            STAT_INC(CONTAINS_OP, hit);
+            int res = _PySet_Contains((PySetObject *)right, left);
+            Py_DECREF(left);
+            Py_DECREF(right);
+            ERROR_IF(res < 0, error);
+            b = Py_NewRef((res^oparg) ? Py_True : Py_False);
+        }
+
+        inst(CONTAINS_OP_STR, (unused/1, left, right -- b)) {
+            assert(cframe.use_tracing == 0);
+            DEOPT_IF(!PyUnicode_CheckExact(right), CONTAINS_OP);
+            DEOPT_IF(!PyUnicode_CheckExact(left), CONTAINS_OP);
+            STAT_INC(CONTAINS_OP, hit);
+            int res = PyUnicode_Contains(right, left);
+            _Py_DECREF_SPECIALIZED(left, _PyUnicode_ExactDealloc);
+            _Py_DECREF_SPECIALIZED(right, _PyUnicode_ExactDealloc);
+            ERROR_IF(res < 0, error);
+            b = Py_NewRef((res^oparg) ? Py_True : Py_False);
+        }
+
+        inst(CONTAINS_OP_TUPLE, (unused/1, left, right -- b)) {
+            assert(cframe.use_tracing == 0);
+            DEOPT_IF(!PyTuple_CheckExact(right), CONTAINS_OP);
+            STAT_INC(CONTAINS_OP, hit);
+            // Same as tuplecontains(), minus the indirect call.
+            int res = 0;
+            for (Py_ssize_t i = 0; res == 0 && i < PyTuple_GET_SIZE(right); i++) {
+                res = PyObject_RichCompareBool(PyTuple_GET_ITEM(right, i),
+                                               left, Py_EQ);
             }
-            PyObject *b = (res^oparg) ? Py_True : Py_False;
-            PUSH(Py_NewRef(b));
+            Py_DECREF(left);
+            Py_DECREF(right);
+            ERROR_IF(res < 0, error);
+            b = Py_NewRef((res^oparg) ? Py_True : Py_False);
         }
 
         // stack effect: ( -- )
@@ -2218,9 +2751,66 @@ dummy_func(
 
         // stack effect: ( -- )
         inst(JUMP_BACKWARD) {
-            assert(oparg < INSTR_OFFSET());
-            JUMPBY(-oparg);
+            _PyJumpBackwardCache *cache = (_PyJumpBackwardCache *)next_instr;
+            assert(oparg <= INSTR_OFFSET() + (int)INLINE_CACHE_ENTRIES_JUMP_BACKWARD);
+            if (ADAPTIVE_COUNTER_IS_ZERO(cache->counter)) {
+                assert(cframe.use_tracing == 0);
+                _Py_CODEUNIT *dest =
+                    next_instr + INLINE_CACHE_ENTRIES_JUMP_BACKWARD - oparg;
+                int optimized = _PyOptimizer_BackEdge(frame, next_instr - 1, dest);
+                ERROR_IF(optimized < 0, error);
+                if (optimized) {
+                    next_instr--;
+                    DISPATCH_SAME_OPARG();
+                }
+            }
+            else {
+                STAT_INC(JUMP_BACKWARD, deferred);
+                DECREMENT_ADAPTIVE_COUNTER(cache->counter);
+            }
+            JUMPBY(INLINE_CACHE_ENTRIES_JUMP_BACKWARD - oparg);
+            CHECK_EVAL_BREAKER();
+        }
+
+        // stack effect: ( -- )
+        inst(JUMP_BACKWARD_INTO_TRACE) {
+            _PyJumpBackwardCache *cache = (_PyJumpBackwardCache *)next_instr;
+            assert(cframe.use_tracing == 0);
+            assert(oparg <= INSTR_OFFSET() + (int)INLINE_CACHE_ENTRIES_JUMP_BACKWARD);
+            STAT_INC(JUMP_BACKWARD, hit);
+            JUMPBY(INLINE_CACHE_ENTRIES_JUMP_BACKWARD - oparg);
             CHECK_EVAL_BREAKER();
+            int index = cache->counter >> ADAPTIVE_BACKOFF_BITS;
+            _PyUOpExecutor *executor =
+                frame->f_code->_co_executors->executors[index];
+            if (executor->jit_code != NULL) {
+                next_instr = ((_PyJITFunction)executor->jit_code)(
+                    frame, stack_pointer, tstate);
+            }
+            else {
+                next_instr = _PyUopExecute(tstate, executor, frame,
+                                           stack_pointer);
+            }
+            if (next_instr == NULL) {
+                goto resume_with_error;
+            }
+            stack_pointer = _PyFrame_GetStackPointer(frame);
+            frame->stacktop = -1;
+            DISPATCH();
+        }
+
+        // Leaves the trace, resuming tier 1 at the uop's target.
+        op(EXIT_TRACE, (--)) {
+            goto exit_trace;
+        }
+
+        // Closes the loop of a trace that ends at the back edge it started
+        // from. Pending signals and tracing are handled in tier 1.
+        op(JUMP_TO_TOP, (--)) {
+            if (_Py_atomic_load_relaxed_int32(eval_breaker) || cframe.use_tracing) {
+                goto exit_trace;
+            }
+            JUMP_TO_UOP(0);
         }
 
         // stack effect: (__0 -- )
@@ -2290,6 +2880,42 @@ dummy_func(
             }
         }
 
+        // Tier-2 forms of the conditional jumps. A trace follows the
+        // fall-through path; a taken jump leaves it through the exit stub
+        // at index oparg. Conditions that aren't bools deopt to tier 1.
+        op(_POP_JUMP_IF_FALSE, (cond --)) {
+            DEOPT_IF(!PyBool_Check(cond), POP_JUMP_IF_FALSE);
+            _Py_DECREF_NO_DEALLOC(cond);
+            if (Py_IsFalse(cond)) {
+                JUMP_TO_UOP(oparg);
+            }
+        }
+
+        op(_POP_JUMP_IF_TRUE, (cond --)) {
+            DEOPT_IF(!PyBool_Check(cond), POP_JUMP_IF_TRUE);
+            _Py_DECREF_NO_DEALLOC(cond);
+            if (Py_IsTrue(cond)) {
+                JUMP_TO_UOP(oparg);
+            }
+        }
+
+        op(_POP_JUMP_IF_NOT_NONE, (value --)) {
+            if (!Py_IsNone(value)) {
+                JUMP_TO_UOP(oparg);
+            }
+            Py_DECREF(value);
+        }
+
+        op(_POP_JUMP_IF_NONE, (value --)) {
+            if (Py_IsNone(value)) {
+                _Py_DECREF_NO_DEALLOC(value);
+                JUMP_TO_UOP(oparg);
+            }
+            else {
+                Py_DECREF(value);
+            }
+        }
+
         // error: JUMP_IF_FALSE_OR_POP stack effect depends on jump flag
         inst(JUMP_IF_FALSE_OR_POP) {
             PyObject *cond = TOP();
@@ -2342,6 +2968,96 @@ dummy_func(
             }
         }
 
+        // Instrumented jumps raise JUMP or BRANCH events, then jump without
+        // specializing or entering tier 2.
+
+        // stack effect: ( -- )
+        inst(INSTRUMENTED_JUMP_FORWARD) {
+            INSTRUMENTED_JUMP(next_instr - 1, next_instr + oparg,
+                              PY_MONITORING_EVENT_JUMP);
+        }
+
+        // stack effect: ( -- )
+        inst(INSTRUMENTED_JUMP_BACKWARD) {
+            INSTRUMENTED_JUMP(
+                next_instr - 1,
+                next_instr + INLINE_CACHE_ENTRIES_JUMP_BACKWARD - oparg,
+                PY_MONITORING_EVENT_JUMP);
+            CHECK_EVAL_BREAKER();
+        }
+
+        // stack effect: (__0 -- )
+        inst(INSTRUMENTED_POP_JUMP_IF_FALSE) {
+            PyObject *cond = POP();
+            int err = PyObject_IsTrue(cond);
+            Py_DECREF(cond);
+            if (err < 0) {
+                goto error;
+            }
+            INSTRUMENTED_JUMP(next_instr - 1, next_instr + (err ? 0 : oparg),
+                              PY_MONITORING_EVENT_BRANCH);
+        }
+
+        // stack effect: (__0 -- )
+        inst(INSTRUMENTED_POP_JUMP_IF_TRUE) {
+            PyObject *cond = POP();
+            int err = PyObject_IsTrue(cond);
+            Py_DECREF(cond);
+            if (err < 0) {
+                goto error;
+            }
+            INSTRUMENTED_JUMP(next_instr - 1, next_instr + (err ? oparg : 0),
+                              PY_MONITORING_EVENT_BRANCH);
+        }
+
+        // stack effect: (__0 -- )
+        inst(INSTRUMENTED_POP_JUMP_IF_NONE) {
+            PyObject *value = POP();
+            int jump = Py_IsNone(value);
+            Py_DECREF(value);
+            INSTRUMENTED_JUMP(next_instr - 1, next_instr + (jump ? oparg : 0),
+                              PY_MONITORING_EVENT_BRANCH);
+        }
+
+        // stack effect: (__0 -- )
+        inst(INSTRUMENTED_POP_JUMP_IF_NOT_NONE) {
+            PyObject *value = POP();
+            int jump = !Py_IsNone(value);
+            Py_DECREF(value);
+            INSTRUMENTED_JUMP(next_instr - 1, next_instr + (jump ? oparg : 0),
+                              PY_MONITORING_EVENT_BRANCH);
+        }
+
+        // error: INSTRUMENTED_JUMP_IF_FALSE_OR_POP stack effect depends on jump flag
+        inst(INSTRUMENTED_JUMP_IF_FALSE_OR_POP) {
+            PyObject *cond = TOP();
+            int err = PyObject_IsTrue(cond);
+            if (err < 0) {
+                goto error;
+            }
+            if (err) {
+                STACK_SHRINK(1);
+                Py_DECREF(cond);
+            }
+            INSTRUMENTED_JUMP(next_instr - 1, next_instr + (err ? 0 : oparg),
+                              PY_MONITORING_EVENT_BRANCH);
+        }
+
+        // error: INSTRUMENTED_JUMP_IF_TRUE_OR_POP stack effect depends on jump flag
+        inst(INSTRUMENTED_JUMP_IF_TRUE_OR_POP) {
+            PyObject *cond = TOP();
+            int err = PyObject_IsTrue(cond);
+            if (err < 0) {
+                goto error;
+            }
+            if (!err) {
+                STACK_SHRINK(1);
+                Py_DECREF(cond);
+            }
+            INSTRUMENTED_JUMP(next_instr - 1, next_instr + (err ? oparg : 0),
+                              PY_MONITORING_EVENT_BRANCH);
+        }
+
         // stack effect: ( -- )
         inst(JUMP_BACKWARD_NO_INTERRUPT) {
             /* This bytecode is used in the `yield from` or `await` loop.
@@ -2571,6 +3287,139 @@ dummy_func(
             }
         }
 
+        // Tier-2 forms of the FOR_ITER specializations. An exhausted
+        // iterator deopts, so that tier 1 leaves the loop.
+        op(_FOR_ITER_LIST, (iter -- iter, next)) {
+            _PyListIterObject *it = (_PyListIterObject *)iter;
+            DEOPT_IF(Py_TYPE(it) != &PyListIter_Type, FOR_ITER);
+            PyListObject *seq = it->it_seq;
+            DEOPT_IF(seq == NULL, FOR_ITER);
+            DEOPT_IF(it->it_index >= PyList_GET_SIZE(seq), FOR_ITER);
+            STAT_INC(FOR_ITER, hit);
+            next = Py_NewRef(PyList_GET_ITEM(seq, it->it_index++));
+        }
+
+        op(_FOR_ITER_TUPLE, (iter -- iter, next)) {
+            _PyTupleIterObject *it = (_PyTupleIterObject *)iter;
+            DEOPT_IF(Py_TYPE(it) != &PyTupleIter_Type, FOR_ITER);
+            PyTupleObject *seq = it->it_seq;
+            DEOPT_IF(seq == NULL, FOR_ITER);
+            DEOPT_IF(it->it_index >= PyTuple_GET_SIZE(seq), FOR_ITER);
+            STAT_INC(FOR_ITER, hit);
+            next = Py_NewRef(PyTuple_GET_ITEM(seq, it->it_index++));
+        }
+
+        // Like FOR_ITER_RANGE, this also does the STORE_FAST that follows;
+        // oparg is the STORE_FAST's oparg.
+        op(_FOR_ITER_RANGE, (iter -- iter)) {
+            _PyRangeIterObject *r = (_PyRangeIterObject *)iter;
+            DEOPT_IF(Py_TYPE(r) != &PyRangeIter_Type, FOR_ITER);
+            DEOPT_IF(r->len <= 0, FOR_ITER);
+            STAT_INC(FOR_ITER, hit);
+            long value = r->start;
+            r->start = value + r->step;
+            r->len--;
+            ERROR_IF(_PyLong_AssignValue(&GETLOCAL(oparg), value) < 0, error);
+        }
+
+        // stack effect: ( -- __0)
+        inst(FOR_ITER_DICT_KEYS) {
+            assert(cframe.use_tracing == 0);
+            PyObject *it = TOP();
+            DEOPT_IF(Py_TYPE(it) != &PyDictIterKey_Type, FOR_ITER);
+            STAT_INC(FOR_ITER, hit);
+            PyObject *key;
+            int res = _PyDictIter_Next(it, &key, NULL);
+            if (res < 0) {
+                goto error;
+            }
+            if (res == 0) {
+                STACK_SHRINK(1);
+                Py_DECREF(it);
+                JUMPBY(INLINE_CACHE_ENTRIES_FOR_ITER + oparg + 1);
+            }
+            else {
+                PUSH(key);
+                JUMPBY(INLINE_CACHE_ENTRIES_FOR_ITER);
+            }
+        }
+
+        // stack effect: ( -- __0)
+        inst(FOR_ITER_DICT_VALUES) {
+            assert(cframe.use_tracing == 0);
+            PyObject *it = TOP();
+            DEOPT_IF(Py_TYPE(it) != &PyDictIterValue_Type, FOR_ITER);
+            STAT_INC(FOR_ITER, hit);
+            PyObject *value;
+            int res = _PyDictIter_Next(it, NULL, &value);
+            if (res < 0) {
+                goto error;
+            }
+            if (res == 0) {
+                STACK_SHRINK(1);
+                Py_DECREF(it);
+                JUMPBY(INLINE_CACHE_ENTRIES_FOR_ITER + oparg + 1);
+            }
+            else {
+                PUSH(value);
+                JUMPBY(INLINE_CACHE_ENTRIES_FOR_ITER);
+            }
+        }
+
+        inst(FOR_ITER_DICT_ITEMS) {
+            assert(cframe.use_tracing == 0);
+            PyObject *it = TOP();
+            DEOPT_IF(Py_TYPE(it) != &PyDictIterItem_Type, FOR_ITER);
+            STAT_INC(FOR_ITER, hit);
+            assert(_PyOpcode_Deopt[_Py_OPCODE(next_instr[INLINE_CACHE_ENTRIES_FOR_ITER])]
+                   == UNPACK_SEQUENCE);
+            assert(_Py_OPARG(next_instr[INLINE_CACHE_ENTRIES_FOR_ITER]) == 2);
+            PyObject *key, *value;
+            int res = _PyDictIter_Next(it, &key, &value);
+            if (res < 0) {
+                goto error;
+            }
+            if (res == 0) {
+                STACK_SHRINK(1);
+                Py_DECREF(it);
+                JUMPBY(INLINE_CACHE_ENTRIES_FOR_ITER + oparg + 1);
+            }
+            else {
+                // The UNPACK_SEQUENCE is already done.
+                PUSH(value);
+                PUSH(key);
+                JUMPBY(INLINE_CACHE_ENTRIES_FOR_ITER + 1 +
+                       INLINE_CACHE_ENTRIES_UNPACK_SEQUENCE);
+            }
+        }
+
+        inst(FOR_ITER_ENUMERATE) {
+            assert(cframe.use_tracing == 0);
+            PyObject *it = TOP();
+            DEOPT_IF(Py_TYPE(it) != &PyEnum_Type, FOR_ITER);
+            STAT_INC(FOR_ITER, hit);
+            assert(_PyOpcode_Deopt[_Py_OPCODE(next_instr[INLINE_CACHE_ENTRIES_FOR_ITER])]
+                   == UNPACK_SEQUENCE);
+            assert(_Py_OPARG(next_instr[INLINE_CACHE_ENTRIES_FOR_ITER]) == 2);
+            PyObject *index, *item;
+            int res = _PyEnum_NextPair(it, &index, &item);
+            if (res < 0) {
+                goto error;
+            }
+            if (res == 0) {
+                STACK_SHRINK(1);
+                Py_DECREF(it);
+                JUMPBY(INLINE_CACHE_ENTRIES_FOR_ITER + oparg + 1);
+            }
+            else {
+                // The UNPACK_SEQUENCE is already done.
+                PUSH(item);
+                PUSH(index);
+                JUMPBY(INLINE_CACHE_ENTRIES_FOR_ITER + 1 +
+                       INLINE_CACHE_ENTRIES_UNPACK_SEQUENCE);
+            }
+        }
+
         inst(FOR_ITER_GEN) {
             assert(cframe.use_tracing == 0);
             PyGenObject *gen = (PyGenObject *)TOP();
@@ -2957,6 +3806,86 @@ dummy_func(
             DISPATCH_INLINED(new_frame);
         }
 
+        // stack effect: (__0, __array[oparg] -- )
+        inst(CALL_NO_KW_ALLOC_AND_ENTER_INIT) {
+            /* This instruction does the following:
+             * 1. Creates the object (as object.__new__ would)
+             * 2. Pushes a shim frame that checks the result of __init__
+             *    and returns the object to this frame.
+             * 3. Pushes the frame for __init__ on top of the shim.
+             */
+            assert(kwnames == NULL);
+            DEOPT_IF(tstate->interp->eval_frame, CALL);
+            DEOPT_IF(is_method(stack_pointer, oparg), CALL);
+            _PyCallCache *cache = (_PyCallCache *)next_instr;
+            PyObject *callable = PEEK(oparg + 1);
+            DEOPT_IF(!PyType_Check(callable), CALL);
+            PyTypeObject *tp = (PyTypeObject *)callable;
+            /* func_version holds the version of the class, and min_args
+             * the version of its __init__ */
+            DEOPT_IF(tp->tp_version_tag != read_u32(cache->func_version), CALL);
+            assert(tp->tp_flags & Py_TPFLAGS_HEAPTYPE);
+            PyObject *cached = ((PyHeapTypeObject *)tp)->_spec_cache.init;
+            assert(PyFunction_Check(cached));
+            PyFunctionObject *init = (PyFunctionObject *)cached;
+            DEOPT_IF(init->func_version != cache->min_args, CALL);
+            PyCodeObject *code = (PyCodeObject *)init->func_code;
+            assert(code->co_argcount == oparg + 1);
+            PyCodeObject *shim_code = tstate->interp->init_cleanup;
+            DEOPT_IF(!_PyThreadState_HasStackSpace(tstate,
+                code->co_framesize + shim_code->co_framesize), CALL);
+            STAT_INC(CALL, hit);
+            /* Same as object_new(), minus the checks done by the specializer */
+            PyObject *self = tp->tp_alloc(tp, 0);
+            if (self == NULL) {
+                goto error;
+            }
+            if (_PyObject_InitializeDict(self)) {
+                Py_DECREF(self);
+                goto error;
+            }
+            Py_DECREF(tp);
+            _PyInterpreterFrame *shim = _PyFrame_PushTrampolineUnchecked(
+                tstate, (PyFunctionObject *)Py_NewRef(init), shim_code, 1);
+            /* The shim keeps the object alive and returns it */
+            shim->localsplus[0] = Py_NewRef(self);
+            _PyInterpreterFrame *init_frame = _PyFrame_PushUnchecked(
+                tstate, (PyFunctionObject *)Py_NewRef(init));
+            STACK_SHRINK(oparg);
+            init_frame->localsplus[0] = self;
+            for (int i = 0; i < oparg; i++) {
+                init_frame->localsplus[i+1] = stack_pointer[i];
+            }
+            for (int i = oparg+1; i < code->co_nlocalsplus; i++) {
+                init_frame->localsplus[i] = NULL;
+            }
+            STACK_SHRINK(2);
+            JUMPBY(INLINE_CACHE_ENTRIES_CALL);
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            frame->prev_instr = next_instr - 1;
+            /* Link frames */
+            shim->previous = frame;
+            init_frame->previous = shim;
+            frame = cframe.current_frame = init_frame;
+            CALL_STAT_INC(inlined_py_calls);
+            /* Account for pushing the shim frame. The recursion limit is
+             * checked for the __init__ frame at start_frame */
+            tstate->py_recursion_remaining--;
+            goto start_frame;
+        }
+
+        inst(EXIT_INIT_CHECK, (should_be_none -- )) {
+            assert(STACK_LEVEL() == 2);
+            if (should_be_none != Py_None) {
+                PyErr_Format(PyExc_TypeError,
+                             "__init__() should return None, not '%.200s'",
+                             Py_TYPE(should_be_none)->tp_name);
+                Py_DECREF(should_be_none);
+                ERROR_IF(true, error);
+            }
+            Py_DECREF(should_be_none);
+        }
+
         // stack effect: (__0, __array[oparg] -- )
         inst(CALL_NO_KW_TYPE_1) {
             assert(kwnames == NULL);
@@ -3242,7 +4171,7 @@ dummy_func(
             Py_DECREF(callable);
             // CALL + POP_TOP
             JUMPBY(INLINE_CACHE_ENTRIES_CALL + 1);
-            assert(_Py_OPCODE(next_instr[-1]) == POP_TOP);
+            assert(_PyOpcode_Deopt[_Py_OPCODE(next_instr[-1])] == POP_TOP);
         }
 
         // stack effect: (__0, __array[oparg] -- )
@@ -3389,6 +4318,17 @@ dummy_func(
 
         // error: CALL_FUNCTION_EX has irregular stack effect
         inst(CALL_FUNCTION_EX) {
+            _PyCallFunctionExCache *cache = (_PyCallFunctionExCache *)next_instr;
+            if (ADAPTIVE_COUNTER_IS_ZERO(cache->counter)) {
+                assert(cframe.use_tracing == 0);
+                next_instr--;
+                _Py_Specialize_CallFunctionEx(PEEK(2 + (oparg & 0x01)),
+                                              PEEK(1 + (oparg & 0x01)),
+                                              next_instr);
+                DISPATCH_SAME_OPARG();
+            }
+            STAT_INC(CALL_FUNCTION_EX, deferred);
+            DECREMENT_ADAPTIVE_COUNTER(cache->counter);
             PyObject *func, *callargs, *kwargs = NULL, *result;
             if (oparg & 0x01) {
                 kwargs = POP();
@@ -3421,9 +4361,39 @@ dummy_func(
             if (result == NULL) {
                 goto error;
             }
+            JUMPBY(INLINE_CACHE_ENTRIES_CALL_FUNCTION_EX);
             CHECK_EVAL_BREAKER();
         }
 
+        // error: CALL_FUNCTION_EX has irregular stack effect
+        inst(CALL_FUNCTION_EX_PY) {
+            assert(cframe.use_tracing == 0);
+            DEOPT_IF(tstate->interp->eval_frame, CALL_FUNCTION_EX);
+            PyObject *kwargs = (oparg & 0x01) ? TOP() : NULL;
+            PyObject *callargs = PEEK(1 + (oparg & 0x01));
+            PyObject *func = PEEK(2 + (oparg & 0x01));
+            DEOPT_IF(!PyTuple_CheckExact(callargs), CALL_FUNCTION_EX);
+            DEOPT_IF(Py_TYPE(func) != &PyFunction_Type, CALL_FUNCTION_EX);
+            DEOPT_IF(((PyFunctionObject *)func)->vectorcall != _PyFunction_Vectorcall,
+                     CALL_FUNCTION_EX);
+            assert(kwargs == NULL || PyDict_CheckExact(kwargs));
+            STAT_INC(CALL_FUNCTION_EX, hit);
+            int code_flags = ((PyCodeObject *)PyFunction_GET_CODE(func))->co_flags;
+            PyObject *locals = code_flags & CO_OPTIMIZED ? NULL : Py_NewRef(PyFunction_GET_GLOBALS(func));
+            // Pop kwargs, callargs, func and the NULL below func
+            STACK_SHRINK(3 + (oparg & 0x01));
+            assert(stack_pointer[0] == NULL);
+            _PyInterpreterFrame *new_frame = _PyEvalFramePushAndInit_Ex(
+                tstate, (PyFunctionObject *)func, locals, callargs, kwargs);
+            // The frame has stolen func, callargs and kwargs from the stack,
+            // so there is no need to clean them up.
+            if (new_frame == NULL) {
+                goto error;
+            }
+            JUMPBY(INLINE_CACHE_ENTRIES_CALL_FUNCTION_EX);
+            DISPATCH_INLINED(new_frame);
+        }
+
         // error: MAKE_FUNCTION has irregular stack effect
         inst(MAKE_FUNCTION) {
             PyObject *codeobj = POP();
@@ -3501,6 +4471,17 @@ dummy_func(
         // error: FORMAT_VALUE has irregular stack effect
         inst(FORMAT_VALUE) {
             /* Handles f-string value formatting. */
+            _PyFormatValueCache *cache = (_PyFormatValueCache *)next_instr;
+            if (ADAPTIVE_COUNTER_IS_ZERO(cache->counter)) {
+                assert(cframe.use_tracing == 0);
+                next_instr--;
+                _Py_Specialize_FormatValue(
+                    (oparg & FVS_MASK) == FVS_HAVE_SPEC ? SECOND() : TOP(),
+                    next_instr, oparg);
+                DISPATCH_SAME_OPARG();
+            }
+            STAT_INC(FORMAT_VALUE, deferred);
+            DECREMENT_ADAPTIVE_COUNTER(cache->counter);
             PyObject *result;
             PyObject *fmt_spec;
             PyObject *value;
@@ -3555,9 +4536,58 @@ dummy_func(
                 }
             }
 
+            JUMPBY(INLINE_CACHE_ENTRIES_FORMAT_VALUE);
             PUSH(result);
         }
 
+        // stack effect: ( -- )
+        inst(FORMAT_VALUE_STR) {
+            assert(cframe.use_tracing == 0);
+            assert((oparg & FVS_MASK) == 0);
+            assert((oparg & FVC_MASK) == FVC_NONE ||
+                   (oparg & FVC_MASK) == FVC_STR);
+            PyObject *value = TOP();
+            DEOPT_IF(!PyUnicode_CheckExact(value), FORMAT_VALUE);
+            STAT_INC(FORMAT_VALUE, hit);
+            /* format(value) and str(value) are value itself */
+            JUMPBY(INLINE_CACHE_ENTRIES_FORMAT_VALUE);
+        }
+
+        // stack effect: ( -- )
+        inst(FORMAT_VALUE_INT) {
+            assert(cframe.use_tracing == 0);
+            assert((oparg & FVS_MASK) == 0);
+            PyObject *value = TOP();
+            DEOPT_IF(!PyLong_CheckExact(value), FORMAT_VALUE);
+            STAT_INC(FORMAT_VALUE, hit);
+            /* For an exact int, format() with an empty spec, str(),
+               repr() and ascii() all give the decimal representation */
+            PyObject *result = _PyLong_Format(value, 10);
+            if (result == NULL) {
+                goto error;
+            }
+            _Py_DECREF_SPECIALIZED(value, (destructor)PyObject_Free);
+            SET_TOP(result);
+            JUMPBY(INLINE_CACHE_ENTRIES_FORMAT_VALUE);
+        }
+
+        // stack effect: ( -- )
+        inst(FORMAT_VALUE_FLOAT) {
+            assert(cframe.use_tracing == 0);
+            assert((oparg & FVS_MASK) == 0);
+            PyObject *value = TOP();
+            DEOPT_IF(!PyFloat_CheckExact(value), FORMAT_VALUE);
+            STAT_INC(FORMAT_VALUE, hit);
+            /* Likewise, these all give the repr() of an exact float */
+            PyObject *result = PyFloat_Type.tp_repr(value);
+            if (result == NULL) {
+                goto error;
+            }
+            _Py_DECREF_SPECIALIZED(value, _PyFloat_ExactDealloc);
+            SET_TOP(result);
+            JUMPBY(INLINE_CACHE_ENTRIES_FORMAT_VALUE);
+        }
+
         // stack effect: ( -- __0)
         inst(COPY) {
             assert(oparg != 0);
@@ -3626,26 +4656,32 @@ dummy_func(
 family(call) = {
     CALL, CALL_PY_EXACT_ARGS,
     CALL_PY_WITH_DEFAULTS, CALL_BOUND_METHOD_EXACT_ARGS, CALL_BUILTIN_CLASS,
-    CALL_BUILTIN_FAST_WITH_KEYWORDS, CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS, CALL_NO_KW_BUILTIN_FAST,
+    CALL_BUILTIN_FAST_WITH_KEYWORDS, CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS,
+    CALL_NO_KW_ALLOC_AND_ENTER_INIT, CALL_NO_KW_BUILTIN_FAST,
     CALL_NO_KW_BUILTIN_O, CALL_NO_KW_ISINSTANCE, CALL_NO_KW_LEN,
     CALL_NO_KW_LIST_APPEND, CALL_NO_KW_METHOD_DESCRIPTOR_FAST, CALL_NO_KW_METHOD_DESCRIPTOR_NOARGS,
     CALL_NO_KW_METHOD_DESCRIPTOR_O, CALL_NO_KW_STR_1, CALL_NO_KW_TUPLE_1,
     CALL_NO_KW_TYPE_1 };
+family(call_function_ex) = { CALL_FUNCTION_EX, CALL_FUNCTION_EX_PY };
 family(for_iter) = {
     FOR_ITER, FOR_ITER_LIST,
-    FOR_ITER_RANGE };
+    FOR_ITER_RANGE, FOR_ITER_DICT_KEYS, FOR_ITER_DICT_VALUES,
+    FOR_ITER_DICT_ITEMS, FOR_ITER_ENUMERATE };
+family(format_value) = {
+    FORMAT_VALUE, FORMAT_VALUE_FLOAT, FORMAT_VALUE_INT, FORMAT_VALUE_STR };
+family(jump_backward) = { JUMP_BACKWARD, JUMP_BACKWARD_INTO_TRACE };
 family(load_attr) = {
     LOAD_ATTR, LOAD_ATTR_CLASS,
     LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN, LOAD_ATTR_INSTANCE_VALUE, LOAD_ATTR_MODULE,
     LOAD_ATTR_PROPERTY, LOAD_ATTR_SLOT, LOAD_ATTR_WITH_HINT,
     LOAD_ATTR_METHOD_LAZY_DICT, LOAD_ATTR_METHOD_NO_DICT, LOAD_ATTR_METHOD_WITH_DICT,
     LOAD_ATTR_METHOD_WITH_VALUES };
-family(load_const) = { LOAD_CONST, LOAD_CONST__LOAD_FAST };
-family(load_fast) = { LOAD_FAST, LOAD_FAST__LOAD_CONST, LOAD_FAST__LOAD_FAST };
 family(load_global) = {
     LOAD_GLOBAL, LOAD_GLOBAL_BUILTIN,
     LOAD_GLOBAL_MODULE };
-family(store_fast) = { STORE_FAST, STORE_FAST__LOAD_FAST, STORE_FAST__STORE_FAST };
+family(load_super_attr) = {
+    LOAD_SUPER_ATTR, LOAD_SUPER_ATTR_ATTR, LOAD_SUPER_ATTR_METHOD };
+family(send) = { SEND, SEND_GEN };
 family(unpack_sequence) = {
     UNPACK_SEQUENCE, UNPACK_SEQUENCE_LIST,
     UNPACK_SEQUENCE_TUPLE, UNPACK_SEQUENCE_TWO_TUPLE };
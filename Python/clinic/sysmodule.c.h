@@ -1178,6 +1178,229 @@ sys__stats_dump(PyObject *module, PyObject *Py_UNUSED(ignored))
 
 #endif /* defined(Py_STATS) */
 
+PyDoc_STRVAR(sys__load_specialization_profile__doc__,
+"_load_specialization_profile($module, path, /)\n"
+"--\n"
+"\n"
+"Load a specialization profile written by _dump_specialization_profile().\n"
+"\n"
+"Code objects created from now on with the same bytecode as those in the\n"
+"profile start out specialized as far as they had been.");
+
+#define SYS__LOAD_SPECIALIZATION_PROFILE_METHODDEF    \
+    {"_load_specialization_profile", (PyCFunction)sys__load_specialization_profile, METH_O, sys__load_specialization_profile__doc__},
+
+static PyObject *
+sys__load_specialization_profile_impl(PyObject *module, PyObject *path);
+
+static PyObject *
+sys__load_specialization_profile(PyObject *module, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    PyObject *path;
+
+    if (!PyUnicode_Check(arg)) {
+        _PyArg_BadArgument("_load_specialization_profile", "argument", "str", arg);
+        goto exit;
+    }
+    if (PyUnicode_READY(arg) == -1) {
+        goto exit;
+    }
+    path = arg;
+    return_value = sys__load_specialization_profile_impl(module, path);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(sys__dump_specialization_profile__doc__,
+"_dump_specialization_profile($module, path, /)\n"
+"--\n"
+"\n"
+"Write how far code objects have specialized to a specialization profile.\n"
+"\n"
+"This covers the loaded profile and the code objects created since it was\n"
+"loaded, with _load_specialization_profile() or PYTHONSPECIALIZATIONPROFILE.");
+
+#define SYS__DUMP_SPECIALIZATION_PROFILE_METHODDEF    \
+    {"_dump_specialization_profile", (PyCFunction)sys__dump_specialization_profile, METH_O, sys__dump_specialization_profile__doc__},
+
+static PyObject *
+sys__dump_specialization_profile_impl(PyObject *module, PyObject *path);
+
+static PyObject *
+sys__dump_specialization_profile(PyObject *module, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    PyObject *path;
+
+    if (!PyUnicode_Check(arg)) {
+        _PyArg_BadArgument("_dump_specialization_profile", "argument", "str", arg);
+        goto exit;
+    }
+    if (PyUnicode_READY(arg) == -1) {
+        goto exit;
+    }
+    path = arg;
+    return_value = sys__dump_specialization_profile_impl(module, path);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(sys__specialization_telemetry_on__doc__,
+"_specialization_telemetry_on($module, /)\n"
+"--\n"
+"\n"
+"Turn on the specialization telemetry.");
+
+#define SYS__SPECIALIZATION_TELEMETRY_ON_METHODDEF    \
+    {"_specialization_telemetry_on", (PyCFunction)sys__specialization_telemetry_on, METH_NOARGS, sys__specialization_telemetry_on__doc__},
+
+static PyObject *
+sys__specialization_telemetry_on_impl(PyObject *module);
+
+static PyObject *
+sys__specialization_telemetry_on(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    return sys__specialization_telemetry_on_impl(module);
+}
+
+PyDoc_STRVAR(sys__specialization_telemetry_off__doc__,
+"_specialization_telemetry_off($module, /)\n"
+"--\n"
+"\n"
+"Turn off the specialization telemetry, keeping what it has counted.");
+
+#define SYS__SPECIALIZATION_TELEMETRY_OFF_METHODDEF    \
+    {"_specialization_telemetry_off", (PyCFunction)sys__specialization_telemetry_off, METH_NOARGS, sys__specialization_telemetry_off__doc__},
+
+static PyObject *
+sys__specialization_telemetry_off_impl(PyObject *module);
+
+static PyObject *
+sys__specialization_telemetry_off(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    return sys__specialization_telemetry_off_impl(module);
+}
+
+PyDoc_STRVAR(sys__specialization_telemetry_clear__doc__,
+"_specialization_telemetry_clear($module, /)\n"
+"--\n"
+"\n"
+"Clear the counts of the specialization telemetry.");
+
+#define SYS__SPECIALIZATION_TELEMETRY_CLEAR_METHODDEF    \
+    {"_specialization_telemetry_clear", (PyCFunction)sys__specialization_telemetry_clear, METH_NOARGS, sys__specialization_telemetry_clear__doc__},
+
+static PyObject *
+sys__specialization_telemetry_clear_impl(PyObject *module);
+
+static PyObject *
+sys__specialization_telemetry_clear(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    return sys__specialization_telemetry_clear_impl(module);
+}
+
+PyDoc_STRVAR(sys__specialization_telemetry_dump__doc__,
+"_specialization_telemetry_dump($module, /, dirname=None)\n"
+"--\n"
+"\n"
+"Write the specialization telemetry to a new file, and clear it.\n"
+"\n"
+"The file is created in the directory dirname, by default the one that\n"
+"Py_STATS builds write their stats to, in the format that\n"
+"Tools/scripts/summarize_stats.py reads.  Return the file\'s path.");
+
+#define SYS__SPECIALIZATION_TELEMETRY_DUMP_METHODDEF    \
+    {"_specialization_telemetry_dump", _PyCFunction_CAST(sys__specialization_telemetry_dump), METH_FASTCALL|METH_KEYWORDS, sys__specialization_telemetry_dump__doc__},
+
+static PyObject *
+sys__specialization_telemetry_dump_impl(PyObject *module, PyObject *dirname);
+
+static PyObject *
+sys__specialization_telemetry_dump(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 1
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_item = { &_Py_ID(dirname), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"dirname", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "_specialization_telemetry_dump",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[1];
+    Py_ssize_t noptargs = nargs + (kwnames ? PyTuple_GET_SIZE(kwnames) : 0) - 0;
+    PyObject *dirname = Py_None;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser, 0, 1, 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    if (!noptargs) {
+        goto skip_optional_pos;
+    }
+    dirname = args[0];
+skip_optional_pos:
+    return_value = sys__specialization_telemetry_dump_impl(module, dirname);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(sys__get_specialization_telemetry__doc__,
+"_get_specialization_telemetry($module, code, /)\n"
+"--\n"
+"\n"
+"Return the specialization telemetry of a code object.\n"
+"\n"
+"This is a dict mapping the offset of each instruction the telemetry has\n"
+"counted something for to a dict of its counts: \"success\" and \"failure\" for\n"
+"attempts to specialize it, \"miss\" for times its specialized form didn\'t\n"
+"apply, \"deopt\" for those that made it specialize again, and \"failure_kinds\",\n"
+"the SPEC_FAIL kinds of its failures.");
+
+#define SYS__GET_SPECIALIZATION_TELEMETRY_METHODDEF    \
+    {"_get_specialization_telemetry", (PyCFunction)sys__get_specialization_telemetry, METH_O, sys__get_specialization_telemetry__doc__},
+
+static PyObject *
+sys__get_specialization_telemetry_impl(PyObject *module, PyCodeObject *code);
+
+static PyObject *
+sys__get_specialization_telemetry(PyObject *module, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    PyCodeObject *code;
+
+    if (!PyObject_TypeCheck(arg, &PyCode_Type)) {
+        _PyArg_BadArgument("_get_specialization_telemetry", "argument", (&PyCode_Type)->tp_name, arg);
+        goto exit;
+    }
+    code = (PyCodeObject *)arg;
+    return_value = sys__get_specialization_telemetry_impl(module, code);
+
+exit:
+    return return_value;
+}
+
 #if defined(ANDROID_API_LEVEL)
 
 PyDoc_STRVAR(sys_getandroidapilevel__doc__,
@@ -1318,4 +1541,4 @@ sys_is_stack_trampoline_active(PyObject *module, PyObject *Py_UNUSED(ignored))
 #ifndef SYS_GETANDROIDAPILEVEL_METHODDEF
     #define SYS_GETANDROIDAPILEVEL_METHODDEF
 #endif /* !defined(SYS_GETANDROIDAPILEVEL_METHODDEF) */
-/*[clinic end generated code: output=79228e569529129c input=a9049054013a1b77]*/
+/*[clinic end generated code: output=d16d9959ddb9a1df input=a9049054013a1b77]*/
@@ -114,12 +114,10 @@
          (opcode) == RAISE_VARARGS || \
          (opcode) == RERAISE)
 
-#define IS_SUPERINSTRUCTION_OPCODE(opcode) \
-        ((opcode) == LOAD_FAST__LOAD_FAST || \
-         (opcode) == LOAD_FAST__LOAD_CONST || \
-         (opcode) == LOAD_CONST__LOAD_FAST || \
-         (opcode) == STORE_FAST__LOAD_FAST || \
-         (opcode) == STORE_FAST__STORE_FAST)
+/* Specialized instructions, superinstructions included, only ever appear
+   in quickened code */
+#define IS_SPECIALIZED_OPCODE(opcode) \
+        ((opcode) < 256 && _PyOpcode_Deopt[(opcode)] != (opcode))
 
 #define IS_TOP_LEVEL_AWAIT(c) ( \
         (c->c_flags.cf_flags & PyCF_ALLOW_TOP_LEVEL_AWAIT) \
@@ -519,13 +517,15 @@ static int compiler_sync_comprehension_generator(
                                       struct compiler *c, location loc,
                                       asdl_comprehension_seq *generators, int gen_index,
                                       int depth,
-                                      expr_ty elt, expr_ty val, int type);
+                                      expr_ty elt, expr_ty val, int type,
+                                      int iter_on_stack);
 
 static int compiler_async_comprehension_generator(
                                       struct compiler *c, location loc,
                                       asdl_comprehension_seq *generators, int gen_index,
                                       int depth,
-                                      expr_ty elt, expr_ty val, int type);
+                                      expr_ty elt, expr_ty val, int type,
+                                      int iter_on_stack);
 
 static int compiler_pattern(struct compiler *, pattern_ty, pattern_context *);
 static int compiler_match(struct compiler *, stmt_ty);
@@ -1050,6 +1050,8 @@ stack_effect(int opcode, int oparg, int jump)
             return 0;
         case END_FOR:
             return -2;
+        case END_SEND:
+            return -1;
 
         /* Unary operators */
         case UNARY_POSITIVE:
@@ -1108,7 +1110,7 @@ stack_effect(int opcode, int oparg, int jump)
         case FOR_ITER:
             return 1;
         case SEND:
-            return jump > 0 ? -1 : 0;
+            return 0;
         case STORE_ATTR:
             return -2;
         case DELETE_ATTR:
@@ -1132,6 +1134,8 @@ stack_effect(int opcode, int oparg, int jump)
             return -oparg;
         case LOAD_ATTR:
             return (oparg & 1);
+        case LOAD_SUPER_ATTR:
+            return -2 + (oparg & 1);
         case COMPARE_OP:
         case IS_OP:
         case CONTAINS_OP:
@@ -1197,8 +1201,10 @@ stack_effect(int opcode, int oparg, int jump)
 
         case LOAD_FAST:
         case LOAD_FAST_CHECK:
+        case LOAD_FAST_AND_CLEAR:
             return 1;
         case STORE_FAST:
+        case STORE_FAST_MAYBE_NULL:
             return -1;
         case DELETE_FAST:
             return 0;
@@ -1256,13 +1262,18 @@ stack_effect(int opcode, int oparg, int jump)
         case END_ASYNC_FOR:
             return -2;
         case CLEANUP_THROW:
-            return -2;
+            return -1;
         case FORMAT_VALUE:
             /* If there's a fmt_spec on the stack, we go from 2->1,
                else 1->1. */
             return (oparg & FVS_MASK) == FVS_HAVE_SPEC ? -1 : 0;
         case LOAD_METHOD:
             return 1;
+        case LOAD_SUPER_METHOD:
+        case LOAD_ZERO_SUPER_METHOD:
+            return -1;
+        case LOAD_ZERO_SUPER_ATTR:
+            return -2;
         case LOAD_ASSERTION_ERROR:
             return 1;
         case LIST_TO_TUPLE:
@@ -1285,6 +1296,8 @@ stack_effect(int opcode, int oparg, int jump)
         case BINARY_OP:
             return -1;
         case INTERPRETER_EXIT:
+        case EXIT_INIT_CHECK:
+        case RETURN_DISCARD:
             return -1;
         default:
             return PY_INVALID_STACK_EFFECT;
@@ -1558,6 +1571,26 @@ compiler_addop_name(struct compiler *c, location loc,
         arg <<= 1;
         arg |= 1;
     }
+    /* The low bit of LOAD_SUPER_ATTR's oparg requests a method load,
+       the next bit marks the two-argument form of super() */
+    if (opcode == LOAD_SUPER_ATTR) {
+        arg <<= 2;
+        arg |= 2;
+    }
+    else if (opcode == LOAD_SUPER_METHOD) {
+        opcode = LOAD_SUPER_ATTR;
+        arg <<= 2;
+        arg |= 3;
+    }
+    else if (opcode == LOAD_ZERO_SUPER_ATTR) {
+        opcode = LOAD_SUPER_ATTR;
+        arg <<= 2;
+    }
+    else if (opcode == LOAD_ZERO_SUPER_METHOD) {
+        opcode = LOAD_SUPER_ATTR;
+        arg <<= 2;
+        arg |= 1;
+    }
     return cfg_builder_addop_i(CFG_BUILDER(c), opcode, arg, loc);
 }
 
@@ -1966,6 +1999,7 @@ compiler_add_yield_from(struct compiler *c, location loc, int await)
     ADDOP(c, loc, CLEANUP_THROW);
 
     USE_LABEL(c, exit);
+    ADDOP(c, loc, END_SEND);
     return 1;
 }
 
@@ -4838,6 +4872,87 @@ update_start_location_to_match_attr(struct compiler *c, location loc,
     return loc;
 }
 
+/* Return 1 if the attribute access can be compiled to LOAD_SUPER_ATTR,
+   that is if its value is a call of the builtin super() either with no
+   arguments, inside a method, or with two positional arguments. */
+static int
+can_optimize_super_call(struct compiler *c, expr_ty attr)
+{
+    expr_ty e = attr->v.Attribute.value;
+    if (e->kind != Call_kind ||
+        e->v.Call.func->kind != Name_kind ||
+        !_PyUnicode_EqualToASCIIString(e->v.Call.func->v.Name.id, "super") ||
+        _PyUnicode_EqualToASCIIString(attr->v.Attribute.attr, "__class__") ||
+        asdl_seq_LEN(e->v.Call.keywords) != 0) {
+        return 0;
+    }
+    Py_ssize_t num_args = asdl_seq_LEN(e->v.Call.args);
+
+    PyObject *super_name = e->v.Call.func->v.Name.id;
+    // detect statically-visible shadowing of 'super' name
+    int scope = _PyST_GetScope(c->u->u_ste, super_name);
+    if (scope != GLOBAL_IMPLICIT) {
+        return 0;
+    }
+    scope = _PyST_GetScope(c->c_st->st_top, super_name);
+    if (scope != 0) {
+        return 0;
+    }
+
+    if (num_args == 2) {
+        for (Py_ssize_t i = 0; i < num_args; i++) {
+            expr_ty elt = asdl_seq_GET(e->v.Call.args, i);
+            if (elt->kind == Starred_kind) {
+                return 0;
+            }
+        }
+        return 1;
+    }
+
+    if (num_args != 0) {
+        return 0;
+    }
+    // zero-arg super() needs the enclosing function's first argument...
+    if (c->u->u_argcount == 0 && c->u->u_posonlyargcount == 0) {
+        return 0;
+    }
+    // ...and the __class__ cell
+    return get_ref_type(c, &_Py_ID(__class__)) == FREE;
+}
+
+/* Push super, the class and the instance for LOAD_SUPER_ATTR */
+static int
+load_args_for_super(struct compiler *c, expr_ty e)
+{
+    location loc = LOC(e);
+
+    PyObject *super_name = e->v.Call.func->v.Name.id;
+    if (!compiler_nameop(c, LOC(e->v.Call.func), super_name, Load)) {
+        return 0;
+    }
+
+    if (asdl_seq_LEN(e->v.Call.args) == 2) {
+        VISIT(c, expr, asdl_seq_GET(e->v.Call.args, 0));
+        VISIT(c, expr, asdl_seq_GET(e->v.Call.args, 1));
+        return 1;
+    }
+
+    // load __class__ cell
+    PyObject *name = &_Py_ID(__class__);
+    assert(get_ref_type(c, name) == FREE);
+    if (!compiler_nameop(c, loc, name, Load)) {
+        return 0;
+    }
+
+    // load self (first argument)
+    Py_ssize_t i = 0;
+    PyObject *key, *value;
+    if (!PyDict_Next(c->u->u_varnames, &i, &key, &value)) {
+        return 0;
+    }
+    return compiler_nameop(c, loc, key, Load);
+}
+
 // Return 1 if the method call was optimized, -1 if not, and 0 on error.
 static int
 maybe_optimize_method_call(struct compiler *c, expr_ty e)
@@ -4878,10 +4993,22 @@ maybe_optimize_method_call(struct compiler *c, expr_ty e)
         }
     }
     /* Alright, we can optimize the code. */
-    VISIT(c, expr, meth->v.Attribute.value);
     location loc = LOC(meth);
-    loc = update_start_location_to_match_attr(c, loc, meth);
-    ADDOP_NAME(c, loc, LOAD_METHOD, meth->v.Attribute.attr, names);
+
+    if (can_optimize_super_call(c, meth)) {
+        if (!load_args_for_super(c, meth->v.Attribute.value)) {
+            return 0;
+        }
+        int opcode = asdl_seq_LEN(meth->v.Attribute.value->v.Call.args) ?
+            LOAD_SUPER_METHOD : LOAD_ZERO_SUPER_METHOD;
+        loc = update_start_location_to_match_attr(c, loc, meth);
+        ADDOP_NAME(c, loc, opcode, meth->v.Attribute.attr, names);
+    }
+    else {
+        VISIT(c, expr, meth->v.Attribute.value);
+        loc = update_start_location_to_match_attr(c, loc, meth);
+        ADDOP_NAME(c, loc, LOAD_METHOD, meth->v.Attribute.attr, names);
+    }
     VISIT_SEQ(c, expr, e->v.Call.args);
 
     if (kwdsl) {
@@ -5207,16 +5334,19 @@ static int
 compiler_comprehension_generator(struct compiler *c, location loc,
                                  asdl_comprehension_seq *generators, int gen_index,
                                  int depth,
-                                 expr_ty elt, expr_ty val, int type)
+                                 expr_ty elt, expr_ty val, int type,
+                                 int iter_on_stack)
 {
     comprehension_ty gen;
     gen = (comprehension_ty)asdl_seq_GET(generators, gen_index);
     if (gen->is_async) {
         return compiler_async_comprehension_generator(
-            c, loc, generators, gen_index, depth, elt, val, type);
+            c, loc, generators, gen_index, depth, elt, val, type,
+            iter_on_stack);
     } else {
         return compiler_sync_comprehension_generator(
-            c, loc, generators, gen_index, depth, elt, val, type);
+            c, loc, generators, gen_index, depth, elt, val, type,
+            iter_on_stack);
     }
 }
 
@@ -5224,7 +5354,8 @@ static int
 compiler_sync_comprehension_generator(struct compiler *c, location loc,
                                       asdl_comprehension_seq *generators,
                                       int gen_index, int depth,
-                                      expr_ty elt, expr_ty val, int type)
+                                      expr_ty elt, expr_ty val, int type,
+                                      int iter_on_stack)
 {
     /* generate code for the iterator, then each of the ifs,
        and then write to the element */
@@ -5237,9 +5368,11 @@ compiler_sync_comprehension_generator(struct compiler *c, location loc,
                                                           gen_index);
 
     if (gen_index == 0) {
-        /* Receive outermost iter as an implicit argument */
-        c->u->u_argcount = 1;
-        ADDOP_I(c, loc, LOAD_FAST, 0);
+        if (!iter_on_stack) {
+            /* Receive outermost iter as an implicit argument */
+            c->u->u_argcount = 1;
+            ADDOP_I(c, loc, LOAD_FAST, 0);
+        }
     }
     else {
         /* Sub-iter - calculate on the fly */
@@ -5288,7 +5421,7 @@ compiler_sync_comprehension_generator(struct compiler *c, location loc,
     if (++gen_index < asdl_seq_LEN(generators)) {
         if (!compiler_comprehension_generator(c, loc,
                                               generators, gen_index, depth,
-                                              elt, val, type)) {
+                                              elt, val, type, 0)) {
             return 0;
         }
     }
@@ -5343,7 +5476,8 @@ static int
 compiler_async_comprehension_generator(struct compiler *c, location loc,
                                       asdl_comprehension_seq *generators,
                                       int gen_index, int depth,
-                                      expr_ty elt, expr_ty val, int type)
+                                      expr_ty elt, expr_ty val, int type,
+                                      int iter_on_stack)
 {
     NEW_JUMP_TARGET_LABEL(c, start);
     NEW_JUMP_TARGET_LABEL(c, except);
@@ -5353,9 +5487,11 @@ compiler_async_comprehension_generator(struct compiler *c, location loc,
                                                           gen_index);
 
     if (gen_index == 0) {
-        /* Receive outermost iter as an implicit argument */
-        c->u->u_argcount = 1;
-        ADDOP_I(c, loc, LOAD_FAST, 0);
+        if (!iter_on_stack) {
+            /* Receive outermost iter as an implicit argument */
+            c->u->u_argcount = 1;
+            ADDOP_I(c, loc, LOAD_FAST, 0);
+        }
     }
     else {
         /* Sub-iter - calculate on the fly */
@@ -5389,7 +5525,7 @@ compiler_async_comprehension_generator(struct compiler *c, location loc,
     if (++gen_index < asdl_seq_LEN(generators)) {
         if (!compiler_comprehension_generator(c, loc,
                                               generators, gen_index, depth,
-                                              elt, val, type)) {
+                                              elt, val, type, 0)) {
             return 0;
         }
     }
@@ -5440,6 +5576,127 @@ compiler_async_comprehension_generator(struct compiler *c, location loc,
     return 1;
 }
 
+/* An inlined comprehension runs in the frame of the enclosing function.
+   The names it binds are plain locals of that function (see
+   inline_comprehension() in symtable.c), so their previous values are
+   pushed onto the stack before the comprehension runs and restored after
+   it, even if it raises.
+
+   Return a new list of the names to save, or NULL on error.
+ */
+static PyObject *
+inlined_comprehension_locals(struct compiler *c, PySTEntryObject *entry)
+{
+    PyObject *k, *v;
+    Py_ssize_t pos = 0;
+    PyObject *names = PyList_New(0);
+    if (names == NULL) {
+        return NULL;
+    }
+    while (PyDict_Next(entry->ste_symbols, &pos, &k, &v)) {
+        long symbol = PyLong_AS_LONG(v);
+        if (!(symbol & DEF_LOCAL) || (symbol & DEF_NONLOCAL)) {
+            continue;
+        }
+        assert(_PyST_GetScope(c->u->u_ste, k) == LOCAL);
+        if (PyList_Append(names, k) < 0) {
+            Py_DECREF(names);
+            return NULL;
+        }
+    }
+    return names;
+}
+
+static int
+restore_inlined_comprehension_locals(struct compiler *c, location loc,
+                                     PyObject *pushed_locals)
+{
+    /* Swap the result (or the exception) back above the saved values,
+       undoing the rotation done when they were pushed */
+    Py_ssize_t npops = PyList_GET_SIZE(pushed_locals);
+    ADDOP_I(c, loc, SWAP, npops + 1);
+    for (Py_ssize_t i = npops - 1; i >= 0; --i) {
+        PyObject *k = PyList_GET_ITEM(pushed_locals, i);
+        ADDOP_NAME(c, loc, STORE_FAST_MAYBE_NULL, k, varnames);
+    }
+    return 1;
+}
+
+static int
+compiler_inlined_comprehension(struct compiler *c, expr_ty e, int type,
+                               PyObject *pushed_locals,
+                               asdl_comprehension_seq *generators,
+                               expr_ty elt, expr_ty val)
+{
+    comprehension_ty outermost = (comprehension_ty)asdl_seq_GET(generators, 0);
+    Py_ssize_t npushed = PyList_GET_SIZE(pushed_locals);
+    location loc = LOC(e);
+    int op;
+
+    switch (type) {
+    case COMP_LISTCOMP:
+        op = BUILD_LIST;
+        break;
+    case COMP_SETCOMP:
+        op = BUILD_SET;
+        break;
+    case COMP_DICTCOMP:
+        op = BUILD_MAP;
+        break;
+    default:
+        PyErr_Format(PyExc_SystemError,
+                     "unknown comprehension type %d", type);
+        return 0;
+    }
+
+    NEW_JUMP_TARGET_LABEL(c, cleanup);
+    NEW_JUMP_TARGET_LABEL(c, end);
+
+    VISIT(c, expr, outermost->iter);
+    if (outermost->is_async) {
+        ADDOP(c, loc, GET_AITER);
+    } else {
+        ADDOP(c, loc, GET_ITER);
+    }
+    if (npushed > 0) {
+        for (Py_ssize_t i = 0; i < npushed; i++) {
+            PyObject *k = PyList_GET_ITEM(pushed_locals, i);
+            /* The saved value is NULL if the local is unbound */
+            ADDOP_NAME(c, loc, LOAD_FAST_AND_CLEAR, k, varnames);
+        }
+        /* Bring the outermost iterator back to the top of the stack */
+        ADDOP_I(c, loc, SWAP, npushed + 1);
+        ADDOP_JUMP(c, loc, SETUP_FINALLY, cleanup);
+    }
+    ADDOP_I(c, loc, op, 0);
+    ADDOP_I(c, loc, SWAP, 2);
+    if (!compiler_comprehension_generator(c, loc, generators, 0, 0,
+                                          elt, val, type, 1)) {
+        return 0;
+    }
+    if (npushed > 0) {
+        ADDOP(c, NO_LOCATION, POP_BLOCK);
+        ADDOP_JUMP(c, NO_LOCATION, JUMP, end);
+
+        /* The exception is on top of the iterator */
+        USE_LABEL(c, cleanup);
+        ADDOP_I(c, NO_LOCATION, SWAP, 2);
+        ADDOP(c, NO_LOCATION, POP_TOP);
+        if (!restore_inlined_comprehension_locals(c, NO_LOCATION,
+                                                  pushed_locals)) {
+            return 0;
+        }
+        ADDOP_I(c, NO_LOCATION, RERAISE, 0);
+
+        USE_LABEL(c, end);
+        if (!restore_inlined_comprehension_locals(c, NO_LOCATION,
+                                                  pushed_locals)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
 static int
 compiler_comprehension(struct compiler *c, expr_ty e, int type,
                        identifier name, asdl_comprehension_seq *generators, expr_ty elt,
@@ -5453,14 +5710,40 @@ compiler_comprehension(struct compiler *c, expr_ty e, int type,
     int is_top_level_await = IS_TOP_LEVEL_AWAIT(c);
 
     outermost = (comprehension_ty) asdl_seq_GET(generators, 0);
+    PySTEntryObject *entry = PySymtable_Lookup(c->c_st, (void *)e);
+    if (entry == NULL) {
+        goto error;
+    }
+    int is_inlined = entry->ste_comp_inlined;
+    is_async_generator = entry->ste_coroutine;
+    location loc = LOC(e);
+
+    if (is_inlined) {
+        if (is_async_generator &&
+            scope_type != COMPILER_SCOPE_ASYNC_FUNCTION &&
+            scope_type != COMPILER_SCOPE_COMPREHENSION)
+        {
+            Py_DECREF(entry);
+            return compiler_error(c, loc, "asynchronous comprehension outside of "
+                                          "an asynchronous function");
+        }
+        PyObject *pushed_locals = inlined_comprehension_locals(c, entry);
+        Py_DECREF(entry);
+        if (pushed_locals == NULL) {
+            return 0;
+        }
+        int res = compiler_inlined_comprehension(c, e, type, pushed_locals,
+                                                 generators, elt, val);
+        Py_DECREF(pushed_locals);
+        return res;
+    }
+    Py_DECREF(entry);
+
     if (!compiler_enter_scope(c, name, COMPILER_SCOPE_COMPREHENSION,
                               (void *)e, e->lineno))
     {
         goto error;
     }
-    location loc = LOC(e);
-
-    is_async_generator = c->u->u_ste->ste_coroutine;
 
     if (is_async_generator && type != COMP_GENEXP &&
         scope_type != COMPILER_SCOPE_ASYNC_FUNCTION &&
@@ -5494,7 +5777,7 @@ compiler_comprehension(struct compiler *c, expr_ty e, int type,
     }
 
     if (!compiler_comprehension_generator(c, loc, generators, 0, 0,
-                                          elt, val, type)) {
+                                          elt, val, type, 0)) {
         goto error_in_scope;
     }
 
@@ -5907,6 +6190,16 @@ compiler_visit_expr1(struct compiler *c, expr_ty e)
         return compiler_formatted_value(c, e);
     /* The following exprs can be assignment targets. */
     case Attribute_kind:
+        if (e->v.Attribute.ctx == Load && can_optimize_super_call(c, e)) {
+            if (!load_args_for_super(c, e->v.Attribute.value)) {
+                return 0;
+            }
+            int opcode = asdl_seq_LEN(e->v.Attribute.value->v.Call.args) ?
+                LOAD_SUPER_ATTR : LOAD_ZERO_SUPER_ATTR;
+            loc = update_start_location_to_match_attr(c, LOC(e), e);
+            ADDOP_NAME(c, loc, opcode, e->v.Attribute.attr, names);
+            return 1;
+        }
         VISIT(c, expr, e->v.Attribute.value);
         loc = LOC(e);
         loc = update_start_location_to_match_attr(c, loc, e);
@@ -7613,13 +7906,16 @@ push_cold_blocks_to_end(cfg_builder *g, int code_flags) {
 }
 
 static void
-convert_exception_handlers_to_nops(basicblock *entryblock) {
+convert_pseudo_ops(basicblock *entryblock) {
     for (basicblock *b = entryblock; b != NULL; b = b->b_next) {
         for (int i = 0; i < b->b_iused; i++) {
             struct instr *instr = &b->b_instr[i];
             if (is_block_push(instr) || instr->i_opcode == POP_BLOCK) {
                 INSTR_SET_OP0(instr, NOP);
             }
+            else if (instr->i_opcode == STORE_FAST_MAYBE_NULL) {
+                instr->i_opcode = STORE_FAST;
+            }
         }
     }
     for (basicblock *b = entryblock; b != NULL; b = b->b_next) {
@@ -8064,24 +8360,25 @@ maybe_push(basicblock *b, uint64_t unsafe_mask, basicblock ***sp)
 }
 
 static void
-scan_block_for_locals(basicblock *b, basicblock ***sp)
+scan_block_for_locals(basicblock *b, int base, basicblock ***sp)
 {
-    // bit i is set if local i is potentially uninitialized
+    // bit i is set if local base+i is potentially uninitialized
     uint64_t unsafe_mask = b->b_unsafe_locals_mask;
     for (int i = 0; i < b->b_iused; i++) {
         struct instr *instr = &b->b_instr[i];
         assert(instr->i_opcode != EXTENDED_ARG);
-        assert(!IS_SUPERINSTRUCTION_OPCODE(instr->i_opcode));
+        assert(!IS_SPECIALIZED_OPCODE(instr->i_opcode));
         if (instr->i_except != NULL) {
             maybe_push(instr->i_except, unsafe_mask, sp);
         }
-        if (instr->i_oparg >= 64) {
+        if (instr->i_oparg < base || instr->i_oparg >= base + 64) {
             continue;
         }
-        assert(instr->i_oparg >= 0);
-        uint64_t bit = (uint64_t)1 << instr->i_oparg;
+        uint64_t bit = (uint64_t)1 << (instr->i_oparg - base);
         switch (instr->i_opcode) {
             case DELETE_FAST:
+            case LOAD_FAST_AND_CLEAR:
+            case STORE_FAST_MAYBE_NULL:
                 unsafe_mask |= bit;
                 break;
             case STORE_FAST:
@@ -8110,16 +8407,16 @@ scan_block_for_locals(basicblock *b, basicblock ***sp)
 }
 
 static int
-fast_scan_many_locals(basicblock *entryblock, int nlocals)
+fast_scan_many_locals(basicblock *entryblock, int nlocals, int nanalyzed)
 {
-    assert(nlocals > 64);
-    Py_ssize_t *states = PyMem_Calloc(nlocals - 64, sizeof(Py_ssize_t));
+    assert(nlocals > nanalyzed);
+    Py_ssize_t *states = PyMem_Calloc(nlocals - nanalyzed, sizeof(Py_ssize_t));
     if (states == NULL) {
         PyErr_NoMemory();
         return -1;
     }
     Py_ssize_t blocknum = 0;
-    // state[i - 64] == blocknum if local i is guaranteed to
+    // state[i - nanalyzed] == blocknum if local i is guaranteed to
     // be initialized, i.e., if it has had a previous LOAD_FAST or
     // STORE_FAST within that basicblock (not followed by DELETE_FAST).
     for (basicblock *b = entryblock; b != NULL; b = b->b_next) {
@@ -8127,24 +8424,26 @@ fast_scan_many_locals(basicblock *entryblock, int nlocals)
         for (int i = 0; i < b->b_iused; i++) {
             struct instr *instr = &b->b_instr[i];
             assert(instr->i_opcode != EXTENDED_ARG);
-            assert(!IS_SUPERINSTRUCTION_OPCODE(instr->i_opcode));
+            assert(!IS_SPECIALIZED_OPCODE(instr->i_opcode));
             int arg = instr->i_oparg;
-            if (arg < 64) {
+            if (arg < nanalyzed) {
                 continue;
             }
             assert(arg >= 0);
             switch (instr->i_opcode) {
                 case DELETE_FAST:
-                    states[arg - 64] = blocknum - 1;
+                case LOAD_FAST_AND_CLEAR:
+                case STORE_FAST_MAYBE_NULL:
+                    states[arg - nanalyzed] = blocknum - 1;
                     break;
                 case STORE_FAST:
-                    states[arg - 64] = blocknum;
+                    states[arg - nanalyzed] = blocknum;
                     break;
                 case LOAD_FAST:
-                    if (states[arg - 64] != blocknum) {
+                    if (states[arg - nanalyzed] != blocknum) {
                         instr->i_opcode = LOAD_FAST_CHECK;
                     }
-                    states[arg - 64] = blocknum;
+                    states[arg - nanalyzed] = blocknum;
                     break;
                 case LOAD_FAST_CHECK:
                     Py_UNREACHABLE();
@@ -8155,6 +8454,10 @@ fast_scan_many_locals(basicblock *entryblock, int nlocals)
     return 0;
 }
 
+/* Locals are analyzed 64 at a time, each group with a full pass over the
+   CFG; beyond this many, they are only analyzed one basicblock at a time. */
+#define MAX_ANALYZED_LOCALS (64 * 8)
+
 static int
 add_checks_for_loads_of_uninitialized_variables(basicblock *entryblock,
                                                 struct compiler *c)
@@ -8163,49 +8466,155 @@ add_checks_for_loads_of_uninitialized_variables(basicblock *entryblock,
     if (nlocals == 0) {
         return 0;
     }
-    if (nlocals > 64) {
+    if (nlocals > MAX_ANALYZED_LOCALS) {
         // To avoid O(nlocals**2) compilation, locals beyond the first
-        // 64 are only analyzed one basicblock at a time: initialization
-        // info is not passed between basicblocks.
-        if (fast_scan_many_locals(entryblock, nlocals) < 0) {
+        // MAX_ANALYZED_LOCALS are only analyzed one basicblock at a time:
+        // initialization info is not passed between basicblocks.
+        if (fast_scan_many_locals(entryblock, nlocals, MAX_ANALYZED_LOCALS) < 0) {
             return -1;
         }
-        nlocals = 64;
+        nlocals = MAX_ANALYZED_LOCALS;
     }
     basicblock **stack = make_cfg_traversal_stack(entryblock);
     if (stack == NULL) {
         return -1;
     }
-    basicblock **sp = stack;
-
-    // First origin of being uninitialized:
-    // The non-parameter locals in the entry block.
     int nparams = (int)PyList_GET_SIZE(c->u->u_ste->ste_varnames);
-    uint64_t start_mask = 0;
-    for (int i = nparams; i < nlocals; i++) {
-        start_mask |= (uint64_t)1 << i;
-    }
-    maybe_push(entryblock, start_mask, &sp);
+    for (int base = 0; base < nlocals; base += 64) {
+        basicblock **sp = stack;
+        for (basicblock *b = entryblock; b != NULL; b = b->b_next) {
+            assert(!b->b_visited);
+            b->b_unsafe_locals_mask = 0;
+        }
 
-    // Second origin of being uninitialized:
-    // There could be DELETE_FAST somewhere, so
-    // be sure to scan each basicblock at least once.
-    for (basicblock *b = entryblock; b != NULL; b = b->b_next) {
-        scan_block_for_locals(b, &sp);
-    }
+        // First origin of being uninitialized:
+        // The non-parameter locals in the entry block.
+        uint64_t start_mask = 0;
+        for (int i = Py_MAX(nparams, base); i < Py_MIN(nlocals, base + 64); i++) {
+            start_mask |= (uint64_t)1 << (i - base);
+        }
+        maybe_push(entryblock, start_mask, &sp);
 
-    // Now propagate the uncertainty from the origins we found: Use
-    // LOAD_FAST_CHECK for any LOAD_FAST where the local could be undefined.
-    while (sp > stack) {
-        basicblock *b = *--sp;
-        // mark as no longer on stack
-        b->b_visited = 0;
-        scan_block_for_locals(b, &sp);
+        // Second origin of being uninitialized:
+        // There could be DELETE_FAST somewhere, so
+        // be sure to scan each basicblock at least once.
+        for (basicblock *b = entryblock; b != NULL; b = b->b_next) {
+            scan_block_for_locals(b, base, &sp);
+        }
+
+        // Now propagate the uncertainty from the origins we found: Use
+        // LOAD_FAST_CHECK for any LOAD_FAST where the local could be undefined.
+        while (sp > stack) {
+            basicblock *b = *--sp;
+            // mark as no longer on stack
+            b->b_visited = 0;
+            scan_block_for_locals(b, base, &sp);
+        }
     }
     PyMem_Free(stack);
     return 0;
 }
 
+/* Instructions that can't raise, run arbitrary code (other than finalizers),
+   or otherwise observe any local besides the one in their oparg. */
+#define IS_LOCALS_TRANSPARENT_OPCODE(opcode) \
+        ((opcode) == NOP || (opcode) == POP_TOP || (opcode) == LOAD_CONST || \
+         (opcode) == LOAD_FAST || (opcode) == STORE_FAST || \
+         (opcode) == COPY || (opcode) == SWAP || (opcode) == PUSH_NULL)
+
+/* Whether a line event could occur between instructions i-1 and i. */
+static bool
+is_line_boundary(basicblock *b, int i)
+{
+    int lineno = b->b_instr[i].i_loc.lineno;
+    return lineno >= 0 && lineno != b->b_instr[i-1].i_loc.lineno;
+}
+
+/* Remove stores to locals whose value can never be seen, by working
+ * backwards through each basicblock and tracking the locals that are
+ * overwritten before they are read:
+ *
+ *   STORE_FAST x ... STORE_FAST x  =>  POP_TOP ... STORE_FAST x
+ *   STORE_FAST x; LOAD_FAST x ... STORE_FAST x  =>  ... STORE_FAST x
+ *   LOAD_FAST x; STORE_FAST x  =>  (nothing)
+ *
+ * Debuggers can look at the locals at any line event, in an exception
+ * handler or traceback, or from any code called in between, so this only
+ * applies within a line, across instructions that can't do any of that.
+ */
+static int
+eliminate_dead_stores(basicblock *entryblock, int nlocals)
+{
+    if (nlocals == 0) {
+        return 0;
+    }
+    // dead[i] == stamp if the current value of local i will be overwritten
+    // before it can be read or observed. Bumping the stamp forgets them all.
+    Py_ssize_t *dead = PyMem_Calloc(nlocals, sizeof(Py_ssize_t));
+    if (dead == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    Py_ssize_t stamp = 0;
+    for (basicblock *b = entryblock; b != NULL; b = b->b_next) {
+        bool changed = false;
+        stamp++;
+        for (int i = b->b_iused - 1; i >= 0; i--) {
+            struct instr *instr = &b->b_instr[i];
+            int opcode = instr->i_opcode;
+            int oparg = instr->i_oparg;
+            struct instr *prev = i > 0 ? &b->b_instr[i-1] : NULL;
+            bool same_line = prev && !is_line_boundary(b, i);
+            if (!IS_LOCALS_TRANSPARENT_OPCODE(opcode) ||
+                ((opcode == LOAD_FAST || opcode == STORE_FAST) &&
+                 oparg >= nlocals))
+            {
+                stamp++;
+            }
+            else if (opcode == STORE_FAST) {
+                if (same_line && prev->i_opcode == LOAD_FAST &&
+                    prev->i_oparg == oparg)
+                {
+                    // x = x
+                    INSTR_SET_OP0(instr, NOP);
+                    INSTR_SET_OP0(prev, NOP);
+                    changed = true;
+                    i--;
+                }
+                else {
+                    if (dead[oparg] == stamp) {
+                        INSTR_SET_OP0(instr, POP_TOP);
+                        changed = true;
+                    }
+                    dead[oparg] = stamp;
+                }
+            }
+            else if (opcode == LOAD_FAST) {
+                if (dead[oparg] == stamp && same_line &&
+                    prev->i_opcode == STORE_FAST && prev->i_oparg == oparg)
+                {
+                    // Leave the stored value on the stack instead
+                    INSTR_SET_OP0(instr, NOP);
+                    INSTR_SET_OP0(prev, NOP);
+                    changed = true;
+                    i--;
+                }
+                else {
+                    dead[oparg] = 0;
+                }
+            }
+            if (i > 0 && is_line_boundary(b, i)) {
+                stamp++;
+            }
+        }
+        if (changed) {
+            remove_redundant_nops(b);
+        }
+    }
+    PyMem_Free(dead);
+    return 0;
+}
+
 static PyObject *
 dict_keys_inorder(PyObject *dict, Py_ssize_t offset)
 {
@@ -8858,6 +9267,10 @@ assemble(struct compiler *c, int addNone)
     if (add_checks_for_loads_of_uninitialized_variables(g->g_entryblock, c) < 0) {
         goto error;
     }
+    if (eliminate_dead_stores(g->g_entryblock,
+                              (int)PyDict_GET_SIZE(c->u->u_varnames)) < 0) {
+        goto error;
+    }
     if (remove_unused_consts(g->g_entryblock, consts)) {
         goto error;
     }
@@ -8886,7 +9299,7 @@ assemble(struct compiler *c, int addNone)
     }
     /* TO DO -- For 3.12, make sure that `maxdepth <= MAX_ALLOWED_STACK_USE` */
 
-    convert_exception_handlers_to_nops(g->g_entryblock);
+    convert_pseudo_ops(g->g_entryblock);
 
     /* Order of basic blocks must have been determined by now */
     if (normalize_jumps(g) < 0) {
@@ -9144,6 +9557,9 @@ swaptimize(basicblock *block, int *ix)
 #define SWAPPABLE(opcode) \
     ((opcode) == STORE_FAST || (opcode) == POP_TOP)
 
+#define STORES_TO(instr) \
+    (((instr).i_opcode == STORE_FAST) ? (instr).i_oparg : -1)
+
 static int
 next_swappable_instruction(basicblock *block, int i, int lineno)
 {
@@ -9195,6 +9611,22 @@ apply_static_swaps(basicblock *block, int i)
                 return;
             }
         }
+        // The reordering is not safe if the two instructions to be swapped
+        // store to the same location, or if any intervening instruction stores
+        // to the same location as either of them.
+        int store_j = STORES_TO(block->b_instr[j]);
+        int store_k = STORES_TO(block->b_instr[k]);
+        if (store_j >= 0 || store_k >= 0) {
+            if (store_j == store_k) {
+                return;
+            }
+            for (int idx = j + 1; idx < k; idx++) {
+                int store_idx = STORES_TO(block->b_instr[idx]);
+                if (store_idx >= 0 && (store_idx == store_j || store_idx == store_k)) {
+                    return;
+                }
+            }
+        }
         // Success!
         INSTR_SET_OP0(swap, NOP);
         struct instr temp = block->b_instr[j];
@@ -0,0 +1,1045 @@
+// This file is generated by Tools/cases_generator/generate_cases.py
+// from Python/bytecodes.c
+// Do not edit!
+
+        case NOP: {
+            break;
+        }
+
+        case LOAD_CLOSURE: {
+            PyObject *value;
+            /* We keep LOAD_CLOSURE so that the bytecode stays more readable. */
+            value = GETLOCAL(oparg);
+            if (value == NULL) goto unbound_local_error;
+            Py_INCREF(value);
+            STACK_GROW(1);
+            POKE(1, value);
+            break;
+        }
+
+        case LOAD_FAST_CHECK: {
+            PyObject *value;
+            value = GETLOCAL(oparg);
+            if (value == NULL) goto unbound_local_error;
+            Py_INCREF(value);
+            STACK_GROW(1);
+            POKE(1, value);
+            break;
+        }
+
+        case LOAD_FAST: {
+            PyObject *value;
+            value = GETLOCAL(oparg);
+            assert(value != NULL);
+            Py_INCREF(value);
+            STACK_GROW(1);
+            POKE(1, value);
+            break;
+        }
+
+        case LOAD_FAST_AND_CLEAR: {
+            PyObject *value;
+            value = GETLOCAL(oparg);
+            // do not use SETLOCAL here, it decrefs the old value
+            GETLOCAL(oparg) = NULL;
+            STACK_GROW(1);
+            POKE(1, value);
+            break;
+        }
+
+        case LOAD_CONST: {
+            PyObject *value;
+            value = GETITEM(consts, oparg);
+            Py_INCREF(value);
+            STACK_GROW(1);
+            POKE(1, value);
+            break;
+        }
+
+        case STORE_FAST: {
+            PyObject *value = PEEK(1);
+            SETLOCAL(oparg, value);
+            STACK_SHRINK(1);
+            break;
+        }
+
+        case POP_TOP: {
+            PyObject *value = PEEK(1);
+            Py_DECREF(value);
+            STACK_SHRINK(1);
+            break;
+        }
+
+        case PUSH_NULL: {
+            PyObject *res;
+            res = NULL;
+            STACK_GROW(1);
+            POKE(1, res);
+            break;
+        }
+
+        case END_SEND: {
+            PyObject *value = PEEK(1);
+            PyObject *receiver = PEEK(2);
+            Py_DECREF(receiver);
+            STACK_SHRINK(1);
+            POKE(1, value);
+            break;
+        }
+
+        case UNARY_POSITIVE: {
+            PyObject *value = PEEK(1);
+            PyObject *res;
+            res = PyNumber_Positive(value);
+            Py_DECREF(value);
+            if (res == NULL) goto pop_1_error;
+            POKE(1, res);
+            break;
+        }
+
+        case UNARY_NEGATIVE: {
+            PyObject *value = PEEK(1);
+            PyObject *res;
+            res = PyNumber_Negative(value);
+            Py_DECREF(value);
+            if (res == NULL) goto pop_1_error;
+            POKE(1, res);
+            break;
+        }
+
+        case UNARY_NOT: {
+            PyObject *value = PEEK(1);
+            PyObject *res;
+            int err = PyObject_IsTrue(value);
+            Py_DECREF(value);
+            if (err < 0) goto pop_1_error;
+            if (err == 0) {
+                res = Py_True;
+            }
+            else {
+                res = Py_False;
+            }
+            Py_INCREF(res);
+            POKE(1, res);
+            break;
+        }
+
+        case UNARY_INVERT: {
+            PyObject *value = PEEK(1);
+            PyObject *res;
+            res = PyNumber_Invert(value);
+            Py_DECREF(value);
+            if (res == NULL) goto pop_1_error;
+            POKE(1, res);
+            break;
+        }
+
+        case _GUARD_BOTH_INT: {
+            PyObject *right = PEEK(1);
+            PyObject *left = PEEK(2);
+            assert(cframe.use_tracing == 0);
+            DEOPT_IF(!PyLong_CheckExact(left), BINARY_OP);
+            DEOPT_IF(!PyLong_CheckExact(right), BINARY_OP);
+            break;
+        }
+
+        case _BINARY_OP_MULTIPLY_INT: {
+            PyObject *right = PEEK(1);
+            PyObject *left = PEEK(2);
+            PyObject *prod;
+            STAT_INC(BINARY_OP, hit);
+            prod = _PyLong_Multiply((PyLongObject *)left, (PyLongObject *)right);
+            _Py_DECREF_SPECIALIZED(right, (destructor)PyObject_Free);
+            _Py_DECREF_SPECIALIZED(left, (destructor)PyObject_Free);
+            if (prod == NULL) goto pop_2_error;
+            STACK_SHRINK(1);
+            POKE(1, prod);
+            break;
+        }
+
+        case _BINARY_OP_ADD_INT: {
+            PyObject *right = PEEK(1);
+            PyObject *left = PEEK(2);
+            PyObject *sum;
+            STAT_INC(BINARY_OP, hit);
+            sum = _PyLong_Add((PyLongObject *)left, (PyLongObject *)right);
+            _Py_DECREF_SPECIALIZED(right, (destructor)PyObject_Free);
+            _Py_DECREF_SPECIALIZED(left, (destructor)PyObject_Free);
+            if (sum == NULL) goto pop_2_error;
+            STACK_SHRINK(1);
+            POKE(1, sum);
+            break;
+        }
+
+        case _BINARY_OP_SUBTRACT_INT: {
+            PyObject *right = PEEK(1);
+            PyObject *left = PEEK(2);
+            PyObject *sub;
+            STAT_INC(BINARY_OP, hit);
+            sub = _PyLong_Subtract((PyLongObject *)left, (PyLongObject *)right);
+            _Py_DECREF_SPECIALIZED(right, (destructor)PyObject_Free);
+            _Py_DECREF_SPECIALIZED(left, (destructor)PyObject_Free);
+            if (sub == NULL) goto pop_2_error;
+            STACK_SHRINK(1);
+            POKE(1, sub);
+            break;
+        }
+
+        case _GUARD_BOTH_FLOAT: {
+            PyObject *right = PEEK(1);
+            PyObject *left = PEEK(2);
+            assert(cframe.use_tracing == 0);
+            DEOPT_IF(!PyFloat_CheckExact(left), BINARY_OP);
+            DEOPT_IF(!PyFloat_CheckExact(right), BINARY_OP);
+            break;
+        }
+
+        case _BINARY_OP_MULTIPLY_FLOAT: {
+            PyObject *right = PEEK(1);
+            PyObject *left = PEEK(2);
+            PyObject *prod;
+            STAT_INC(BINARY_OP, hit);
+            double dprod = ((PyFloatObject *)left)->ob_fval *
+                ((PyFloatObject *)right)->ob_fval;
+            prod = PyFloat_FromDouble(dprod);
+            _Py_DECREF_SPECIALIZED(right, _PyFloat_ExactDealloc);
+            _Py_DECREF_SPECIALIZED(left, _PyFloat_ExactDealloc);
+            if (prod == NULL) goto pop_2_error;
+            STACK_SHRINK(1);
+            POKE(1, prod);
+            break;
+        }
+
+        case _BINARY_OP_ADD_FLOAT: {
+            PyObject *right = PEEK(1);
+            PyObject *left = PEEK(2);
+            PyObject *sum;
+            STAT_INC(BINARY_OP, hit);
+            double dsum = ((PyFloatObject *)left)->ob_fval +
+                ((PyFloatObject *)right)->ob_fval;
+            sum = PyFloat_FromDouble(dsum);
+            _Py_DECREF_SPECIALIZED(right, _PyFloat_ExactDealloc);
+            _Py_DECREF_SPECIALIZED(left, _PyFloat_ExactDealloc);
+            if (sum == NULL) goto pop_2_error;
+            STACK_SHRINK(1);
+            POKE(1, sum);
+            break;
+        }
+
+        case _BINARY_OP_SUBTRACT_FLOAT: {
+            PyObject *right = PEEK(1);
+            PyObject *left = PEEK(2);
+            PyObject *sub;
+            STAT_INC(BINARY_OP, hit);
+            double dsub = ((PyFloatObject *)left)->ob_fval - ((PyFloatObject *)right)->ob_fval;
+            sub = PyFloat_FromDouble(dsub);
+            _Py_DECREF_SPECIALIZED(right, _PyFloat_ExactDealloc);
+            _Py_DECREF_SPECIALIZED(left, _PyFloat_ExactDealloc);
+            if (sub == NULL) goto pop_2_error;
+            STACK_SHRINK(1);
+            POKE(1, sub);
+            break;
+        }
+
+        case _GUARD_BOTH_UNICODE: {
+            PyObject *right = PEEK(1);
+            PyObject *left = PEEK(2);
+            assert(cframe.use_tracing == 0);
+            DEOPT_IF(!PyUnicode_CheckExact(left), BINARY_OP);
+            DEOPT_IF(!PyUnicode_CheckExact(right), BINARY_OP);
+            break;
+        }
+
+        case _BINARY_OP_ADD_UNICODE: {
+            PyObject *right = PEEK(1);
+            PyObject *left = PEEK(2);
+            PyObject *res;
+            STAT_INC(BINARY_OP, hit);
+            res = PyUnicode_Concat(left, right);
+            _Py_DECREF_SPECIALIZED(left, _PyUnicode_ExactDealloc);
+            _Py_DECREF_SPECIALIZED(right, _PyUnicode_ExactDealloc);
+            if (res == NULL) goto pop_2_error;
+            STACK_SHRINK(1);
+            POKE(1, res);
+            break;
+        }
+
+        case BINARY_SLICE_STR: {
+            PyObject *stop = PEEK(1);
+            PyObject *start = PEEK(2);
+            PyObject *container = PEEK(3);
+            PyObject *res;
+            assert(cframe.use_tracing == 0);
+            DEOPT_IF(!PyUnicode_CheckExact(container), BINARY_SLICE);
+            Py_ssize_t istart;
+            Py_ssize_t len = simple_slice_bounds(
+                start, stop, PyUnicode_GET_LENGTH(container), &istart);
+            DEOPT_IF(len < 0, BINARY_SLICE);
+            STAT_INC(BINARY_SLICE, hit);
+            res = PyUnicode_Substring(container, istart, istart + len);
+            Py_DECREF(container);
+            Py_DECREF(start);
+            Py_DECREF(stop);
+            if (res == NULL) goto pop_3_error;
+            STACK_SHRINK(2);
+            POKE(1, res);
+            break;
+        }
+
+        case BINARY_SLICE_BYTES: {
+            PyObject *stop = PEEK(1);
+            PyObject *start = PEEK(2);
+            PyObject *container = PEEK(3);
+            PyObject *res;
+            assert(cframe.use_tracing == 0);
+            DEOPT_IF(!PyBytes_CheckExact(container), BINARY_SLICE);
+            Py_ssize_t istart;
+            Py_ssize_t size = PyBytes_GET_SIZE(container);
+            Py_ssize_t len = simple_slice_bounds(start, stop, size, &istart);
+            DEOPT_IF(len < 0, BINARY_SLICE);
+            STAT_INC(BINARY_SLICE, hit);
+            if (len == size) {
+                res = Py_NewRef(container);
+            }
+            else {
+                res = PyBytes_FromStringAndSize(
+                    PyBytes_AS_STRING(container) + istart, len);
+            }
+            Py_DECREF(container);
+            Py_DECREF(start);
+            Py_DECREF(stop);
+            if (res == NULL) goto pop_3_error;
+            STACK_SHRINK(2);
+            POKE(1, res);
+            break;
+        }
+
+        case BINARY_SLICE_BYTEARRAY: {
+            PyObject *stop = PEEK(1);
+            PyObject *start = PEEK(2);
+            PyObject *container = PEEK(3);
+            PyObject *res;
+            assert(cframe.use_tracing == 0);
+            DEOPT_IF(!PyByteArray_CheckExact(container), BINARY_SLICE);
+            Py_ssize_t istart;
+            Py_ssize_t len = simple_slice_bounds(
+                start, stop, PyByteArray_GET_SIZE(container), &istart);
+            DEOPT_IF(len < 0, BINARY_SLICE);
+            STAT_INC(BINARY_SLICE, hit);
+            res = PyByteArray_FromStringAndSize(
+                PyByteArray_AS_STRING(container) + istart, len);
+            Py_DECREF(container);
+            Py_DECREF(start);
+            Py_DECREF(stop);
+            if (res == NULL) goto pop_3_error;
+            STACK_SHRINK(2);
+            POKE(1, res);
+            break;
+        }
+
+        case STORE_SLICE: {
+            PyObject *stop = PEEK(1);
+            PyObject *start = PEEK(2);
+            PyObject *container = PEEK(3);
+            PyObject *v = PEEK(4);
+            PyObject *slice = _PyBuildSlice_ConsumeRefs(start, stop);
+            int err;
+            if (slice == NULL) {
+                err = 1;
+            }
+            else {
+                err = PyObject_SetItem(container, slice, v);
+                Py_DECREF(slice);
+            }
+            Py_DECREF(v);
+            Py_DECREF(container);
+            if (err) goto pop_4_error;
+            STACK_SHRINK(4);
+            break;
+        }
+
+        case BINARY_SUBSCR_LIST_INT: {
+            PyObject *sub = PEEK(1);
+            PyObject *list = PEEK(2);
+            PyObject *res;
+            assert(cframe.use_tracing == 0);
+            DEOPT_IF(!PyLong_CheckExact(sub), BINARY_SUBSCR);
+            DEOPT_IF(!PyList_CheckExact(list), BINARY_SUBSCR);
+
+            // Deopt unless 0 <= sub < PyList_Size(list)
+            Py_ssize_t signed_magnitude = Py_SIZE(sub);
+            DEOPT_IF(((size_t)signed_magnitude) > 1, BINARY_SUBSCR);
+            assert(((PyLongObject *)_PyLong_GetZero())->ob_digit[0] == 0);
+            Py_ssize_t index = ((PyLongObject*)sub)->ob_digit[0];
+            DEOPT_IF(index >= PyList_GET_SIZE(list), BINARY_SUBSCR);
+            STAT_INC(BINARY_SUBSCR, hit);
+            res = PyList_GET_ITEM(list, index);
+            assert(res != NULL);
+            Py_INCREF(res);
+            _Py_DECREF_SPECIALIZED(sub, (destructor)PyObject_Free);
+            Py_DECREF(list);
+            STACK_SHRINK(1);
+            POKE(1, res);
+            break;
+        }
+
+        case BINARY_SUBSCR_TUPLE_INT: {
+            PyObject *sub = PEEK(1);
+            PyObject *tuple = PEEK(2);
+            PyObject *res;
+            assert(cframe.use_tracing == 0);
+            DEOPT_IF(!PyLong_CheckExact(sub), BINARY_SUBSCR);
+            DEOPT_IF(!PyTuple_CheckExact(tuple), BINARY_SUBSCR);
+
+            // Deopt unless 0 <= sub < PyTuple_Size(list)
+            Py_ssize_t signed_magnitude = Py_SIZE(sub);
+            DEOPT_IF(((size_t)signed_magnitude) > 1, BINARY_SUBSCR);
+            assert(((PyLongObject *)_PyLong_GetZero())->ob_digit[0] == 0);
+            Py_ssize_t index = ((PyLongObject*)sub)->ob_digit[0];
+            DEOPT_IF(index >= PyTuple_GET_SIZE(tuple), BINARY_SUBSCR);
+            STAT_INC(BINARY_SUBSCR, hit);
+            res = PyTuple_GET_ITEM(tuple, index);
+            assert(res != NULL);
+            Py_INCREF(res);
+            _Py_DECREF_SPECIALIZED(sub, (destructor)PyObject_Free);
+            Py_DECREF(tuple);
+            STACK_SHRINK(1);
+            POKE(1, res);
+            break;
+        }
+
+        case BINARY_SUBSCR_STR_INT: {
+            PyObject *sub = PEEK(1);
+            PyObject *str = PEEK(2);
+            PyObject *res;
+            assert(cframe.use_tracing == 0);
+            DEOPT_IF(!PyLong_CheckExact(sub), BINARY_SUBSCR);
+            DEOPT_IF(!PyUnicode_CheckExact(str), BINARY_SUBSCR);
+            Py_ssize_t signed_magnitude = Py_SIZE(sub);
+            DEOPT_IF(((size_t)signed_magnitude) > 1, BINARY_SUBSCR);
+            assert(((PyLongObject *)_PyLong_GetZero())->ob_digit[0] == 0);
+            Py_ssize_t index = ((PyLongObject*)sub)->ob_digit[0];
+            DEOPT_IF(index >= PyUnicode_GET_LENGTH(str), BINARY_SUBSCR);
+            // Only Latin-1 characters have a cached 1-character string
+            Py_UCS4 c = PyUnicode_READ_CHAR(str, index);
+            DEOPT_IF(c > 0xff, BINARY_SUBSCR);
+            STAT_INC(BINARY_SUBSCR, hit);
+            if (c < 128) {
+                res = (PyObject *)&_Py_SINGLETON(strings).ascii[c];
+            }
+            else {
+                res = (PyObject *)&_Py_SINGLETON(strings).latin1[c - 128];
+            }
+            Py_INCREF(res);
+            _Py_DECREF_SPECIALIZED(sub, (destructor)PyObject_Free);
+            Py_DECREF(str);
+            STACK_SHRINK(1);
+            POKE(1, res);
+            break;
+        }
+
+        case BINARY_SUBSCR_BYTES_INT: {
+            PyObject *sub = PEEK(1);
+            PyObject *bytes = PEEK(2);
+            PyObject *res;
+            assert(cframe.use_tracing == 0);
+            DEOPT_IF(!PyLong_CheckExact(sub), BINARY_SUBSCR);
+            DEOPT_IF(!PyBytes_CheckExact(bytes), BINARY_SUBSCR);
+            Py_ssize_t signed_magnitude = Py_SIZE(sub);
+            DEOPT_IF(((size_t)signed_magnitude) > 1, BINARY_SUBSCR);
+            assert(((PyLongObject *)_PyLong_GetZero())->ob_digit[0] == 0);
+            Py_ssize_t index = ((PyLongObject*)sub)->ob_digit[0];
+            DEOPT_IF(index >= PyBytes_GET_SIZE(bytes), BINARY_SUBSCR);
+            STAT_INC(BINARY_SUBSCR, hit);
+            res = _PyLong_FromUnsignedChar(
+                (unsigned char)PyBytes_AS_STRING(bytes)[index]);
+            _Py_DECREF_SPECIALIZED(sub, (destructor)PyObject_Free);
+            Py_DECREF(bytes);
+            STACK_SHRINK(1);
+            POKE(1, res);
+            break;
+        }
+
+        case BINARY_SUBSCR_BYTEARRAY_INT: {
+            PyObject *sub = PEEK(1);
+            PyObject *bytearray = PEEK(2);
+            PyObject *res;
+            assert(cframe.use_tracing == 0);
+            DEOPT_IF(!PyLong_CheckExact(sub), BINARY_SUBSCR);
+            DEOPT_IF(!PyByteArray_CheckExact(bytearray), BINARY_SUBSCR);
+            Py_ssize_t signed_magnitude = Py_SIZE(sub);
+            DEOPT_IF(((size_t)signed_magnitude) > 1, BINARY_SUBSCR);
+            assert(((PyLongObject *)_PyLong_GetZero())->ob_digit[0] == 0);
+            Py_ssize_t index = ((PyLongObject*)sub)->ob_digit[0];
+            DEOPT_IF(index >= PyByteArray_GET_SIZE(bytearray), BINARY_SUBSCR);
+            STAT_INC(BINARY_SUBSCR, hit);
+            res = _PyLong_FromUnsignedChar(
+                (unsigned char)PyByteArray_AS_STRING(bytearray)[index]);
+            _Py_DECREF_SPECIALIZED(sub, (destructor)PyObject_Free);
+            Py_DECREF(bytearray);
+            STACK_SHRINK(1);
+            POKE(1, res);
+            break;
+        }
+
+        case BINARY_SUBSCR_DICT: {
+            PyObject *sub = PEEK(1);
+            PyObject *dict = PEEK(2);
+            PyObject *res;
+            assert(cframe.use_tracing == 0);
+            DEOPT_IF(!PyDict_CheckExact(dict), BINARY_SUBSCR);
+            STAT_INC(BINARY_SUBSCR, hit);
+            res = PyDict_GetItemWithError(dict, sub);
+            if (res == NULL) {
+                if (!_PyErr_Occurred(tstate)) {
+                    _PyErr_SetKeyError(sub);
+                }
+                Py_DECREF(dict);
+                Py_DECREF(sub);
+                if (true) goto pop_2_error;
+            }
+            Py_INCREF(res);  // Do this before DECREF'ing dict, sub
+            Py_DECREF(dict);
+            Py_DECREF(sub);
+            STACK_SHRINK(1);
+            POKE(1, res);
+            break;
+        }
+
+        case LIST_APPEND: {
+            PyObject *v = PEEK(1);
+            PyObject *list = PEEK(oparg + 1);  // +1 to account for v staying on stack
+            if (_PyList_AppendTakeRef((PyListObject *)list, v) < 0) goto pop_1_error;
+            STACK_SHRINK(1);
+            break;
+        }
+
+        case SET_ADD: {
+            PyObject *v = PEEK(1);
+            PyObject *set = PEEK(oparg + 1);  // +1 to account for v staying on stack
+            int err = PySet_Add(set, v);
+            Py_DECREF(v);
+            if (err) goto pop_1_error;
+            STACK_SHRINK(1);
+            break;
+        }
+
+        case STORE_SUBSCR_LIST_INT: {
+            PyObject *sub = PEEK(1);
+            PyObject *list = PEEK(2);
+            PyObject *value = PEEK(3);
+            assert(cframe.use_tracing == 0);
+            DEOPT_IF(!PyLong_CheckExact(sub), STORE_SUBSCR);
+            DEOPT_IF(!PyList_CheckExact(list), STORE_SUBSCR);
+
+            // Ensure nonnegative, zero-or-one-digit ints.
+            DEOPT_IF(((size_t)Py_SIZE(sub)) > 1, STORE_SUBSCR);
+            Py_ssize_t index = ((PyLongObject*)sub)->ob_digit[0];
+            // Ensure index < len(list)
+            DEOPT_IF(index >= PyList_GET_SIZE(list), STORE_SUBSCR);
+            STAT_INC(STORE_SUBSCR, hit);
+
+            PyObject *old_value = PyList_GET_ITEM(list, index);
+            PyList_SET_ITEM(list, index, value);
+            assert(old_value != NULL);
+            Py_DECREF(old_value);
+            _Py_DECREF_SPECIALIZED(sub, (destructor)PyObject_Free);
+            Py_DECREF(list);
+            STACK_SHRINK(3);
+            break;
+        }
+
+        case STORE_SUBSCR_DICT: {
+            PyObject *sub = PEEK(1);
+            PyObject *dict = PEEK(2);
+            PyObject *value = PEEK(3);
+            assert(cframe.use_tracing == 0);
+            DEOPT_IF(!PyDict_CheckExact(dict), STORE_SUBSCR);
+            STAT_INC(STORE_SUBSCR, hit);
+            int err = _PyDict_SetItem_Take2((PyDictObject *)dict, sub, value);
+            Py_DECREF(dict);
+            if (err) goto pop_3_error;
+            STACK_SHRINK(3);
+            break;
+        }
+
+        case DELETE_SUBSCR: {
+            PyObject *sub = PEEK(1);
+            PyObject *container = PEEK(2);
+            /* del container[sub] */
+            int err = PyObject_DelItem(container, sub);
+            Py_DECREF(container);
+            Py_DECREF(sub);
+            if (err) goto pop_2_error;
+            STACK_SHRINK(2);
+            break;
+        }
+
+        case PRINT_EXPR: {
+            PyObject *value = PEEK(1);
+            PyObject *hook = _PySys_GetAttr(tstate, &_Py_ID(displayhook));
+            PyObject *res;
+            // Can't use ERROR_IF here.
+            if (hook == NULL) {
+                _PyErr_SetString(tstate, PyExc_RuntimeError,
+                                 "lost sys.displayhook");
+                Py_DECREF(value);
+                if (true) goto pop_1_error;
+            }
+            res = PyObject_CallOneArg(hook, value);
+            Py_DECREF(value);
+            if (res == NULL) goto pop_1_error;
+            Py_DECREF(res);
+            STACK_SHRINK(1);
+            break;
+        }
+
+        case GET_AITER: {
+            PyObject *obj = PEEK(1);
+            PyObject *iter;
+            unaryfunc getter = NULL;
+            PyTypeObject *type = Py_TYPE(obj);
+
+            if (type->tp_as_async != NULL) {
+                getter = type->tp_as_async->am_aiter;
+            }
+
+            if (getter == NULL) {
+                _PyErr_Format(tstate, PyExc_TypeError,
+                              "'async for' requires an object with "
+                              "__aiter__ method, got %.100s",
+                              type->tp_name);
+                Py_DECREF(obj);
+                if (true) goto pop_1_error;
+            }
+
+            iter = (*getter)(obj);
+            Py_DECREF(obj);
+            if (iter == NULL) goto pop_1_error;
+
+            if (Py_TYPE(iter)->tp_as_async == NULL ||
+                    Py_TYPE(iter)->tp_as_async->am_anext == NULL) {
+
+                _PyErr_Format(tstate, PyExc_TypeError,
+                              "'async for' received an object from __aiter__ "
+                              "that does not implement __anext__: %.100s",
+                              Py_TYPE(iter)->tp_name);
+                Py_DECREF(iter);
+                if (true) goto pop_1_error;
+            }
+            POKE(1, iter);
+            break;
+        }
+
+        case DELETE_NAME: {
+            PyObject *name = GETITEM(names, oparg);
+            PyObject *ns = LOCALS();
+            int err;
+            if (ns == NULL) {
+                _PyErr_Format(tstate, PyExc_SystemError,
+                              "no locals when deleting %R", name);
+                goto error;
+            }
+            err = PyObject_DelItem(ns, name);
+            // Can't use ERROR_IF here.
+            if (err != 0) {
+                _PyEval_FormatExcCheckArg(tstate, PyExc_NameError,
+                                          NAME_ERROR_MSG,
+                                          name);
+                goto error;
+            }
+            break;
+        }
+
+        case DELETE_ATTR: {
+            PyObject *owner = PEEK(1);
+            PyObject *name = GETITEM(names, oparg);
+            int err = PyObject_SetAttr(owner, name, (PyObject *)NULL);
+            Py_DECREF(owner);
+            if (err) goto pop_1_error;
+            STACK_SHRINK(1);
+            break;
+        }
+
+        case STORE_GLOBAL: {
+            PyObject *v = PEEK(1);
+            PyObject *name = GETITEM(names, oparg);
+            int err = PyDict_SetItem(GLOBALS(), name, v);
+            Py_DECREF(v);
+            if (err) goto pop_1_error;
+            STACK_SHRINK(1);
+            break;
+        }
+
+        case DELETE_GLOBAL: {
+            PyObject *name = GETITEM(names, oparg);
+            int err;
+            err = PyDict_DelItem(GLOBALS(), name);
+            // Can't use ERROR_IF here.
+            if (err != 0) {
+                if (_PyErr_ExceptionMatches(tstate, PyExc_KeyError)) {
+                    _PyEval_FormatExcCheckArg(tstate, PyExc_NameError,
+                                              NAME_ERROR_MSG, name);
+                }
+                goto error;
+            }
+            break;
+        }
+
+        case DELETE_FAST: {
+            PyObject *v = GETLOCAL(oparg);
+            if (v == NULL) goto unbound_local_error;
+            SETLOCAL(oparg, NULL);
+            break;
+        }
+
+        case DELETE_DEREF: {
+            PyObject *cell = GETLOCAL(oparg);
+            PyObject *oldobj = PyCell_GET(cell);
+            // Can't use ERROR_IF here.
+            // Fortunately we don't need its superpower.
+            if (oldobj == NULL) {
+                _PyEval_FormatExcUnbound(tstate, frame->f_code, oparg);
+                goto error;
+            }
+            PyCell_SET(cell, NULL);
+            Py_DECREF(oldobj);
+            break;
+        }
+
+        case STORE_ATTR_CLASS: {
+            PyObject *owner = PEEK(1);
+            PyObject *value = PEEK(2);
+            uint32_t type_version = (uint32_t)operand;
+            assert(cframe.use_tracing == 0);
+            /* type_version is the version of the metaclass, which guards
+             * against __setattr__ or a data descriptor being added to it */
+            DEOPT_IF(Py_TYPE(owner)->tp_version_tag != type_version, STORE_ATTR);
+            assert(PyType_Check(owner));
+            PyTypeObject *cls = (PyTypeObject *)owner;
+            DEOPT_IF(cls->tp_flags & Py_TPFLAGS_IMMUTABLETYPE, STORE_ATTR);
+            STAT_INC(STORE_ATTR, hit);
+            PyObject *name = GETITEM(names, oparg);
+            /* Same as type_setattro(), minus the checks done by the specializer */
+            int err = PyDict_SetItem(cls->tp_dict, name, value);
+            if (err == 0) {
+                PyType_Modified(cls);
+            }
+            Py_DECREF(value);
+            Py_DECREF(owner);
+            if (err) goto pop_2_error;
+            STACK_SHRINK(2);
+            break;
+        }
+
+        case _COMPARE_OP_FLOAT: {
+            PyObject *right = PEEK(1);
+            PyObject *left = PEEK(2);
+            size_t jump;
+            uint16_t when_to_jump_mask = (uint16_t)operand;
+            assert(cframe.use_tracing == 0);
+            // Combined: COMPARE_OP (float ? float) + POP_JUMP_IF_(true/false)
+            DEOPT_IF(!PyFloat_CheckExact(left), COMPARE_OP);
+            DEOPT_IF(!PyFloat_CheckExact(right), COMPARE_OP);
+            double dleft = PyFloat_AS_DOUBLE(left);
+            double dright = PyFloat_AS_DOUBLE(right);
+            // 1 if <, 2 if ==, 4 if >; this matches when _to_jump_mask
+            int sign_ish = 2*(dleft > dright) + 2 - (dleft < dright);
+            DEOPT_IF(isnan(dleft), COMPARE_OP);
+            DEOPT_IF(isnan(dright), COMPARE_OP);
+            STAT_INC(COMPARE_OP, hit);
+            _Py_DECREF_SPECIALIZED(left, _PyFloat_ExactDealloc);
+            _Py_DECREF_SPECIALIZED(right, _PyFloat_ExactDealloc);
+            jump = sign_ish & when_to_jump_mask;
+            STACK_SHRINK(1);
+            POKE(1, (PyObject *)jump);
+            break;
+        }
+
+        case _JUMP_TO_STUB_IF: {
+            size_t jump = (size_t)PEEK(1);
+            if (jump) {
+                JUMP_TO_UOP(oparg);
+            }
+            STACK_SHRINK(1);
+            break;
+        }
+
+        case _COMPARE_OP_INT: {
+            PyObject *right = PEEK(1);
+            PyObject *left = PEEK(2);
+            size_t jump;
+            uint16_t when_to_jump_mask = (uint16_t)operand;
+            assert(cframe.use_tracing == 0);
+            // Combined: COMPARE_OP (int ? int) + POP_JUMP_IF_(true/false)
+            DEOPT_IF(!PyLong_CheckExact(left), COMPARE_OP);
+            DEOPT_IF(!PyLong_CheckExact(right), COMPARE_OP);
+            DEOPT_IF((size_t)(Py_SIZE(left) + 1) > 2, COMPARE_OP);
+            DEOPT_IF((size_t)(Py_SIZE(right) + 1) > 2, COMPARE_OP);
+            STAT_INC(COMPARE_OP, hit);
+            assert(Py_ABS(Py_SIZE(left)) <= 1 && Py_ABS(Py_SIZE(right)) <= 1);
+            Py_ssize_t ileft = Py_SIZE(left) * ((PyLongObject *)left)->ob_digit[0];
+            Py_ssize_t iright = Py_SIZE(right) * ((PyLongObject *)right)->ob_digit[0];
+            // 1 if <, 2 if ==, 4 if >; this matches when _to_jump_mask
+            int sign_ish = 2*(ileft > iright) + 2 - (ileft < iright);
+            _Py_DECREF_SPECIALIZED(left, (destructor)PyObject_Free);
+            _Py_DECREF_SPECIALIZED(right, (destructor)PyObject_Free);
+            jump = sign_ish & when_to_jump_mask;
+            STACK_SHRINK(1);
+            POKE(1, (PyObject *)jump);
+            break;
+        }
+
+        case _COMPARE_OP_STR: {
+            PyObject *right = PEEK(1);
+            PyObject *left = PEEK(2);
+            size_t jump;
+            uint16_t invert = (uint16_t)operand;
+            assert(cframe.use_tracing == 0);
+            // Combined: COMPARE_OP (str == str or str != str) + POP_JUMP_IF_(true/false)
+            DEOPT_IF(!PyUnicode_CheckExact(left), COMPARE_OP);
+            DEOPT_IF(!PyUnicode_CheckExact(right), COMPARE_OP);
+            STAT_INC(COMPARE_OP, hit);
+            int res = _PyUnicode_Equal(left, right);
+            assert(oparg == Py_EQ || oparg == Py_NE);
+            _Py_DECREF_SPECIALIZED(left, _PyUnicode_ExactDealloc);
+            _Py_DECREF_SPECIALIZED(right, _PyUnicode_ExactDealloc);
+            assert(res == 0 || res == 1);
+            assert(invert == 0 || invert == 1);
+            jump = res ^ invert;
+            STACK_SHRINK(1);
+            POKE(1, (PyObject *)jump);
+            break;
+        }
+
+        case IS_OP: {
+            PyObject *right = PEEK(1);
+            PyObject *left = PEEK(2);
+            PyObject *b;
+            int res = Py_Is(left, right) ^ oparg;
+            Py_DECREF(left);
+            Py_DECREF(right);
+            b = Py_NewRef(res ? Py_True : Py_False);
+            STACK_SHRINK(1);
+            POKE(1, b);
+            break;
+        }
+
+        case CONTAINS_OP_DICT: {
+            PyObject *right = PEEK(1);
+            PyObject *left = PEEK(2);
+            PyObject *b;
+            assert(cframe.use_tracing == 0);
+            DEOPT_IF(!PyDict_CheckExact(right), CONTAINS_OP);
+            STAT_INC(CONTAINS_OP, hit);
+            int res = PyDict_Contains(right, left);
+            Py_DECREF(left);
+            Py_DECREF(right);
+            if (res < 0) goto pop_2_error;
+            b = Py_NewRef((res^oparg) ? Py_True : Py_False);
+            STACK_SHRINK(1);
+            POKE(1, b);
+            break;
+        }
+
+        case CONTAINS_OP_SET: {
+            PyObject *right = PEEK(1);
+            PyObject *left = PEEK(2);
+            PyObject *b;
+            assert(cframe.use_tracing == 0);
+            DEOPT_IF(!PyAnySet_CheckExact(right), CONTAINS_OP);
+            STAT_INC(CONTAINS_OP, hit);
+            int res = _PySet_Contains((PySetObject *)right, left);
+            Py_DECREF(left);
+            Py_DECREF(right);
+            if (res < 0) goto pop_2_error;
+            b = Py_NewRef((res^oparg) ? Py_True : Py_False);
+            STACK_SHRINK(1);
+            POKE(1, b);
+            break;
+        }
+
+        case CONTAINS_OP_STR: {
+            PyObject *right = PEEK(1);
+            PyObject *left = PEEK(2);
+            PyObject *b;
+            assert(cframe.use_tracing == 0);
+            DEOPT_IF(!PyUnicode_CheckExact(right), CONTAINS_OP);
+            DEOPT_IF(!PyUnicode_CheckExact(left), CONTAINS_OP);
+            STAT_INC(CONTAINS_OP, hit);
+            int res = PyUnicode_Contains(right, left);
+            _Py_DECREF_SPECIALIZED(left, _PyUnicode_ExactDealloc);
+            _Py_DECREF_SPECIALIZED(right, _PyUnicode_ExactDealloc);
+            if (res < 0) goto pop_2_error;
+            b = Py_NewRef((res^oparg) ? Py_True : Py_False);
+            STACK_SHRINK(1);
+            POKE(1, b);
+            break;
+        }
+
+        case CONTAINS_OP_TUPLE: {
+            PyObject *right = PEEK(1);
+            PyObject *left = PEEK(2);
+            PyObject *b;
+            assert(cframe.use_tracing == 0);
+            DEOPT_IF(!PyTuple_CheckExact(right), CONTAINS_OP);
+            STAT_INC(CONTAINS_OP, hit);
+            // Same as tuplecontains(), minus the indirect call.
+            int res = 0;
+            for (Py_ssize_t i = 0; res == 0 && i < PyTuple_GET_SIZE(right); i++) {
+                res = PyObject_RichCompareBool(PyTuple_GET_ITEM(right, i),
+                                               left, Py_EQ);
+            }
+            Py_DECREF(left);
+            Py_DECREF(right);
+            if (res < 0) goto pop_2_error;
+            b = Py_NewRef((res^oparg) ? Py_True : Py_False);
+            STACK_SHRINK(1);
+            POKE(1, b);
+            break;
+        }
+
+        case EXIT_TRACE: {
+            goto exit_trace;
+        }
+
+        case JUMP_TO_TOP: {
+            if (_Py_atomic_load_relaxed_int32(eval_breaker) || cframe.use_tracing) {
+                goto exit_trace;
+            }
+            JUMP_TO_UOP(0);
+            break;
+        }
+
+        case _POP_JUMP_IF_FALSE: {
+            PyObject *cond = PEEK(1);
+            DEOPT_IF(!PyBool_Check(cond), POP_JUMP_IF_FALSE);
+            _Py_DECREF_NO_DEALLOC(cond);
+            if (Py_IsFalse(cond)) {
+                JUMP_TO_UOP(oparg);
+            }
+            STACK_SHRINK(1);
+            break;
+        }
+
+        case _POP_JUMP_IF_TRUE: {
+            PyObject *cond = PEEK(1);
+            DEOPT_IF(!PyBool_Check(cond), POP_JUMP_IF_TRUE);
+            _Py_DECREF_NO_DEALLOC(cond);
+            if (Py_IsTrue(cond)) {
+                JUMP_TO_UOP(oparg);
+            }
+            STACK_SHRINK(1);
+            break;
+        }
+
+        case _POP_JUMP_IF_NOT_NONE: {
+            PyObject *value = PEEK(1);
+            if (!Py_IsNone(value)) {
+                JUMP_TO_UOP(oparg);
+            }
+            Py_DECREF(value);
+            STACK_SHRINK(1);
+            break;
+        }
+
+        case _POP_JUMP_IF_NONE: {
+            PyObject *value = PEEK(1);
+            if (Py_IsNone(value)) {
+                _Py_DECREF_NO_DEALLOC(value);
+                JUMP_TO_UOP(oparg);
+            }
+            else {
+                Py_DECREF(value);
+            }
+            STACK_SHRINK(1);
+            break;
+        }
+
+        case _FOR_ITER_LIST: {
+            PyObject *iter = PEEK(1);
+            PyObject *next;
+            _PyListIterObject *it = (_PyListIterObject *)iter;
+            DEOPT_IF(Py_TYPE(it) != &PyListIter_Type, FOR_ITER);
+            PyListObject *seq = it->it_seq;
+            DEOPT_IF(seq == NULL, FOR_ITER);
+            DEOPT_IF(it->it_index >= PyList_GET_SIZE(seq), FOR_ITER);
+            STAT_INC(FOR_ITER, hit);
+            next = Py_NewRef(PyList_GET_ITEM(seq, it->it_index++));
+            STACK_GROW(1);
+            POKE(1, next);
+            break;
+        }
+
+        case _FOR_ITER_TUPLE: {
+            PyObject *iter = PEEK(1);
+            PyObject *next;
+            _PyTupleIterObject *it = (_PyTupleIterObject *)iter;
+            DEOPT_IF(Py_TYPE(it) != &PyTupleIter_Type, FOR_ITER);
+            PyTupleObject *seq = it->it_seq;
+            DEOPT_IF(seq == NULL, FOR_ITER);
+            DEOPT_IF(it->it_index >= PyTuple_GET_SIZE(seq), FOR_ITER);
+            STAT_INC(FOR_ITER, hit);
+            next = Py_NewRef(PyTuple_GET_ITEM(seq, it->it_index++));
+            STACK_GROW(1);
+            POKE(1, next);
+            break;
+        }
+
+        case _FOR_ITER_RANGE: {
+            PyObject *iter = PEEK(1);
+            _PyRangeIterObject *r = (_PyRangeIterObject *)iter;
+            DEOPT_IF(Py_TYPE(r) != &PyRangeIter_Type, FOR_ITER);
+            DEOPT_IF(r->len <= 0, FOR_ITER);
+            STAT_INC(FOR_ITER, hit);
+            long value = r->start;
+            r->start = value + r->step;
+            r->len--;
+            if (_PyLong_AssignValue(&GETLOCAL(oparg), value) < 0) goto error;
+            break;
+        }
+
+        case WITH_EXCEPT_START: {
+            PyObject *val = PEEK(1);
+            PyObject *lasti = PEEK(3);
+            PyObject *exit_func = PEEK(4);
+            PyObject *res;
+            /* At the top of the stack are 4 values:
+               - val: TOP = exc_info()
+               - unused: SECOND = previous exception
+               - lasti: THIRD = lasti of exception in exc_info()
+               - exit_func: FOURTH = the context.__exit__ bound method
+               We call FOURTH(type(TOP), TOP, GetTraceback(TOP)).
+               Then we push the __exit__ return value.
+            */
+            PyObject *exc, *tb;
+
+            assert(val && PyExceptionInstance_Check(val));
+            exc = PyExceptionInstance_Class(val);
+            tb = PyException_GetTraceback(val);
+            Py_XDECREF(tb);
+            assert(PyLong_Check(lasti));
+            (void)lasti; // Shut up compiler warning if asserts are off
+            PyObject *stack[4] = {NULL, exc, val, tb};
+            res = PyObject_Vectorcall(exit_func, stack + 1,
+                    3 | PY_VECTORCALL_ARGUMENTS_OFFSET, NULL);
+            if (res == NULL) goto error;
+            STACK_GROW(1);
+            POKE(1, res);
+            break;
+        }
+
+        case EXIT_INIT_CHECK: {
+            PyObject *should_be_none = PEEK(1);
+            assert(STACK_LEVEL() == 2);
+            if (should_be_none != Py_None) {
+                PyErr_Format(PyExc_TypeError,
+                             "__init__() should return None, not '%.200s'",
+                             Py_TYPE(should_be_none)->tp_name);
+                Py_DECREF(should_be_none);
+                if (true) goto pop_1_error;
+            }
+            Py_DECREF(should_be_none);
+            STACK_SHRINK(1);
+            break;
+        }
@@ -7,8 +7,40 @@
         }
 
         TARGET(RESUME) {
+            PREDICTED(RESUME);
             assert(tstate->cframe == &cframe);
             assert(frame == cframe.current_frame);
+            if (frame->f_code->_co_instrumentation_version !=
+                tstate->interp->monitoring.version)
+            {
+                int err = _Py_Instrument(frame->f_code, tstate->interp);
+                if (err) goto error;
+                if (_Py_OPCODE(next_instr[-1]) == INSTRUMENTED_RESUME) {
+                    GO_TO_INSTRUCTION(INSTRUMENTED_RESUME);
+                }
+            }
+            if (_Py_atomic_load_relaxed_int32(eval_breaker) && oparg < 2) {
+                goto handle_eval_breaker;
+            }
+            DISPATCH();
+        }
+
+        TARGET(INSTRUMENTED_RESUME) {
+            PREDICTED(INSTRUMENTED_RESUME);
+            if (frame->f_code->_co_instrumentation_version !=
+                tstate->interp->monitoring.version)
+            {
+                int err = _Py_Instrument(frame->f_code, tstate->interp);
+                if (err) goto error;
+                if (_Py_OPCODE(next_instr[-1]) == RESUME) {
+                    GO_TO_INSTRUCTION(RESUME);
+                }
+            }
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            int err = _Py_call_instrumentation(
+                tstate, PY_MONITORING_EVENT_PY_START, frame, next_instr - 1);
+            stack_pointer = _PyFrame_GetStackPointer(frame);
+            if (err) goto error;
             if (_Py_atomic_load_relaxed_int32(eval_breaker) && oparg < 2) {
                 goto handle_eval_breaker;
             }
@@ -46,6 +78,41 @@
             DISPATCH();
         }
 
+        TARGET(LOAD_FAST__LOAD_FAST) {
+            PyObject *_tmp_1;
+            PyObject *_tmp_2;
+            {
+                PyObject *value;
+                value = GETLOCAL(oparg);
+                assert(value != NULL);
+                Py_INCREF(value);
+                _tmp_2 = value;
+            }
+            NEXTOPARG();
+            JUMPBY(1);
+            {
+                PyObject *value;
+                value = GETLOCAL(oparg);
+                assert(value != NULL);
+                Py_INCREF(value);
+                _tmp_1 = value;
+            }
+            STACK_GROW(2);
+            POKE(1, _tmp_1);
+            POKE(2, _tmp_2);
+            DISPATCH();
+        }
+
+        TARGET(LOAD_FAST_AND_CLEAR) {
+            PyObject *value;
+            value = GETLOCAL(oparg);
+            // do not use SETLOCAL here, it decrefs the old value
+            GETLOCAL(oparg) = NULL;
+            STACK_GROW(1);
+            POKE(1, value);
+            DISPATCH();
+        }
+
         TARGET(LOAD_CONST) {
             PREDICTED(LOAD_CONST);
             PyObject *value;
@@ -56,20 +123,12 @@
             DISPATCH();
         }
 
-        TARGET(STORE_FAST) {
-            PyObject *value = PEEK(1);
-            SETLOCAL(oparg, value);
-            STACK_SHRINK(1);
-            DISPATCH();
-        }
-
-        TARGET(LOAD_FAST__LOAD_FAST) {
+        TARGET(LOAD_CONST__LOAD_FAST) {
             PyObject *_tmp_1;
             PyObject *_tmp_2;
             {
                 PyObject *value;
-                value = GETLOCAL(oparg);
-                assert(value != NULL);
+                value = GETITEM(consts, oparg);
                 Py_INCREF(value);
                 _tmp_2 = value;
             }
@@ -112,6 +171,13 @@
             DISPATCH();
         }
 
+        TARGET(STORE_FAST) {
+            PyObject *value = PEEK(1);
+            SETLOCAL(oparg, value);
+            STACK_SHRINK(1);
+            DISPATCH();
+        }
+
         TARGET(STORE_FAST__LOAD_FAST) {
             PyObject *_tmp_1 = PEEK(1);
             {
@@ -148,30 +214,6 @@
             DISPATCH();
         }
 
-        TARGET(LOAD_CONST__LOAD_FAST) {
-            PyObject *_tmp_1;
-            PyObject *_tmp_2;
-            {
-                PyObject *value;
-                value = GETITEM(consts, oparg);
-                Py_INCREF(value);
-                _tmp_2 = value;
-            }
-            NEXTOPARG();
-            JUMPBY(1);
-            {
-                PyObject *value;
-                value = GETLOCAL(oparg);
-                assert(value != NULL);
-                Py_INCREF(value);
-                _tmp_1 = value;
-            }
-            STACK_GROW(2);
-            POKE(1, _tmp_1);
-            POKE(2, _tmp_2);
-            DISPATCH();
-        }
-
         TARGET(POP_TOP) {
             PyObject *value = PEEK(1);
             Py_DECREF(value);
@@ -202,6 +244,15 @@
             DISPATCH();
         }
 
+        TARGET(END_SEND) {
+            PyObject *value = PEEK(1);
+            PyObject *receiver = PEEK(2);
+            Py_DECREF(receiver);
+            STACK_SHRINK(1);
+            POKE(1, value);
+            DISPATCH();
+        }
+
         TARGET(UNARY_POSITIVE) {
             PyObject *value = PEEK(1);
             PyObject *res;
@@ -250,95 +301,210 @@
         }
 
         TARGET(BINARY_OP_MULTIPLY_INT) {
-            PyObject *right = PEEK(1);
-            PyObject *left = PEEK(2);
-            PyObject *prod;
-            assert(cframe.use_tracing == 0);
-            DEOPT_IF(!PyLong_CheckExact(left), BINARY_OP);
-            DEOPT_IF(!PyLong_CheckExact(right), BINARY_OP);
-            STAT_INC(BINARY_OP, hit);
-            prod = _PyLong_Multiply((PyLongObject *)left, (PyLongObject *)right);
-            _Py_DECREF_SPECIALIZED(right, (destructor)PyObject_Free);
-            _Py_DECREF_SPECIALIZED(left, (destructor)PyObject_Free);
-            if (prod == NULL) goto pop_2_error;
-            STACK_SHRINK(1);
-            POKE(1, prod);
+            PyObject *_tmp_1 = PEEK(1);
+            PyObject *_tmp_2 = PEEK(2);
+            {
+                PyObject *right = _tmp_1;
+                PyObject *left = _tmp_2;
+                assert(cframe.use_tracing == 0);
+                DEOPT_IF(!PyLong_CheckExact(left), BINARY_OP);
+                DEOPT_IF(!PyLong_CheckExact(right), BINARY_OP);
+                _tmp_2 = left;
+                _tmp_1 = right;
+            }
+            {
+                PyObject *right = _tmp_1;
+                PyObject *left = _tmp_2;
+                PyObject *prod;
+                STAT_INC(BINARY_OP, hit);
+                prod = _PyLong_Multiply((PyLongObject *)left, (PyLongObject *)right);
+                _Py_DECREF_SPECIALIZED(right, (destructor)PyObject_Free);
+                _Py_DECREF_SPECIALIZED(left, (destructor)PyObject_Free);
+                if (prod == NULL) goto pop_2_error;
+                _tmp_2 = prod;
+            }
             JUMPBY(1);
+            STACK_SHRINK(1);
+            POKE(1, _tmp_2);
             DISPATCH();
         }
 
-        TARGET(BINARY_OP_MULTIPLY_FLOAT) {
-            PyObject *right = PEEK(1);
-            PyObject *left = PEEK(2);
-            PyObject *prod;
-            assert(cframe.use_tracing == 0);
-            DEOPT_IF(!PyFloat_CheckExact(left), BINARY_OP);
-            DEOPT_IF(!PyFloat_CheckExact(right), BINARY_OP);
-            STAT_INC(BINARY_OP, hit);
-            double dprod = ((PyFloatObject *)left)->ob_fval *
-                ((PyFloatObject *)right)->ob_fval;
-            prod = PyFloat_FromDouble(dprod);
-            _Py_DECREF_SPECIALIZED(right, _PyFloat_ExactDealloc);
-            _Py_DECREF_SPECIALIZED(left, _PyFloat_ExactDealloc);
-            if (prod == NULL) goto pop_2_error;
-            STACK_SHRINK(1);
-            POKE(1, prod);
+        TARGET(BINARY_OP_ADD_INT) {
+            PyObject *_tmp_1 = PEEK(1);
+            PyObject *_tmp_2 = PEEK(2);
+            {
+                PyObject *right = _tmp_1;
+                PyObject *left = _tmp_2;
+                assert(cframe.use_tracing == 0);
+                DEOPT_IF(!PyLong_CheckExact(left), BINARY_OP);
+                DEOPT_IF(!PyLong_CheckExact(right), BINARY_OP);
+                _tmp_2 = left;
+                _tmp_1 = right;
+            }
+            {
+                PyObject *right = _tmp_1;
+                PyObject *left = _tmp_2;
+                PyObject *sum;
+                STAT_INC(BINARY_OP, hit);
+                sum = _PyLong_Add((PyLongObject *)left, (PyLongObject *)right);
+                _Py_DECREF_SPECIALIZED(right, (destructor)PyObject_Free);
+                _Py_DECREF_SPECIALIZED(left, (destructor)PyObject_Free);
+                if (sum == NULL) goto pop_2_error;
+                _tmp_2 = sum;
+            }
             JUMPBY(1);
+            STACK_SHRINK(1);
+            POKE(1, _tmp_2);
             DISPATCH();
         }
 
         TARGET(BINARY_OP_SUBTRACT_INT) {
-            PyObject *right = PEEK(1);
-            PyObject *left = PEEK(2);
-            PyObject *sub;
-            assert(cframe.use_tracing == 0);
-            DEOPT_IF(!PyLong_CheckExact(left), BINARY_OP);
-            DEOPT_IF(!PyLong_CheckExact(right), BINARY_OP);
-            STAT_INC(BINARY_OP, hit);
-            sub = _PyLong_Subtract((PyLongObject *)left, (PyLongObject *)right);
-            _Py_DECREF_SPECIALIZED(right, (destructor)PyObject_Free);
-            _Py_DECREF_SPECIALIZED(left, (destructor)PyObject_Free);
-            if (sub == NULL) goto pop_2_error;
+            PyObject *_tmp_1 = PEEK(1);
+            PyObject *_tmp_2 = PEEK(2);
+            {
+                PyObject *right = _tmp_1;
+                PyObject *left = _tmp_2;
+                assert(cframe.use_tracing == 0);
+                DEOPT_IF(!PyLong_CheckExact(left), BINARY_OP);
+                DEOPT_IF(!PyLong_CheckExact(right), BINARY_OP);
+                _tmp_2 = left;
+                _tmp_1 = right;
+            }
+            {
+                PyObject *right = _tmp_1;
+                PyObject *left = _tmp_2;
+                PyObject *sub;
+                STAT_INC(BINARY_OP, hit);
+                sub = _PyLong_Subtract((PyLongObject *)left, (PyLongObject *)right);
+                _Py_DECREF_SPECIALIZED(right, (destructor)PyObject_Free);
+                _Py_DECREF_SPECIALIZED(left, (destructor)PyObject_Free);
+                if (sub == NULL) goto pop_2_error;
+                _tmp_2 = sub;
+            }
+            JUMPBY(1);
             STACK_SHRINK(1);
-            POKE(1, sub);
+            POKE(1, _tmp_2);
+            DISPATCH();
+        }
+
+        TARGET(BINARY_OP_MULTIPLY_FLOAT) {
+            PyObject *_tmp_1 = PEEK(1);
+            PyObject *_tmp_2 = PEEK(2);
+            {
+                PyObject *right = _tmp_1;
+                PyObject *left = _tmp_2;
+                assert(cframe.use_tracing == 0);
+                DEOPT_IF(!PyFloat_CheckExact(left), BINARY_OP);
+                DEOPT_IF(!PyFloat_CheckExact(right), BINARY_OP);
+                _tmp_2 = left;
+                _tmp_1 = right;
+            }
+            {
+                PyObject *right = _tmp_1;
+                PyObject *left = _tmp_2;
+                PyObject *prod;
+                STAT_INC(BINARY_OP, hit);
+                double dprod = ((PyFloatObject *)left)->ob_fval *
+                    ((PyFloatObject *)right)->ob_fval;
+                prod = PyFloat_FromDouble(dprod);
+                _Py_DECREF_SPECIALIZED(right, _PyFloat_ExactDealloc);
+                _Py_DECREF_SPECIALIZED(left, _PyFloat_ExactDealloc);
+                if (prod == NULL) goto pop_2_error;
+                _tmp_2 = prod;
+            }
             JUMPBY(1);
+            STACK_SHRINK(1);
+            POKE(1, _tmp_2);
             DISPATCH();
         }
 
-        TARGET(BINARY_OP_SUBTRACT_FLOAT) {
-            PyObject *right = PEEK(1);
-            PyObject *left = PEEK(2);
-            PyObject *sub;
-            assert(cframe.use_tracing == 0);
-            DEOPT_IF(!PyFloat_CheckExact(left), BINARY_OP);
-            DEOPT_IF(!PyFloat_CheckExact(right), BINARY_OP);
-            STAT_INC(BINARY_OP, hit);
-            double dsub = ((PyFloatObject *)left)->ob_fval - ((PyFloatObject *)right)->ob_fval;
-            sub = PyFloat_FromDouble(dsub);
-            _Py_DECREF_SPECIALIZED(right, _PyFloat_ExactDealloc);
-            _Py_DECREF_SPECIALIZED(left, _PyFloat_ExactDealloc);
-            if (sub == NULL) goto pop_2_error;
+        TARGET(BINARY_OP_ADD_FLOAT) {
+            PyObject *_tmp_1 = PEEK(1);
+            PyObject *_tmp_2 = PEEK(2);
+            {
+                PyObject *right = _tmp_1;
+                PyObject *left = _tmp_2;
+                assert(cframe.use_tracing == 0);
+                DEOPT_IF(!PyFloat_CheckExact(left), BINARY_OP);
+                DEOPT_IF(!PyFloat_CheckExact(right), BINARY_OP);
+                _tmp_2 = left;
+                _tmp_1 = right;
+            }
+            {
+                PyObject *right = _tmp_1;
+                PyObject *left = _tmp_2;
+                PyObject *sum;
+                STAT_INC(BINARY_OP, hit);
+                double dsum = ((PyFloatObject *)left)->ob_fval +
+                    ((PyFloatObject *)right)->ob_fval;
+                sum = PyFloat_FromDouble(dsum);
+                _Py_DECREF_SPECIALIZED(right, _PyFloat_ExactDealloc);
+                _Py_DECREF_SPECIALIZED(left, _PyFloat_ExactDealloc);
+                if (sum == NULL) goto pop_2_error;
+                _tmp_2 = sum;
+            }
+            JUMPBY(1);
             STACK_SHRINK(1);
-            POKE(1, sub);
+            POKE(1, _tmp_2);
+            DISPATCH();
+        }
+
+        TARGET(BINARY_OP_SUBTRACT_FLOAT) {
+            PyObject *_tmp_1 = PEEK(1);
+            PyObject *_tmp_2 = PEEK(2);
+            {
+                PyObject *right = _tmp_1;
+                PyObject *left = _tmp_2;
+                assert(cframe.use_tracing == 0);
+                DEOPT_IF(!PyFloat_CheckExact(left), BINARY_OP);
+                DEOPT_IF(!PyFloat_CheckExact(right), BINARY_OP);
+                _tmp_2 = left;
+                _tmp_1 = right;
+            }
+            {
+                PyObject *right = _tmp_1;
+                PyObject *left = _tmp_2;
+                PyObject *sub;
+                STAT_INC(BINARY_OP, hit);
+                double dsub = ((PyFloatObject *)left)->ob_fval - ((PyFloatObject *)right)->ob_fval;
+                sub = PyFloat_FromDouble(dsub);
+                _Py_DECREF_SPECIALIZED(right, _PyFloat_ExactDealloc);
+                _Py_DECREF_SPECIALIZED(left, _PyFloat_ExactDealloc);
+                if (sub == NULL) goto pop_2_error;
+                _tmp_2 = sub;
+            }
             JUMPBY(1);
+            STACK_SHRINK(1);
+            POKE(1, _tmp_2);
             DISPATCH();
         }
 
         TARGET(BINARY_OP_ADD_UNICODE) {
-            PyObject *right = PEEK(1);
-            PyObject *left = PEEK(2);
-            PyObject *res;
-            assert(cframe.use_tracing == 0);
-            DEOPT_IF(!PyUnicode_CheckExact(left), BINARY_OP);
-            DEOPT_IF(Py_TYPE(right) != Py_TYPE(left), BINARY_OP);
-            STAT_INC(BINARY_OP, hit);
-            res = PyUnicode_Concat(left, right);
-            _Py_DECREF_SPECIALIZED(left, _PyUnicode_ExactDealloc);
-            _Py_DECREF_SPECIALIZED(right, _PyUnicode_ExactDealloc);
-            if (res == NULL) goto pop_2_error;
-            STACK_SHRINK(1);
-            POKE(1, res);
+            PyObject *_tmp_1 = PEEK(1);
+            PyObject *_tmp_2 = PEEK(2);
+            {
+                PyObject *right = _tmp_1;
+                PyObject *left = _tmp_2;
+                assert(cframe.use_tracing == 0);
+                DEOPT_IF(!PyUnicode_CheckExact(left), BINARY_OP);
+                DEOPT_IF(!PyUnicode_CheckExact(right), BINARY_OP);
+                _tmp_2 = left;
+                _tmp_1 = right;
+            }
+            {
+                PyObject *right = _tmp_1;
+                PyObject *left = _tmp_2;
+                PyObject *res;
+                STAT_INC(BINARY_OP, hit);
+                res = PyUnicode_Concat(left, right);
+                _Py_DECREF_SPECIALIZED(left, _PyUnicode_ExactDealloc);
+                _Py_DECREF_SPECIALIZED(right, _PyUnicode_ExactDealloc);
+                if (res == NULL) goto pop_2_error;
+                _tmp_2 = res;
+            }
             JUMPBY(1);
+            STACK_SHRINK(1);
+            POKE(1, _tmp_2);
             DISPATCH();
         }
 
@@ -349,8 +515,7 @@
             DEOPT_IF(!PyUnicode_CheckExact(left), BINARY_OP);
             DEOPT_IF(Py_TYPE(right) != Py_TYPE(left), BINARY_OP);
             _Py_CODEUNIT true_next = next_instr[INLINE_CACHE_ENTRIES_BINARY_OP];
-            assert(_Py_OPCODE(true_next) == STORE_FAST ||
-                   _Py_OPCODE(true_next) == STORE_FAST__LOAD_FAST);
+            assert(_PyOpcode_Deopt[_Py_OPCODE(true_next)] == STORE_FAST);
             PyObject **target_local = &GETLOCAL(_Py_OPARG(true_next));
             DEOPT_IF(*target_local != left, BINARY_OP);
             STAT_INC(BINARY_OP, hit);
@@ -376,88 +541,138 @@
             DISPATCH();
         }
 
-        TARGET(BINARY_OP_ADD_FLOAT) {
-            PyObject *right = PEEK(1);
-            PyObject *left = PEEK(2);
-            PyObject *sum;
-            assert(cframe.use_tracing == 0);
-            DEOPT_IF(!PyFloat_CheckExact(left), BINARY_OP);
-            DEOPT_IF(Py_TYPE(right) != Py_TYPE(left), BINARY_OP);
-            STAT_INC(BINARY_OP, hit);
-            double dsum = ((PyFloatObject *)left)->ob_fval +
-                ((PyFloatObject *)right)->ob_fval;
-            sum = PyFloat_FromDouble(dsum);
-            _Py_DECREF_SPECIALIZED(right, _PyFloat_ExactDealloc);
-            _Py_DECREF_SPECIALIZED(left, _PyFloat_ExactDealloc);
-            if (sum == NULL) goto pop_2_error;
+        TARGET(BINARY_SUBSCR) {
+            PREDICTED(BINARY_SUBSCR);
+            static_assert(INLINE_CACHE_ENTRIES_BINARY_SUBSCR == 4, "incorrect cache size");
+            PyObject *sub = PEEK(1);
+            PyObject *container = PEEK(2);
+            PyObject *res;
+            _PyBinarySubscrCache *cache = (_PyBinarySubscrCache *)next_instr;
+            if (ADAPTIVE_COUNTER_IS_ZERO(cache->counter)) {
+                assert(cframe.use_tracing == 0);
+                next_instr--;
+                _Py_Specialize_BinarySubscr(container, sub, next_instr);
+                DISPATCH_SAME_OPARG();
+            }
+            STAT_INC(BINARY_SUBSCR, deferred);
+            DECREMENT_ADAPTIVE_COUNTER(cache->counter);
+            res = PyObject_GetItem(container, sub);
+            Py_DECREF(container);
+            Py_DECREF(sub);
+            if (res == NULL) goto pop_2_error;
             STACK_SHRINK(1);
-            POKE(1, sum);
+            POKE(1, res);
+            JUMPBY(4);
+            DISPATCH();
+        }
+
+        TARGET(BINARY_SLICE) {
+            PREDICTED(BINARY_SLICE);
+            static_assert(INLINE_CACHE_ENTRIES_BINARY_SLICE == 1, "incorrect cache size");
+            PyObject *stop = PEEK(1);
+            PyObject *start = PEEK(2);
+            PyObject *container = PEEK(3);
+            PyObject *res;
+            _PyBinarySliceCache *cache = (_PyBinarySliceCache *)next_instr;
+            if (ADAPTIVE_COUNTER_IS_ZERO(cache->counter)) {
+                assert(cframe.use_tracing == 0);
+                next_instr--;
+                _Py_Specialize_BinarySlice(container, start, stop, next_instr);
+                DISPATCH_SAME_OPARG();
+            }
+            STAT_INC(BINARY_SLICE, deferred);
+            DECREMENT_ADAPTIVE_COUNTER(cache->counter);
+            PyObject *slice = _PyBuildSlice_ConsumeRefs(start, stop);
+            // Can't use ERROR_IF() here, because we haven't
+            // DECREF'ed container yet, and we still own slice.
+            if (slice == NULL) {
+                res = NULL;
+            }
+            else {
+                res = PyObject_GetItem(container, slice);
+                Py_DECREF(slice);
+            }
+            Py_DECREF(container);
+            if (res == NULL) goto pop_3_error;
+            STACK_SHRINK(2);
+            POKE(1, res);
             JUMPBY(1);
             DISPATCH();
         }
 
-        TARGET(BINARY_OP_ADD_INT) {
-            PyObject *right = PEEK(1);
-            PyObject *left = PEEK(2);
-            PyObject *sum;
+        TARGET(BINARY_SLICE_STR) {
+            PyObject *stop = PEEK(1);
+            PyObject *start = PEEK(2);
+            PyObject *container = PEEK(3);
+            PyObject *res;
             assert(cframe.use_tracing == 0);
-            DEOPT_IF(!PyLong_CheckExact(left), BINARY_OP);
-            DEOPT_IF(Py_TYPE(right) != Py_TYPE(left), BINARY_OP);
-            STAT_INC(BINARY_OP, hit);
-            sum = _PyLong_Add((PyLongObject *)left, (PyLongObject *)right);
-            _Py_DECREF_SPECIALIZED(right, (destructor)PyObject_Free);
-            _Py_DECREF_SPECIALIZED(left, (destructor)PyObject_Free);
-            if (sum == NULL) goto pop_2_error;
-            STACK_SHRINK(1);
-            POKE(1, sum);
+            DEOPT_IF(!PyUnicode_CheckExact(container), BINARY_SLICE);
+            Py_ssize_t istart;
+            Py_ssize_t len = simple_slice_bounds(
+                start, stop, PyUnicode_GET_LENGTH(container), &istart);
+            DEOPT_IF(len < 0, BINARY_SLICE);
+            STAT_INC(BINARY_SLICE, hit);
+            res = PyUnicode_Substring(container, istart, istart + len);
+            Py_DECREF(container);
+            Py_DECREF(start);
+            Py_DECREF(stop);
+            if (res == NULL) goto pop_3_error;
+            STACK_SHRINK(2);
+            POKE(1, res);
             JUMPBY(1);
             DISPATCH();
         }
 
-        TARGET(BINARY_SUBSCR) {
-            PREDICTED(BINARY_SUBSCR);
-            static_assert(INLINE_CACHE_ENTRIES_BINARY_SUBSCR == 4, "incorrect cache size");
-            PyObject *sub = PEEK(1);
-            PyObject *container = PEEK(2);
+        TARGET(BINARY_SLICE_BYTES) {
+            PyObject *stop = PEEK(1);
+            PyObject *start = PEEK(2);
+            PyObject *container = PEEK(3);
             PyObject *res;
-            _PyBinarySubscrCache *cache = (_PyBinarySubscrCache *)next_instr;
-            if (ADAPTIVE_COUNTER_IS_ZERO(cache->counter)) {
-                assert(cframe.use_tracing == 0);
-                next_instr--;
-                _Py_Specialize_BinarySubscr(container, sub, next_instr);
-                DISPATCH_SAME_OPARG();
+            assert(cframe.use_tracing == 0);
+            DEOPT_IF(!PyBytes_CheckExact(container), BINARY_SLICE);
+            Py_ssize_t istart;
+            Py_ssize_t size = PyBytes_GET_SIZE(container);
+            Py_ssize_t len = simple_slice_bounds(start, stop, size, &istart);
+            DEOPT_IF(len < 0, BINARY_SLICE);
+            STAT_INC(BINARY_SLICE, hit);
+            if (len == size) {
+                res = Py_NewRef(container);
+            }
+            else {
+                res = PyBytes_FromStringAndSize(
+                    PyBytes_AS_STRING(container) + istart, len);
             }
-            STAT_INC(BINARY_SUBSCR, deferred);
-            DECREMENT_ADAPTIVE_COUNTER(cache->counter);
-            res = PyObject_GetItem(container, sub);
             Py_DECREF(container);
-            Py_DECREF(sub);
-            if (res == NULL) goto pop_2_error;
-            STACK_SHRINK(1);
+            Py_DECREF(start);
+            Py_DECREF(stop);
+            if (res == NULL) goto pop_3_error;
+            STACK_SHRINK(2);
             POKE(1, res);
-            JUMPBY(4);
+            JUMPBY(1);
             DISPATCH();
         }
 
-        TARGET(BINARY_SLICE) {
+        TARGET(BINARY_SLICE_BYTEARRAY) {
             PyObject *stop = PEEK(1);
             PyObject *start = PEEK(2);
             PyObject *container = PEEK(3);
             PyObject *res;
-            PyObject *slice = _PyBuildSlice_ConsumeRefs(start, stop);
-            // Can't use ERROR_IF() here, because we haven't
-            // DECREF'ed container yet, and we still own slice.
-            if (slice == NULL) {
-                res = NULL;
-            }
-            else {
-                res = PyObject_GetItem(container, slice);
-                Py_DECREF(slice);
-            }
+            assert(cframe.use_tracing == 0);
+            DEOPT_IF(!PyByteArray_CheckExact(container), BINARY_SLICE);
+            Py_ssize_t istart;
+            Py_ssize_t len = simple_slice_bounds(
+                start, stop, PyByteArray_GET_SIZE(container), &istart);
+            DEOPT_IF(len < 0, BINARY_SLICE);
+            STAT_INC(BINARY_SLICE, hit);
+            res = PyByteArray_FromStringAndSize(
+                PyByteArray_AS_STRING(container) + istart, len);
             Py_DECREF(container);
+            Py_DECREF(start);
+            Py_DECREF(stop);
             if (res == NULL) goto pop_3_error;
             STACK_SHRINK(2);
             POKE(1, res);
+            JUMPBY(1);
             DISPATCH();
         }
 
@@ -534,6 +749,83 @@
             DISPATCH();
         }
 
+        TARGET(BINARY_SUBSCR_STR_INT) {
+            PyObject *sub = PEEK(1);
+            PyObject *str = PEEK(2);
+            PyObject *res;
+            assert(cframe.use_tracing == 0);
+            DEOPT_IF(!PyLong_CheckExact(sub), BINARY_SUBSCR);
+            DEOPT_IF(!PyUnicode_CheckExact(str), BINARY_SUBSCR);
+            Py_ssize_t signed_magnitude = Py_SIZE(sub);
+            DEOPT_IF(((size_t)signed_magnitude) > 1, BINARY_SUBSCR);
+            assert(((PyLongObject *)_PyLong_GetZero())->ob_digit[0] == 0);
+            Py_ssize_t index = ((PyLongObject*)sub)->ob_digit[0];
+            DEOPT_IF(index >= PyUnicode_GET_LENGTH(str), BINARY_SUBSCR);
+            // Only Latin-1 characters have a cached 1-character string
+            Py_UCS4 c = PyUnicode_READ_CHAR(str, index);
+            DEOPT_IF(c > 0xff, BINARY_SUBSCR);
+            STAT_INC(BINARY_SUBSCR, hit);
+            if (c < 128) {
+                res = (PyObject *)&_Py_SINGLETON(strings).ascii[c];
+            }
+            else {
+                res = (PyObject *)&_Py_SINGLETON(strings).latin1[c - 128];
+            }
+            Py_INCREF(res);
+            _Py_DECREF_SPECIALIZED(sub, (destructor)PyObject_Free);
+            Py_DECREF(str);
+            STACK_SHRINK(1);
+            POKE(1, res);
+            JUMPBY(4);
+            DISPATCH();
+        }
+
+        TARGET(BINARY_SUBSCR_BYTES_INT) {
+            PyObject *sub = PEEK(1);
+            PyObject *bytes = PEEK(2);
+            PyObject *res;
+            assert(cframe.use_tracing == 0);
+            DEOPT_IF(!PyLong_CheckExact(sub), BINARY_SUBSCR);
+            DEOPT_IF(!PyBytes_CheckExact(bytes), BINARY_SUBSCR);
+            Py_ssize_t signed_magnitude = Py_SIZE(sub);
+            DEOPT_IF(((size_t)signed_magnitude) > 1, BINARY_SUBSCR);
+            assert(((PyLongObject *)_PyLong_GetZero())->ob_digit[0] == 0);
+            Py_ssize_t index = ((PyLongObject*)sub)->ob_digit[0];
+            DEOPT_IF(index >= PyBytes_GET_SIZE(bytes), BINARY_SUBSCR);
+            STAT_INC(BINARY_SUBSCR, hit);
+            res = _PyLong_FromUnsignedChar(
+                (unsigned char)PyBytes_AS_STRING(bytes)[index]);
+            _Py_DECREF_SPECIALIZED(sub, (destructor)PyObject_Free);
+            Py_DECREF(bytes);
+            STACK_SHRINK(1);
+            POKE(1, res);
+            JUMPBY(4);
+            DISPATCH();
+        }
+
+        TARGET(BINARY_SUBSCR_BYTEARRAY_INT) {
+            PyObject *sub = PEEK(1);
+            PyObject *bytearray = PEEK(2);
+            PyObject *res;
+            assert(cframe.use_tracing == 0);
+            DEOPT_IF(!PyLong_CheckExact(sub), BINARY_SUBSCR);
+            DEOPT_IF(!PyByteArray_CheckExact(bytearray), BINARY_SUBSCR);
+            Py_ssize_t signed_magnitude = Py_SIZE(sub);
+            DEOPT_IF(((size_t)signed_magnitude) > 1, BINARY_SUBSCR);
+            assert(((PyLongObject *)_PyLong_GetZero())->ob_digit[0] == 0);
+            Py_ssize_t index = ((PyLongObject*)sub)->ob_digit[0];
+            DEOPT_IF(index >= PyByteArray_GET_SIZE(bytearray), BINARY_SUBSCR);
+            STAT_INC(BINARY_SUBSCR, hit);
+            res = _PyLong_FromUnsignedChar(
+                (unsigned char)PyByteArray_AS_STRING(bytearray)[index]);
+            _Py_DECREF_SPECIALIZED(sub, (destructor)PyObject_Free);
+            Py_DECREF(bytearray);
+            STACK_SHRINK(1);
+            POKE(1, res);
+            JUMPBY(4);
+            DISPATCH();
+        }
+
         TARGET(BINARY_SUBSCR_DICT) {
             PyObject *sub = PEEK(1);
             PyObject *dict = PEEK(2);
@@ -759,6 +1051,49 @@
             goto resume_frame;
         }
 
+        TARGET(INSTRUMENTED_RETURN_VALUE) {
+            PyObject *retval = PEEK(1);
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            int err = _Py_call_instrumentation_arg(
+                tstate, PY_MONITORING_EVENT_PY_RETURN,
+                frame, next_instr - 1, retval);
+            stack_pointer = _PyFrame_GetStackPointer(frame);
+            if (err) {
+                Py_DECREF(retval);
+            }
+            if (err) goto pop_1_error;
+            STACK_SHRINK(1);
+            assert(EMPTY());
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            TRACE_FUNCTION_EXIT();
+            DTRACE_FUNCTION_EXIT();
+            _Py_LeaveRecursiveCallPy(tstate);
+            assert(frame != &entry_frame);
+            _PyInterpreterFrame *dying = frame;
+            frame = cframe.current_frame = dying->previous;
+            _PyEvalFrameClearAndPop(tstate, dying);
+            _PyFrame_StackPush(frame, retval);
+            goto resume_frame;
+        }
+
+        TARGET(RETURN_DISCARD) {
+            PyObject *retval = PEEK(1);
+            /* Like RETURN_VALUE, but does not push retval to the caller.
+             * Only used by the shim that cleans up after property setters. */
+            Py_DECREF(retval);
+            STACK_SHRINK(1);
+            assert(EMPTY());
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            TRACE_FUNCTION_EXIT();
+            DTRACE_FUNCTION_EXIT();
+            _Py_LeaveRecursiveCallPy(tstate);
+            assert(frame != &entry_frame);
+            _PyInterpreterFrame *dying = frame;
+            frame = cframe.current_frame = dying->previous;
+            _PyEvalFrameClearAndPop(tstate, dying);
+            goto resume_frame;
+        }
+
         TARGET(GET_AITER) {
             PyObject *obj = PEEK(1);
             PyObject *iter;
@@ -883,8 +1218,18 @@
         }
 
         TARGET(SEND) {
+            PREDICTED(SEND);
             assert(frame != &entry_frame);
             assert(STACK_LEVEL() >= 2);
+            _PySendCache *cache = (_PySendCache *)next_instr;
+            if (ADAPTIVE_COUNTER_IS_ZERO(cache->counter)) {
+                assert(cframe.use_tracing == 0);
+                next_instr--;
+                _Py_Specialize_Send(SECOND(), next_instr, oparg);
+                DISPATCH_SAME_OPARG();
+            }
+            STAT_INC(SEND, deferred);
+            DECREMENT_ADAPTIVE_COUNTER(cache->counter);
             PyObject *v = POP();
             PyObject *receiver = TOP();
             PySendResult gen_status;
@@ -918,20 +1263,43 @@
                 assert(retval == NULL);
                 goto error;
             }
+            assert(retval != NULL);
+            PUSH(retval);
             if (gen_status == PYGEN_RETURN) {
-                assert(retval != NULL);
-                Py_DECREF(receiver);
-                SET_TOP(retval);
-                JUMPBY(oparg);
+                /* The receiver is popped by the END_SEND at the target */
+                JUMPBY(INLINE_CACHE_ENTRIES_SEND + oparg);
             }
             else {
                 assert(gen_status == PYGEN_NEXT);
-                assert(retval != NULL);
-                PUSH(retval);
+                JUMPBY(INLINE_CACHE_ENTRIES_SEND);
             }
             DISPATCH();
         }
 
+        TARGET(SEND_GEN) {
+            assert(cframe.use_tracing == 0);
+            PyGenObject *gen = (PyGenObject *)SECOND();
+            DEOPT_IF(Py_TYPE(gen) != &PyGen_Type &&
+                     Py_TYPE(gen) != &PyCoro_Type, SEND);
+            DEOPT_IF(gen->gi_frame_state >= FRAME_EXECUTING, SEND);
+            PyObject *v = TOP();
+            // gen_send_ex2() rejects this case with a TypeError:
+            DEOPT_IF(gen->gi_frame_state == FRAME_CREATED && !Py_IsNone(v), SEND);
+            STAT_INC(SEND, hit);
+            STACK_SHRINK(1);
+            _PyInterpreterFrame *gen_frame = (_PyInterpreterFrame *)gen->gi_iframe;
+            frame->yield_offset = oparg;
+            _PyFrame_StackPush(gen_frame, v);
+            gen->gi_frame_state = FRAME_EXECUTING;
+            gen->gi_exc_state.previous_item = tstate->exc_info;
+            tstate->exc_info = &gen->gi_exc_state;
+            /* Returning resumes at the END_SEND; yielding moves back to just
+               after this instruction (see YIELD_VALUE) */
+            JUMPBY(INLINE_CACHE_ENTRIES_SEND + oparg);
+            assert(_PyOpcode_Deopt[_Py_OPCODE(*next_instr)] == END_SEND);
+            DISPATCH_INLINED(gen_frame);
+        }
+
         TARGET(ASYNC_GEN_WRAP) {
             PyObject *v = TOP();
             assert(frame->f_code->co_flags & CO_ASYNC_GENERATOR);
@@ -1038,7 +1406,7 @@
                 Py_INCREF(value);
                 Py_DECREF(POP());  // The StopIteration.
                 Py_DECREF(POP());  // The last sent value.
-                Py_DECREF(POP());  // The delegated sub-iterator.
+                // The delegated sub-iterator is popped by END_SEND.
                 PUSH(value);
             }
             else {
@@ -1158,9 +1526,9 @@
             err = PyObject_DelItem(ns, name);
             // Can't use ERROR_IF here.
             if (err != 0) {
-                format_exc_check_arg(tstate, PyExc_NameError,
-                                     NAME_ERROR_MSG,
-                                     name);
+                _PyEval_FormatExcCheckArg(tstate, PyExc_NameError,
+                                          NAME_ERROR_MSG,
+                                          name);
                 goto error;
             }
             DISPATCH();
@@ -1266,7 +1634,7 @@
             Py_DECREF(owner);
             if (err) goto pop_2_error;
             STACK_SHRINK(2);
-            JUMPBY(4);
+            JUMPBY(9);
             DISPATCH();
         }
 
@@ -1297,8 +1665,8 @@
             // Can't use ERROR_IF here.
             if (err != 0) {
                 if (_PyErr_ExceptionMatches(tstate, PyExc_KeyError)) {
-                    format_exc_check_arg(tstate, PyExc_NameError,
-                                         NAME_ERROR_MSG, name);
+                    _PyEval_FormatExcCheckArg(tstate, PyExc_NameError,
+                                              NAME_ERROR_MSG, name);
                 }
                 goto error;
             }
@@ -1344,7 +1712,7 @@
                         v = PyDict_GetItemWithError(BUILTINS(), name);
                         if (v == NULL) {
                             if (!_PyErr_Occurred(tstate)) {
-                                format_exc_check_arg(
+                                _PyEval_FormatExcCheckArg(
                                         tstate, PyExc_NameError,
                                         NAME_ERROR_MSG, name);
                             }
@@ -1356,7 +1724,7 @@
                         v = PyObject_GetItem(BUILTINS(), name);
                         if (v == NULL) {
                             if (_PyErr_ExceptionMatches(tstate, PyExc_KeyError)) {
-                                format_exc_check_arg(
+                                _PyEval_FormatExcCheckArg(
                                             tstate, PyExc_NameError,
                                             NAME_ERROR_MSG, name);
                             }
@@ -1395,8 +1763,8 @@
                     if (!_PyErr_Occurred(tstate)) {
                         /* _PyDict_LoadGlobal() returns NULL without raising
                          * an exception if the key doesn't exist */
-                        format_exc_check_arg(tstate, PyExc_NameError,
-                                             NAME_ERROR_MSG, name);
+                        _PyEval_FormatExcCheckArg(tstate, PyExc_NameError,
+                                                  NAME_ERROR_MSG, name);
                     }
                     goto error;
                 }
@@ -1417,7 +1785,7 @@
                     v = PyObject_GetItem(BUILTINS(), name);
                     if (v == NULL) {
                         if (_PyErr_ExceptionMatches(tstate, PyExc_KeyError)) {
-                            format_exc_check_arg(
+                            _PyEval_FormatExcCheckArg(
                                         tstate, PyExc_NameError,
                                         NAME_ERROR_MSG, name);
                         }
@@ -1501,7 +1869,7 @@
             // Can't use ERROR_IF here.
             // Fortunately we don't need its superpower.
             if (oldobj == NULL) {
-                format_exc_unbound(tstate, frame->f_code, oparg);
+                _PyEval_FormatExcUnbound(tstate, frame->f_code, oparg);
                 goto error;
             }
             PyCell_SET(cell, NULL);
@@ -1536,7 +1904,7 @@
                 PyObject *cell = GETLOCAL(oparg);
                 value = PyCell_GET(cell);
                 if (value == NULL) {
-                    format_exc_unbound(tstate, frame->f_code, oparg);
+                    _PyEval_FormatExcUnbound(tstate, frame->f_code, oparg);
                     goto error;
                 }
                 Py_INCREF(value);
@@ -1549,7 +1917,7 @@
             PyObject *cell = GETLOCAL(oparg);
             PyObject *value = PyCell_GET(cell);
             if (value == NULL) {
-                format_exc_unbound(tstate, frame->f_code, oparg);
+                _PyEval_FormatExcUnbound(tstate, frame->f_code, oparg);
                 goto error;
             }
             PUSH(Py_NewRef(value));
@@ -1581,8 +1949,7 @@
 
         TARGET(BUILD_STRING) {
             PyObject *str;
-            str = _PyUnicode_JoinArray(&_Py_STR(empty),
-                                       stack_pointer - oparg, oparg);
+            str = _PyUnicode_BuildString(stack_pointer - oparg, oparg);
             if (str == NULL)
                 goto error;
             while (--oparg >= 0) {
@@ -1818,6 +2185,143 @@
             DISPATCH();
         }
 
+        TARGET(LOAD_SUPER_ATTR) {
+            PREDICTED(LOAD_SUPER_ATTR);
+            _PySuperAttrCache *cache = (_PySuperAttrCache *)next_instr;
+            PyObject *self = TOP();
+            PyObject *class = SECOND();
+            PyObject *global_super = THIRD();
+            PyObject *name = GETITEM(names, oparg >> 2);
+            if (ADAPTIVE_COUNTER_IS_ZERO(cache->counter)) {
+                assert(cframe.use_tracing == 0);
+                next_instr--;
+                _Py_Specialize_LoadSuperAttr(global_super, class, self,
+                                             next_instr, name, oparg & 1);
+                DISPATCH_SAME_OPARG();
+            }
+            STAT_INC(LOAD_SUPER_ATTR, deferred);
+            DECREMENT_ADAPTIVE_COUNTER(cache->counter);
+            PyObject *res;
+            int method_found = 0;
+            if (global_super == (PyObject *)&PySuper_Type &&
+                PyType_Check(class))
+            {
+                /* Avoid creating the super object */
+                int *method = NULL;
+                if ((oparg & 1) &&
+                    Py_TYPE(self)->tp_getattro == PyObject_GenericGetAttr)
+                {
+                    method = &method_found;
+                }
+                res = _PySuper_Lookup((PyTypeObject *)class, self, name,
+                                      method);
+            }
+            else {
+                PyObject *stack[] = {class, self};
+                PyObject *super = PyObject_Vectorcall(
+                    global_super, (oparg & 2) ? stack : NULL,
+                    (oparg & 2) ? 2 : 0, NULL);
+                if (super == NULL) {
+                    goto error;
+                }
+                res = PyObject_GetAttr(super, name);
+                Py_DECREF(super);
+            }
+            if (res == NULL) {
+                goto error;
+            }
+            STACK_SHRINK(2);
+            Py_DECREF(global_super);
+            Py_DECREF(class);
+            if (oparg & 1) {
+                if (method_found) {
+                    /* meth | self | arg1 | ... | argN */
+                    SET_TOP(res);
+                    PUSH(self);
+                }
+                else {
+                    /* NULL | meth | arg1 | ... | argN */
+                    SET_TOP(NULL);
+                    Py_DECREF(self);
+                    PUSH(res);
+                }
+            }
+            else {
+                Py_DECREF(self);
+                SET_TOP(res);
+            }
+            JUMPBY(INLINE_CACHE_ENTRIES_LOAD_SUPER_ATTR);
+            DISPATCH();
+        }
+
+        TARGET(LOAD_SUPER_ATTR_ATTR) {
+            PyObject *self = PEEK(1);
+            PyObject *class = PEEK(2);
+            PyObject *global_super = PEEK(3);
+            PyObject *res;
+            uint32_t class_version = read_u32(next_instr + 1);
+            uint32_t self_type_version = read_u32(next_instr + 3);
+            PyObject *descr = read_obj(next_instr + 5);
+            assert(cframe.use_tracing == 0);
+            assert((oparg & 1) == 0);
+            DEOPT_IF(global_super != (PyObject *)&PySuper_Type, LOAD_SUPER_ATTR);
+            DEOPT_IF(!PyType_Check(class), LOAD_SUPER_ATTR);
+            PyTypeObject *self_type = Py_TYPE(self);
+            DEOPT_IF(((PyTypeObject *)class)->tp_version_tag != class_version,
+                     LOAD_SUPER_ATTR);
+            DEOPT_IF(self_type->tp_version_tag != self_type_version,
+                     LOAD_SUPER_ATTR);
+            STAT_INC(LOAD_SUPER_ATTR, hit);
+            descrgetfunc f = Py_TYPE(descr)->tp_descr_get;
+            if (f != NULL) {
+                res = f(descr, self, (PyObject *)self_type);
+            }
+            else {
+                res = Py_NewRef(descr);
+            }
+            Py_DECREF(global_super);
+            Py_DECREF(class);
+            Py_DECREF(self);
+            if (res == NULL) goto pop_3_error;
+            STACK_SHRINK(2);
+            POKE(1, res);
+            JUMPBY(9);
+            DISPATCH();
+        }
+
+        TARGET(LOAD_SUPER_ATTR_METHOD) {
+            PyObject *self = PEEK(1);
+            PyObject *class = PEEK(2);
+            PyObject *global_super = PEEK(3);
+            PyObject *res2;
+            PyObject *res;
+            uint32_t class_version = read_u32(next_instr + 1);
+            uint32_t self_type_version = read_u32(next_instr + 3);
+            PyObject *descr = read_obj(next_instr + 5);
+            assert(cframe.use_tracing == 0);
+            assert(oparg & 1);
+            DEOPT_IF(global_super != (PyObject *)&PySuper_Type, LOAD_SUPER_ATTR);
+            DEOPT_IF(!PyType_Check(class), LOAD_SUPER_ATTR);
+            PyTypeObject *self_type = Py_TYPE(self);
+            DEOPT_IF(((PyTypeObject *)class)->tp_version_tag != class_version,
+                     LOAD_SUPER_ATTR);
+            DEOPT_IF(self_type->tp_version_tag != self_type_version,
+                     LOAD_SUPER_ATTR);
+            STAT_INC(LOAD_SUPER_ATTR, hit);
+            assert(descr != NULL);
+            assert(_PyType_HasFeature(Py_TYPE(descr),
+                                      Py_TPFLAGS_METHOD_DESCRIPTOR));
+            res2 = Py_NewRef(descr);
+            res = self;
+            Py_DECREF(global_super);
+            Py_DECREF(class);
+            STACK_SHRINK(1);
+            POKE(1, res);
+            POKE(2, res2);
+            JUMPBY(9);
+            DISPATCH();
+        }
+
         TARGET(LOAD_ATTR) {
             PREDICTED(LOAD_ATTR);
             _PyAttrCache *cache = (_PyAttrCache *)next_instr;
@@ -2104,7 +2608,7 @@
             }
             Py_DECREF(owner);
             STACK_SHRINK(2);
-            JUMPBY(4);
+            JUMPBY(9);
             DISPATCH();
         }
 
@@ -2153,7 +2657,7 @@
             dict->ma_version_tag = new_version;
             Py_DECREF(owner);
             STACK_SHRINK(2);
-            JUMPBY(4);
+            JUMPBY(9);
             DISPATCH();
         }
 
@@ -2173,8 +2677,114 @@
             Py_XDECREF(old_value);
             Py_DECREF(owner);
             STACK_SHRINK(2);
-            JUMPBY(4);
-            DISPATCH();
+            JUMPBY(9);
+            DISPATCH();
+        }
+
+        TARGET(STORE_ATTR_MODULE) {
+            PyObject *owner = PEEK(1);
+            PyObject *value = PEEK(2);
+            uint32_t version = read_u32(next_instr + 1);
+            uint16_t index = read_u16(next_instr + 3);
+            assert(cframe.use_tracing == 0);
+            DEOPT_IF(!PyModule_CheckExact(owner), STORE_ATTR);
+            PyDictObject *dict = (PyDictObject *)((PyModuleObject *)owner)->md_dict;
+            assert(dict != NULL);
+            DEOPT_IF(dict->ma_keys->dk_version != version, STORE_ATTR);
+            assert(dict->ma_keys->dk_kind == DICT_KEYS_UNICODE);
+            assert(index < dict->ma_keys->dk_nentries);
+            PyDictUnicodeEntry *ep = DK_UNICODE_ENTRIES(dict->ma_keys) + index;
+            PyObject *old_value = ep->me_value;
+            DEOPT_IF(old_value == NULL, STORE_ATTR);
+            STAT_INC(STORE_ATTR, hit);
+            uint64_t new_version = _PyDict_NotifyEvent(PyDict_EVENT_MODIFIED, dict, ep->me_key, value);
+            ep->me_value = value;
+            Py_DECREF(old_value);
+            /* Ensure dict is GC tracked if it needs to be */
+            if (!_PyObject_GC_IS_TRACKED(dict) && _PyObject_GC_MAY_BE_TRACKED(value)) {
+                _PyObject_GC_TRACK(dict);
+            }
+            /* PEP 509 */
+            dict->ma_version_tag = new_version;
+            Py_DECREF(owner);
+            STACK_SHRINK(2);
+            JUMPBY(9);
+            DISPATCH();
+        }
+
+        TARGET(STORE_ATTR_CLASS) {
+            PyObject *owner = PEEK(1);
+            PyObject *value = PEEK(2);
+            uint32_t type_version = read_u32(next_instr + 1);
+            assert(cframe.use_tracing == 0);
+            /* type_version is the version of the metaclass, which guards
+             * against __setattr__ or a data descriptor being added to it */
+            DEOPT_IF(Py_TYPE(owner)->tp_version_tag != type_version, STORE_ATTR);
+            assert(PyType_Check(owner));
+            PyTypeObject *cls = (PyTypeObject *)owner;
+            DEOPT_IF(cls->tp_flags & Py_TPFLAGS_IMMUTABLETYPE, STORE_ATTR);
+            STAT_INC(STORE_ATTR, hit);
+            PyObject *name = GETITEM(names, oparg);
+            /* Same as type_setattro(), minus the checks done by the specializer */
+            int err = PyDict_SetItem(cls->tp_dict, name, value);
+            if (err == 0) {
+                PyType_Modified(cls);
+            }
+            Py_DECREF(value);
+            Py_DECREF(owner);
+            if (err) goto pop_2_error;
+            STACK_SHRINK(2);
+            JUMPBY(9);
+            DISPATCH();
+        }
+
+        TARGET(STORE_ATTR_PROPERTY) {
+            PyObject *owner = PEEK(1);
+            PyObject *value = PEEK(2);
+            uint32_t type_version = read_u32(next_instr + 1);
+            uint32_t func_version = read_u32(next_instr + 3);
+            PyObject *fset = read_obj(next_instr + 5);
+            /* This instruction does the following:
+             * 1. Pushes a shim frame that discards the result of the setter.
+             * 2. Pushes the frame for the setter on top of the shim.
+             */
+            assert(cframe.use_tracing == 0);
+            DEOPT_IF(tstate->interp->eval_frame, STORE_ATTR);
+            PyTypeObject *tp = Py_TYPE(owner);
+            assert(type_version != 0);
+            DEOPT_IF(tp->tp_version_tag != type_version, STORE_ATTR);
+            assert(Py_IS_TYPE(fset, &PyFunction_Type));
+            PyFunctionObject *f = (PyFunctionObject *)fset;
+            assert(func_version != 0);
+            DEOPT_IF(f->func_version != func_version, STORE_ATTR);
+            PyCodeObject *code = (PyCodeObject *)f->func_code;
+            assert(code->co_argcount == 2);
+            PyCodeObject *shim_code = tstate->interp->setter_cleanup;
+            DEOPT_IF(!_PyThreadState_HasStackSpace(tstate,
+                code->co_framesize + shim_code->co_framesize), STORE_ATTR);
+            STAT_INC(STORE_ATTR, hit);
+            _PyInterpreterFrame *shim = _PyFrame_PushTrampolineUnchecked(
+                tstate, (PyFunctionObject *)Py_NewRef(fset), shim_code, 0);
+            _PyInterpreterFrame *new_frame = _PyFrame_PushUnchecked(
+                tstate, (PyFunctionObject *)Py_NewRef(fset));
+            new_frame->localsplus[0] = owner;
+            new_frame->localsplus[1] = value;
+            for (int i = 2; i < code->co_nlocalsplus; i++) {
+                new_frame->localsplus[i] = NULL;
+            }
+            STACK_SHRINK(2);
+            JUMPBY(INLINE_CACHE_ENTRIES_STORE_ATTR);
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            frame->prev_instr = next_instr - 1;
+            /* Link frames */
+            shim->previous = frame;
+            new_frame->previous = shim;
+            frame = cframe.current_frame = new_frame;
+            CALL_STAT_INC(inlined_py_calls);
+            /* Account for pushing the shim frame. The recursion limit is
+             * checked for the setter frame at start_frame */
+            tstate->py_recursion_remaining--;
+            goto start_frame;
         }
 
         TARGET(COMPARE_OP) {
@@ -2316,27 +2926,119 @@
         }
 
         TARGET(IS_OP) {
-            PyObject *right = POP();
-            PyObject *left = TOP();
+            PyObject *right = PEEK(1);
+            PyObject *left = PEEK(2);
+            PyObject *b;
             int res = Py_Is(left, right) ^ oparg;
-            PyObject *b = res ? Py_True : Py_False;
-            SET_TOP(Py_NewRef(b));
             Py_DECREF(left);
             Py_DECREF(right);
+            b = Py_NewRef(res ? Py_True : Py_False);
+            STACK_SHRINK(1);
+            POKE(1, b);
             DISPATCH();
         }
 
         TARGET(CONTAINS_OP) {
-            PyObject *right = POP();
-            PyObject *left = POP();
+            PREDICTED(CONTAINS_OP);
+            static_assert(INLINE_CACHE_ENTRIES_CONTAINS_OP == 1, "incorrect cache size");
+            PyObject *right = PEEK(1);
+            PyObject *left = PEEK(2);
+            PyObject *b;
+            _PyContainsOpCache *cache = (_PyContainsOpCache *)next_instr;
+            if (ADAPTIVE_COUNTER_IS_ZERO(cache->counter)) {
+                assert(cframe.use_tracing == 0);
+                next_instr--;
+                _Py_Specialize_ContainsOp(left, right, next_instr);
+                DISPATCH_SAME_OPARG();
+            }
+            STAT_INC(CONTAINS_OP, deferred);
+            DECREMENT_ADAPTIVE_COUNTER(cache->counter);
             int res = PySequence_Contains(right, left);
             Py_DECREF(left);
             Py_DECREF(right);
-            if (res < 0) {
-                goto error;
+            if (res < 0) goto pop_2_error;
+            b = Py_NewRef((res^oparg) ? Py_True : Py_False);
+            STACK_SHRINK(1);
+            POKE(1, b);
+            JUMPBY(1);
+            DISPATCH();
+        }
+
+        TARGET(CONTAINS_OP_DICT) {
+            PyObject *right = PEEK(1);
+            PyObject *left = PEEK(2);
+            PyObject *b;
+            assert(cframe.use_tracing == 0);
+            DEOPT_IF(!PyDict_CheckExact(right), CONTAINS_OP);
+            STAT_INC(CONTAINS_OP, hit);
+            int res = PyDict_Contains(right, left);
+            Py_DECREF(left);
+            Py_DECREF(right);
+            if (res < 0) goto pop_2_error;
+            b = Py_NewRef((res^oparg) ? Py_True : Py_False);
+            STACK_SHRINK(1);
+            POKE(1, b);
+            JUMPBY(1);
+            DISPATCH();
+        }
+
+        TARGET(CONTAINS_OP_SET) {
+            PyObject *right = PEEK(1);
+            PyObject *left = PEEK(2);
+            PyObject *b;
+            assert(cframe.use_tracing == 0);
+            DEOPT_IF(!PyAnySet_CheckExact(right), CONTAINS_OP);
+            STAT_INC(CONTAINS_OP, hit);
+            int res = _PySet_Contains((PySetObject *)right, left);
+            Py_DECREF(left);
+            Py_DECREF(right);
+            if (res < 0) goto pop_2_error;
+            b = Py_NewRef((res^oparg) ? Py_True : Py_False);
+            STACK_SHRINK(1);
+            POKE(1, b);
+            JUMPBY(1);
+            DISPATCH();
+        }
+
+        TARGET(CONTAINS_OP_STR) {
+            PyObject *right = PEEK(1);
+            PyObject *left = PEEK(2);
+            PyObject *b;
+            assert(cframe.use_tracing == 0);
+            DEOPT_IF(!PyUnicode_CheckExact(right), CONTAINS_OP);
+            DEOPT_IF(!PyUnicode_CheckExact(left), CONTAINS_OP);
+            STAT_INC(CONTAINS_OP, hit);
+            int res = PyUnicode_Contains(right, left);
+            _Py_DECREF_SPECIALIZED(left, _PyUnicode_ExactDealloc);
+            _Py_DECREF_SPECIALIZED(right, _PyUnicode_ExactDealloc);
+            if (res < 0) goto pop_2_error;
+            b = Py_NewRef((res^oparg) ? Py_True : Py_False);
+            STACK_SHRINK(1);
+            POKE(1, b);
+            JUMPBY(1);
+            DISPATCH();
+        }
+
+        TARGET(CONTAINS_OP_TUPLE) {
+            PyObject *right = PEEK(1);
+            PyObject *left = PEEK(2);
+            PyObject *b;
+            assert(cframe.use_tracing == 0);
+            DEOPT_IF(!PyTuple_CheckExact(right), CONTAINS_OP);
+            STAT_INC(CONTAINS_OP, hit);
+            // Same as tuplecontains(), minus the indirect call.
+            int res = 0;
+            for (Py_ssize_t i = 0; res == 0 && i < PyTuple_GET_SIZE(right); i++) {
+                res = PyObject_RichCompareBool(PyTuple_GET_ITEM(right, i),
+                                               left, Py_EQ);
             }
-            PyObject *b = (res^oparg) ? Py_True : Py_False;
-            PUSH(Py_NewRef(b));
+            Py_DECREF(left);
+            Py_DECREF(right);
+            if (res < 0) goto pop_2_error;
+            b = Py_NewRef((res^oparg) ? Py_True : Py_False);
+            STACK_SHRINK(1);
+            POKE(1, b);
+            JUMPBY(1);
             DISPATCH();
         }
 
@@ -2451,9 +3153,51 @@
 
         TARGET(JUMP_BACKWARD) {
             PREDICTED(JUMP_BACKWARD);
-            assert(oparg < INSTR_OFFSET());
-            JUMPBY(-oparg);
+            _PyJumpBackwardCache *cache = (_PyJumpBackwardCache *)next_instr;
+            assert(oparg <= INSTR_OFFSET() + (int)INLINE_CACHE_ENTRIES_JUMP_BACKWARD);
+            if (ADAPTIVE_COUNTER_IS_ZERO(cache->counter)) {
+                assert(cframe.use_tracing == 0);
+                _Py_CODEUNIT *dest =
+                    next_instr + INLINE_CACHE_ENTRIES_JUMP_BACKWARD - oparg;
+                int optimized = _PyOptimizer_BackEdge(frame, next_instr - 1, dest);
+                if (optimized < 0) goto error;
+                if (optimized) {
+                    next_instr--;
+                    DISPATCH_SAME_OPARG();
+                }
+            }
+            else {
+                STAT_INC(JUMP_BACKWARD, deferred);
+                DECREMENT_ADAPTIVE_COUNTER(cache->counter);
+            }
+            JUMPBY(INLINE_CACHE_ENTRIES_JUMP_BACKWARD - oparg);
+            CHECK_EVAL_BREAKER();
+            DISPATCH();
+        }
+
+        TARGET(JUMP_BACKWARD_INTO_TRACE) {
+            _PyJumpBackwardCache *cache = (_PyJumpBackwardCache *)next_instr;
+            assert(cframe.use_tracing == 0);
+            assert(oparg <= INSTR_OFFSET() + (int)INLINE_CACHE_ENTRIES_JUMP_BACKWARD);
+            STAT_INC(JUMP_BACKWARD, hit);
+            JUMPBY(INLINE_CACHE_ENTRIES_JUMP_BACKWARD - oparg);
             CHECK_EVAL_BREAKER();
+            int index = cache->counter >> ADAPTIVE_BACKOFF_BITS;
+            _PyUOpExecutor *executor =
+                frame->f_code->_co_executors->executors[index];
+            if (executor->jit_code != NULL) {
+                next_instr = ((_PyJITFunction)executor->jit_code)(
+                    frame, stack_pointer, tstate);
+            }
+            else {
+                next_instr = _PyUopExecute(tstate, executor, frame,
+                                           stack_pointer);
+            }
+            if (next_instr == NULL) {
+                goto resume_with_error;
+            }
+            stack_pointer = _PyFrame_GetStackPointer(frame);
+            frame->stacktop = -1;
             DISPATCH();
         }
 
@@ -2577,6 +3321,93 @@
             DISPATCH();
         }
 
+        TARGET(INSTRUMENTED_JUMP_FORWARD) {
+            INSTRUMENTED_JUMP(next_instr - 1, next_instr + oparg,
+                              PY_MONITORING_EVENT_JUMP);
+            DISPATCH();
+        }
+
+        TARGET(INSTRUMENTED_JUMP_BACKWARD) {
+            INSTRUMENTED_JUMP(
+                next_instr - 1,
+                next_instr + INLINE_CACHE_ENTRIES_JUMP_BACKWARD - oparg,
+                PY_MONITORING_EVENT_JUMP);
+            CHECK_EVAL_BREAKER();
+            DISPATCH();
+        }
+
+        TARGET(INSTRUMENTED_POP_JUMP_IF_FALSE) {
+            PyObject *cond = POP();
+            int err = PyObject_IsTrue(cond);
+            Py_DECREF(cond);
+            if (err < 0) {
+                goto error;
+            }
+            INSTRUMENTED_JUMP(next_instr - 1, next_instr + (err ? 0 : oparg),
+                              PY_MONITORING_EVENT_BRANCH);
+            DISPATCH();
+        }
+
+        TARGET(INSTRUMENTED_POP_JUMP_IF_TRUE) {
+            PyObject *cond = POP();
+            int err = PyObject_IsTrue(cond);
+            Py_DECREF(cond);
+            if (err < 0) {
+                goto error;
+            }
+            INSTRUMENTED_JUMP(next_instr - 1, next_instr + (err ? oparg : 0),
+                              PY_MONITORING_EVENT_BRANCH);
+            DISPATCH();
+        }
+
+        TARGET(INSTRUMENTED_POP_JUMP_IF_NONE) {
+            PyObject *value = POP();
+            int jump = Py_IsNone(value);
+            Py_DECREF(value);
+            INSTRUMENTED_JUMP(next_instr - 1, next_instr + (jump ? oparg : 0),
+                              PY_MONITORING_EVENT_BRANCH);
+            DISPATCH();
+        }
+
+        TARGET(INSTRUMENTED_POP_JUMP_IF_NOT_NONE) {
+            PyObject *value = POP();
+            int jump = !Py_IsNone(value);
+            Py_DECREF(value);
+            INSTRUMENTED_JUMP(next_instr - 1, next_instr + (jump ? oparg : 0),
+                              PY_MONITORING_EVENT_BRANCH);
+            DISPATCH();
+        }
+
+        TARGET(INSTRUMENTED_JUMP_IF_FALSE_OR_POP) {
+            PyObject *cond = TOP();
+            int err = PyObject_IsTrue(cond);
+            if (err < 0) {
+                goto error;
+            }
+            if (err) {
+                STACK_SHRINK(1);
+                Py_DECREF(cond);
+            }
+            INSTRUMENTED_JUMP(next_instr - 1, next_instr + (err ? 0 : oparg),
+                              PY_MONITORING_EVENT_BRANCH);
+            DISPATCH();
+        }
+
+        TARGET(INSTRUMENTED_JUMP_IF_TRUE_OR_POP) {
+            PyObject *cond = TOP();
+            int err = PyObject_IsTrue(cond);
+            if (err < 0) {
+                goto error;
+            }
+            if (!err) {
+                STACK_SHRINK(1);
+                Py_DECREF(cond);
+            }
+            INSTRUMENTED_JUMP(next_instr - 1, next_instr + (err ? oparg : 0),
+                              PY_MONITORING_EVENT_BRANCH);
+            DISPATCH();
+        }
+
         TARGET(JUMP_BACKWARD_NO_INTERRUPT) {
             /* This bytecode is used in the `yield from` or `await` loop.
              * If there is an interrupt, we want it handled in the innermost
@@ -2807,6 +3638,106 @@
             DISPATCH();
         }
 
+        TARGET(FOR_ITER_DICT_KEYS) {
+            assert(cframe.use_tracing == 0);
+            PyObject *it = TOP();
+            DEOPT_IF(Py_TYPE(it) != &PyDictIterKey_Type, FOR_ITER);
+            STAT_INC(FOR_ITER, hit);
+            PyObject *key;
+            int res = _PyDictIter_Next(it, &key, NULL);
+            if (res < 0) {
+                goto error;
+            }
+            if (res == 0) {
+                STACK_SHRINK(1);
+                Py_DECREF(it);
+                JUMPBY(INLINE_CACHE_ENTRIES_FOR_ITER + oparg + 1);
+            }
+            else {
+                PUSH(key);
+                JUMPBY(INLINE_CACHE_ENTRIES_FOR_ITER);
+            }
+            DISPATCH();
+        }
+
+        TARGET(FOR_ITER_DICT_VALUES) {
+            assert(cframe.use_tracing == 0);
+            PyObject *it = TOP();
+            DEOPT_IF(Py_TYPE(it) != &PyDictIterValue_Type, FOR_ITER);
+            STAT_INC(FOR_ITER, hit);
+            PyObject *value;
+            int res = _PyDictIter_Next(it, NULL, &value);
+            if (res < 0) {
+                goto error;
+            }
+            if (res == 0) {
+                STACK_SHRINK(1);
+                Py_DECREF(it);
+                JUMPBY(INLINE_CACHE_ENTRIES_FOR_ITER + oparg + 1);
+            }
+            else {
+                PUSH(value);
+                JUMPBY(INLINE_CACHE_ENTRIES_FOR_ITER);
+            }
+            DISPATCH();
+        }
+
+        TARGET(FOR_ITER_DICT_ITEMS) {
+            assert(cframe.use_tracing == 0);
+            PyObject *it = TOP();
+            DEOPT_IF(Py_TYPE(it) != &PyDictIterItem_Type, FOR_ITER);
+            STAT_INC(FOR_ITER, hit);
+            assert(_PyOpcode_Deopt[_Py_OPCODE(next_instr[INLINE_CACHE_ENTRIES_FOR_ITER])]
+                   == UNPACK_SEQUENCE);
+            assert(_Py_OPARG(next_instr[INLINE_CACHE_ENTRIES_FOR_ITER]) == 2);
+            PyObject *key, *value;
+            int res = _PyDictIter_Next(it, &key, &value);
+            if (res < 0) {
+                goto error;
+            }
+            if (res == 0) {
+                STACK_SHRINK(1);
+                Py_DECREF(it);
+                JUMPBY(INLINE_CACHE_ENTRIES_FOR_ITER + oparg + 1);
+            }
+            else {
+                // The UNPACK_SEQUENCE is already done.
+                PUSH(value);
+                PUSH(key);
+                JUMPBY(INLINE_CACHE_ENTRIES_FOR_ITER + 1 +
+                       INLINE_CACHE_ENTRIES_UNPACK_SEQUENCE);
+            }
+            DISPATCH();
+        }
+
+        TARGET(FOR_ITER_ENUMERATE) {
+            assert(cframe.use_tracing == 0);
+            PyObject *it = TOP();
+            DEOPT_IF(Py_TYPE(it) != &PyEnum_Type, FOR_ITER);
+            STAT_INC(FOR_ITER, hit);
+            assert(_PyOpcode_Deopt[_Py_OPCODE(next_instr[INLINE_CACHE_ENTRIES_FOR_ITER])]
+                   == UNPACK_SEQUENCE);
+            assert(_Py_OPARG(next_instr[INLINE_CACHE_ENTRIES_FOR_ITER]) == 2);
+            PyObject *index, *item;
+            int res = _PyEnum_NextPair(it, &index, &item);
+            if (res < 0) {
+                goto error;
+            }
+            if (res == 0) {
+                STACK_SHRINK(1);
+                Py_DECREF(it);
+                JUMPBY(INLINE_CACHE_ENTRIES_FOR_ITER + oparg + 1);
+            }
+            else {
+                // The UNPACK_SEQUENCE is already done.
+                PUSH(item);
+                PUSH(index);
+                JUMPBY(INLINE_CACHE_ENTRIES_FOR_ITER + 1 +
+                       INLINE_CACHE_ENTRIES_UNPACK_SEQUENCE);
+            }
+            DISPATCH();
+        }
+
         TARGET(FOR_ITER_GEN) {
             assert(cframe.use_tracing == 0);
             PyGenObject *gen = (PyGenObject *)TOP();
@@ -3198,6 +4129,88 @@
             DISPATCH_INLINED(new_frame);
         }
 
+        TARGET(CALL_NO_KW_ALLOC_AND_ENTER_INIT) {
+            /* This instruction does the following:
+             * 1. Creates the object (as object.__new__ would)
+             * 2. Pushes a shim frame that checks the result of __init__
+             *    and returns the object to this frame.
+             * 3. Pushes the frame for __init__ on top of the shim.
+             */
+            assert(kwnames == NULL);
+            DEOPT_IF(tstate->interp->eval_frame, CALL);
+            DEOPT_IF(is_method(stack_pointer, oparg), CALL);
+            _PyCallCache *cache = (_PyCallCache *)next_instr;
+            PyObject *callable = PEEK(oparg + 1);
+            DEOPT_IF(!PyType_Check(callable), CALL);
+            PyTypeObject *tp = (PyTypeObject *)callable;
+            /* func_version holds the version of the class, and min_args
+             * the version of its __init__ */
+            DEOPT_IF(tp->tp_version_tag != read_u32(cache->func_version), CALL);
+            assert(tp->tp_flags & Py_TPFLAGS_HEAPTYPE);
+            PyObject *cached = ((PyHeapTypeObject *)tp)->_spec_cache.init;
+            assert(PyFunction_Check(cached));
+            PyFunctionObject *init = (PyFunctionObject *)cached;
+            DEOPT_IF(init->func_version != cache->min_args, CALL);
+            PyCodeObject *code = (PyCodeObject *)init->func_code;
+            assert(code->co_argcount == oparg + 1);
+            PyCodeObject *shim_code = tstate->interp->init_cleanup;
+            DEOPT_IF(!_PyThreadState_HasStackSpace(tstate,
+                code->co_framesize + shim_code->co_framesize), CALL);
+            STAT_INC(CALL, hit);
+            /* Same as object_new(), minus the checks done by the specializer */
+            PyObject *self = tp->tp_alloc(tp, 0);
+            if (self == NULL) {
+                goto error;
+            }
+            if (_PyObject_InitializeDict(self)) {
+                Py_DECREF(self);
+                goto error;
+            }
+            Py_DECREF(tp);
+            _PyInterpreterFrame *shim = _PyFrame_PushTrampolineUnchecked(
+                tstate, (PyFunctionObject *)Py_NewRef(init), shim_code, 1);
+            /* The shim keeps the object alive and returns it */
+            shim->localsplus[0] = Py_NewRef(self);
+            _PyInterpreterFrame *init_frame = _PyFrame_PushUnchecked(
+                tstate, (PyFunctionObject *)Py_NewRef(init));
+            STACK_SHRINK(oparg);
+            init_frame->localsplus[0] = self;
+            for (int i = 0; i < oparg; i++) {
+                init_frame->localsplus[i+1] = stack_pointer[i];
+            }
+            for (int i = oparg+1; i < code->co_nlocalsplus; i++) {
+                init_frame->localsplus[i] = NULL;
+            }
+            STACK_SHRINK(2);
+            JUMPBY(INLINE_CACHE_ENTRIES_CALL);
+            _PyFrame_SetStackPointer(frame, stack_pointer);
+            frame->prev_instr = next_instr - 1;
+            /* Link frames */
+            shim->previous = frame;
+            init_frame->previous = shim;
+            frame = cframe.current_frame = init_frame;
+            CALL_STAT_INC(inlined_py_calls);
+            /* Account for pushing the shim frame. The recursion limit is
+             * checked for the __init__ frame at start_frame */
+            tstate->py_recursion_remaining--;
+            goto start_frame;
+        }
+
+        TARGET(EXIT_INIT_CHECK) {
+            PyObject *should_be_none = PEEK(1);
+            assert(STACK_LEVEL() == 2);
+            if (should_be_none != Py_None) {
+                PyErr_Format(PyExc_TypeError,
+                             "__init__() should return None, not '%.200s'",
+                             Py_TYPE(should_be_none)->tp_name);
+                Py_DECREF(should_be_none);
+                if (true) goto pop_1_error;
+            }
+            Py_DECREF(should_be_none);
+            STACK_SHRINK(1);
+            DISPATCH();
+        }
+
         TARGET(CALL_NO_KW_TYPE_1) {
             assert(kwnames == NULL);
             assert(cframe.use_tracing == 0);
@@ -3482,7 +4495,7 @@
             Py_DECREF(callable);
             // CALL + POP_TOP
             JUMPBY(INLINE_CACHE_ENTRIES_CALL + 1);
-            assert(_Py_OPCODE(next_instr[-1]) == POP_TOP);
+            assert(_PyOpcode_Deopt[_Py_OPCODE(next_instr[-1])] == POP_TOP);
             DISPATCH();
         }
 
@@ -3630,6 +4643,17 @@
 
         TARGET(CALL_FUNCTION_EX) {
             PREDICTED(CALL_FUNCTION_EX);
+            _PyCallFunctionExCache *cache = (_PyCallFunctionExCache *)next_instr;
+            if (ADAPTIVE_COUNTER_IS_ZERO(cache->counter)) {
+                assert(cframe.use_tracing == 0);
+                next_instr--;
+                _Py_Specialize_CallFunctionEx(PEEK(2 + (oparg & 0x01)),
+                                              PEEK(1 + (oparg & 0x01)),
+                                              next_instr);
+                DISPATCH_SAME_OPARG();
+            }
+            STAT_INC(CALL_FUNCTION_EX, deferred);
+            DECREMENT_ADAPTIVE_COUNTER(cache->counter);
             PyObject *func, *callargs, *kwargs = NULL, *result;
             if (oparg & 0x01) {
                 kwargs = POP();
@@ -3662,10 +4686,39 @@
             if (result == NULL) {
                 goto error;
             }
+            JUMPBY(INLINE_CACHE_ENTRIES_CALL_FUNCTION_EX);
             CHECK_EVAL_BREAKER();
             DISPATCH();
         }
 
+        TARGET(CALL_FUNCTION_EX_PY) {
+            assert(cframe.use_tracing == 0);
+            DEOPT_IF(tstate->interp->eval_frame, CALL_FUNCTION_EX);
+            PyObject *kwargs = (oparg & 0x01) ? TOP() : NULL;
+            PyObject *callargs = PEEK(1 + (oparg & 0x01));
+            PyObject *func = PEEK(2 + (oparg & 0x01));
+            DEOPT_IF(!PyTuple_CheckExact(callargs), CALL_FUNCTION_EX);
+            DEOPT_IF(Py_TYPE(func) != &PyFunction_Type, CALL_FUNCTION_EX);
+            DEOPT_IF(((PyFunctionObject *)func)->vectorcall != _PyFunction_Vectorcall,
+                     CALL_FUNCTION_EX);
+            assert(kwargs == NULL || PyDict_CheckExact(kwargs));
+            STAT_INC(CALL_FUNCTION_EX, hit);
+            int code_flags = ((PyCodeObject *)PyFunction_GET_CODE(func))->co_flags;
+            PyObject *locals = code_flags & CO_OPTIMIZED ? NULL : Py_NewRef(PyFunction_GET_GLOBALS(func));
+            // Pop kwargs, callargs, func and the NULL below func
+            STACK_SHRINK(3 + (oparg & 0x01));
+            assert(stack_pointer[0] == NULL);
+            _PyInterpreterFrame *new_frame = _PyEvalFramePushAndInit_Ex(
+                tstate, (PyFunctionObject *)func, locals, callargs, kwargs);
+            // The frame has stolen func, callargs and kwargs from the stack,
+            // so there is no need to clean them up.
+            if (new_frame == NULL) {
+                goto error;
+            }
+            JUMPBY(INLINE_CACHE_ENTRIES_CALL_FUNCTION_EX);
+            DISPATCH_INLINED(new_frame);
+        }
+
         TARGET(MAKE_FUNCTION) {
             PyObject *codeobj = POP();
             PyFunctionObject *func = (PyFunctionObject *)
@@ -3740,7 +4793,19 @@
         }
 
         TARGET(FORMAT_VALUE) {
+            PREDICTED(FORMAT_VALUE);
             /* Handles f-string value formatting. */
+            _PyFormatValueCache *cache = (_PyFormatValueCache *)next_instr;
+            if (ADAPTIVE_COUNTER_IS_ZERO(cache->counter)) {
+                assert(cframe.use_tracing == 0);
+                next_instr--;
+                _Py_Specialize_FormatValue(
+                    (oparg & FVS_MASK) == FVS_HAVE_SPEC ? SECOND() : TOP(),
+                    next_instr, oparg);
+                DISPATCH_SAME_OPARG();
+            }
+            STAT_INC(FORMAT_VALUE, deferred);
+            DECREMENT_ADAPTIVE_COUNTER(cache->counter);
             PyObject *result;
             PyObject *fmt_spec;
             PyObject *value;
@@ -3795,10 +4860,59 @@
                 }
             }
 
+            JUMPBY(INLINE_CACHE_ENTRIES_FORMAT_VALUE);
             PUSH(result);
             DISPATCH();
         }
 
+        TARGET(FORMAT_VALUE_STR) {
+            assert(cframe.use_tracing == 0);
+            assert((oparg & FVS_MASK) == 0);
+            assert((oparg & FVC_MASK) == FVC_NONE ||
+                   (oparg & FVC_MASK) == FVC_STR);
+            PyObject *value = TOP();
+            DEOPT_IF(!PyUnicode_CheckExact(value), FORMAT_VALUE);
+            STAT_INC(FORMAT_VALUE, hit);
+            /* format(value) and str(value) are value itself */
+            JUMPBY(INLINE_CACHE_ENTRIES_FORMAT_VALUE);
+            DISPATCH();
+        }
+
+        TARGET(FORMAT_VALUE_INT) {
+            assert(cframe.use_tracing == 0);
+            assert((oparg & FVS_MASK) == 0);
+            PyObject *value = TOP();
+            DEOPT_IF(!PyLong_CheckExact(value), FORMAT_VALUE);
+            STAT_INC(FORMAT_VALUE, hit);
+            /* For an exact int, format() with an empty spec, str(),
+               repr() and ascii() all give the decimal representation */
+            PyObject *result = _PyLong_Format(value, 10);
+            if (result == NULL) {
+                goto error;
+            }
+            _Py_DECREF_SPECIALIZED(value, (destructor)PyObject_Free);
+            SET_TOP(result);
+            JUMPBY(INLINE_CACHE_ENTRIES_FORMAT_VALUE);
+            DISPATCH();
+        }
+
+        TARGET(FORMAT_VALUE_FLOAT) {
+            assert(cframe.use_tracing == 0);
+            assert((oparg & FVS_MASK) == 0);
+            PyObject *value = TOP();
+            DEOPT_IF(!PyFloat_CheckExact(value), FORMAT_VALUE);
+            STAT_INC(FORMAT_VALUE, hit);
+            /* Likewise, these all give the repr() of an exact float */
+            PyObject *result = PyFloat_Type.tp_repr(value);
+            if (result == NULL) {
+                goto error;
+            }
+            _Py_DECREF_SPECIALIZED(value, _PyFloat_ExactDealloc);
+            SET_TOP(result);
+            JUMPBY(INLINE_CACHE_ENTRIES_FORMAT_VALUE);
+            DISPATCH();
+        }
+
         TARGET(COPY) {
             assert(oparg != 0);
             PyObject *peek = PEEK(oparg);
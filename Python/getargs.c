@@ -4,6 +4,7 @@
 #include "Python.h"
 #include "pycore_tuple.h"         // _PyTuple_ITEMS()
 #include "pycore_pylifecycle.h"   // _PyArg_Fini
+#include "pycore_pystate.h"       // _PyThreadState_SwapToMain()
 
 #include <ctype.h>
 #include <float.h>
@@ -2035,16 +2036,23 @@ parser_init(struct _PyArg_Parser *parser)
         assert(parser->kwtuple != NULL);
         return 1;
     }
+    // The parser is shared by all interpreters, so its kwtuple must be
+    // created by the main interpreter.  Switch to it before taking the
+    // lock: a thread holding the main GIL may be waiting for the lock.
+    PyThreadState *tstate = _PyThreadState_SwapToMain();
+    if (tstate == NULL) {
+        return 0;
+    }
     PyThread_acquire_lock(_PyRuntime.getargs.mutex, WAIT_LOCK);
     // Check again if another thread initialized the parser
     // while we were waiting for the lock.
-    if (*((volatile int *)&parser->initialized)) {
-        assert(parser->kwtuple != NULL);
-        PyThread_release_lock(_PyRuntime.getargs.mutex);
-        return 1;
+    int ret = 1;
+    if (!*((volatile int *)&parser->initialized)) {
+        ret = _parser_init(parser);
     }
-    int ret = _parser_init(parser);
+    assert(!ret || parser->kwtuple != NULL);
     PyThread_release_lock(_PyRuntime.getargs.mutex);
+    _PyThreadState_SwapFromMain(tstate);
     return ret;
 }
 
@@ -444,18 +444,28 @@ PyImport_GetMagicTag(void)
    dictionary, to avoid loading shared libraries twice.
 */
 
+/* The cache is only ever modified by interpreters sharing the main
+   interpreter's GIL (and its object allocator), but it is read by all
+   of them, so every access goes through the extensions mutex. */
+#define EXTENSIONS_LOCK() \
+    PyThread_acquire_lock(_PyRuntime.imports.extensions_mutex, WAIT_LOCK)
+#define EXTENSIONS_UNLOCK() \
+    PyThread_release_lock(_PyRuntime.imports.extensions_mutex)
+
 static PyModuleDef *
 _extensions_cache_get(PyObject *filename, PyObject *name)
 {
-    PyObject *extensions = _PyRuntime.imports.extensions;
-    if (extensions == NULL) {
-        return NULL;
-    }
+    PyModuleDef *def = NULL;
     PyObject *key = PyTuple_Pack(2, filename, name);
     if (key == NULL) {
         return NULL;
     }
-    PyModuleDef *def = (PyModuleDef *)PyDict_GetItemWithError(extensions, key);
+    EXTENSIONS_LOCK();
+    PyObject *extensions = _PyRuntime.imports.extensions;
+    if (extensions != NULL) {
+        def = (PyModuleDef *)PyDict_GetItemWithError(extensions, key);
+    }
+    EXTENSIONS_UNLOCK();
     Py_DECREF(key);
     return def;
 }
@@ -463,30 +473,54 @@ _extensions_cache_get(PyObject *filename, PyObject *name)
 static int
 _extensions_cache_set(PyObject *filename, PyObject *name, PyModuleDef *def)
 {
+    assert(!_PyInterpreterState_HasFeature(_PyInterpreterState_GET(),
+                                           Py_RTFLAGS_OWN_GIL));
+    int res = -1;
+    EXTENSIONS_LOCK();
     PyObject *extensions = _PyRuntime.imports.extensions;
     if (extensions == NULL) {
         extensions = PyDict_New();
         if (extensions == NULL) {
-            return -1;
+            goto finally;
         }
         _PyRuntime.imports.extensions = extensions;
     }
     PyObject *key = PyTuple_Pack(2, filename, name);
     if (key == NULL) {
-        return -1;
+        goto finally;
     }
-    int res = PyDict_SetItem(extensions, key, (PyObject *)def);
+    res = PyDict_SetItem(extensions, key, (PyObject *)def);
     Py_DECREF(key);
-    if (res < 0) {
-        return -1;
-    }
-    return 0;
+
+finally:
+    EXTENSIONS_UNLOCK();
+    return res < 0 ? -1 : 0;
 }
 
 static void
 _extensions_cache_clear(void)
 {
-    Py_CLEAR(_PyRuntime.imports.extensions);
+    EXTENSIONS_LOCK();
+    PyObject *extensions = _PyRuntime.imports.extensions;
+    _PyRuntime.imports.extensions = NULL;
+    EXTENSIONS_UNLOCK();
+    Py_XDECREF(extensions);
+}
+
+/* Single-phase init extension modules keep their state in process-wide
+   globals (and m_copy), so they can only be used by interpreters that
+   share the main interpreter's GIL. */
+int
+_PyImport_CheckLegacyExtensionAllowed(PyObject *name)
+{
+    PyInterpreterState *interp = _PyInterpreterState_GET();
+    if (_PyInterpreterState_HasFeature(interp, Py_RTFLAGS_OWN_GIL)) {
+        PyErr_Format(PyExc_ImportError,
+                     "module %R does not support loading in subinterpreters "
+                     "with their own GIL", name);
+        return -1;
+    }
+    return 0;
 }
 
 int
@@ -515,7 +549,12 @@ _PyImport_FixupExtensionObject(PyObject *mod, PyObject *name,
 
     // bpo-44050: Extensions and def->m_base.m_copy can be updated
     // when the extension module doesn't support sub-interpreters.
-    if (_Py_IsMainInterpreter(tstate->interp) || def->m_size == -1) {
+    // Interpreters with their own GIL never do: both belong to the
+    // main interpreter's allocator.  The only legacy modules they get
+    // here with are sys and builtins, which they set up themselves.
+    if ((_Py_IsMainInterpreter(tstate->interp) || def->m_size == -1)
+        && !_PyInterpreterState_HasFeature(tstate->interp, Py_RTFLAGS_OWN_GIL))
+    {
         if (def->m_size == -1) {
             if (def->m_base.m_copy) {
                 /* Somebody already imported the module,
@@ -566,6 +605,14 @@ import_find_extension(PyThreadState *tstate, PyObject *name,
     PyObject *mod, *mdict;
     PyObject *modules = tstate->interp->modules;
 
+    /* Builtin modules are looked up with their name as filename.  Those
+       supporting repeated initialization are simply initialized again. */
+    if (def->m_size == -1 || !_PyUnicode_Equal(filename, name)) {
+        if (_PyImport_CheckLegacyExtensionAllowed(name) < 0) {
+            return NULL;
+        }
+    }
+
     if (def->m_size == -1) {
         /* Module does not support repeated initialization */
         if (def->m_base.m_copy == NULL)
@@ -1054,6 +1101,12 @@ create_builtin(PyThreadState *tstate, PyObject *name, PyObject *spec)
                 }
 
                 def->m_base.m_init = p->initfunc;
+                if (def->m_size == -1
+                    && _PyImport_CheckLegacyExtensionAllowed(name) < 0)
+                {
+                    Py_DECREF(mod);
+                    return NULL;
+                }
                 if (_PyImport_FixupExtensionObject(mod, name, name,
                                                    modules) < 0) {
                     return NULL;
@@ -1381,12 +1434,49 @@ find_frozen(PyObject *nameobj, struct frozen_info *info)
     return FROZEN_OKAY;
 }
 
+/* Deepfrozen code objects are static and get quickened in place, so they
+   can't be shared with interpreters that have their own GIL.  These get a
+   copy, marshalled by the main interpreter (which owns the code). */
+static PyObject *
+copy_deepfrozen_code(PyObject *code)
+{
+    PyThreadState *tstate = _PyThreadState_SwapToMain();
+    if (tstate == NULL) {
+        return NULL;
+    }
+    char *data = NULL;
+    Py_ssize_t size = 0;
+    PyObject *bytes = PyMarshal_WriteObjectToString(code, Py_MARSHAL_VERSION);
+    if (bytes != NULL) {
+        size = PyBytes_GET_SIZE(bytes);
+        data = PyMem_RawMalloc(size);
+        if (data == NULL) {
+            PyErr_NoMemory();
+        }
+        else {
+            memcpy(data, PyBytes_AS_STRING(bytes), size);
+        }
+        Py_DECREF(bytes);
+    }
+    _PyThreadState_SwapFromMain(tstate);
+    if (data == NULL) {
+        return NULL;
+    }
+    PyObject *copy = PyMarshal_ReadObjectFromString(data, size);
+    PyMem_RawFree(data);
+    return copy;
+}
+
 static PyObject *
 unmarshal_frozen_code(struct frozen_info *info)
 {
     if (info->get_code) {
         PyObject *code = info->get_code();
         assert(code != NULL);
+        PyInterpreterState *interp = _PyInterpreterState_GET();
+        if (_PyInterpreterState_HasFeature(interp, Py_RTFLAGS_OWN_GIL)) {
+            return copy_deepfrozen_code(code);
+        }
         return code;
     }
     PyObject *co = PyMarshal_ReadObjectFromString(info->data, info->size);
@@ -216,6 +216,10 @@ _PyImport_LoadDynamicModuleWithSpec(PyObject *spec, FILE *fp)
         goto error;
     }
 
+    if (_PyImport_CheckLegacyExtensionAllowed(name_unicode) < 0) {
+        goto error;
+    }
+
     /* Remember pointer to module init function. */
     def = PyModule_GetDef(m);
     if (def == NULL) {
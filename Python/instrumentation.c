@@ -0,0 +1,1002 @@
+/* sys.monitoring: raising events by instrumenting bytecode in place.
+ *
+ * See pycore_instruments.h for an overview. Each code object that has been
+ * instrumented has a _PyCoMonitoringData with an entry for every code unit,
+ * holding the tools monitoring the event raised there and the instruction
+ * that was replaced. An instrumented position holds one of the
+ * INSTRUMENTED_* instructions: INSTRUMENTED_LINE if any tool wants LINE
+ * events there, otherwise the instrumented form of the original
+ * instruction. INSTRUMENTED_LINE runs whichever of those would be there
+ * without it.
+ *
+ * The specialized form of an instrumented instruction is kept, except that
+ * it is not respecialized, so that the specializer never overwrites the
+ * instrumentation. Specializations that run the instruction after them
+ * (superinstructions, COMPARE_OP_*_JUMP and the like) are deoptimized
+ * before an instrumented position, as that would skip it.
+ */
+
+#include "Python.h"
+#include "pycore_code.h"          // _PyCode_CODE()
+#include "pycore_frame.h"         // _PyInterpreterFrame
+#include "pycore_instruments.h"
+#include "pycore_interp.h"        // PyInterpreterState.monitoring
+#include "pycore_namespace.h"     // _PyNamespace_New()
+#include "pycore_object.h"        // _PyObject_IMMORTAL_INIT()
+#include "pycore_opcode.h"        // _PyOpcode_Deopt
+#include "pycore_pyerrors.h"      // _PyErr_Fetch()
+#include "pycore_pystate.h"       // _PyInterpreterState_GET()
+#include "pycore_runtime.h"       // _PyRuntime
+
+#include "clinic/instrumentation.c.h"
+
+/*[clinic input]
+module monitoring
+[clinic start generated code]*/
+/*[clinic end generated code: output=da39a3ee5e6b4b0d input=37257f5987a360cf]*/
+
+#define HEAD_LOCK(runtime) \
+    PyThread_acquire_lock((runtime)->interpreters.mutex, WAIT_LOCK)
+#define HEAD_UNLOCK(runtime) \
+    PyThread_release_lock((runtime)->interpreters.mutex)
+
+/* Returned by a callback to stop it being called for that event at that
+   position, until restart_events() is called. */
+static PyObject _PyInstrumentation_DISABLE =
+    _PyObject_IMMORTAL_INIT(&PyBaseObject_Type);
+
+#define DISABLE (&_PyInstrumentation_DISABLE)
+
+static const char *const event_names[PY_MONITORING_EVENTS] = {
+    [PY_MONITORING_EVENT_PY_START] = "PY_START",
+    [PY_MONITORING_EVENT_PY_RETURN] = "PY_RETURN",
+    [PY_MONITORING_EVENT_LINE] = "LINE",
+    [PY_MONITORING_EVENT_JUMP] = "JUMP",
+    [PY_MONITORING_EVENT_BRANCH] = "BRANCH",
+    [PY_MONITORING_EVENT_RAISE] = "RAISE",
+};
+
+static const uint8_t INSTRUMENTED_OPCODES[256] = {
+    [RESUME] = INSTRUMENTED_RESUME,
+    [RETURN_VALUE] = INSTRUMENTED_RETURN_VALUE,
+    [JUMP_FORWARD] = INSTRUMENTED_JUMP_FORWARD,
+    [JUMP_BACKWARD] = INSTRUMENTED_JUMP_BACKWARD,
+    [POP_JUMP_IF_FALSE] = INSTRUMENTED_POP_JUMP_IF_FALSE,
+    [POP_JUMP_IF_TRUE] = INSTRUMENTED_POP_JUMP_IF_TRUE,
+    [POP_JUMP_IF_NONE] = INSTRUMENTED_POP_JUMP_IF_NONE,
+    [POP_JUMP_IF_NOT_NONE] = INSTRUMENTED_POP_JUMP_IF_NOT_NONE,
+    [JUMP_IF_FALSE_OR_POP] = INSTRUMENTED_JUMP_IF_FALSE_OR_POP,
+    [JUMP_IF_TRUE_OR_POP] = INSTRUMENTED_JUMP_IF_TRUE_OR_POP,
+};
+
+#define IS_INSTRUMENTED(opcode) \
+    ((opcode) >= MIN_INSTRUMENTED_OPCODE && (opcode) <= INSTRUMENTED_LINE)
+
+int
+_Py_GetOriginalOpcode(PyCodeObject *code, int offset)
+{
+    int opcode = _Py_OPCODE(_PyCode_CODE(code)[offset]);
+    if (IS_INSTRUMENTED(opcode)) {
+        assert(code->_co_monitoring != NULL);
+        opcode = code->_co_monitoring->positions[offset].original_opcode;
+    }
+    return opcode;
+}
+
+int
+_Py_GetBaseOpcode(PyCodeObject *code, int offset)
+{
+    return _PyOpcode_Deopt[_Py_GetOriginalOpcode(code, offset)];
+}
+
+static int
+monitors_are_empty(_Py_Monitors monitors)
+{
+    for (int e = 0; e < PY_MONITORING_EVENTS; e++) {
+        if (monitors.tools[e]) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* The local event raised by the instruction at offset, or -1 */
+static int
+instruction_event(PyCodeObject *code, int offset, int base)
+{
+    switch (base) {
+        case RESUME:
+            return offset == code->_co_firsttraceable ?
+                PY_MONITORING_EVENT_PY_START : -1;
+        case RETURN_VALUE:
+            return PY_MONITORING_EVENT_PY_RETURN;
+        case JUMP_FORWARD:
+        case JUMP_BACKWARD:
+            return PY_MONITORING_EVENT_JUMP;
+        case POP_JUMP_IF_FALSE:
+        case POP_JUMP_IF_TRUE:
+        case POP_JUMP_IF_NONE:
+        case POP_JUMP_IF_NOT_NONE:
+        case JUMP_IF_FALSE_OR_POP:
+        case JUMP_IF_TRUE_OR_POP:
+            return PY_MONITORING_EVENT_BRANCH;
+        default:
+            return -1;
+    }
+}
+
+/* Whether the (specialized) instruction also runs the one after it */
+static int
+runs_next_instruction(int opcode)
+{
+    int base = _PyOpcode_Deopt[opcode];
+    if (opcode != base && _PyOpcode_Caches[base] == 0) {
+        // A superinstruction
+        return 1;
+    }
+    switch (opcode) {
+        case BINARY_OP_INPLACE_ADD_UNICODE:
+        case CALL_NO_KW_LIST_APPEND:
+        case COMPARE_OP_FLOAT_JUMP:
+        case COMPARE_OP_INT_JUMP:
+        case COMPARE_OP_STR_JUMP:
+        case FOR_ITER_DICT_ITEMS:
+        case FOR_ITER_ENUMERATE:
+        case FOR_ITER_RANGE:
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+/* Where the jump at offset can go, other than the next instruction, or -1.
+   Exhausted FOR_ITERs skip the END_FOR at their target. The loops of
+   "yield from" and "await" don't start new lines, as with sys.settrace(). */
+static int
+jump_target(int offset, int base, int oparg)
+{
+    int next = offset + 1 + _PyOpcode_Caches[base];
+    switch (base) {
+        case JUMP_FORWARD:
+        case POP_JUMP_IF_FALSE:
+        case POP_JUMP_IF_TRUE:
+        case POP_JUMP_IF_NONE:
+        case POP_JUMP_IF_NOT_NONE:
+        case JUMP_IF_FALSE_OR_POP:
+        case JUMP_IF_TRUE_OR_POP:
+            return next + oparg;
+        case FOR_ITER:
+            return next + oparg + 1;
+        case JUMP_BACKWARD:
+            return next - oparg;
+        default:
+            return -1;
+    }
+}
+
+/* Find the line number of every code unit, and the positions where LINE
+ * events can happen: the starts of lines, and wherever a jump or an
+ * exception handler can resume execution. */
+static _PyCoMonitoringData *
+allocate_monitoring_data(PyCodeObject *code)
+{
+    Py_ssize_t size = Py_SIZE(code);
+    _PyCoMonitoringData *data = PyMem_Calloc(
+        1, sizeof(_PyCoMonitoringData) +
+           size * sizeof(_PyCoMonitoringPosition));
+    if (data == NULL) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+    _PyCoMonitoringPosition *positions = data->positions;
+    PyCodeAddressRange range;
+    _PyCode_InitAddressRange(code, &range);
+    for (int i = 0; i < size; i++) {
+        positions[i].line =
+            _PyCode_CheckLineNumber(i * (int)sizeof(_Py_CODEUNIT), &range);
+    }
+    _Py_CODEUNIT *instructions = _PyCode_CODE(code);
+    int first = code->_co_firsttraceable;
+    int prev = -1;
+    int oparg = 0;
+    for (int i = first; i < size; i++) {
+        int opcode = _PyOpcode_Deopt[_Py_OPCODE(instructions[i])];
+        assert(!IS_INSTRUMENTED(opcode));
+        oparg = oparg << 8 | _Py_OPARG(instructions[i]);
+        if (prev == first ||
+            (prev >= 0 && positions[i].line != positions[prev].line))
+        {
+            positions[i].line_point = 1;
+        }
+        if (opcode != EXTENDED_ARG) {
+            int target = jump_target(i, opcode, oparg);
+            if (target >= 0 && target < size) {
+                positions[target].line_point = 1;
+            }
+            oparg = 0;
+        }
+        prev = i;
+        i += _PyOpcode_Caches[opcode];
+    }
+    unsigned char *scan =
+        (unsigned char *)PyBytes_AS_STRING(code->co_exceptiontable);
+    unsigned char *end = scan + PyBytes_GET_SIZE(code->co_exceptiontable);
+    while (scan < end) {
+        int start, length, handler, depth_and_lasti;
+        scan = parse_varint(scan, &start);
+        scan = parse_varint(scan, &length);
+        scan = parse_varint(scan, &handler);
+        scan = parse_varint(scan, &depth_and_lasti);
+        if (handler < size) {
+            positions[handler].line_point = 1;
+        }
+    }
+    /* Only instructions can be line points, and not all of them: RESUME
+     * has its own events, END_FOR and END_SEND are skipped over by
+     * specialized instructions that assert they are there, and the
+     * instruction after an EXTENDED_ARG must be reached through it. */
+    int after_extended_arg = 0;
+    for (int i = 0; i < size; i++) {
+        int opcode = _PyOpcode_Deopt[_Py_OPCODE(instructions[i])];
+        if (i <= first || opcode == RESUME || opcode == END_FOR ||
+            opcode == END_SEND || after_extended_arg ||
+            positions[i].line < 0)
+        {
+            positions[i].line_point = 0;
+        }
+        after_extended_arg = opcode == EXTENDED_ARG;
+        for (int j = 0; j < _PyOpcode_Caches[opcode]; j++) {
+            positions[++i].line_point = 0;
+        }
+    }
+    return data;
+}
+
+/* Make the instruction at offset match its monitoring data */
+static void
+set_opcode(PyCodeObject *code, int offset)
+{
+    _PyCoMonitoringPosition *position = &code->_co_monitoring->positions[offset];
+    int opcode = position->original_opcode;
+    if (position->line_tools) {
+        opcode = INSTRUMENTED_LINE;
+    }
+    else if (position->tools) {
+        opcode = INSTRUMENTED_OPCODES[_PyOpcode_Deopt[opcode]];
+        assert(opcode != 0);
+    }
+    _Py_SET_OPCODE(_PyCode_CODE(code)[offset], opcode);
+}
+
+/* The instruction at offset comes before an instrumented one; stop it from
+   running that one itself. */
+static void
+deopt_before_instrumented(PyCodeObject *code, int offset)
+{
+    _Py_CODEUNIT *instructions = _PyCode_CODE(code);
+    _PyCoMonitoringPosition *position = &code->_co_monitoring->positions[offset];
+    int instrumented = IS_INSTRUMENTED(_Py_OPCODE(instructions[offset]));
+    int opcode = instrumented ? position->original_opcode
+                              : _Py_OPCODE(instructions[offset]);
+    if (!runs_next_instruction(opcode)) {
+        return;
+    }
+    int base = _PyOpcode_Deopt[opcode];
+    if (_PyOpcode_Caches[base]) {
+        instructions[offset + 1] = adaptive_counter_warmup();
+    }
+    if (instrumented) {
+        position->original_opcode = base;
+    }
+    else {
+        _Py_SET_OPCODE(instructions[offset], base);
+    }
+}
+
+static uint8_t
+update_tools(uint8_t tools, uint8_t old_active, uint8_t new_active)
+{
+    /* Keep the tools that are still active and haven't disabled the
+     * event here, and add those that have just been activated. */
+    return (tools & new_active) | (new_active & ~old_active);
+}
+
+int
+_Py_Instrument(PyCodeObject *code, PyInterpreterState *interp)
+{
+    struct _Py_monitoring_state *state = &interp->monitoring;
+    _PyCoMonitoringData *data = code->_co_monitoring;
+    _Py_Monitors active = state->monitors;
+    if (data == NULL) {
+        if (monitors_are_empty(active)) {
+            code->_co_instrumentation_version = state->version;
+            return 0;
+        }
+        data = allocate_monitoring_data(code);
+        if (data == NULL) {
+            return -1;
+        }
+        code->_co_monitoring = data;
+    }
+    for (int e = 0; e < PY_MONITORING_EVENTS; e++) {
+        active.tools[e] |= data->local_monitors.tools[e];
+    }
+    _Py_Monitors old = data->active_monitors;
+    if (data->restart_version != state->restart_version) {
+        // Bring back the events that tools have disabled
+        memset(&old, 0, sizeof(old));
+    }
+    int monitored = !monitors_are_empty(active);
+    _Py_CODEUNIT *instructions = _PyCode_CODE(code);
+    int prev = -1;
+    for (int i = code->_co_firsttraceable; i < Py_SIZE(code); i++) {
+        _PyCoMonitoringPosition *position = &data->positions[i];
+        int opcode = _Py_OPCODE(instructions[i]);
+        if (IS_INSTRUMENTED(opcode)) {
+            opcode = position->original_opcode;
+        }
+        if (opcode == JUMP_BACKWARD_INTO_TRACE && monitored) {
+            // Traces don't raise events, so stop running this one:
+            opcode = JUMP_BACKWARD;
+            instructions[i + 1] = adaptive_counter_back_edge();
+        }
+        position->original_opcode = opcode;
+        int base = _PyOpcode_Deopt[opcode];
+        int event = instruction_event(code, i, base);
+        if (event >= 0) {
+            position->tools = update_tools(position->tools, old.tools[event],
+                                           active.tools[event]);
+        }
+        if (position->line_point) {
+            int e = PY_MONITORING_EVENT_LINE;
+            position->line_tools = update_tools(position->line_tools,
+                                                old.tools[e], active.tools[e]);
+        }
+        set_opcode(code, i);
+        if ((position->tools || position->line_tools) && prev >= 0) {
+            deopt_before_instrumented(code, prev);
+        }
+        prev = i;
+        i += _PyOpcode_Caches[base];
+    }
+    data->active_monitors = active;
+    data->restart_version = state->restart_version;
+    code->_co_instrumentation_version = state->version;
+    return 0;
+}
+
+/* Call the tools in *tools that have a callable for event. Those that
+   return DISABLE are removed from *tools. */
+static int
+call_tools(PyThreadState *tstate, int event, uint8_t *tools,
+           PyObject **args, Py_ssize_t nargs)
+{
+    PyObject *(*callables)[PY_MONITORING_EVENTS] =
+        tstate->interp->monitoring.callables;
+    int err = 0;
+    PyThreadState_EnterTracing(tstate);
+    for (int tool = 0; tool < PY_MONITORING_TOOL_IDS; tool++) {
+        if ((*tools & (1 << tool)) == 0 || callables[tool][event] == NULL) {
+            continue;
+        }
+        PyObject *callable = Py_NewRef(callables[tool][event]);
+        PyObject *res = PyObject_Vectorcall(callable, args, nargs, NULL);
+        Py_DECREF(callable);
+        if (res == NULL) {
+            err = -1;
+            break;
+        }
+        if (res == DISABLE) {
+            *tools &= ~(1 << tool);
+        }
+        Py_DECREF(res);
+    }
+    PyThreadState_LeaveTracing(tstate);
+    return err;
+}
+
+/* Stop calling the tools in disabled for the event at offset */
+static void
+disable_tools(PyCodeObject *code, int offset, int line, uint8_t disabled)
+{
+    if (disabled == 0 ||
+        !IS_INSTRUMENTED(_Py_OPCODE(_PyCode_CODE(code)[offset])))
+    {
+        // A callback may have removed the instrumentation already
+        return;
+    }
+    _PyCoMonitoringPosition *position = &code->_co_monitoring->positions[offset];
+    if (line) {
+        position->line_tools &= ~disabled;
+    }
+    else {
+        position->tools &= ~disabled;
+    }
+    set_opcode(code, offset);
+}
+
+static int
+call_instrumentation_vector(PyThreadState *tstate, int event,
+                            _PyInterpreterFrame *frame, _Py_CODEUNIT *instr,
+                            PyObject **args, Py_ssize_t nargs)
+{
+    if (tstate->tracing) {
+        return 0;
+    }
+    PyCodeObject *code = frame->f_code;
+    int offset = (int)(instr - _PyCode_CODE(code));
+    uint8_t tools = code->_co_monitoring->positions[offset].tools;
+    uint8_t enabled = tools;
+    PyObject *offset_obj = PyLong_FromLong(offset * (int)sizeof(_Py_CODEUNIT));
+    if (offset_obj == NULL) {
+        return -1;
+    }
+    args[0] = (PyObject *)code;
+    args[1] = offset_obj;
+    int err = call_tools(tstate, event, &tools, args, nargs);
+    Py_DECREF(offset_obj);
+    disable_tools(code, offset, 0, enabled & ~tools);
+    return err;
+}
+
+int
+_Py_call_instrumentation(PyThreadState *tstate, int event,
+                         _PyInterpreterFrame *frame, _Py_CODEUNIT *instr)
+{
+    PyObject *args[2];
+    return call_instrumentation_vector(tstate, event, frame, instr, args, 2);
+}
+
+int
+_Py_call_instrumentation_arg(PyThreadState *tstate, int event,
+                             _PyInterpreterFrame *frame, _Py_CODEUNIT *instr,
+                             PyObject *arg)
+{
+    PyObject *args[3] = {NULL, NULL, arg};
+    return call_instrumentation_vector(tstate, event, frame, instr, args, 3);
+}
+
+int
+_Py_call_instrumentation_jump(PyThreadState *tstate, int event,
+                              _PyInterpreterFrame *frame,
+                              _Py_CODEUNIT *src, _Py_CODEUNIT *dest)
+{
+    assert(event == PY_MONITORING_EVENT_JUMP ||
+           event == PY_MONITORING_EVENT_BRANCH);
+    int to = (int)(dest - _PyCode_CODE(frame->f_code));
+    PyObject *to_obj = PyLong_FromLong(to * (int)sizeof(_Py_CODEUNIT));
+    if (to_obj == NULL) {
+        return -1;
+    }
+    PyObject *args[3] = {NULL, NULL, to_obj};
+    int err = call_instrumentation_vector(tstate, event, frame, src, args, 3);
+    Py_DECREF(to_obj);
+    return err;
+}
+
+int
+_Py_call_instrumentation_line(PyThreadState *tstate,
+                              _PyInterpreterFrame *frame,
+                              _Py_CODEUNIT *here, _Py_CODEUNIT *prev)
+{
+    PyCodeObject *code = frame->f_code;
+    _PyCoMonitoringData *data = code->_co_monitoring;
+    int offset = (int)(here - _PyCode_CODE(code));
+    int prev_offset = (int)(prev - _PyCode_CODE(code));
+    _PyCoMonitoringPosition *position = &data->positions[offset];
+    /* The line is new if execution has just started, jumped back (other
+     * than to the SEND of a "yield from" or "await"), or come from another
+     * line. */
+    if (tstate->tracing == 0 && position->line >= 0 &&
+        (prev_offset <= code->_co_firsttraceable ||
+         (prev_offset >= offset &&
+          _PyOpcode_Deopt[position->original_opcode] != SEND) ||
+         data->positions[prev_offset].line != position->line))
+    {
+        PyObject *line = PyLong_FromLong(position->line);
+        if (line == NULL) {
+            return -1;
+        }
+        PyObject *args[2] = {(PyObject *)code, line};
+        uint8_t tools = position->line_tools;
+        uint8_t enabled = tools;
+        int err = call_tools(tstate, PY_MONITORING_EVENT_LINE, &tools,
+                             args, 2);
+        Py_DECREF(line);
+        disable_tools(code, offset, 1, enabled & ~tools);
+        if (err) {
+            return -1;
+        }
+    }
+    /* A callback may have changed the instrumentation here */
+    int opcode = _Py_OPCODE(*here);
+    if (!IS_INSTRUMENTED(opcode)) {
+        return opcode;
+    }
+    if (position->tools) {
+        return INSTRUMENTED_OPCODES[_PyOpcode_Deopt[position->original_opcode]];
+    }
+    return position->original_opcode;
+}
+
+void
+_Py_call_instrumentation_exc(PyThreadState *tstate, _PyInterpreterFrame *frame)
+{
+    PyCodeObject *code = frame->f_code;
+    assert(code->_co_monitoring != NULL);
+    uint8_t tools =
+        code->_co_monitoring->active_monitors.tools[PY_MONITORING_EVENT_RAISE];
+    if (tools == 0 || tstate->tracing) {
+        return;
+    }
+    PyObject *type, *value, *traceback;
+    _PyErr_Fetch(tstate, &type, &value, &traceback);
+    _PyErr_NormalizeException(tstate, &type, &value, &traceback);
+    int offset = _PyInterpreterFrame_LASTI(frame) * (int)sizeof(_Py_CODEUNIT);
+    PyObject *offset_obj = PyLong_FromLong(offset);
+    int err = -1;
+    if (offset_obj != NULL) {
+        PyObject *args[3] = {(PyObject *)code, offset_obj, value};
+        uint8_t enabled = tools;
+        err = call_tools(tstate, PY_MONITORING_EVENT_RAISE, &tools, args, 3);
+        Py_DECREF(offset_obj);
+        if (err == 0 && tools != enabled) {
+            PyErr_SetString(PyExc_ValueError,
+                            "cannot disable RAISE events");
+            err = -1;
+        }
+    }
+    if (err == 0) {
+        _PyErr_Restore(tstate, type, value, traceback);
+    }
+    else {
+        Py_XDECREF(type);
+        Py_XDECREF(value);
+        Py_XDECREF(traceback);
+    }
+}
+
+/* Versions are unique across interpreters, since they share the code
+ * objects that are statically allocated. */
+static uint32_t last_monitoring_version = 0;
+
+static void
+bump_version(PyInterpreterState *interp)
+{
+    _PyRuntimeState *runtime = &_PyRuntime;
+    HEAD_LOCK(runtime);
+    if (++last_monitoring_version == 0) {
+        // Zero is the version of code that has never been instrumented
+        last_monitoring_version++;
+    }
+    interp->monitoring.version = last_monitoring_version;
+    HEAD_UNLOCK(runtime);
+}
+
+/* Code that isn't running will be instrumented by its next RESUME */
+static int
+instrument_running_code(PyInterpreterState *interp)
+{
+    bump_version(interp);
+    _PyRuntimeState *runtime = &_PyRuntime;
+    int err = 0;
+    HEAD_LOCK(runtime);
+    for (PyThreadState *p = interp->threads.head; p != NULL; p = p->next) {
+        _PyInterpreterFrame *frame = p->cframe->current_frame;
+        for (; frame != NULL && err == 0; frame = frame->previous) {
+            if (frame->owner != FRAME_OWNED_BY_CSTACK) {
+                err = _Py_Instrument(frame->f_code, interp);
+            }
+        }
+    }
+    HEAD_UNLOCK(runtime);
+    return err;
+}
+
+void
+_Py_ClearMonitoring(PyInterpreterState *interp)
+{
+    struct _Py_monitoring_state *state = &interp->monitoring;
+    memset(&state->monitors, 0, sizeof(state->monitors));
+    for (int tool = 0; tool < PY_MONITORING_TOOL_IDS; tool++) {
+        Py_CLEAR(state->tool_names[tool]);
+        for (int e = 0; e < PY_MONITORING_EVENTS; e++) {
+            Py_CLEAR(state->callables[tool][e]);
+        }
+    }
+}
+
+static int
+check_valid_tool(int tool_id)
+{
+    if (tool_id < 0 || tool_id >= PY_MONITORING_TOOL_IDS) {
+        PyErr_Format(PyExc_ValueError, "invalid tool %d (must be between 0 "
+                     "and %d)", tool_id, PY_MONITORING_TOOL_IDS - 1);
+        return -1;
+    }
+    return 0;
+}
+
+static int
+check_tool(PyInterpreterState *interp, int tool_id)
+{
+    if (check_valid_tool(tool_id)) {
+        return -1;
+    }
+    if (interp->monitoring.tool_names[tool_id] == NULL) {
+        PyErr_Format(PyExc_ValueError, "tool %d is not in use", tool_id);
+        return -1;
+    }
+    return 0;
+}
+
+static int
+check_event_set(int event_set)
+{
+    if (event_set < 0 || event_set >= (1 << PY_MONITORING_EVENTS)) {
+        PyErr_Format(PyExc_ValueError, "invalid event set 0x%x", event_set);
+        return -1;
+    }
+    return 0;
+}
+
+static int
+get_events(_Py_Monitors *monitors, int tool_id)
+{
+    int event_set = 0;
+    for (int e = 0; e < PY_MONITORING_EVENTS; e++) {
+        if (monitors->tools[e] & (1 << tool_id)) {
+            event_set |= 1 << e;
+        }
+    }
+    return event_set;
+}
+
+static void
+set_events(_Py_Monitors *monitors, int tool_id, int event_set)
+{
+    for (int e = 0; e < PY_MONITORING_EVENTS; e++) {
+        if (event_set & (1 << e)) {
+            monitors->tools[e] |= 1 << tool_id;
+        }
+        else {
+            monitors->tools[e] &= ~(1 << tool_id);
+        }
+    }
+}
+
+/*[clinic input]
+monitoring.use_tool_id
+
+    tool_id: int
+    name: unicode
+    /
+
+Reserve tool_id for the tool called name.
+
+Raise ValueError if tool_id is already in use.
+[clinic start generated code]*/
+
+static PyObject *
+monitoring_use_tool_id_impl(PyObject *module, int tool_id, PyObject *name)
+/*[clinic end generated code: output=30d76dc92b7cd653 input=6c82518ad084553e]*/
+{
+    if (check_valid_tool(tool_id)) {
+        return NULL;
+    }
+    PyInterpreterState *interp = _PyInterpreterState_GET();
+    if (interp->monitoring.tool_names[tool_id] != NULL) {
+        PyErr_Format(PyExc_ValueError, "tool %d is already in use", tool_id);
+        return NULL;
+    }
+    interp->monitoring.tool_names[tool_id] = Py_NewRef(name);
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+monitoring.free_tool_id
+
+    tool_id: int
+    /
+
+Release tool_id, clearing its global events and callbacks.
+[clinic start generated code]*/
+
+static PyObject *
+monitoring_free_tool_id_impl(PyObject *module, int tool_id)
+/*[clinic end generated code: output=86c2d2a1219a8591 input=808dd4c98d8b1d4f]*/
+{
+    if (check_valid_tool(tool_id)) {
+        return NULL;
+    }
+    PyInterpreterState *interp = _PyInterpreterState_GET();
+    struct _Py_monitoring_state *state = &interp->monitoring;
+    Py_CLEAR(state->tool_names[tool_id]);
+    for (int e = 0; e < PY_MONITORING_EVENTS; e++) {
+        Py_CLEAR(state->callables[tool_id][e]);
+    }
+    set_events(&state->monitors, tool_id, 0);
+    if (instrument_running_code(interp)) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+monitoring.get_tool
+
+    tool_id: int
+    /
+
+Return the name of the tool using tool_id, or None if it is free.
+[clinic start generated code]*/
+
+static PyObject *
+monitoring_get_tool_impl(PyObject *module, int tool_id)
+/*[clinic end generated code: output=1c05a98b404a9a16 input=831346b22d3611c2]*/
+{
+    if (check_valid_tool(tool_id)) {
+        return NULL;
+    }
+    PyInterpreterState *interp = _PyInterpreterState_GET();
+    PyObject *name = interp->monitoring.tool_names[tool_id];
+    if (name == NULL) {
+        Py_RETURN_NONE;
+    }
+    return Py_NewRef(name);
+}
+
+/*[clinic input]
+monitoring.register_callback
+
+    tool_id: int
+    event: int
+    func: object
+    /
+
+Register func to be called by tool_id for event, or unregister if None.
+
+Return the callable that was registered before, or None.
+[clinic start generated code]*/
+
+static PyObject *
+monitoring_register_callback_impl(PyObject *module, int tool_id, int event,
+                                  PyObject *func)
+/*[clinic end generated code: output=e64daa363004030c input=8efd9dfd2c8c88dd]*/
+{
+    PyInterpreterState *interp = _PyInterpreterState_GET();
+    if (check_tool(interp, tool_id)) {
+        return NULL;
+    }
+    if (event <= 0 || (event & (event - 1)) != 0 ||
+        event >= (1 << PY_MONITORING_EVENTS))
+    {
+        PyErr_Format(PyExc_ValueError,
+                     "invalid event %d (must be a single event)", event);
+        return NULL;
+    }
+    int e = 0;
+    while (event >> (e + 1)) {
+        e++;
+    }
+    PyObject **slot = &interp->monitoring.callables[tool_id][e];
+    PyObject *old = *slot;
+    *slot = Py_IsNone(func) ? NULL : Py_NewRef(func);
+    if (old == NULL) {
+        Py_RETURN_NONE;
+    }
+    return old;
+}
+
+/*[clinic input]
+monitoring.get_events -> int
+
+    tool_id: int
+    /
+
+Return the set of events that tool_id monitors in all code.
+[clinic start generated code]*/
+
+static int
+monitoring_get_events_impl(PyObject *module, int tool_id)
+/*[clinic end generated code: output=4450cc13f826c8c0 input=58c094721ea47568]*/
+{
+    PyInterpreterState *interp = _PyInterpreterState_GET();
+    if (check_tool(interp, tool_id)) {
+        return -1;
+    }
+    return get_events(&interp->monitoring.monitors, tool_id);
+}
+
+/*[clinic input]
+monitoring.set_events
+
+    tool_id: int
+    event_set: int
+    /
+
+Make tool_id monitor the events in event_set in all code.
+[clinic start generated code]*/
+
+static PyObject *
+monitoring_set_events_impl(PyObject *module, int tool_id, int event_set)
+/*[clinic end generated code: output=1916c1e49cfb5bdb input=c23b13ce22d67aa7]*/
+{
+    PyInterpreterState *interp = _PyInterpreterState_GET();
+    if (check_tool(interp, tool_id) || check_event_set(event_set)) {
+        return NULL;
+    }
+    set_events(&interp->monitoring.monitors, tool_id, event_set);
+    if (instrument_running_code(interp)) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+monitoring.get_local_events -> int
+
+    tool_id: int
+    code: object(subclass_of='&PyCode_Type')
+    /
+
+Return the set of events that tool_id monitors in code alone.
+[clinic start generated code]*/
+
+static int
+monitoring_get_local_events_impl(PyObject *module, int tool_id,
+                                 PyObject *code)
+/*[clinic end generated code: output=d3e92c1c9c1de8f9 input=1ac82111c559ee2c]*/
+{
+    PyInterpreterState *interp = _PyInterpreterState_GET();
+    if (check_tool(interp, tool_id)) {
+        return -1;
+    }
+    _PyCoMonitoringData *data = ((PyCodeObject *)code)->_co_monitoring;
+    if (data == NULL) {
+        return 0;
+    }
+    return get_events(&data->local_monitors, tool_id);
+}
+
+/*[clinic input]
+monitoring.set_local_events
+
+    tool_id: int
+    code: object(subclass_of='&PyCode_Type')
+    event_set: int
+    /
+
+Make tool_id monitor the events in event_set in code alone.
+[clinic start generated code]*/
+
+static PyObject *
+monitoring_set_local_events_impl(PyObject *module, int tool_id,
+                                 PyObject *code, int event_set)
+/*[clinic end generated code: output=68cc755a65dfea99 input=59b9f46ab5da931e]*/
+{
+    PyInterpreterState *interp = _PyInterpreterState_GET();
+    if (check_tool(interp, tool_id) || check_event_set(event_set)) {
+        return NULL;
+    }
+    PyCodeObject *co = (PyCodeObject *)code;
+    if (co->_co_monitoring == NULL) {
+        if (event_set == 0) {
+            Py_RETURN_NONE;
+        }
+        // Without monitoring data, the code has never been instrumented
+        co->_co_monitoring = allocate_monitoring_data(co);
+        if (co->_co_monitoring == NULL) {
+            return NULL;
+        }
+    }
+    set_events(&co->_co_monitoring->local_monitors, tool_id, event_set);
+    if (_Py_Instrument(co, interp)) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+monitoring.restart_events
+
+Re-enable the events that callbacks have disabled by returning DISABLE.
+[clinic start generated code]*/
+
+static PyObject *
+monitoring_restart_events_impl(PyObject *module)
+/*[clinic end generated code: output=e025dd5ba33314c4 input=6130405d28c176d8]*/
+{
+    PyInterpreterState *interp = _PyInterpreterState_GET();
+    interp->monitoring.restart_version++;
+    if (instrument_running_code(interp)) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+static PyMethodDef monitoring_methods[] = {
+    MONITORING_USE_TOOL_ID_METHODDEF
+    MONITORING_FREE_TOOL_ID_METHODDEF
+    MONITORING_GET_TOOL_METHODDEF
+    MONITORING_REGISTER_CALLBACK_METHODDEF
+    MONITORING_GET_EVENTS_METHODDEF
+    MONITORING_SET_EVENTS_METHODDEF
+    MONITORING_GET_LOCAL_EVENTS_METHODDEF
+    MONITORING_SET_LOCAL_EVENTS_METHODDEF
+    MONITORING_RESTART_EVENTS_METHODDEF
+    {NULL, NULL}
+};
+
+PyDoc_STRVAR(monitoring_doc,
+"Event monitoring for tools such as debuggers, profilers and coverage.\n\
+\n\
+A tool reserves a tool id with use_tool_id(), registers callbacks for the\n\
+events in sys.monitoring.events with register_callback(), and turns the\n\
+events on for all code with set_events(), or for a single code object\n\
+with set_local_events(). Only the code that is monitored is affected.");
+
+static struct PyModuleDef monitoring_module = {
+    PyModuleDef_HEAD_INIT,
+    .m_name = "sys.monitoring",
+    .m_doc = monitoring_doc,
+    .m_size = -1,
+    .m_methods = monitoring_methods,
+};
+
+PyObject *
+_Py_CreateMonitoringObject(void)
+{
+    PyObject *mod = _PyModule_CreateInitialized(&monitoring_module,
+                                                PYTHON_API_VERSION);
+    if (mod == NULL) {
+        return NULL;
+    }
+    if (PyModule_AddObjectRef(mod, "DISABLE", DISABLE) < 0) {
+        goto error;
+    }
+    PyObject *events = PyDict_New();
+    if (events == NULL) {
+        goto error;
+    }
+    for (int e = 0; e <= PY_MONITORING_EVENTS; e++) {
+        const char *name = e < PY_MONITORING_EVENTS ? event_names[e]
+                                                    : "NO_EVENTS";
+        PyObject *value = PyLong_FromLong(
+            e < PY_MONITORING_EVENTS ? 1 << e : 0);
+        if (value == NULL ||
+            PyDict_SetItemString(events, name, value) < 0)
+        {
+            Py_XDECREF(value);
+            Py_DECREF(events);
+            goto error;
+        }
+        Py_DECREF(value);
+    }
+    PyObject *namespace = _PyNamespace_New(events);
+    Py_DECREF(events);
+    if (namespace == NULL) {
+        goto error;
+    }
+    int err = PyModule_AddObjectRef(mod, "events", namespace);
+    Py_DECREF(namespace);
+    if (err < 0) {
+        goto error;
+    }
+    if (PyModule_AddIntConstant(mod, "DEBUGGER_ID",
+                                PY_MONITORING_DEBUGGER_ID) < 0 ||
+        PyModule_AddIntConstant(mod, "COVERAGE_ID",
+                                PY_MONITORING_COVERAGE_ID) < 0 ||
+        PyModule_AddIntConstant(mod, "PROFILER_ID",
+                                PY_MONITORING_PROFILER_ID) < 0 ||
+        PyModule_AddIntConstant(mod, "OPTIMIZER_ID",
+                                PY_MONITORING_OPTIMIZER_ID) < 0)
+    {
+        goto error;
+    }
+    return mod;
+
+error:
+    Py_DECREF(mod);
+    return NULL;
+}
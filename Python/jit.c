@@ -0,0 +1,169 @@
+/* The experimental copy-and-patch JIT compiler.
+ *
+ * A tier-2 trace is compiled by copying, for each of its micro-ops, the
+ * stencil that Tools/jit/build.py built for that micro-op from
+ * Tools/jit/template.c, and patching the holes in the copy: the micro-op's
+ * oparg, operand and target, the addresses of the code for the next
+ * micro-op and for the target of a branch, and the addresses of the C
+ * functions and data it uses. The code of all micro-ops goes in one block
+ * of memory, followed by their read-only data, and is then made executable.
+ *
+ * Only built when configured with --enable-experimental-jit; traces that
+ * can't be compiled are interpreted by _PyUopExecute() as usual.
+ */
+
+#include "Python.h"
+#include "pycore_abstract.h"      // _PyIndex_Check()
+#include "pycore_call.h"          // _PyObject_FastCallDictTstate()
+#include "pycore_ceval.h"         // _PyPerfTrampoline_RegisterCode()
+#include "pycore_code.h"
+#include "pycore_dict.h"
+#include "pycore_frame.h"
+#include "pycore_jit.h"
+#include "pycore_long.h"          // _PyLong_Add()
+#include "pycore_object.h"
+#include "pycore_opcode.h"        // _PyOpcode_Deopt
+#include "pycore_pyerrors.h"      // _PyErr_Format()
+#include "pycore_range.h"         // _PyRangeIterObject
+#include "pycore_sliceobject.h"   // _PyBuildSlice_ConsumeRefs
+#include "pycore_uops.h"
+#include "opcode.h"
+#include "opcode_metadata.h"      // MAX_UOP_ID
+
+#ifdef _Py_JIT
+
+#include <sys/mman.h>             // mmap()
+#include <unistd.h>               // sysconf()
+
+// What a hole is patched with, besides the address of its symbol (if any)
+// and its addend:
+typedef enum {
+    HoleValue_CODE,               // The start of this micro-op's code
+    HoleValue_CONTINUE,           // The code of the next micro-op
+    HoleValue_DATA,               // The start of this micro-op's data
+    HoleValue_JUMP_TARGET,        // The code of the micro-op at index oparg
+    HoleValue_OPARG,
+    HoleValue_OPERAND,
+    HoleValue_TARGET,
+    HoleValue_ZERO,
+} HoleValue;
+
+typedef struct {
+    // Offset of the 64-bit absolute address to patch
+    size_t offset;
+    HoleValue value;
+    uintptr_t symbol;
+    int64_t addend;
+} Hole;
+
+typedef struct {
+    size_t body_size;
+    const unsigned char *body;
+    size_t holes_size;
+    const Hole *holes;
+} Stencil;
+
+typedef struct {
+    Stencil code;
+    Stencil data;
+} StencilGroup;
+
+// Generated at build time by Tools/jit/build.py:
+#include "Python/jit_stencils.h"
+
+// The data of each micro-op is copied to an address aligned like this,
+// which is at least as strict as any of the sections it came from
+#define DATA_ALIGN 16
+
+static void
+copy_and_patch(unsigned char *base, const Stencil *stencil,
+               const uint64_t patches[])
+{
+    if (stencil->body_size == 0) {
+        return;
+    }
+    memcpy(base, stencil->body, stencil->body_size);
+    for (size_t i = 0; i < stencil->holes_size; i++) {
+        const Hole *hole = &stencil->holes[i];
+        uint64_t value = patches[hole->value] + hole->symbol +
+                         (uint64_t)hole->addend;
+        // Holes aren't necessarily aligned:
+        memcpy(base + hole->offset, &value, sizeof(value));
+    }
+}
+
+void
+_PyJIT_Compile(_PyUOpExecutor *executor, PyCodeObject *code)
+{
+    assert(executor->jit_code == NULL);
+    int length = executor->length;
+    // Offsets of the code of each micro-op, and of the end of the code:
+    size_t *offsets = PyMem_Malloc((length + 1) * sizeof(size_t));
+    if (offsets == NULL) {
+        return;
+    }
+    size_t code_size = 0;
+    size_t data_size = 0;
+    for (int i = 0; i < length; i++) {
+        const StencilGroup *group = &stencil_groups[executor->trace[i].opcode];
+        if (group->code.body_size == 0) {
+            // No stencil for this micro-op
+            PyMem_Free(offsets);
+            return;
+        }
+        offsets[i] = code_size;
+        code_size += group->code.body_size;
+        data_size += _Py_SIZE_ROUND_UP(group->data.body_size, DATA_ALIGN);
+    }
+    offsets[length] = code_size;
+    size_t data_start = _Py_SIZE_ROUND_UP(code_size, DATA_ALIGN);
+    size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+    size_t size = _Py_SIZE_ROUND_UP(data_start + data_size, page_size);
+    unsigned char *memory = mmap(NULL, size, PROT_READ | PROT_WRITE,
+                                 MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (memory == MAP_FAILED) {
+        PyMem_Free(offsets);
+        return;
+    }
+    unsigned char *data = memory + data_start;
+    for (int i = 0; i < length; i++) {
+        _PyUOpInstruction *uop = &executor->trace[i];
+        const StencilGroup *group = &stencil_groups[uop->opcode];
+        unsigned char *code_base = memory + offsets[i];
+        uint64_t patches[] = {
+            [HoleValue_CODE] = (uintptr_t)code_base,
+            [HoleValue_CONTINUE] = (uintptr_t)(memory + offsets[i + 1]),
+            [HoleValue_DATA] = (uintptr_t)data,
+            [HoleValue_JUMP_TARGET] = uop->oparg < length
+                ? (uintptr_t)(memory + offsets[uop->oparg]) : 0,
+            [HoleValue_OPARG] = uop->oparg,
+            [HoleValue_OPERAND] = uop->operand,
+            [HoleValue_TARGET] = uop->target,
+            [HoleValue_ZERO] = 0,
+        };
+        copy_and_patch(code_base, &group->code, patches);
+        copy_and_patch(data, &group->data, patches);
+        data += _Py_SIZE_ROUND_UP(group->data.body_size, DATA_ALIGN);
+    }
+    PyMem_Free(offsets);
+    // Some systems don't allow executable memory; interpret the trace there
+    if (mprotect(memory, size, PROT_READ | PROT_EXEC) < 0) {
+        munmap(memory, size);
+        return;
+    }
+    executor->jit_code = memory;
+    executor->jit_size = size;
+    _PyPerfTrampoline_RegisterCode(memory, (unsigned int)code_size, code);
+}
+
+void
+_PyJIT_Free(_PyUOpExecutor *executor)
+{
+    if (executor->jit_code != NULL) {
+        munmap(executor->jit_code, executor->jit_size);
+        executor->jit_code = NULL;
+        executor->jit_size = 0;
+    }
+}
+
+#endif  // _Py_JIT
@@ -0,0 +1,351 @@
+// This file is generated by Tools/cases_generator/generate_cases.py
+// from Python/bytecodes.c
+// Do not edit!
+
+// Micro-ops that aren't also tier-1 instructions
+#define _GUARD_BOTH_INT 300
+#define _BINARY_OP_MULTIPLY_INT 301
+#define _BINARY_OP_ADD_INT 302
+#define _BINARY_OP_SUBTRACT_INT 303
+#define _GUARD_BOTH_FLOAT 304
+#define _BINARY_OP_MULTIPLY_FLOAT 305
+#define _BINARY_OP_ADD_FLOAT 306
+#define _BINARY_OP_SUBTRACT_FLOAT 307
+#define _GUARD_BOTH_UNICODE 308
+#define _BINARY_OP_ADD_UNICODE 309
+#define _COMPARE_OP_FLOAT 310
+#define _JUMP_IF 311
+#define _JUMP_TO_STUB_IF 312
+#define _COMPARE_OP_INT 313
+#define _COMPARE_OP_STR 314
+#define EXIT_TRACE 315
+#define JUMP_TO_TOP 316
+#define _POP_JUMP_IF_FALSE 317
+#define _POP_JUMP_IF_TRUE 318
+#define _POP_JUMP_IF_NOT_NONE 319
+#define _POP_JUMP_IF_NONE 320
+#define _FOR_ITER_LIST 321
+#define _FOR_ITER_TUPLE 322
+#define _FOR_ITER_RANGE 323
+#define MAX_UOP_ID 323
+
+#define MAX_UOPS_PER_EXPANSION 4
+
+// The superinstruction that _PyCode_Quicken() puts in place of the
+// first of a pair of instructions, or 0
+static inline int
+_PyOpcode_Superinstruction(int first, int second)
+{
+    switch (first << 8 | second) {
+        case LOAD_CONST << 8 | LOAD_FAST:
+            return LOAD_CONST__LOAD_FAST;
+        case LOAD_FAST << 8 | LOAD_CONST:
+            return LOAD_FAST__LOAD_CONST;
+        case LOAD_FAST << 8 | LOAD_FAST:
+            return LOAD_FAST__LOAD_FAST;
+        case STORE_FAST << 8 | LOAD_FAST:
+            return STORE_FAST__LOAD_FAST;
+        case STORE_FAST << 8 | STORE_FAST:
+            return STORE_FAST__STORE_FAST;
+    }
+    return 0;
+}
+
+struct opcode_macro_expansion {
+    int nuops;
+    struct {
+        int16_t uop;
+        // Code unit holding the oparg, relative to the instruction
+        int8_t offset;
+        // Operand location in the cache following that code unit
+        int8_t cache_offset;
+        int8_t cache_size;  // 0 if there is no operand
+    } uops[MAX_UOPS_PER_EXPANSION];
+};
+
+#ifndef NEED_OPCODE_METADATA
+extern const struct opcode_macro_expansion _PyOpcode_macro_expansion[256];
+extern const char *const _PyUop_name[MAX_UOP_ID + 1];
+extern const int8_t _PyUop_popped[MAX_UOP_ID + 1];
+extern const int8_t _PyUop_pushed[MAX_UOP_ID + 1];
+#else
+const struct opcode_macro_expansion _PyOpcode_macro_expansion[256] = {
+    [NOP] = { .nuops = 1, .uops = { { NOP, 0, 0, 0 } } },
+    [LOAD_CLOSURE] = { .nuops = 1, .uops = { { LOAD_CLOSURE, 0, 0, 0 } } },
+    [LOAD_FAST_CHECK] = { .nuops = 1, .uops = { { LOAD_FAST_CHECK, 0, 0, 0 } } },
+    [LOAD_FAST] = { .nuops = 1, .uops = { { LOAD_FAST, 0, 0, 0 } } },
+    [LOAD_FAST__LOAD_FAST] = { .nuops = 2, .uops = { { LOAD_FAST, 0, 0, 0 }, { LOAD_FAST, 1, 0, 0 } } },
+    [LOAD_FAST_AND_CLEAR] = { .nuops = 1, .uops = { { LOAD_FAST_AND_CLEAR, 0, 0, 0 } } },
+    [LOAD_CONST] = { .nuops = 1, .uops = { { LOAD_CONST, 0, 0, 0 } } },
+    [LOAD_CONST__LOAD_FAST] = { .nuops = 2, .uops = { { LOAD_CONST, 0, 0, 0 }, { LOAD_FAST, 1, 0, 0 } } },
+    [LOAD_FAST__LOAD_CONST] = { .nuops = 2, .uops = { { LOAD_FAST, 0, 0, 0 }, { LOAD_CONST, 1, 0, 0 } } },
+    [STORE_FAST] = { .nuops = 1, .uops = { { STORE_FAST, 0, 0, 0 } } },
+    [STORE_FAST__LOAD_FAST] = { .nuops = 2, .uops = { { STORE_FAST, 0, 0, 0 }, { LOAD_FAST, 1, 0, 0 } } },
+    [STORE_FAST__STORE_FAST] = { .nuops = 2, .uops = { { STORE_FAST, 0, 0, 0 }, { STORE_FAST, 1, 0, 0 } } },
+    [POP_TOP] = { .nuops = 1, .uops = { { POP_TOP, 0, 0, 0 } } },
+    [PUSH_NULL] = { .nuops = 1, .uops = { { PUSH_NULL, 0, 0, 0 } } },
+    [END_FOR] = { .nuops = 2, .uops = { { POP_TOP, 0, 0, 0 }, { POP_TOP, 0, 0, 0 } } },
+    [END_SEND] = { .nuops = 1, .uops = { { END_SEND, 0, 0, 0 } } },
+    [UNARY_POSITIVE] = { .nuops = 1, .uops = { { UNARY_POSITIVE, 0, 0, 0 } } },
+    [UNARY_NEGATIVE] = { .nuops = 1, .uops = { { UNARY_NEGATIVE, 0, 0, 0 } } },
+    [UNARY_NOT] = { .nuops = 1, .uops = { { UNARY_NOT, 0, 0, 0 } } },
+    [UNARY_INVERT] = { .nuops = 1, .uops = { { UNARY_INVERT, 0, 0, 0 } } },
+    [BINARY_OP_MULTIPLY_INT] = { .nuops = 2, .uops = { { _GUARD_BOTH_INT, 0, 0, 0 }, { _BINARY_OP_MULTIPLY_INT, 0, 0, 0 } } },
+    [BINARY_OP_ADD_INT] = { .nuops = 2, .uops = { { _GUARD_BOTH_INT, 0, 0, 0 }, { _BINARY_OP_ADD_INT, 0, 0, 0 } } },
+    [BINARY_OP_SUBTRACT_INT] = { .nuops = 2, .uops = { { _GUARD_BOTH_INT, 0, 0, 0 }, { _BINARY_OP_SUBTRACT_INT, 0, 0, 0 } } },
+    [BINARY_OP_MULTIPLY_FLOAT] = { .nuops = 2, .uops = { { _GUARD_BOTH_FLOAT, 0, 0, 0 }, { _BINARY_OP_MULTIPLY_FLOAT, 0, 0, 0 } } },
+    [BINARY_OP_ADD_FLOAT] = { .nuops = 2, .uops = { { _GUARD_BOTH_FLOAT, 0, 0, 0 }, { _BINARY_OP_ADD_FLOAT, 0, 0, 0 } } },
+    [BINARY_OP_SUBTRACT_FLOAT] = { .nuops = 2, .uops = { { _GUARD_BOTH_FLOAT, 0, 0, 0 }, { _BINARY_OP_SUBTRACT_FLOAT, 0, 0, 0 } } },
+    [BINARY_OP_ADD_UNICODE] = { .nuops = 2, .uops = { { _GUARD_BOTH_UNICODE, 0, 0, 0 }, { _BINARY_OP_ADD_UNICODE, 0, 0, 0 } } },
+    [BINARY_SLICE_STR] = { .nuops = 1, .uops = { { BINARY_SLICE_STR, 0, 0, 0 } } },
+    [BINARY_SLICE_BYTES] = { .nuops = 1, .uops = { { BINARY_SLICE_BYTES, 0, 0, 0 } } },
+    [BINARY_SLICE_BYTEARRAY] = { .nuops = 1, .uops = { { BINARY_SLICE_BYTEARRAY, 0, 0, 0 } } },
+    [STORE_SLICE] = { .nuops = 1, .uops = { { STORE_SLICE, 0, 0, 0 } } },
+    [BINARY_SUBSCR_LIST_INT] = { .nuops = 1, .uops = { { BINARY_SUBSCR_LIST_INT, 0, 0, 0 } } },
+    [BINARY_SUBSCR_TUPLE_INT] = { .nuops = 1, .uops = { { BINARY_SUBSCR_TUPLE_INT, 0, 0, 0 } } },
+    [BINARY_SUBSCR_STR_INT] = { .nuops = 1, .uops = { { BINARY_SUBSCR_STR_INT, 0, 0, 0 } } },
+    [BINARY_SUBSCR_BYTES_INT] = { .nuops = 1, .uops = { { BINARY_SUBSCR_BYTES_INT, 0, 0, 0 } } },
+    [BINARY_SUBSCR_BYTEARRAY_INT] = { .nuops = 1, .uops = { { BINARY_SUBSCR_BYTEARRAY_INT, 0, 0, 0 } } },
+    [BINARY_SUBSCR_DICT] = { .nuops = 1, .uops = { { BINARY_SUBSCR_DICT, 0, 0, 0 } } },
+    [LIST_APPEND] = { .nuops = 1, .uops = { { LIST_APPEND, 0, 0, 0 } } },
+    [SET_ADD] = { .nuops = 1, .uops = { { SET_ADD, 0, 0, 0 } } },
+    [STORE_SUBSCR_LIST_INT] = { .nuops = 1, .uops = { { STORE_SUBSCR_LIST_INT, 0, 0, 0 } } },
+    [STORE_SUBSCR_DICT] = { .nuops = 1, .uops = { { STORE_SUBSCR_DICT, 0, 0, 0 } } },
+    [DELETE_SUBSCR] = { .nuops = 1, .uops = { { DELETE_SUBSCR, 0, 0, 0 } } },
+    [PRINT_EXPR] = { .nuops = 1, .uops = { { PRINT_EXPR, 0, 0, 0 } } },
+    [GET_AITER] = { .nuops = 1, .uops = { { GET_AITER, 0, 0, 0 } } },
+    [DELETE_NAME] = { .nuops = 1, .uops = { { DELETE_NAME, 0, 0, 0 } } },
+    [DELETE_ATTR] = { .nuops = 1, .uops = { { DELETE_ATTR, 0, 0, 0 } } },
+    [STORE_GLOBAL] = { .nuops = 1, .uops = { { STORE_GLOBAL, 0, 0, 0 } } },
+    [DELETE_GLOBAL] = { .nuops = 1, .uops = { { DELETE_GLOBAL, 0, 0, 0 } } },
+    [DELETE_FAST] = { .nuops = 1, .uops = { { DELETE_FAST, 0, 0, 0 } } },
+    [DELETE_DEREF] = { .nuops = 1, .uops = { { DELETE_DEREF, 0, 0, 0 } } },
+    [STORE_ATTR_CLASS] = { .nuops = 1, .uops = { { STORE_ATTR_CLASS, 0, 1, 2 } } },
+    [COMPARE_OP_FLOAT_JUMP] = { .nuops = 2, .uops = { { _COMPARE_OP_FLOAT, 0, 1, 1 }, { _JUMP_IF, 3, 0, 0 } } },
+    [COMPARE_OP_INT_JUMP] = { .nuops = 2, .uops = { { _COMPARE_OP_INT, 0, 1, 1 }, { _JUMP_IF, 3, 0, 0 } } },
+    [COMPARE_OP_STR_JUMP] = { .nuops = 2, .uops = { { _COMPARE_OP_STR, 0, 1, 1 }, { _JUMP_IF, 3, 0, 0 } } },
+    [IS_OP] = { .nuops = 1, .uops = { { IS_OP, 0, 0, 0 } } },
+    [CONTAINS_OP_DICT] = { .nuops = 1, .uops = { { CONTAINS_OP_DICT, 0, 0, 0 } } },
+    [CONTAINS_OP_SET] = { .nuops = 1, .uops = { { CONTAINS_OP_SET, 0, 0, 0 } } },
+    [CONTAINS_OP_STR] = { .nuops = 1, .uops = { { CONTAINS_OP_STR, 0, 0, 0 } } },
+    [CONTAINS_OP_TUPLE] = { .nuops = 1, .uops = { { CONTAINS_OP_TUPLE, 0, 0, 0 } } },
+    [WITH_EXCEPT_START] = { .nuops = 1, .uops = { { WITH_EXCEPT_START, 0, 0, 0 } } },
+    [EXIT_INIT_CHECK] = { .nuops = 1, .uops = { { EXIT_INIT_CHECK, 0, 0, 0 } } },
+};
+
+const char *const _PyUop_name[MAX_UOP_ID + 1] = {
+    [NOP] = "NOP",
+    [LOAD_CLOSURE] = "LOAD_CLOSURE",
+    [LOAD_FAST_CHECK] = "LOAD_FAST_CHECK",
+    [LOAD_FAST] = "LOAD_FAST",
+    [LOAD_FAST_AND_CLEAR] = "LOAD_FAST_AND_CLEAR",
+    [LOAD_CONST] = "LOAD_CONST",
+    [STORE_FAST] = "STORE_FAST",
+    [POP_TOP] = "POP_TOP",
+    [PUSH_NULL] = "PUSH_NULL",
+    [END_SEND] = "END_SEND",
+    [UNARY_POSITIVE] = "UNARY_POSITIVE",
+    [UNARY_NEGATIVE] = "UNARY_NEGATIVE",
+    [UNARY_NOT] = "UNARY_NOT",
+    [UNARY_INVERT] = "UNARY_INVERT",
+    [_GUARD_BOTH_INT] = "_GUARD_BOTH_INT",
+    [_BINARY_OP_MULTIPLY_INT] = "_BINARY_OP_MULTIPLY_INT",
+    [_BINARY_OP_ADD_INT] = "_BINARY_OP_ADD_INT",
+    [_BINARY_OP_SUBTRACT_INT] = "_BINARY_OP_SUBTRACT_INT",
+    [_GUARD_BOTH_FLOAT] = "_GUARD_BOTH_FLOAT",
+    [_BINARY_OP_MULTIPLY_FLOAT] = "_BINARY_OP_MULTIPLY_FLOAT",
+    [_BINARY_OP_ADD_FLOAT] = "_BINARY_OP_ADD_FLOAT",
+    [_BINARY_OP_SUBTRACT_FLOAT] = "_BINARY_OP_SUBTRACT_FLOAT",
+    [_GUARD_BOTH_UNICODE] = "_GUARD_BOTH_UNICODE",
+    [_BINARY_OP_ADD_UNICODE] = "_BINARY_OP_ADD_UNICODE",
+    [BINARY_SLICE_STR] = "BINARY_SLICE_STR",
+    [BINARY_SLICE_BYTES] = "BINARY_SLICE_BYTES",
+    [BINARY_SLICE_BYTEARRAY] = "BINARY_SLICE_BYTEARRAY",
+    [STORE_SLICE] = "STORE_SLICE",
+    [BINARY_SUBSCR_LIST_INT] = "BINARY_SUBSCR_LIST_INT",
+    [BINARY_SUBSCR_TUPLE_INT] = "BINARY_SUBSCR_TUPLE_INT",
+    [BINARY_SUBSCR_STR_INT] = "BINARY_SUBSCR_STR_INT",
+    [BINARY_SUBSCR_BYTES_INT] = "BINARY_SUBSCR_BYTES_INT",
+    [BINARY_SUBSCR_BYTEARRAY_INT] = "BINARY_SUBSCR_BYTEARRAY_INT",
+    [BINARY_SUBSCR_DICT] = "BINARY_SUBSCR_DICT",
+    [LIST_APPEND] = "LIST_APPEND",
+    [SET_ADD] = "SET_ADD",
+    [STORE_SUBSCR_LIST_INT] = "STORE_SUBSCR_LIST_INT",
+    [STORE_SUBSCR_DICT] = "STORE_SUBSCR_DICT",
+    [DELETE_SUBSCR] = "DELETE_SUBSCR",
+    [PRINT_EXPR] = "PRINT_EXPR",
+    [GET_AITER] = "GET_AITER",
+    [DELETE_NAME] = "DELETE_NAME",
+    [DELETE_ATTR] = "DELETE_ATTR",
+    [STORE_GLOBAL] = "STORE_GLOBAL",
+    [DELETE_GLOBAL] = "DELETE_GLOBAL",
+    [DELETE_FAST] = "DELETE_FAST",
+    [DELETE_DEREF] = "DELETE_DEREF",
+    [STORE_ATTR_CLASS] = "STORE_ATTR_CLASS",
+    [_COMPARE_OP_FLOAT] = "_COMPARE_OP_FLOAT",
+    [_JUMP_IF] = "_JUMP_IF",
+    [_JUMP_TO_STUB_IF] = "_JUMP_TO_STUB_IF",
+    [_COMPARE_OP_INT] = "_COMPARE_OP_INT",
+    [_COMPARE_OP_STR] = "_COMPARE_OP_STR",
+    [IS_OP] = "IS_OP",
+    [CONTAINS_OP_DICT] = "CONTAINS_OP_DICT",
+    [CONTAINS_OP_SET] = "CONTAINS_OP_SET",
+    [CONTAINS_OP_STR] = "CONTAINS_OP_STR",
+    [CONTAINS_OP_TUPLE] = "CONTAINS_OP_TUPLE",
+    [EXIT_TRACE] = "EXIT_TRACE",
+    [JUMP_TO_TOP] = "JUMP_TO_TOP",
+    [_POP_JUMP_IF_FALSE] = "_POP_JUMP_IF_FALSE",
+    [_POP_JUMP_IF_TRUE] = "_POP_JUMP_IF_TRUE",
+    [_POP_JUMP_IF_NOT_NONE] = "_POP_JUMP_IF_NOT_NONE",
+    [_POP_JUMP_IF_NONE] = "_POP_JUMP_IF_NONE",
+    [_FOR_ITER_LIST] = "_FOR_ITER_LIST",
+    [_FOR_ITER_TUPLE] = "_FOR_ITER_TUPLE",
+    [_FOR_ITER_RANGE] = "_FOR_ITER_RANGE",
+    [WITH_EXCEPT_START] = "WITH_EXCEPT_START",
+    [EXIT_INIT_CHECK] = "EXIT_INIT_CHECK",
+};
+
+const int8_t _PyUop_popped[MAX_UOP_ID + 1] = {
+    [NOP] = 0,
+    [LOAD_CLOSURE] = 0,
+    [LOAD_FAST_CHECK] = 0,
+    [LOAD_FAST] = 0,
+    [LOAD_FAST_AND_CLEAR] = 0,
+    [LOAD_CONST] = 0,
+    [STORE_FAST] = 1,
+    [POP_TOP] = 1,
+    [PUSH_NULL] = 0,
+    [END_SEND] = 2,
+    [UNARY_POSITIVE] = 1,
+    [UNARY_NEGATIVE] = 1,
+    [UNARY_NOT] = 1,
+    [UNARY_INVERT] = 1,
+    [_GUARD_BOTH_INT] = 2,
+    [_BINARY_OP_MULTIPLY_INT] = 2,
+    [_BINARY_OP_ADD_INT] = 2,
+    [_BINARY_OP_SUBTRACT_INT] = 2,
+    [_GUARD_BOTH_FLOAT] = 2,
+    [_BINARY_OP_MULTIPLY_FLOAT] = 2,
+    [_BINARY_OP_ADD_FLOAT] = 2,
+    [_BINARY_OP_SUBTRACT_FLOAT] = 2,
+    [_GUARD_BOTH_UNICODE] = 2,
+    [_BINARY_OP_ADD_UNICODE] = 2,
+    [BINARY_SLICE_STR] = 3,
+    [BINARY_SLICE_BYTES] = 3,
+    [BINARY_SLICE_BYTEARRAY] = 3,
+    [STORE_SLICE] = 4,
+    [BINARY_SUBSCR_LIST_INT] = 2,
+    [BINARY_SUBSCR_TUPLE_INT] = 2,
+    [BINARY_SUBSCR_STR_INT] = 2,
+    [BINARY_SUBSCR_BYTES_INT] = 2,
+    [BINARY_SUBSCR_BYTEARRAY_INT] = 2,
+    [BINARY_SUBSCR_DICT] = 2,
+    [LIST_APPEND] = 1,
+    [SET_ADD] = 1,
+    [STORE_SUBSCR_LIST_INT] = 3,
+    [STORE_SUBSCR_DICT] = 3,
+    [DELETE_SUBSCR] = 2,
+    [PRINT_EXPR] = 1,
+    [GET_AITER] = 1,
+    [DELETE_NAME] = 0,
+    [DELETE_ATTR] = 1,
+    [STORE_GLOBAL] = 1,
+    [DELETE_GLOBAL] = 0,
+    [DELETE_FAST] = 0,
+    [DELETE_DEREF] = 0,
+    [STORE_ATTR_CLASS] = 2,
+    [_COMPARE_OP_FLOAT] = 2,
+    [_JUMP_IF] = 1,
+    [_JUMP_TO_STUB_IF] = 1,
+    [_COMPARE_OP_INT] = 2,
+    [_COMPARE_OP_STR] = 2,
+    [IS_OP] = 2,
+    [CONTAINS_OP_DICT] = 2,
+    [CONTAINS_OP_SET] = 2,
+    [CONTAINS_OP_STR] = 2,
+    [CONTAINS_OP_TUPLE] = 2,
+    [EXIT_TRACE] = 0,
+    [JUMP_TO_TOP] = 0,
+    [_POP_JUMP_IF_FALSE] = 1,
+    [_POP_JUMP_IF_TRUE] = 1,
+    [_POP_JUMP_IF_NOT_NONE] = 1,
+    [_POP_JUMP_IF_NONE] = 1,
+    [_FOR_ITER_LIST] = 1,
+    [_FOR_ITER_TUPLE] = 1,
+    [_FOR_ITER_RANGE] = 1,
+    [WITH_EXCEPT_START] = 4,
+    [EXIT_INIT_CHECK] = 1,
+};
+
+const int8_t _PyUop_pushed[MAX_UOP_ID + 1] = {
+    [NOP] = 0,
+    [LOAD_CLOSURE] = 1,
+    [LOAD_FAST_CHECK] = 1,
+    [LOAD_FAST] = 1,
+    [LOAD_FAST_AND_CLEAR] = 1,
+    [LOAD_CONST] = 1,
+    [STORE_FAST] = 0,
+    [POP_TOP] = 0,
+    [PUSH_NULL] = 1,
+    [END_SEND] = 1,
+    [UNARY_POSITIVE] = 1,
+    [UNARY_NEGATIVE] = 1,
+    [UNARY_NOT] = 1,
+    [UNARY_INVERT] = 1,
+    [_GUARD_BOTH_INT] = 2,
+    [_BINARY_OP_MULTIPLY_INT] = 1,
+    [_BINARY_OP_ADD_INT] = 1,
+    [_BINARY_OP_SUBTRACT_INT] = 1,
+    [_GUARD_BOTH_FLOAT] = 2,
+    [_BINARY_OP_MULTIPLY_FLOAT] = 1,
+    [_BINARY_OP_ADD_FLOAT] = 1,
+    [_BINARY_OP_SUBTRACT_FLOAT] = 1,
+    [_GUARD_BOTH_UNICODE] = 2,
+    [_BINARY_OP_ADD_UNICODE] = 1,
+    [BINARY_SLICE_STR] = 1,
+    [BINARY_SLICE_BYTES] = 1,
+    [BINARY_SLICE_BYTEARRAY] = 1,
+    [STORE_SLICE] = 0,
+    [BINARY_SUBSCR_LIST_INT] = 1,
+    [BINARY_SUBSCR_TUPLE_INT] = 1,
+    [BINARY_SUBSCR_STR_INT] = 1,
+    [BINARY_SUBSCR_BYTES_INT] = 1,
+    [BINARY_SUBSCR_BYTEARRAY_INT] = 1,
+    [BINARY_SUBSCR_DICT] = 1,
+    [LIST_APPEND] = 0,
+    [SET_ADD] = 0,
+    [STORE_SUBSCR_LIST_INT] = 0,
+    [STORE_SUBSCR_DICT] = 0,
+    [DELETE_SUBSCR] = 0,
+    [PRINT_EXPR] = 0,
+    [GET_AITER] = 1,
+    [DELETE_NAME] = 0,
+    [DELETE_ATTR] = 0,
+    [STORE_GLOBAL] = 0,
+    [DELETE_GLOBAL] = 0,
+    [DELETE_FAST] = 0,
+    [DELETE_DEREF] = 0,
+    [STORE_ATTR_CLASS] = 0,
+    [_COMPARE_OP_FLOAT] = 1,
+    [_JUMP_IF] = 0,
+    [_JUMP_TO_STUB_IF] = 0,
+    [_COMPARE_OP_INT] = 1,
+    [_COMPARE_OP_STR] = 1,
+    [IS_OP] = 1,
+    [CONTAINS_OP_DICT] = 1,
+    [CONTAINS_OP_SET] = 1,
+    [CONTAINS_OP_STR] = 1,
+    [CONTAINS_OP_TUPLE] = 1,
+    [EXIT_TRACE] = 0,
+    [JUMP_TO_TOP] = 0,
+    [_POP_JUMP_IF_FALSE] = 0,
+    [_POP_JUMP_IF_TRUE] = 0,
+    [_POP_JUMP_IF_NOT_NONE] = 0,
+    [_POP_JUMP_IF_NONE] = 0,
+    [_FOR_ITER_LIST] = 2,
+    [_FOR_ITER_TUPLE] = 2,
+    [_FOR_ITER_RANGE] = 1,
+    [WITH_EXCEPT_START] = 5,
+    [EXIT_INIT_CHECK] = 0,
+};
+#endif  // NEED_OPCODE_METADATA
@@ -0,0 +1,502 @@
+/* Tier-2 trace projection.
+ *
+ * When JUMP_BACKWARD's counter runs out, _PyOptimizer_BackEdge() projects a
+ * trace of micro-ops from the head of the loop, following the instructions
+ * as they are currently specialized. Conditional branches are assumed to
+ * fall through; taking one leaves the trace through an exit stub. The trace
+ * ends when it gets back to the JUMP_BACKWARD (closing the loop) or at the
+ * first instruction that has no micro-op expansion.
+ *
+ * Redundant type guards are then removed, and the JUMP_BACKWARD becomes a
+ * JUMP_BACKWARD_INTO_TRACE that runs the trace with _PyUopExecute(), or as
+ * machine code if the JIT compiler (Python/jit.c) is enabled.
+ */
+
+#include "Python.h"
+#include "opcode.h"
+#include "pycore_code.h"          // _PyJumpBackwardCache
+#include "pycore_frame.h"         // _PyInterpreterFrame
+#include "pycore_instruments.h"   // _Py_GetOriginalOpcode()
+#include "pycore_jit.h"           // _PyJIT_Compile()
+#include "pycore_opcode.h"        // _PyOpcode_Caches
+#include "pycore_uops.h"
+
+#define NEED_OPCODE_METADATA
+#include "opcode_metadata.h"      // _PyOpcode_macro_expansion
+
+#include <stddef.h>               // offsetof()
+
+// Traces that don't close the loop must at least be this long to be kept
+#define MIN_OPEN_TRACE_LENGTH 8
+
+// Room for the exit stubs of the conditional branches in a trace
+#define MAX_EXIT_STUBS 16
+
+typedef struct {
+    _PyUOpInstruction trace[_Py_UOP_MAX_TRACE_LENGTH];
+    int length;
+    _PyUOpInstruction stubs[MAX_EXIT_STUBS];
+    int nstubs;
+} trace_buffer;
+
+static void
+add_uop(trace_buffer *buf, int opcode, int oparg, int target, uint64_t operand)
+{
+    assert(buf->length < _Py_UOP_MAX_TRACE_LENGTH);
+    _PyUOpInstruction *uop = &buf->trace[buf->length++];
+    uop->opcode = (uint16_t)opcode;
+    uop->oparg = (uint16_t)oparg;
+    uop->target = (uint32_t)target;
+    uop->operand = operand;
+}
+
+/* Adds a branch uop whose oparg is, for now, the index of its exit stub;
+   make_executor() turns that into the index of the stub in the trace. */
+static void
+add_branch(trace_buffer *buf, int opcode, int target, int exit_target,
+           uint64_t operand)
+{
+    assert(buf->nstubs < MAX_EXIT_STUBS);
+    _PyUOpInstruction *stub = &buf->stubs[buf->nstubs];
+    stub->opcode = EXIT_TRACE;
+    stub->oparg = 0;
+    stub->target = (uint32_t)exit_target;
+    stub->operand = 0;
+    add_uop(buf, opcode, buf->nstubs++, target, operand);
+}
+
+static int
+is_branch(int opcode)
+{
+    switch (opcode) {
+        case _POP_JUMP_IF_FALSE:
+        case _POP_JUMP_IF_TRUE:
+        case _POP_JUMP_IF_NONE:
+        case _POP_JUMP_IF_NOT_NONE:
+        case _JUMP_TO_STUB_IF:
+            return 1;
+    }
+    return 0;
+}
+
+/* Projects the trace starting at dest. Returns 1 if the trace closes the
+   loop back to src, 0 if it ends in an EXIT_TRACE. */
+static int
+project_trace(PyCodeObject *code, _Py_CODEUNIT *src, _Py_CODEUNIT *dest,
+              trace_buffer *buf)
+{
+    _Py_CODEUNIT *first_instr = _PyCode_CODE(code);
+    int index = (int)(dest - first_instr);
+    buf->length = 0;
+    buf->nstubs = 0;
+    for (;;) {
+        /* Leave room for a whole expansion, plus the final EXIT_TRACE */
+        if (buf->length + MAX_UOPS_PER_EXPANSION + 1 > _Py_UOP_MAX_TRACE_LENGTH
+            || buf->nstubs + MAX_UOPS_PER_EXPANSION > MAX_EXIT_STUBS)
+        {
+            break;
+        }
+        _Py_CODEUNIT *instr = first_instr + index;
+        int opcode = _Py_OPCODE(*instr);
+        int oparg = _Py_OPARG(*instr);
+        switch (opcode) {
+            case NOP:
+                index++;
+                continue;
+            case JUMP_FORWARD:
+                index += 1 + oparg;
+                continue;
+            case JUMP_BACKWARD:
+            case JUMP_BACKWARD_INTO_TRACE:
+                if (instr != src) {
+                    /* An inner loop; it gets a trace of its own */
+                    goto done;
+                }
+                add_uop(buf, JUMP_TO_TOP, 0, index, 0);
+                return 1;
+            case POP_JUMP_IF_FALSE:
+                add_branch(buf, _POP_JUMP_IF_FALSE, index, index + 1 + oparg, 0);
+                index++;
+                continue;
+            case POP_JUMP_IF_TRUE:
+                add_branch(buf, _POP_JUMP_IF_TRUE, index, index + 1 + oparg, 0);
+                index++;
+                continue;
+            case POP_JUMP_IF_NONE:
+                add_branch(buf, _POP_JUMP_IF_NONE, index, index + 1 + oparg, 0);
+                index++;
+                continue;
+            case POP_JUMP_IF_NOT_NONE:
+                add_branch(buf, _POP_JUMP_IF_NOT_NONE, index, index + 1 + oparg, 0);
+                index++;
+                continue;
+            case FOR_ITER_LIST:
+                add_uop(buf, _FOR_ITER_LIST, 0, index, 0);
+                index += 1 + INLINE_CACHE_ENTRIES_FOR_ITER;
+                continue;
+            case FOR_ITER_TUPLE:
+                add_uop(buf, _FOR_ITER_TUPLE, 0, index, 0);
+                index += 1 + INLINE_CACHE_ENTRIES_FOR_ITER;
+                continue;
+            case FOR_ITER_RANGE:
+            {
+                /* Like FOR_ITER_RANGE, _FOR_ITER_RANGE does the STORE_FAST */
+                _Py_CODEUNIT next = instr[1 + INLINE_CACHE_ENTRIES_FOR_ITER];
+                assert(_PyOpcode_Deopt[_Py_OPCODE(next)] == STORE_FAST);
+                add_uop(buf, _FOR_ITER_RANGE, _Py_OPARG(next), index, 0);
+                index += 1 + INLINE_CACHE_ENTRIES_FOR_ITER + 1;
+                continue;
+            }
+        }
+        /* EXTENDED_ARG and everything without an expansion ends the trace */
+        const struct opcode_macro_expansion *expansion =
+            &_PyOpcode_macro_expansion[opcode];
+        if (expansion->nuops == 0) {
+            break;
+        }
+        int last_offset = 0;
+        for (int i = 0; i < expansion->nuops; i++) {
+            int uop = expansion->uops[i].uop;
+            int offset = expansion->uops[i].offset;
+            int uop_oparg = _Py_OPARG(instr[offset]);
+            /* The operand is the uop's cache entry, if it has one */
+            uint64_t operand = 0;
+            int cache_offset = offset + 1 + expansion->uops[i].cache_offset;
+            switch (expansion->uops[i].cache_size) {
+                case 1:
+                    operand = read_u16(&instr[cache_offset]);
+                    break;
+                case 2:
+                    operand = read_u32(&instr[cache_offset]);
+                    break;
+                default:
+                    assert(expansion->uops[i].cache_size == 0);
+            }
+            if (uop == _JUMP_IF) {
+                /* The POP_JUMP_IF_* half of a COMPARE_OP superinstruction */
+                add_branch(buf, _JUMP_TO_STUB_IF, index + offset,
+                           index + offset + 1 + uop_oparg, 0);
+            }
+            else {
+                add_uop(buf, uop, uop_oparg, index + offset, operand);
+            }
+            last_offset = offset;
+        }
+        int last = _PyOpcode_Deopt[_Py_OPCODE(instr[last_offset])];
+        index += last_offset + 1 + _PyOpcode_Caches[last];
+    }
+done:
+    add_uop(buf, EXIT_TRACE, 0, index, 0);
+    return 0;
+}
+
+/* Guard elimination.
+ *
+ * A forward pass over the trace tracks which stack slots and locals are
+ * known to hold an exact int, float or str, and replaces the type guards
+ * that would always succeed with NOPs. */
+
+enum known_type {
+    TYPE_UNKNOWN = 0,
+    TYPE_INT,
+    TYPE_FLOAT,
+    TYPE_STR,
+};
+
+static unsigned char
+type_of_const(PyObject *obj)
+{
+    if (PyLong_CheckExact(obj)) {
+        return TYPE_INT;
+    }
+    if (PyFloat_CheckExact(obj)) {
+        return TYPE_FLOAT;
+    }
+    if (PyUnicode_CheckExact(obj)) {
+        return TYPE_STR;
+    }
+    return TYPE_UNKNOWN;
+}
+
+/* The type that a guard checks both operands for */
+static unsigned char
+guarded_type(int opcode)
+{
+    switch (opcode) {
+        case _GUARD_BOTH_INT:
+            return TYPE_INT;
+        case _GUARD_BOTH_FLOAT:
+            return TYPE_FLOAT;
+        case _GUARD_BOTH_UNICODE:
+            return TYPE_STR;
+    }
+    return TYPE_UNKNOWN;
+}
+
+/* The type of the result of a guarded binary operation */
+static unsigned char
+result_type(int opcode)
+{
+    switch (opcode) {
+        case _BINARY_OP_MULTIPLY_INT:
+        case _BINARY_OP_ADD_INT:
+        case _BINARY_OP_SUBTRACT_INT:
+            return TYPE_INT;
+        case _BINARY_OP_MULTIPLY_FLOAT:
+        case _BINARY_OP_ADD_FLOAT:
+        case _BINARY_OP_SUBTRACT_FLOAT:
+            return TYPE_FLOAT;
+        case _BINARY_OP_ADD_UNICODE:
+            return TYPE_STR;
+    }
+    return TYPE_UNKNOWN;
+}
+
+static int
+remove_redundant_guards(PyCodeObject *code, trace_buffer *buf)
+{
+    /* The abstract stack starts out empty at the loop head; slots below
+       its bottom are unknown. It can't get deeper than the real stack. */
+    unsigned char *locals = PyMem_Calloc(
+        code->co_nlocalsplus + code->co_stacksize + 1, 1);
+    if (locals == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    unsigned char *stack = locals + code->co_nlocalsplus;
+    int sp = 0;
+#define POP_TYPE() (sp > 0 ? stack[--sp] : TYPE_UNKNOWN)
+#define PUSH_TYPE(t) (stack[sp++] = (t))
+#define PEEK_TYPE(n) (sp >= (n) ? stack[sp - (n)] : TYPE_UNKNOWN)
+    int removed = 0;
+    for (int pc = 0; pc < buf->length; pc++) {
+        _PyUOpInstruction *uop = &buf->trace[pc];
+        unsigned char type;
+        switch (uop->opcode) {
+            case LOAD_FAST:
+            case LOAD_FAST_CHECK:
+                PUSH_TYPE(locals[uop->oparg]);
+                break;
+            case LOAD_FAST_AND_CLEAR:
+                PUSH_TYPE(locals[uop->oparg]);
+                locals[uop->oparg] = TYPE_UNKNOWN;
+                break;
+            case LOAD_CONST:
+                PUSH_TYPE(type_of_const(
+                    PyTuple_GET_ITEM(code->co_consts, uop->oparg)));
+                break;
+            case STORE_FAST:
+                locals[uop->oparg] = POP_TYPE();
+                break;
+            case DELETE_FAST:
+                locals[uop->oparg] = TYPE_UNKNOWN;
+                break;
+            case _FOR_ITER_RANGE:
+                locals[uop->oparg] = TYPE_INT;
+                break;
+            case _GUARD_BOTH_INT:
+            case _GUARD_BOTH_FLOAT:
+            case _GUARD_BOTH_UNICODE:
+                type = guarded_type(uop->opcode);
+                if (PEEK_TYPE(1) == type && PEEK_TYPE(2) == type) {
+                    uop->opcode = NOP;
+                    removed++;
+                }
+                /* Past the guard, both operands are known */
+                POP_TYPE();
+                POP_TYPE();
+                PUSH_TYPE(type);
+                PUSH_TYPE(type);
+                break;
+            case _BINARY_OP_MULTIPLY_INT:
+            case _BINARY_OP_ADD_INT:
+            case _BINARY_OP_SUBTRACT_INT:
+            case _BINARY_OP_MULTIPLY_FLOAT:
+            case _BINARY_OP_ADD_FLOAT:
+            case _BINARY_OP_SUBTRACT_FLOAT:
+            case _BINARY_OP_ADD_UNICODE:
+                POP_TYPE();
+                POP_TYPE();
+                PUSH_TYPE(result_type(uop->opcode));
+                break;
+            default:
+                for (int i = 0; i < _PyUop_popped[uop->opcode]; i++) {
+                    POP_TYPE();
+                }
+                for (int i = 0; i < _PyUop_pushed[uop->opcode]; i++) {
+                    PUSH_TYPE(TYPE_UNKNOWN);
+                }
+        }
+        assert(sp <= code->co_stacksize);
+    }
+#undef POP_TYPE
+#undef PUSH_TYPE
+#undef PEEK_TYPE
+    PyMem_Free(locals);
+    return removed;
+}
+
+static _PyUOpExecutor *
+make_executor(trace_buffer *buf)
+{
+    int length = 0;
+    for (int pc = 0; pc < buf->length; pc++) {
+        if (buf->trace[pc].opcode != NOP) {
+            length++;
+        }
+    }
+    int stubs_start = length;
+    length += buf->nstubs;
+    _PyUOpExecutor *executor = PyMem_Malloc(
+        offsetof(_PyUOpExecutor, trace) + length * sizeof(_PyUOpInstruction));
+    if (executor == NULL) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+    executor->length = length;
+    executor->jit_code = NULL;
+    executor->jit_size = 0;
+    int dst = 0;
+    for (int pc = 0; pc < buf->length; pc++) {
+        _PyUOpInstruction uop = buf->trace[pc];
+        if (uop.opcode == NOP) {
+            continue;
+        }
+        if (is_branch(uop.opcode)) {
+            uop.oparg = (uint16_t)(stubs_start + uop.oparg);
+        }
+        executor->trace[dst++] = uop;
+    }
+    for (int i = 0; i < buf->nstubs; i++) {
+        executor->trace[dst++] = buf->stubs[i];
+    }
+    assert(dst == length);
+    return executor;
+}
+
+/* Appends the executor to the code object's array, returning its index,
+   or -1 if there is no room (without setting an exception) or on error. */
+static int
+add_executor(PyCodeObject *code, _PyUOpExecutor *executor)
+{
+    _PyExecutorArray *array = code->_co_executors;
+    if (array == NULL || array->size == array->capacity) {
+        int capacity = array == NULL ? 4 : array->capacity * 2;
+        if (capacity > _Py_MAX_EXECUTORS_PER_CODE) {
+            return -1;
+        }
+        size_t size = offsetof(_PyExecutorArray, executors) +
+                      capacity * sizeof(_PyUOpExecutor *);
+        _PyExecutorArray *new_array = PyMem_Realloc(array, size);
+        if (new_array == NULL) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        if (array == NULL) {
+            new_array->size = 0;
+        }
+        new_array->capacity = capacity;
+        array = code->_co_executors = new_array;
+    }
+    array->executors[array->size] = executor;
+    return array->size++;
+}
+
+int
+_PyOptimizer_BackEdge(_PyInterpreterFrame *frame, _Py_CODEUNIT *src,
+                      _Py_CODEUNIT *dest)
+{
+    PyCodeObject *code = frame->f_code;
+    _PyJumpBackwardCache *cache = (_PyJumpBackwardCache *)(src + 1);
+    assert(_Py_OPCODE(*src) == JUMP_BACKWARD);
+    trace_buffer buf;
+    int closed = project_trace(code, src, dest, &buf);
+    if (!closed && buf.length < MIN_OPEN_TRACE_LENGTH) {
+        STAT_INC(JUMP_BACKWARD, failure);
+        cache->counter = adaptive_counter_backoff(cache->counter);
+        return 0;
+    }
+    if (remove_redundant_guards(code, &buf) < 0) {
+        return -1;
+    }
+    _PyUOpExecutor *executor = make_executor(&buf);
+    if (executor == NULL) {
+        return -1;
+    }
+    int index = add_executor(code, executor);
+    if (index < 0) {
+        PyMem_Free(executor);
+        if (PyErr_Occurred()) {
+            return -1;
+        }
+        STAT_INC(JUMP_BACKWARD, failure);
+        cache->counter = adaptive_counter_backoff(cache->counter);
+        return 0;
+    }
+#ifdef _Py_JIT
+    _PyJIT_Compile(executor, code);
+#endif
+    STAT_INC(JUMP_BACKWARD, success);
+    _Py_SET_OPCODE(*src, JUMP_BACKWARD_INTO_TRACE);
+    cache->counter = (uint16_t)(index << ADAPTIVE_BACKOFF_BITS);
+    return 1;
+}
+
+void
+_PyExecutorArray_Free(_PyExecutorArray *array)
+{
+    for (int i = 0; i < array->size; i++) {
+#ifdef _Py_JIT
+        _PyJIT_Free(array->executors[i]);
+#endif
+        PyMem_Free(array->executors[i]);
+    }
+    PyMem_Free(array);
+}
+
+PyObject *
+_PyOptimizer_GetExecutors(PyCodeObject *code)
+{
+    PyObject *result = PyList_New(0);
+    if (result == NULL) {
+        return NULL;
+    }
+    _Py_CODEUNIT *instructions = _PyCode_CODE(code);
+    for (int i = 0; i < Py_SIZE(code); i++) {
+        int opcode = _Py_GetOriginalOpcode(code, i);
+        if (opcode == JUMP_BACKWARD_INTO_TRACE) {
+            _PyJumpBackwardCache *cache =
+                (_PyJumpBackwardCache *)&instructions[i + 1];
+            _PyUOpExecutor *executor =
+                code->_co_executors->executors[cache->counter >> ADAPTIVE_BACKOFF_BITS];
+            PyObject *uops = PyTuple_New(executor->length);
+            if (uops == NULL) {
+                goto error;
+            }
+            for (int j = 0; j < executor->length; j++) {
+                const char *name = _PyUop_name[executor->trace[j].opcode];
+                PyObject *str = PyUnicode_FromString(name ? name : "<unknown>");
+                if (str == NULL) {
+                    Py_DECREF(uops);
+                    goto error;
+                }
+                PyTuple_SET_ITEM(uops, j, str);
+            }
+            PyObject *item = Py_BuildValue("(iN)", i * (int)sizeof(_Py_CODEUNIT),
+                                           uops);
+            if (item == NULL) {
+                goto error;
+            }
+            int err = PyList_Append(result, item);
+            Py_DECREF(item);
+            if (err < 0) {
+                goto error;
+            }
+        }
+        i += _PyOpcode_Caches[_PyOpcode_Deopt[opcode]];
+    }
+    return result;
+error:
+    Py_DECREF(result);
+    return NULL;
+}
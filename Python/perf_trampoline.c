@@ -412,6 +412,20 @@ _PyIsPerfTrampolineActive(void)
     return 0;
 }
 
+/* Registers code that the JIT compiler generated for a code object, so that
+   profilers attribute it to the Python function, like the trampolines. */
+void
+_PyPerfTrampoline_RegisterCode(const void *code_addr, unsigned int code_size,
+                               PyCodeObject *co)
+{
+#ifdef PY_HAVE_PERF_TRAMPOLINE
+    if (perf_status == PERF_STATUS_OK && trampoline_api.state != NULL) {
+        trampoline_api.write_state(trampoline_api.state, code_addr,
+                                   code_size, co);
+    }
+#endif
+}
+
 void
 _PyPerfTrampoline_GetCallbacks(_PyPerf_Callbacks *callbacks)
 {
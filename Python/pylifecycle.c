@@ -643,11 +643,15 @@ init_interp_settings(PyInterpreterState *interp, const _PyInterpreterConfig *con
     if (config->allow_daemon_threads) {
         interp->feature_flags |= Py_RTFLAGS_DAEMON_THREADS;
     }
+
+    if (config->own_gil && !_Py_IsMainInterpreter(interp)) {
+        interp->feature_flags |= Py_RTFLAGS_OWN_GIL;
+    }
 }
 
 
 static PyStatus
-init_interp_create_gil(PyThreadState *tstate)
+init_interp_create_gil(PyThreadState *tstate, int own_gil)
 {
     PyStatus status;
 
@@ -661,8 +665,8 @@ init_interp_create_gil(PyThreadState *tstate)
         return status;
     }
 
-    /* Create the GIL and take it */
-    status = _PyEval_InitGIL(tstate);
+    /* Create the GIL (or share the main interpreter's) and take it */
+    status = _PyEval_InitGIL(tstate, own_gil);
     if (_PyStatus_EXCEPTION(status)) {
         return status;
     }
@@ -700,9 +704,10 @@ pycore_create_interpreter(_PyRuntimeState *runtime,
     if (tstate == NULL) {
         return _PyStatus_ERR("can't make first thread");
     }
-    (void) PyThreadState_Swap(tstate);
+    _PyThreadState_Swap(&runtime->gilstate, tstate);
 
-    status = init_interp_create_gil(tstate);
+    /* The main interpreter always has its own GIL. */
+    status = init_interp_create_gil(tstate, 1);
     if (_PyStatus_EXCEPTION(status)) {
         return status;
     }
@@ -807,6 +812,40 @@ static const _PyShimCodeDef INTERPRETER_TRAMPOLINE_CODEDEF = {
     "<interpreter trampoline>"
 };
 
+static const uint8_t INIT_CLEANUP_INSTRUCTIONS[] = {
+    /* Put a NOP at the start, so that the IP points into
+    * the code, rather than before it */
+    NOP, 0,
+    EXIT_INIT_CHECK, 0,
+    RETURN_VALUE, 0,
+    /* RESUME at end makes sure that the frame appears incomplete */
+    RESUME, 0
+};
+
+static const _PyShimCodeDef INIT_CLEANUP_CODEDEF = {
+    INIT_CLEANUP_INSTRUCTIONS,
+    sizeof(INIT_CLEANUP_INSTRUCTIONS),
+    2,
+    "<init cleanup>"
+};
+
+static const uint8_t SETTER_CLEANUP_INSTRUCTIONS[] = {
+    /* Put a NOP at the start, so that the IP points into
+    * the code, rather than before it */
+    NOP, 0,
+    /* Discard the result of the property setter */
+    RETURN_DISCARD, 0,
+    /* RESUME at end makes sure that the frame appears incomplete */
+    RESUME, 0
+};
+
+static const _PyShimCodeDef SETTER_CLEANUP_CODEDEF = {
+    SETTER_CLEANUP_INSTRUCTIONS,
+    sizeof(SETTER_CLEANUP_INSTRUCTIONS),
+    1,
+    "<setter cleanup>"
+};
+
 static PyStatus
 pycore_init_builtins(PyThreadState *tstate)
 {
@@ -843,6 +882,14 @@ pycore_init_builtins(PyThreadState *tstate)
     if (interp->interpreter_trampoline == NULL) {
         return _PyStatus_ERR("failed to create interpreter trampoline.");
     }
+    interp->init_cleanup = _Py_MakeShimCode(&INIT_CLEANUP_CODEDEF);
+    if (interp->init_cleanup == NULL) {
+        return _PyStatus_ERR("failed to create init cleanup code.");
+    }
+    interp->setter_cleanup = _Py_MakeShimCode(&SETTER_CLEANUP_CODEDEF);
+    if (interp->setter_cleanup == NULL) {
+        return _PyStatus_ERR("failed to create setter cleanup code.");
+    }
     if (_PyBuiltins_AddExceptions(bimod) < 0) {
         return _PyStatus_ERR("failed to add exceptions to builtins");
     }
@@ -1244,6 +1291,14 @@ init_interp_main(PyThreadState *tstate)
         interp->runtime->initialized = 1;
     }
 
+    if (is_main_interp) {
+        // Before importing site, so that it applies to site's modules
+        status = _PySpecializationProfile_Init(interp);
+        if (_PyStatus_EXCEPTION(status)) {
+            return status;
+        }
+    }
+
     if (config->site_import) {
         status = init_import_site();
         if (_PyStatus_EXCEPTION(status)) {
@@ -1842,6 +1897,8 @@ Py_FinalizeEx(void)
 
     _PyAtExit_Call(tstate->interp);
 
+    _PySpecializationProfile_AtExit(tstate->interp);
+
     /* Copy the core config, PyInterpreterState_Delete() free
        the core config memory */
 #ifdef Py_REF_DEBUG
@@ -2035,6 +2092,17 @@ new_interpreter(PyThreadState **tstate_p, const _PyInterpreterConfig *config)
        interpreters: disable PyGILState_Check(). */
     runtime->gilstate.check_enabled = 0;
 
+    /* Until the new interpreter holds its GIL (init_interp_create_gil()),
+       nothing below may allocate objects or otherwise rely on a GIL. */
+    PyThreadState *save_tstate = _PyThreadState_GET();
+    int has_gil = 0;
+
+    if (config->own_gil) {
+        /* The new interpreter will use the static types concurrently
+           with the interpreters sharing the main GIL. */
+        _PyStaticType_ShareAll();
+    }
+
     PyInterpreterState *interp = PyInterpreterState_New();
     if (interp == NULL) {
         *tstate_p = NULL;
@@ -2048,8 +2116,6 @@ new_interpreter(PyThreadState **tstate_p, const _PyInterpreterConfig *config)
         return _PyStatus_OK();
     }
 
-    PyThreadState *save_tstate = PyThreadState_Swap(tstate);
-
     /* Copy the current interpreter config into the new interpreter */
     const PyConfig *src_config;
     if (save_tstate != NULL) {
@@ -2069,10 +2135,28 @@ new_interpreter(PyThreadState **tstate_p, const _PyInterpreterConfig *config)
 
     init_interp_settings(interp, config);
 
-    status = init_interp_create_gil(tstate);
+    if (config->own_gil) {
+        /* An interpreter with its own GIL can't share the allocator
+           of the other interpreters. */
+        status = _PyObject_InitState(interp);
+        if (_PyStatus_EXCEPTION(status)) {
+            goto error;
+        }
+    }
+
+    /* Release the GIL of the calling thread (if any) and
+       take the GIL of the new interpreter. */
+    if (save_tstate != NULL) {
+        _PyThreadState_Swap(&runtime->gilstate, NULL);
+        _PyEval_ReleaseLock(save_tstate);
+    }
+    _PyThreadState_Swap(&runtime->gilstate, tstate);
+
+    status = init_interp_create_gil(tstate, config->own_gil);
     if (_PyStatus_EXCEPTION(status)) {
         goto error;
     }
+    has_gil = 1;
 
     status = pycore_interp_init(tstate);
     if (_PyStatus_EXCEPTION(status)) {
@@ -2091,11 +2175,16 @@ new_interpreter(PyThreadState **tstate_p, const _PyInterpreterConfig *config)
     *tstate_p = NULL;
 
     /* Oops, it didn't work.  Undo it all. */
-    PyErr_PrintEx(0);
-    PyThreadState_Clear(tstate);
-    PyThreadState_Delete(tstate);
+    if (has_gil) {
+        PyErr_PrintEx(0);
+        PyThreadState_Clear(tstate);
+    }
+    /* This also deletes tstate and releases the new interpreter's GIL. */
     PyInterpreterState_Delete(interp);
-    PyThreadState_Swap(save_tstate);
+    if (_PyThreadState_GET() != save_tstate) {
+        /* Take the GIL of the calling thread back. */
+        PyThreadState_Swap(save_tstate);
+    }
 
     return status;
 }
@@ -37,11 +37,18 @@ to avoid the expense of doing their own locking).
 extern "C" {
 #endif
 
-#define _PyRuntimeGILState_GetThreadState(gilstate) \
-    ((PyThreadState*)_Py_atomic_load_relaxed(&(gilstate)->tstate_current))
+#ifndef HAVE_THREAD_LOCAL
+#  error "the runtime requires support for thread-local variables"
+#endif
+
+/* The thread state of the current thread, or NULL if it has none.
+   Each thread keeps its own copy, which is what allows interpreters that
+   have their own GIL to run at the same time. */
+_Py_thread_local PyThreadState *_Py_tss_tstate = NULL;
+
+#define _PyRuntimeGILState_GetThreadState(gilstate) (_Py_tss_tstate)
 #define _PyRuntimeGILState_SetThreadState(gilstate, value) \
-    _Py_atomic_store_relaxed(&(gilstate)->tstate_current, \
-                             (uintptr_t)(value))
+    (_Py_tss_tstate = (value))
 
 /* Forward declarations */
 static PyThreadState *_PyGILState_GetThisThreadState(struct _gilstate_runtime_state *gilstate);
@@ -60,7 +67,8 @@ _Py_COMP_DIAG_POP
 
 static int
 alloc_for_runtime(PyThread_type_lock *plock1, PyThread_type_lock *plock2,
-                  PyThread_type_lock *plock3, PyThread_type_lock *plock4)
+                  PyThread_type_lock *plock3, PyThread_type_lock *plock4,
+                  PyThread_type_lock *plock5)
 {
     /* Force default allocator, since _PyRuntimeState_Fini() must
        use the same allocator than this function. */
@@ -93,12 +101,22 @@ alloc_for_runtime(PyThread_type_lock *plock1, PyThread_type_lock *plock2,
         return -1;
     }
 
+    PyThread_type_lock lock5 = PyThread_allocate_lock();
+    if (lock5 == NULL) {
+        PyThread_free_lock(lock1);
+        PyThread_free_lock(lock2);
+        PyThread_free_lock(lock3);
+        PyThread_free_lock(lock4);
+        return -1;
+    }
+
     PyMem_SetAllocator(PYMEM_DOMAIN_RAW, &old_alloc);
 
     *plock1 = lock1;
     *plock2 = lock2;
     *plock3 = lock3;
     *plock4 = lock4;
+    *plock5 = lock5;
     return 0;
 }
 
@@ -110,7 +128,8 @@ init_runtime(_PyRuntimeState *runtime,
              PyThread_type_lock unicode_ids_mutex,
              PyThread_type_lock interpreters_mutex,
              PyThread_type_lock xidregistry_mutex,
-             PyThread_type_lock getargs_mutex)
+             PyThread_type_lock getargs_mutex,
+             PyThread_type_lock extensions_mutex)
 {
     if (runtime->_initialized) {
         Py_FatalError("runtime already initialized");
@@ -124,7 +143,6 @@ init_runtime(_PyRuntimeState *runtime,
     runtime->open_code_userdata = open_code_userdata;
     runtime->audit_hook_head = audit_hook_head;
 
-    _PyEval_InitRuntimeState(&runtime->ceval);
 
     PyPreConfig_InitPythonConfig(&runtime->preconfig);
 
@@ -134,6 +152,8 @@ init_runtime(_PyRuntimeState *runtime,
 
     runtime->getargs.mutex = getargs_mutex;
 
+    runtime->imports.extensions_mutex = extensions_mutex;
+
     // Set it to the ID of the main thread of the main interpreter.
     runtime->main_thread = PyThread_get_thread_ident();
 
@@ -156,8 +176,8 @@ _PyRuntimeState_Init(_PyRuntimeState *runtime)
     // is called multiple times.
     Py_ssize_t unicode_next_index = runtime->unicode_state.ids.next_index;
 
-    PyThread_type_lock lock1, lock2, lock3, lock4;
-    if (alloc_for_runtime(&lock1, &lock2, &lock3, &lock4) != 0) {
+    PyThread_type_lock lock1, lock2, lock3, lock4, lock5;
+    if (alloc_for_runtime(&lock1, &lock2, &lock3, &lock4, &lock5) != 0) {
         return _PyStatus_NO_MEMORY();
     }
 
@@ -167,7 +187,7 @@ _PyRuntimeState_Init(_PyRuntimeState *runtime)
         memcpy(runtime, &initial, sizeof(*runtime));
     }
     init_runtime(runtime, open_code_hook, open_code_userdata, audit_hook_head,
-                 unicode_next_index, lock1, lock2, lock3, lock4);
+                 unicode_next_index, lock1, lock2, lock3, lock4, lock5);
 
     return _PyStatus_OK();
 }
@@ -188,6 +208,7 @@ _PyRuntimeState_Fini(_PyRuntimeState *runtime)
     FREE_LOCK(runtime->xidregistry.mutex);
     FREE_LOCK(runtime->unicode_state.ids.lock);
     FREE_LOCK(runtime->getargs.mutex);
+    FREE_LOCK(runtime->imports.extensions_mutex);
 
 #undef FREE_LOCK
     PyMem_SetAllocator(PYMEM_DOMAIN_RAW, &old_alloc);
@@ -211,6 +232,7 @@ _PyRuntimeState_ReInitThreads(_PyRuntimeState *runtime)
     int reinit_xidregistry = _PyThread_at_fork_reinit(&runtime->xidregistry.mutex);
     int reinit_unicode_ids = _PyThread_at_fork_reinit(&runtime->unicode_state.ids.lock);
     int reinit_getargs = _PyThread_at_fork_reinit(&runtime->getargs.mutex);
+    int reinit_extensions = _PyThread_at_fork_reinit(&runtime->imports.extensions_mutex);
 
     PyMem_SetAllocator(PYMEM_DOMAIN_RAW, &old_alloc);
 
@@ -222,7 +244,8 @@ _PyRuntimeState_ReInitThreads(_PyRuntimeState *runtime)
         || reinit_main_id < 0
         || reinit_xidregistry < 0
         || reinit_unicode_ids < 0
-        || reinit_getargs < 0)
+        || reinit_getargs < 0
+        || reinit_extensions < 0)
     {
         return _PyStatus_ERR("Failed to reinitialize runtime locks");
 
@@ -310,6 +333,9 @@ init_interpreter(PyInterpreterState *interp,
     assert(next != NULL || (interp == runtime->interpreters.main));
     interp->next = next;
 
+    /* new_interpreter() replaces this if the interpreter gets its own GIL. */
+    interp->obmalloc = &runtime->obmalloc;
+
     _PyEval_InitState(&interp->ceval, pending_lock);
     _PyGC_InitState(&interp->gc);
     PyConfig_InitPythonConfig(&interp->config);
@@ -437,6 +463,9 @@ interpreter_clear(PyInterpreterState *interp, PyThreadState *tstate)
 #endif
 
     _PyAST_Fini(interp);
+    _PySpecializationProfile_Fini(interp);
+    _PySpecializationTelemetry_Fini(interp);
+    _Py_ClearMonitoring(interp);
     _PyWarnings_Fini(interp);
     _PyAtExit_Fini(interp);
 
@@ -456,6 +485,8 @@ interpreter_clear(PyInterpreterState *interp, PyThreadState *tstate)
     Py_CLEAR(interp->sysdict);
     Py_CLEAR(interp->builtins);
     Py_CLEAR(interp->interpreter_trampoline);
+    Py_CLEAR(interp->init_cleanup);
+    Py_CLEAR(interp->setter_cleanup);
 
     for (int i=0; i < DICT_MAX_WATCHERS; i++) {
         interp->dict_state.watchers[i] = NULL;
@@ -513,12 +544,30 @@ PyInterpreterState_Delete(PyInterpreterState *interp)
 {
     _PyRuntimeState *runtime = interp->runtime;
     struct pyinterpreters *interpreters = &runtime->interpreters;
+
+    /* Delete current thread. After this, many C API calls become crashy. */
+    PyThreadState *tcur = _PyRuntimeGILState_GetThreadState(&runtime->gilstate);
+    if (tcur != NULL && tcur->interp == interp) {
+        _PyThreadState_Swap(&runtime->gilstate, NULL);
+        /* The main interpreter keeps holding its GIL: daemon threads may
+           still be waiting for it (see finalize_interp_delete()).  Any
+           other interpreter releases it, so that the caller can switch
+           back to its previous thread state with PyThreadState_Swap(). */
+        if (!_Py_IsMainInterpreter(interp) && interp->ceval.gil != NULL) {
+            _PyEval_ReleaseLock(tcur);
+        }
+    }
+
     zapthreads(interp, 0);
 
     _PyEval_FiniState(&interp->ceval);
-
-    /* Delete current thread. After this, many C API calls become crashy. */
-    _PyThreadState_Swap(&runtime->gilstate, NULL);
+    if (!_Py_IsMainInterpreter(interp)) {
+        /* Daemon threads would have to be able to wait for the GIL of an
+           interpreter that no longer exists, which is why interpreters
+           with their own GIL disallow them by default. */
+        _PyEval_FiniGIL(interp);
+        _PyObject_FiniState(interp);
+    }
 
     HEAD_LOCK(runtime);
     PyInterpreterState **p;
@@ -577,7 +626,12 @@ _PyInterpreterState_DeleteExceptMain(_PyRuntimeState *runtime)
             continue;
         }
 
-        PyInterpreterState_Clear(interp);  // XXX must activate?
+        if (interp->obmalloc == &runtime->obmalloc) {
+            PyInterpreterState_Clear(interp);  // XXX must activate?
+        }
+        /* Otherwise the interpreter had its own GIL and allocator, which
+           may have been in use by another thread at the time of the
+           fork.  Its objects are leaked. */
         zapthreads(interp, 1);
         if (interp->id_mutex != NULL) {
             PyThread_free_lock(interp->id_mutex);
@@ -692,7 +746,6 @@ _PyInterpreterState_IDDecref(PyInterpreterState *interp)
 {
     assert(interp->id_mutex != NULL);
 
-    struct _gilstate_runtime_state *gilstate = &_PyRuntime.gilstate;
     PyThread_acquire_lock(interp->id_mutex, WAIT_LOCK);
     assert(interp->id_refcount != 0);
     interp->id_refcount -= 1;
@@ -703,9 +756,9 @@ _PyInterpreterState_IDDecref(PyInterpreterState *interp)
         // XXX Using the "head" thread isn't strictly correct.
         PyThreadState *tstate = PyInterpreterState_ThreadHead(interp);
         // XXX Possible GILState issues?
-        PyThreadState *save_tstate = _PyThreadState_Swap(gilstate, tstate);
+        PyThreadState *save_tstate = PyThreadState_Swap(tstate);
         Py_EndInterpreter(tstate);
-        _PyThreadState_Swap(gilstate, save_tstate);
+        PyThreadState_Swap(save_tstate);
     }
 }
 
@@ -1016,10 +1069,13 @@ _PyInterpreterState_ClearModules(PyInterpreterState *interp)
         return;
     }
 
+    /* The saved copies belong to the main interpreter's allocator, so an
+       interpreter with its own GIL leaves them alone. */
+    int own_gil = _PyInterpreterState_HasFeature(interp, Py_RTFLAGS_OWN_GIL);
     Py_ssize_t i;
     for (i = 0; i < PyList_GET_SIZE(interp->modules_by_index); i++) {
         PyObject *m = PyList_GET_ITEM(interp->modules_by_index, i);
-        if (PyModule_Check(m)) {
+        if (!own_gil && PyModule_Check(m)) {
             /* cleanup the saved copy of module dicts */
             PyModuleDef *md = PyModule_GetDef(m);
             if (md) {
@@ -1160,8 +1216,7 @@ _PyThreadState_DeleteCurrent(PyThreadState *tstate)
 void
 PyThreadState_DeleteCurrent(void)
 {
-    struct _gilstate_runtime_state *gilstate = &_PyRuntime.gilstate;
-    PyThreadState *tstate = _PyRuntimeGILState_GetThreadState(gilstate);
+    PyThreadState *tstate = _PyThreadState_GET();
     _PyThreadState_DeleteCurrent(tstate);
 }
 
@@ -1208,6 +1263,13 @@ _PyThreadState_DeleteExcept(_PyRuntimeState *runtime, PyThreadState *tstate)
 }
 
 
+PyThreadState *
+_PyThreadState_GetCurrent(void)
+{
+    return _Py_tss_tstate;
+}
+
+
 PyThreadState *
 _PyThreadState_UncheckedGet(void)
 {
@@ -1252,7 +1314,110 @@ _PyThreadState_Swap(struct _gilstate_runtime_state *gilstate, PyThreadState *new
 PyThreadState *
 PyThreadState_Swap(PyThreadState *newts)
 {
-    return _PyThreadState_Swap(&_PyRuntime.gilstate, newts);
+    struct _gilstate_runtime_state *gilstate = &_PyRuntime.gilstate;
+    PyThreadState *oldts = _PyRuntimeGILState_GetThreadState(gilstate);
+    if (oldts == newts) {
+        return oldts;
+    }
+    if (oldts != NULL && newts != NULL
+        && oldts->interp->ceval.gil == newts->interp->ceval.gil)
+    {
+        /* Both thread states are covered by the same GIL,
+           which the caller already holds. */
+        return _PyThreadState_Swap(gilstate, newts);
+    }
+
+    /* Release the GIL of the old interpreter and acquire the GIL of the
+       new one.  A NULL thread state holds no GIL. */
+    _PyThreadState_Swap(gilstate, NULL);
+    if (oldts != NULL) {
+        _PyEval_ReleaseLock(oldts);
+    }
+    if (newts != NULL) {
+        _PyEval_AcquireLock(newts);
+    }
+    _PyThreadState_Swap(gilstate, newts);
+    return oldts;
+}
+
+/* Objects shared by all interpreters (e.g. the dicts of static types)
+   must come from the main interpreter's allocator.  An interpreter with
+   its own GIL creates them by temporarily switching the current thread
+   to a new thread state of the main interpreter.  The other interpreters
+   already use the main interpreter's GIL and allocator, so for them this
+   does nothing.
+
+   Return the thread state to pass to _PyThreadState_SwapFromMain(), or
+   NULL with an exception set on failure. */
+PyThreadState *
+_PyThreadState_SwapToMain(void)
+{
+    PyThreadState *tstate = _PyThreadState_GET();
+    if (!_PyInterpreterState_HasFeature(tstate->interp, Py_RTFLAGS_OWN_GIL)) {
+        return tstate;
+    }
+    /* A thread has at most one thread state per interpreter: reuse the
+       one the thread already has in the main interpreter, if any. */
+    PyInterpreterState *main_interp = _PyInterpreterState_Main();
+    PyThreadState *temp = _PyGILState_GetThisThreadState(&_PyRuntime.gilstate);
+    if (temp == NULL || temp->interp != main_interp) {
+        temp = _PyThreadState_Prealloc(main_interp);
+        if (temp == NULL) {
+            PyErr_NoMemory();
+            return NULL;
+        }
+    }
+    (void)PyThreadState_Swap(temp);
+    return tstate;
+}
+
+void
+_PyThreadState_SwapFromMain(PyThreadState *tstate)
+{
+    PyThreadState *temp = _PyThreadState_GET();
+    if (temp == tstate) {
+        return;
+    }
+    assert(_Py_IsMainInterpreter(temp->interp));
+    int reused = (temp == _PyGILState_GetThisThreadState(&_PyRuntime.gilstate));
+
+    /* The exception belongs to the main interpreter: only its type
+       (a static type, if it is a builtin exception) and message can
+       be passed on. */
+    PyObject *exc_type = NULL;
+    char *msg = NULL;
+    if (_PyErr_Occurred(temp)) {
+        PyObject *type, *value, *tb;
+        _PyErr_Fetch(temp, &type, &value, &tb);
+        exc_type = type;
+        if (_PyType_HasFeature((PyTypeObject *)type, Py_TPFLAGS_HEAPTYPE)) {
+            exc_type = PyExc_RuntimeError;
+        }
+        PyObject *str = value != NULL ? PyObject_Str(value) : NULL;
+        const char *utf8 = str != NULL ? PyUnicode_AsUTF8(str) : NULL;
+        if (utf8 != NULL) {
+            msg = _PyMem_RawStrdup(utf8);
+        }
+        _PyErr_Clear(temp);
+        Py_XDECREF(str);
+        Py_DECREF(type);
+        Py_XDECREF(value);
+        Py_XDECREF(tb);
+    }
+
+    if (!reused) {
+        PyThreadState_Clear(temp);
+    }
+    (void)PyThreadState_Swap(tstate);
+    if (!reused) {
+        PyThreadState_Delete(temp);
+    }
+
+    if (exc_type != NULL) {
+        _PyErr_SetString(tstate, exc_type,
+                         msg != NULL ? msg : "failed in the main interpreter");
+        PyMem_RawFree(msg);
+    }
 }
 
 /* An extension mechanism to store arbitrary additional per-thread state.
@@ -1703,7 +1868,7 @@ PyGILState_Ensure(void)
 
     /* Ensure that _PyEval_InitThreads() and _PyGILState_Init() have been
        called by Py_Initialize() */
-    assert(_PyEval_ThreadsInitialized(runtime));
+    assert(_PyEval_ThreadsInitialized());
     assert(gilstate->autoInterpreterState);
 
     PyThreadState *tcur = (PyThreadState *)PyThread_tss_get(&gilstate->autoTSSkey);
@@ -1843,11 +2008,11 @@ _PyCrossInterpreterData_InitWithSize(_PyCrossInterpreterData *data,
     // where it was allocated, so the interpreter is required.
     assert(interp != NULL);
     _PyCrossInterpreterData_Init(data, interp, NULL, obj, new_object);
-    data->data = PyMem_Malloc(size);
+    data->data = PyMem_RawMalloc(size);
     if (data->data == NULL) {
         return -1;
     }
-    data->free = PyMem_Free;
+    data->free = PyMem_RawFree;
     return 0;
 }
 
@@ -1965,16 +2130,16 @@ _call_in_interpreter(struct _gilstate_runtime_state *gilstate,
         // XXX Using the "head" thread isn't strictly correct.
         PyThreadState *tstate = PyInterpreterState_ThreadHead(interp);
         // XXX Possible GILState issues?
-        save_tstate = _PyThreadState_Swap(gilstate, tstate);
+        // This releases the calling interpreter's GIL and acquires
+        // the target interpreter's GIL, if they are not the same.
+        save_tstate = PyThreadState_Swap(tstate);
     }
 
-    // XXX Once the GIL is per-interpreter, this should be called with the
-    // calling interpreter's GIL released and the target interpreter's held.
     func(interp, arg);
 
     // Switch back.
     if (save_tstate != NULL) {
-        _PyThreadState_Swap(gilstate, save_tstate);
+        PyThreadState_Swap(save_tstate);
     }
 }
 
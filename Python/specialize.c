@@ -1,16 +1,28 @@
 #include "Python.h"
 #include "pycore_code.h"
 #include "pycore_dict.h"
+#include "pycore_frame.h"         // _PyInterpreterFrame
 #include "pycore_function.h"      // _PyFunction_GetVersionForCurrentState()
 #include "pycore_global_strings.h"  // _Py_ID()
+#include "pycore_hashtable.h"     // _Py_hashtable_t
+#include "pycore_initconfig.h"    // _Py_GetEnv()
+#include "pycore_instruments.h"   // _Py_GetBaseOpcode()
+#include "pycore_interp.h"        // PyInterpreterState.specialization_profile
 #include "pycore_long.h"
 #include "pycore_moduleobject.h"
 #include "pycore_object.h"
 #include "pycore_opcode.h"        // _PyOpcode_Caches
+#include "pycore_typeobject.h"    // _PySuper_LookupDescr()
 #include "structmember.h"         // struct PyMemberDef, T_OFFSET_EX
 #include "pycore_descrobject.h"
+#include "opcode_metadata.h"      // _PyOpcode_Superinstruction()
+#include "osdefs.h"               // SEP
+#include "marshal.h"              // PyMarshal_ReadObjectFromFile()
 
 #include <stdlib.h> // rand()
+#ifdef MS_WINDOWS
+#  include <windows.h>            // MoveFileExW()
+#endif
 
 /* For guidance on adding or extending families of instructions see
  * ./adaptive.md
@@ -99,13 +111,20 @@ _Py_GetSpecializationStats(void) {
     err += add_stat_dict(stats, LOAD_ATTR, "load_attr");
     err += add_stat_dict(stats, LOAD_GLOBAL, "load_global");
     err += add_stat_dict(stats, BINARY_SUBSCR, "binary_subscr");
+    err += add_stat_dict(stats, BINARY_SLICE, "binary_slice");
     err += add_stat_dict(stats, STORE_SUBSCR, "store_subscr");
     err += add_stat_dict(stats, STORE_ATTR, "store_attr");
     err += add_stat_dict(stats, CALL, "call");
+    err += add_stat_dict(stats, CALL_FUNCTION_EX, "call_function_ex");
     err += add_stat_dict(stats, BINARY_OP, "binary_op");
     err += add_stat_dict(stats, COMPARE_OP, "compare_op");
     err += add_stat_dict(stats, UNPACK_SEQUENCE, "unpack_sequence");
     err += add_stat_dict(stats, FOR_ITER, "for_iter");
+    err += add_stat_dict(stats, CONTAINS_OP, "contains_op");
+    err += add_stat_dict(stats, FORMAT_VALUE, "format_value");
+    err += add_stat_dict(stats, SEND, "send");
+    err += add_stat_dict(stats, LOAD_SUPER_ATTR, "load_super_attr");
+    err += add_stat_dict(stats, JUMP_BACKWARD, "jump_backward");
     if (err < 0) {
         Py_DECREF(stats);
         return NULL;
@@ -244,20 +263,6 @@ _Py_PrintSpecializationStats(int to_file)
     }
 }
 
-#ifdef Py_STATS
-
-#define SPECIALIZATION_FAIL(opcode, kind) \
-do { \
-    if (_py_stats) { \
-        _py_stats->opcode_stats[opcode].specialization.failure_kinds[kind]++; \
-    } \
-} while (0)
-
-#endif
-#endif
-
-#ifndef SPECIALIZATION_FAIL
-#define SPECIALIZATION_FAIL(opcode, kind) ((void)0)
 #endif
 
 // Initialize warmup counters and insert superinstructions. This cannot fail.
@@ -270,27 +275,15 @@ _PyCode_Quicken(PyCodeObject *code)
         int opcode = _PyOpcode_Deopt[_Py_OPCODE(instructions[i])];
         int caches = _PyOpcode_Caches[opcode];
         if (caches) {
-            instructions[i + 1] = adaptive_counter_warmup();
+            instructions[i + 1] = opcode == JUMP_BACKWARD ?
+                adaptive_counter_back_edge() : adaptive_counter_warmup();
             previous_opcode = 0;
             i += caches;
             continue;
         }
-        switch (previous_opcode << 8 | opcode) {
-            case LOAD_CONST << 8 | LOAD_FAST:
-                _Py_SET_OPCODE(instructions[i - 1], LOAD_CONST__LOAD_FAST);
-                break;
-            case LOAD_FAST << 8 | LOAD_CONST:
-                _Py_SET_OPCODE(instructions[i - 1], LOAD_FAST__LOAD_CONST);
-                break;
-            case LOAD_FAST << 8 | LOAD_FAST:
-                _Py_SET_OPCODE(instructions[i - 1], LOAD_FAST__LOAD_FAST);
-                break;
-            case STORE_FAST << 8 | LOAD_FAST:
-                _Py_SET_OPCODE(instructions[i - 1], STORE_FAST__LOAD_FAST);
-                break;
-            case STORE_FAST << 8 | STORE_FAST:
-                _Py_SET_OPCODE(instructions[i - 1], STORE_FAST__STORE_FAST);
-                break;
+        int super = _PyOpcode_Superinstruction(previous_opcode, opcode);
+        if (super) {
+            _Py_SET_OPCODE(instructions[i - 1], super);
         }
         previous_opcode = opcode;
     }
@@ -335,6 +328,9 @@ _PyCode_Quicken(PyCodeObject *code)
 #define SPEC_FAIL_ATTR_INSTANCE_ATTRIBUTE 26
 #define SPEC_FAIL_ATTR_METACLASS_ATTRIBUTE 27
 #define SPEC_FAIL_ATTR_PROPERTY_NOT_PY_FUNCTION 28
+#define SPEC_FAIL_ATTR_CLASS_DUNDER 29
+#define SPEC_FAIL_ATTR_METACLASS_OVERRIDDEN 30
+#define SPEC_FAIL_ATTR_MODULE_DESCRIPTOR 31
 
 /* Binary subscr and store subscr */
 
@@ -342,7 +338,6 @@ _PyCode_Quicken(PyCodeObject *code)
 #define SPEC_FAIL_SUBSCR_ARRAY_SLICE 9
 #define SPEC_FAIL_SUBSCR_LIST_SLICE 10
 #define SPEC_FAIL_SUBSCR_TUPLE_SLICE 11
-#define SPEC_FAIL_SUBSCR_STRING_INT 12
 #define SPEC_FAIL_SUBSCR_STRING_SLICE 13
 #define SPEC_FAIL_SUBSCR_BUFFER_INT 15
 #define SPEC_FAIL_SUBSCR_BUFFER_SLICE 16
@@ -356,6 +351,13 @@ _PyCode_Quicken(PyCodeObject *code)
 #define SPEC_FAIL_SUBSCR_DICT_SUBCLASS_NO_OVERRIDE 22
 #define SPEC_FAIL_SUBSCR_NOT_HEAP_TYPE 23
 
+/* Binary slice */
+
+#define SPEC_FAIL_BINARY_SLICE_LIST 8
+#define SPEC_FAIL_BINARY_SLICE_TUPLE 9
+#define SPEC_FAIL_BINARY_SLICE_NOT_INT 10
+#define SPEC_FAIL_BINARY_SLICE_BUFFER 11
+
 /* Binary op */
 
 #define SPEC_FAIL_BINARY_OP_ADD_DIFFERENT_TYPES          8
@@ -403,6 +405,9 @@ _PyCode_Quicken(PyCodeObject *code)
 #define SPEC_FAIL_CALL_OPERATOR_WRAPPER 27
 #define SPEC_FAIL_CALL_PYFUNCTION 28
 #define SPEC_FAIL_CALL_PEP_523 29
+#define SPEC_FAIL_CALL_INIT_NOT_PYTHON 30
+#define SPEC_FAIL_CALL_METACLASS 31
+#define SPEC_FAIL_CALL_ABSTRACT_CLASS 32
 
 /* COMPARE_OP */
 #define SPEC_FAIL_COMPARE_OP_DIFFERENT_TYPES 12
@@ -441,11 +446,91 @@ _PyCode_Quicken(PyCodeObject *code)
 #define SPEC_FAIL_FOR_ITER_CALLABLE 28
 #define SPEC_FAIL_FOR_ITER_ASCII_STRING 29
 
+/* CONTAINS_OP */
+#define SPEC_FAIL_CONTAINS_OP_STR_NON_STR 8
+#define SPEC_FAIL_CONTAINS_OP_LIST 9
+#define SPEC_FAIL_CONTAINS_OP_BYTES 10
+#define SPEC_FAIL_CONTAINS_OP_RANGE 11
+#define SPEC_FAIL_CONTAINS_OP_DICT_VIEW 12
+#define SPEC_FAIL_CONTAINS_OP_DICT_SUBCLASS 13
+#define SPEC_FAIL_CONTAINS_OP_SET_SUBCLASS 14
+#define SPEC_FAIL_CONTAINS_OP_USER_CLASS 15
+
+/* CALL_FUNCTION_EX */
+#define SPEC_FAIL_CALL_FUNCTION_EX_ARGS_NOT_TUPLE 8
+#define SPEC_FAIL_CALL_FUNCTION_EX_BOUND_METHOD 9
+#define SPEC_FAIL_CALL_FUNCTION_EX_BUILTIN 10
+#define SPEC_FAIL_CALL_FUNCTION_EX_CLASS 11
+#define SPEC_FAIL_CALL_FUNCTION_EX_PY_OTHER 12
+
+/* FORMAT_VALUE */
+#define SPEC_FAIL_FORMAT_VALUE_FORMAT_SPEC 8
+#define SPEC_FAIL_FORMAT_VALUE_STR_CONVERSION 9
+#define SPEC_FAIL_FORMAT_VALUE_BOOL 10
+#define SPEC_FAIL_FORMAT_VALUE_STR_SUBCLASS 11
+
+/* LOAD_SUPER_ATTR */
+#define SPEC_FAIL_SUPER_SHADOWED 8
+#define SPEC_FAIL_SUPER_BAD_CLASS 9
+#define SPEC_FAIL_SUPER_CLASS_METHOD 10
+#define SPEC_FAIL_SUPER_NOT_SUBCLASS 11
+#define SPEC_FAIL_SUPER_NOT_FOUND 12
+#define SPEC_FAIL_SUPER_NOT_METHOD 13
+#define SPEC_FAIL_SUPER_GETATTRO_OVERRIDDEN 14
+
 // UNPACK_SEQUENCE
 
 #define SPEC_FAIL_UNPACK_SEQUENCE_ITERATOR 8
 #define SPEC_FAIL_UNPACK_SEQUENCE_SEQUENCE 9
 
+/* Working out why an instruction can't be specialized may take a while, so
+ * it's only done if Py_STATS or the specialization telemetry is on. */
+#ifdef Py_STATS
+#define FAILURE_KINDS_WANTED(interp) \
+    (_py_stats != NULL || (interp)->specialization_telemetry.enabled)
+#else
+#define FAILURE_KINDS_WANTED(interp) \
+    ((interp)->specialization_telemetry.enabled)
+#endif
+
+static void
+record_failure_kind(PyInterpreterState *interp, int opcode, int kind)
+{
+    assert(kind >= 0 && kind < SPECIALIZATION_FAILURE_KINDS);
+#ifdef Py_STATS
+    if (_py_stats) {
+        _py_stats->opcode_stats[opcode].specialization.failure_kinds[kind]++;
+    }
+#endif
+    interp->specialization_telemetry.failure_kind = kind;
+}
+
+#define SPECIALIZATION_FAIL(opcode, kind) \
+do { \
+    PyInterpreterState *interp_ = _PyInterpreterState_GET(); \
+    if (FAILURE_KINDS_WANTED(interp_)) { \
+        record_failure_kind(interp_, (opcode), (kind)); \
+    } \
+} while (0)
+
+static void record_attempt(PyInterpreterState *interp, _Py_CODEUNIT *instr,
+                           int success);
+
+/* Record the outcome of specializing the instruction at instr for the
+ * specialization telemetry, and forget the failure kind. */
+static inline void
+telemetry_record_attempt(_Py_CODEUNIT *instr, int success)
+{
+    PyInterpreterState *interp = _PyInterpreterState_GET();
+    if (interp->specialization_telemetry.enabled) {
+        record_attempt(interp, instr, success);
+    }
+    interp->specialization_telemetry.failure_kind = SPEC_FAIL_OTHER;
+}
+
+#define SPECIALIZATION_ATTEMPT(instr, success) \
+    telemetry_record_attempt((instr), (success))
+
 static int function_kind(PyCodeObject *code);
 static bool function_check_args(PyObject *o, int expected_argcount, int opcode);
 static uint32_t function_get_version(PyObject *o, int opcode);
@@ -490,6 +575,98 @@ specialize_module_load_attr(PyObject *owner, _Py_CODEUNIT *instr,
 }
 
 
+static int
+specialize_module_store_attr(PyObject *owner, _Py_CODEUNIT *instr,
+                             PyObject *name)
+{
+    _PyAttrCache *cache = (_PyAttrCache *)(instr + 1);
+    PyModuleObject *m = (PyModuleObject *)owner;
+    PyDictObject *dict = (PyDictObject *)m->md_dict;
+    if (dict == NULL) {
+        SPECIALIZATION_FAIL(STORE_ATTR, SPEC_FAIL_NO_DICT);
+        return -1;
+    }
+    /* Data descriptors of the module type, such as __annotations__,
+       take precedence over the module dict */
+    PyObject *descr = _PyType_Lookup(&PyModule_Type, name);
+    if (descr != NULL && Py_TYPE(descr)->tp_descr_set != NULL) {
+        SPECIALIZATION_FAIL(STORE_ATTR, SPEC_FAIL_ATTR_MODULE_DESCRIPTOR);
+        return -1;
+    }
+    if (dict->ma_keys->dk_kind != DICT_KEYS_UNICODE) {
+        SPECIALIZATION_FAIL(STORE_ATTR, SPEC_FAIL_ATTR_NON_STRING_OR_SPLIT);
+        return -1;
+    }
+    /* Only existing attributes are specialized, as adding a key
+       invalidates the keys version */
+    Py_ssize_t index = _PyDict_LookupIndex(dict, name);
+    assert (index != DKIX_ERROR);
+    if (index == DKIX_EMPTY) {
+        SPECIALIZATION_FAIL(STORE_ATTR, SPEC_FAIL_ATTR_MODULE_ATTR_NOT_FOUND);
+        return -1;
+    }
+    if (index != (uint16_t)index) {
+        SPECIALIZATION_FAIL(STORE_ATTR, SPEC_FAIL_OUT_OF_RANGE);
+        return -1;
+    }
+    uint32_t keys_version = _PyDictKeys_GetVersionForCurrentState(dict->ma_keys);
+    if (keys_version == 0) {
+        SPECIALIZATION_FAIL(STORE_ATTR, SPEC_FAIL_OUT_OF_VERSIONS);
+        return -1;
+    }
+    write_u32(cache->version, keys_version);
+    cache->index = (uint16_t)index;
+    _Py_SET_OPCODE(*instr, STORE_ATTR_MODULE);
+    return 0;
+}
+
+static int
+specialize_class_store_attr(PyObject *owner, _Py_CODEUNIT *instr,
+                            PyObject *name)
+{
+    _PyAttrCache *cache = (_PyAttrCache *)(instr + 1);
+    PyTypeObject *cls = (PyTypeObject *)owner;
+    PyTypeObject *metaclass = Py_TYPE(owner);
+    if (metaclass->tp_setattro != PyType_Type.tp_setattro) {
+        SPECIALIZATION_FAIL(STORE_ATTR, SPEC_FAIL_ATTR_METACLASS_OVERRIDDEN);
+        return -1;
+    }
+    if (cls->tp_flags & Py_TPFLAGS_IMMUTABLETYPE) {
+        SPECIALIZATION_FAIL(STORE_ATTR, SPEC_FAIL_EXPECTED_ERROR);
+        return -1;
+    }
+    /* Setting a special method has to update the type slots */
+    Py_ssize_t len = PyUnicode_GET_LENGTH(name);
+    if (len > 4 &&
+        PyUnicode_READ_CHAR(name, 0) == '_' &&
+        PyUnicode_READ_CHAR(name, 1) == '_' &&
+        PyUnicode_READ_CHAR(name, len - 2) == '_' &&
+        PyUnicode_READ_CHAR(name, len - 1) == '_')
+    {
+        SPECIALIZATION_FAIL(STORE_ATTR, SPEC_FAIL_ATTR_CLASS_DUNDER);
+        return -1;
+    }
+    PyObject *descr = _PyType_Lookup(metaclass, name);
+    if (descr != NULL) {
+        PyTypeObject *desc_cls = Py_TYPE(descr);
+        if (!(desc_cls->tp_flags & Py_TPFLAGS_IMMUTABLETYPE)) {
+            SPECIALIZATION_FAIL(STORE_ATTR, SPEC_FAIL_ATTR_MUTABLE_CLASS);
+            return -1;
+        }
+        if (desc_cls->tp_descr_set != NULL) {
+            SPECIALIZATION_FAIL(STORE_ATTR, SPEC_FAIL_ATTR_OVERRIDING_DESCRIPTOR);
+            return -1;
+        }
+    }
+    uint32_t version = metaclass->tp_version_tag;
+    if (version == 0) {
+        SPECIALIZATION_FAIL(STORE_ATTR, SPEC_FAIL_OUT_OF_VERSIONS);
+        return -1;
+    }
+    write_u32(cache->version, version);
+    _Py_SET_OPCODE(*instr, STORE_ATTR_CLASS);
+    return 0;
+}
 
 /* Attribute specialization */
 
@@ -811,12 +988,14 @@ _Py_Specialize_LoadAttr(PyObject *owner, _Py_CODEUNIT *instr, PyObject *name)
     }
 fail:
     STAT_INC(LOAD_ATTR, failure);
+    SPECIALIZATION_ATTEMPT(instr, 0);
     assert(!PyErr_Occurred());
     _Py_SET_OPCODE(*instr, LOAD_ATTR);
     cache->counter = adaptive_counter_backoff(cache->counter);
     return;
 success:
     STAT_INC(LOAD_ATTR, success);
+    SPECIALIZATION_ATTEMPT(instr, 1);
     assert(!PyErr_Occurred());
     cache->counter = adaptive_counter_cooldown();
 }
@@ -835,8 +1014,16 @@ _Py_Specialize_StoreAttr(PyObject *owner, _Py_CODEUNIT *instr, PyObject *name)
         goto fail;
     }
     if (PyModule_CheckExact(owner)) {
-        SPECIALIZATION_FAIL(STORE_ATTR, SPEC_FAIL_OVERRIDDEN);
-        goto fail;
+        if (specialize_module_store_attr(owner, instr, name)) {
+            goto fail;
+        }
+        goto success;
+    }
+    if (PyType_Check(owner)) {
+        if (specialize_class_store_attr(owner, instr, name)) {
+            goto fail;
+        }
+        goto success;
     }
     PyObject *descr;
     DescriptorClassification kind = analyze_descriptor(type, name, &descr, 1);
@@ -848,8 +1035,33 @@ _Py_Specialize_StoreAttr(PyObject *owner, _Py_CODEUNIT *instr, PyObject *name)
             SPECIALIZATION_FAIL(STORE_ATTR, SPEC_FAIL_ATTR_METHOD);
             goto fail;
         case PROPERTY:
-            SPECIALIZATION_FAIL(STORE_ATTR, SPEC_FAIL_ATTR_PROPERTY);
-            goto fail;
+        {
+            _PyLoadMethodCache *lm_cache = (_PyLoadMethodCache *)(instr + 1);
+            assert(Py_TYPE(descr) == &PyProperty_Type);
+            PyObject *fset = ((_PyPropertyObject *)descr)->prop_set;
+            if (fset == NULL) {
+                SPECIALIZATION_FAIL(STORE_ATTR, SPEC_FAIL_EXPECTED_ERROR);
+                goto fail;
+            }
+            if (!Py_IS_TYPE(fset, &PyFunction_Type)) {
+                SPECIALIZATION_FAIL(STORE_ATTR, SPEC_FAIL_ATTR_PROPERTY_NOT_PY_FUNCTION);
+                goto fail;
+            }
+            if (!function_check_args(fset, 2, STORE_ATTR)) {
+                goto fail;
+            }
+            uint32_t version = function_get_version(fset, STORE_ATTR);
+            if (version == 0) {
+                goto fail;
+            }
+            write_u32(lm_cache->keys_version, version);
+            assert(type->tp_version_tag != 0);
+            write_u32(lm_cache->type_version, type->tp_version_tag);
+            /* borrowed */
+            write_obj(lm_cache->descr, fset);
+            _Py_SET_OPCODE(*instr, STORE_ATTR_PROPERTY);
+            goto success;
+        }
         case OBJECT_SLOT:
         {
             PyMemberDescrObject *member = (PyMemberDescrObject *)descr;
@@ -899,18 +1111,19 @@ _Py_Specialize_StoreAttr(PyObject *owner, _Py_CODEUNIT *instr, PyObject *name)
     }
 fail:
     STAT_INC(STORE_ATTR, failure);
+    SPECIALIZATION_ATTEMPT(instr, 0);
     assert(!PyErr_Occurred());
     _Py_SET_OPCODE(*instr, STORE_ATTR);
     cache->counter = adaptive_counter_backoff(cache->counter);
     return;
 success:
     STAT_INC(STORE_ATTR, success);
+    SPECIALIZATION_ATTEMPT(instr, 1);
     assert(!PyErr_Occurred());
     cache->counter = adaptive_counter_cooldown();
 }
 
 
-#ifdef Py_STATS
 static int
 load_attr_fail_kind(DescriptorClassification kind)
 {
@@ -945,7 +1158,6 @@ load_attr_fail_kind(DescriptorClassification kind)
     }
     Py_UNREACHABLE();
 }
-#endif
 
 static int
 specialize_class_load_attr(PyObject *owner, _Py_CODEUNIT *instr,
@@ -966,11 +1178,9 @@ specialize_class_load_attr(PyObject *owner, _Py_CODEUNIT *instr,
             write_obj(cache->descr, descr);
             _Py_SET_OPCODE(*instr, LOAD_ATTR_CLASS);
             return 0;
-#ifdef Py_STATS
         case ABSENT:
             SPECIALIZATION_FAIL(LOAD_ATTR, SPEC_FAIL_EXPECTED_ERROR);
             return -1;
-#endif
         default:
             SPECIALIZATION_FAIL(LOAD_ATTR, load_attr_fail_kind(kind));
             return -1;
@@ -1157,30 +1367,22 @@ _Py_Specialize_LoadGlobal(
     goto success;
 fail:
     STAT_INC(LOAD_GLOBAL, failure);
+    SPECIALIZATION_ATTEMPT(instr, 0);
     assert(!PyErr_Occurred());
     _Py_SET_OPCODE(*instr, LOAD_GLOBAL);
     cache->counter = adaptive_counter_backoff(cache->counter);
     return;
 success:
     STAT_INC(LOAD_GLOBAL, success);
+    SPECIALIZATION_ATTEMPT(instr, 1);
     assert(!PyErr_Occurred());
     cache->counter = adaptive_counter_cooldown();
 }
 
-#ifdef Py_STATS
 static int
 binary_subscr_fail_kind(PyTypeObject *container_type, PyObject *sub)
 {
-    if (container_type == &PyUnicode_Type) {
-        if (PyLong_CheckExact(sub)) {
-            return SPEC_FAIL_SUBSCR_STRING_INT;
-        }
-        if (PySlice_Check(sub)) {
-            return SPEC_FAIL_SUBSCR_STRING_SLICE;
-        }
-        return SPEC_FAIL_OTHER;
-    }
-    else if (strcmp(container_type->tp_name, "array.array") == 0) {
+    if (strcmp(container_type->tp_name, "array.array") == 0) {
         if (PyLong_CheckExact(sub)) {
             return SPEC_FAIL_SUBSCR_ARRAY_INT;
         }
@@ -1205,7 +1407,6 @@ binary_subscr_fail_kind(PyTypeObject *container_type, PyObject *sub)
     }
     return SPEC_FAIL_OTHER;
 }
-#endif
 
 static int
 function_kind(PyCodeObject *code) {
@@ -1278,6 +1479,33 @@ _Py_Specialize_BinarySubscr(
             PySlice_Check(sub) ? SPEC_FAIL_SUBSCR_TUPLE_SLICE : SPEC_FAIL_OTHER);
         goto fail;
     }
+    if (container_type == &PyUnicode_Type) {
+        if (PyLong_CheckExact(sub)) {
+            _Py_SET_OPCODE(*instr, BINARY_SUBSCR_STR_INT);
+            goto success;
+        }
+        SPECIALIZATION_FAIL(BINARY_SUBSCR,
+            PySlice_Check(sub) ? SPEC_FAIL_SUBSCR_STRING_SLICE : SPEC_FAIL_OTHER);
+        goto fail;
+    }
+    if (container_type == &PyBytes_Type) {
+        if (PyLong_CheckExact(sub)) {
+            _Py_SET_OPCODE(*instr, BINARY_SUBSCR_BYTES_INT);
+            goto success;
+        }
+        SPECIALIZATION_FAIL(BINARY_SUBSCR,
+            PySlice_Check(sub) ? SPEC_FAIL_SUBSCR_BUFFER_SLICE : SPEC_FAIL_OTHER);
+        goto fail;
+    }
+    if (container_type == &PyByteArray_Type) {
+        if (PyLong_CheckExact(sub)) {
+            _Py_SET_OPCODE(*instr, BINARY_SUBSCR_BYTEARRAY_INT);
+            goto success;
+        }
+        SPECIALIZATION_FAIL(BINARY_SUBSCR,
+            PySlice_Check(sub) ? SPEC_FAIL_SUBSCR_BYTEARRAY_SLICE : SPEC_FAIL_OTHER);
+        goto fail;
+    }
     if (container_type == &PyDict_Type) {
         _Py_SET_OPCODE(*instr, BINARY_SUBSCR_DICT);
         goto success;
@@ -1317,92 +1545,126 @@ _Py_Specialize_BinarySubscr(
                         binary_subscr_fail_kind(container_type, sub));
 fail:
     STAT_INC(BINARY_SUBSCR, failure);
+    SPECIALIZATION_ATTEMPT(instr, 0);
     assert(!PyErr_Occurred());
     _Py_SET_OPCODE(*instr, BINARY_SUBSCR);
     cache->counter = adaptive_counter_backoff(cache->counter);
     return;
 success:
     STAT_INC(BINARY_SUBSCR, success);
+    SPECIALIZATION_ATTEMPT(instr, 1);
     assert(!PyErr_Occurred());
     cache->counter = adaptive_counter_cooldown();
 }
 
+static int
+binary_slice_fail_kind(PyTypeObject *container_type)
+{
+    if (container_type == &PyList_Type) {
+        return SPEC_FAIL_BINARY_SLICE_LIST;
+    }
+    if (container_type == &PyTuple_Type) {
+        return SPEC_FAIL_BINARY_SLICE_TUPLE;
+    }
+    if (container_type == &PyUnicode_Type ||
+        container_type == &PyBytes_Type ||
+        container_type == &PyByteArray_Type)
+    {
+        return SPEC_FAIL_BINARY_SLICE_NOT_INT;
+    }
+    if (container_type->tp_as_buffer) {
+        return SPEC_FAIL_BINARY_SLICE_BUFFER;
+    }
+    return SPEC_FAIL_OTHER;
+}
+
+static inline bool
+is_simple_slice_bound(PyObject *bound)
+{
+    return Py_IsNone(bound) || PyLong_CheckExact(bound);
+}
+
 void
-_Py_Specialize_StoreSubscr(PyObject *container, PyObject *sub, _Py_CODEUNIT *instr)
+_Py_Specialize_BinarySlice(PyObject *container, PyObject *start,
+                           PyObject *stop, _Py_CODEUNIT *instr)
 {
-    _PyStoreSubscrCache *cache = (_PyStoreSubscrCache *)(instr + 1);
+    assert(_PyOpcode_Caches[BINARY_SLICE] ==
+           INLINE_CACHE_ENTRIES_BINARY_SLICE);
+    _PyBinarySliceCache *cache = (_PyBinarySliceCache *)(instr + 1);
     PyTypeObject *container_type = Py_TYPE(container);
-    if (container_type == &PyList_Type) {
-        if (PyLong_CheckExact(sub)) {
-            if ((Py_SIZE(sub) == 0 || Py_SIZE(sub) == 1)
-                && ((PyLongObject *)sub)->ob_digit[0] < (size_t)PyList_GET_SIZE(container))
-            {
-                _Py_SET_OPCODE(*instr, STORE_SUBSCR_LIST_INT);
-                goto success;
-            }
-            else {
-                SPECIALIZATION_FAIL(STORE_SUBSCR, SPEC_FAIL_OUT_OF_RANGE);
-                goto fail;
-            }
+    if (is_simple_slice_bound(start) && is_simple_slice_bound(stop)) {
+        if (container_type == &PyUnicode_Type) {
+            _Py_SET_OPCODE(*instr, BINARY_SLICE_STR);
+            goto success;
         }
-        else if (PySlice_Check(sub)) {
-            SPECIALIZATION_FAIL(STORE_SUBSCR, SPEC_FAIL_SUBSCR_LIST_SLICE);
-            goto fail;
+        if (container_type == &PyBytes_Type) {
+            _Py_SET_OPCODE(*instr, BINARY_SLICE_BYTES);
+            goto success;
         }
-        else {
-            SPECIALIZATION_FAIL(STORE_SUBSCR, SPEC_FAIL_OTHER);
-            goto fail;
+        if (container_type == &PyByteArray_Type) {
+            _Py_SET_OPCODE(*instr, BINARY_SLICE_BYTEARRAY);
+            goto success;
         }
     }
-    if (container_type == &PyDict_Type) {
-        _Py_SET_OPCODE(*instr, STORE_SUBSCR_DICT);
-         goto success;
-    }
-#ifdef Py_STATS
+    SPECIALIZATION_FAIL(BINARY_SLICE,
+                        binary_slice_fail_kind(container_type));
+    STAT_INC(BINARY_SLICE, failure);
+    SPECIALIZATION_ATTEMPT(instr, 0);
+    _Py_SET_OPCODE(*instr, BINARY_SLICE);
+    cache->counter = adaptive_counter_backoff(cache->counter);
+    return;
+success:
+    STAT_INC(BINARY_SLICE, success);
+    SPECIALIZATION_ATTEMPT(instr, 1);
+    cache->counter = adaptive_counter_cooldown();
+}
+
+static int
+store_subscr_fail_kind(PyObject *container, PyObject *sub)
+{
+    PyTypeObject *container_type = Py_TYPE(container);
     PyMappingMethods *as_mapping = container_type->tp_as_mapping;
     if (as_mapping && (as_mapping->mp_ass_subscript
                        == PyDict_Type.tp_as_mapping->mp_ass_subscript)) {
-        SPECIALIZATION_FAIL(STORE_SUBSCR, SPEC_FAIL_SUBSCR_DICT_SUBCLASS_NO_OVERRIDE);
-        goto fail;
+        return SPEC_FAIL_SUBSCR_DICT_SUBCLASS_NO_OVERRIDE;
     }
     if (PyObject_CheckBuffer(container)) {
         if (PyLong_CheckExact(sub) && (((size_t)Py_SIZE(sub)) > 1)) {
-            SPECIALIZATION_FAIL(STORE_SUBSCR, SPEC_FAIL_OUT_OF_RANGE);
+            return SPEC_FAIL_OUT_OF_RANGE;
         }
         else if (strcmp(container_type->tp_name, "array.array") == 0) {
             if (PyLong_CheckExact(sub)) {
-                SPECIALIZATION_FAIL(STORE_SUBSCR, SPEC_FAIL_SUBSCR_ARRAY_INT);
+                return SPEC_FAIL_SUBSCR_ARRAY_INT;
             }
             else if (PySlice_Check(sub)) {
-                SPECIALIZATION_FAIL(STORE_SUBSCR, SPEC_FAIL_SUBSCR_ARRAY_SLICE);
+                return SPEC_FAIL_SUBSCR_ARRAY_SLICE;
             }
             else {
-                SPECIALIZATION_FAIL(STORE_SUBSCR, SPEC_FAIL_OTHER);
+                return SPEC_FAIL_OTHER;
             }
         }
         else if (PyByteArray_CheckExact(container)) {
             if (PyLong_CheckExact(sub)) {
-                SPECIALIZATION_FAIL(STORE_SUBSCR, SPEC_FAIL_SUBSCR_BYTEARRAY_INT);
+                return SPEC_FAIL_SUBSCR_BYTEARRAY_INT;
             }
             else if (PySlice_Check(sub)) {
-                SPECIALIZATION_FAIL(STORE_SUBSCR, SPEC_FAIL_SUBSCR_BYTEARRAY_SLICE);
+                return SPEC_FAIL_SUBSCR_BYTEARRAY_SLICE;
             }
             else {
-                SPECIALIZATION_FAIL(STORE_SUBSCR, SPEC_FAIL_OTHER);
+                return SPEC_FAIL_OTHER;
             }
         }
         else {
             if (PyLong_CheckExact(sub)) {
-                SPECIALIZATION_FAIL(STORE_SUBSCR, SPEC_FAIL_SUBSCR_BUFFER_INT);
+                return SPEC_FAIL_SUBSCR_BUFFER_INT;
             }
             else if (PySlice_Check(sub)) {
-                SPECIALIZATION_FAIL(STORE_SUBSCR, SPEC_FAIL_SUBSCR_BUFFER_SLICE);
+                return SPEC_FAIL_SUBSCR_BUFFER_SLICE;
             }
             else {
-                SPECIALIZATION_FAIL(STORE_SUBSCR, SPEC_FAIL_OTHER);
+                return SPEC_FAIL_OTHER;
             }
         }
-        goto fail;
     }
     PyObject *descriptor = _PyType_Lookup(container_type, &_Py_ID(__setitem__));
     if (descriptor && Py_TYPE(descriptor) == &PyFunction_Type) {
@@ -1410,41 +1672,143 @@ _Py_Specialize_StoreSubscr(PyObject *container, PyObject *sub, _Py_CODEUNIT *ins
         PyCodeObject *code = (PyCodeObject *)func->func_code;
         int kind = function_kind(code);
         if (kind == SIMPLE_FUNCTION) {
-            SPECIALIZATION_FAIL(STORE_SUBSCR, SPEC_FAIL_SUBSCR_PY_SIMPLE);
+            return SPEC_FAIL_SUBSCR_PY_SIMPLE;
         }
         else {
-            SPECIALIZATION_FAIL(STORE_SUBSCR, SPEC_FAIL_SUBSCR_PY_OTHER);
+            return SPEC_FAIL_SUBSCR_PY_OTHER;
         }
-        goto fail;
     }
-#endif
-    SPECIALIZATION_FAIL(STORE_SUBSCR, SPEC_FAIL_OTHER);
+    return SPEC_FAIL_OTHER;
+}
+
+void
+_Py_Specialize_StoreSubscr(PyObject *container, PyObject *sub, _Py_CODEUNIT *instr)
+{
+    _PyStoreSubscrCache *cache = (_PyStoreSubscrCache *)(instr + 1);
+    PyTypeObject *container_type = Py_TYPE(container);
+    if (container_type == &PyList_Type) {
+        if (PyLong_CheckExact(sub)) {
+            if ((Py_SIZE(sub) == 0 || Py_SIZE(sub) == 1)
+                && ((PyLongObject *)sub)->ob_digit[0] < (size_t)PyList_GET_SIZE(container))
+            {
+                _Py_SET_OPCODE(*instr, STORE_SUBSCR_LIST_INT);
+                goto success;
+            }
+            else {
+                SPECIALIZATION_FAIL(STORE_SUBSCR, SPEC_FAIL_OUT_OF_RANGE);
+                goto fail;
+            }
+        }
+        else if (PySlice_Check(sub)) {
+            SPECIALIZATION_FAIL(STORE_SUBSCR, SPEC_FAIL_SUBSCR_LIST_SLICE);
+            goto fail;
+        }
+        else {
+            SPECIALIZATION_FAIL(STORE_SUBSCR, SPEC_FAIL_OTHER);
+            goto fail;
+        }
+    }
+    if (container_type == &PyDict_Type) {
+        _Py_SET_OPCODE(*instr, STORE_SUBSCR_DICT);
+         goto success;
+    }
+    SPECIALIZATION_FAIL(STORE_SUBSCR,
+                        store_subscr_fail_kind(container, sub));
 fail:
     STAT_INC(STORE_SUBSCR, failure);
+    SPECIALIZATION_ATTEMPT(instr, 0);
     assert(!PyErr_Occurred());
     _Py_SET_OPCODE(*instr, STORE_SUBSCR);
     cache->counter = adaptive_counter_backoff(cache->counter);
     return;
 success:
     STAT_INC(STORE_SUBSCR, success);
+    SPECIALIZATION_ATTEMPT(instr, 1);
     assert(!PyErr_Occurred());
     cache->counter = adaptive_counter_cooldown();
 }
 
+/* Calling a Python class whose __init__ is a simple Python function
+ * allocates the object and pushes the frame for __init__ directly,
+ * bypassing type.__call__ and object.__new__. */
 static int
-specialize_class_call(PyObject *callable, _Py_CODEUNIT *instr, int nargs,
-                      PyObject *kwnames)
+specialize_python_class_call(PyTypeObject *tp, _Py_CODEUNIT *instr, int nargs,
+                             PyObject *kwnames)
 {
-    PyTypeObject *tp = _PyType_CAST(callable);
-    if (tp->tp_new == PyBaseObject_Type.tp_new) {
-        SPECIALIZATION_FAIL(CALL, SPEC_FAIL_CALL_PYTHON_CLASS);
+    assert(tp->tp_new == PyBaseObject_Type.tp_new);
+    _PyCallCache *cache = (_PyCallCache *)(instr + 1);
+    /* Don't specialize if PEP 523 is active */
+    if (_PyInterpreterState_GET()->eval_frame) {
+        SPECIALIZATION_FAIL(CALL, SPEC_FAIL_CALL_PEP_523);
         return -1;
     }
-    if (tp->tp_flags & Py_TPFLAGS_IMMUTABLETYPE) {
-        int oparg = _Py_OPARG(*instr);
-        if (nargs == 1 && kwnames == NULL && oparg == 1) {
-            if (tp == &PyUnicode_Type) {
-                _Py_SET_OPCODE(*instr, CALL_NO_KW_STR_1);
+    if (kwnames) {
+        SPECIALIZATION_FAIL(CALL, SPEC_FAIL_CALL_KWNAMES);
+        return -1;
+    }
+    if (Py_TYPE(tp) != &PyType_Type) {
+        SPECIALIZATION_FAIL(CALL, SPEC_FAIL_CALL_METACLASS);
+        return -1;
+    }
+    if (!(tp->tp_flags & Py_TPFLAGS_HEAPTYPE)) {
+        SPECIALIZATION_FAIL(CALL, SPEC_FAIL_CALL_PYTHON_CLASS);
+        return -1;
+    }
+    if (tp->tp_flags & Py_TPFLAGS_IS_ABSTRACT) {
+        SPECIALIZATION_FAIL(CALL, SPEC_FAIL_CALL_ABSTRACT_CLASS);
+        return -1;
+    }
+    if (tp->tp_alloc != PyType_GenericAlloc) {
+        SPECIALIZATION_FAIL(CALL, SPEC_FAIL_OVERRIDDEN);
+        return -1;
+    }
+    PyObject *init = _PyType_Lookup(tp, &_Py_ID(__init__));
+    if (init == NULL || !PyFunction_Check(init)) {
+        SPECIALIZATION_FAIL(CALL, SPEC_FAIL_CALL_INIT_NOT_PYTHON);
+        return -1;
+    }
+    PyCodeObject *code = (PyCodeObject *)((PyFunctionObject *)init)->func_code;
+    int kind = function_kind(code);
+    if (kind != SIMPLE_FUNCTION) {
+        SPECIALIZATION_FAIL(CALL, kind);
+        return -1;
+    }
+    if (code->co_argcount != nargs + 1) {
+        SPECIALIZATION_FAIL(CALL, SPEC_FAIL_WRONG_NUMBER_ARGUMENTS);
+        return -1;
+    }
+    if (tp->tp_version_tag == 0) {
+        SPECIALIZATION_FAIL(CALL, SPEC_FAIL_OUT_OF_VERSIONS);
+        return -1;
+    }
+    int version = _PyFunction_GetVersionForCurrentState((PyFunctionObject *)init);
+    if (version == 0 || version != (uint16_t)version) {
+        SPECIALIZATION_FAIL(CALL, version == 0 ?
+            SPEC_FAIL_OUT_OF_VERSIONS : SPEC_FAIL_OUT_OF_RANGE);
+        return -1;
+    }
+    /* The class version guards the cached __init__, and the function
+     * version (stored in min_args) guards its code. */
+    write_u32(cache->func_version, tp->tp_version_tag);
+    cache->min_args = version;
+    ((PyHeapTypeObject *)tp)->_spec_cache.init = init;
+    _Py_SET_OPCODE(*instr, CALL_NO_KW_ALLOC_AND_ENTER_INIT);
+    return 0;
+}
+
+static int
+specialize_class_call(PyObject *callable, _Py_CODEUNIT *instr, int nargs,
+                      PyObject *kwnames)
+{
+    PyTypeObject *tp = _PyType_CAST(callable);
+    if (tp->tp_new == PyBaseObject_Type.tp_new) {
+        return specialize_python_class_call(tp, instr, nargs, kwnames);
+    }
+    if (tp->tp_flags & Py_TPFLAGS_IMMUTABLETYPE) {
+        int oparg = _Py_OPARG(*instr);
+        if (nargs == 1 && kwnames == NULL && oparg == 1) {
+            if (tp == &PyUnicode_Type) {
+                _Py_SET_OPCODE(*instr, CALL_NO_KW_STR_1);
                 return 0;
             }
             else if (tp == &PyType_Type) {
@@ -1468,7 +1832,6 @@ specialize_class_call(PyObject *callable, _Py_CODEUNIT *instr, int nargs,
     return -1;
 }
 
-#ifdef Py_STATS
 static int
 builtin_call_fail_kind(int ml_flags)
 {
@@ -1490,7 +1853,6 @@ builtin_call_fail_kind(int ml_flags)
             return SPEC_FAIL_CALL_BAD_CALL_FLAGS;
     }
 }
-#endif
 
 static int
 specialize_method_descriptor(PyMethodDescrObject *descr, _Py_CODEUNIT *instr,
@@ -1520,7 +1882,10 @@ specialize_method_descriptor(PyMethodDescrObject *descr, _Py_CODEUNIT *instr,
             PyInterpreterState *interp = _PyInterpreterState_GET();
             PyObject *list_append = interp->callable_cache.list_append;
             _Py_CODEUNIT next = instr[INLINE_CACHE_ENTRIES_CALL + 1];
-            bool pop = (_Py_OPCODE(next) == POP_TOP);
+            // CALL_NO_KW_LIST_APPEND skips the POP_TOP. If that's part of a
+            // superinstruction, the other half still runs from its own code
+            // unit.
+            bool pop = (_PyOpcode_Deopt[_Py_OPCODE(next)] == POP_TOP);
             int oparg = _Py_OPARG(*instr);
             if ((PyObject *)descr == list_append && oparg == 1 && pop) {
                 _Py_SET_OPCODE(*instr, CALL_NO_KW_LIST_APPEND);
@@ -1652,7 +2017,6 @@ specialize_c_call(PyObject *callable, _Py_CODEUNIT *instr, int nargs,
     }
 }
 
-#ifdef Py_STATS
 static int
 call_fail_kind(PyObject *callable)
 {
@@ -1691,7 +2055,6 @@ call_fail_kind(PyObject *callable)
     }
     return SPEC_FAIL_OTHER;
 }
-#endif
 
 
 /* TODO:
@@ -1734,18 +2097,19 @@ _Py_Specialize_Call(PyObject *callable, _Py_CODEUNIT *instr, int nargs,
     }
     if (fail) {
         STAT_INC(CALL, failure);
+        SPECIALIZATION_ATTEMPT(instr, 0);
         assert(!PyErr_Occurred());
         _Py_SET_OPCODE(*instr, CALL);
         cache->counter = adaptive_counter_backoff(cache->counter);
     }
     else {
         STAT_INC(CALL, success);
+        SPECIALIZATION_ATTEMPT(instr, 1);
         assert(!PyErr_Occurred());
         cache->counter = adaptive_counter_cooldown();
     }
 }
 
-#ifdef Py_STATS
 static int
 binary_op_fail_kind(int oparg, PyObject *lhs, PyObject *rhs)
 {
@@ -1813,7 +2177,6 @@ binary_op_fail_kind(int oparg, PyObject *lhs, PyObject *rhs)
     }
     Py_UNREACHABLE();
 }
-#endif
 
 void
 _Py_Specialize_BinaryOp(PyObject *lhs, PyObject *rhs, _Py_CODEUNIT *instr,
@@ -1829,8 +2192,7 @@ _Py_Specialize_BinaryOp(PyObject *lhs, PyObject *rhs, _Py_CODEUNIT *instr,
             }
             if (PyUnicode_CheckExact(lhs)) {
                 _Py_CODEUNIT next = instr[INLINE_CACHE_ENTRIES_BINARY_OP + 1];
-                bool to_store = (_Py_OPCODE(next) == STORE_FAST ||
-                                 _Py_OPCODE(next) == STORE_FAST__LOAD_FAST);
+                bool to_store = (_PyOpcode_Deopt[_Py_OPCODE(next)] == STORE_FAST);
                 if (to_store && locals[_Py_OPARG(next)] == lhs) {
                     _Py_SET_OPCODE(*instr, BINARY_OP_INPLACE_ADD_UNICODE);
                     goto success;
@@ -1878,16 +2240,17 @@ _Py_Specialize_BinaryOp(PyObject *lhs, PyObject *rhs, _Py_CODEUNIT *instr,
     }
     SPECIALIZATION_FAIL(BINARY_OP, binary_op_fail_kind(oparg, lhs, rhs));
     STAT_INC(BINARY_OP, failure);
+    SPECIALIZATION_ATTEMPT(instr, 0);
     _Py_SET_OPCODE(*instr, BINARY_OP);
     cache->counter = adaptive_counter_backoff(cache->counter);
     return;
 success:
     STAT_INC(BINARY_OP, success);
+    SPECIALIZATION_ATTEMPT(instr, 1);
     cache->counter = adaptive_counter_cooldown();
 }
 
 
-#ifdef Py_STATS
 static int
 compare_op_fail_kind(PyObject *lhs, PyObject *rhs)
 {
@@ -1920,7 +2283,6 @@ compare_op_fail_kind(PyObject *lhs, PyObject *rhs)
     }
     return SPEC_FAIL_OTHER;
 }
-#endif
 
 
 static int compare_masks[] = {
@@ -1989,15 +2351,16 @@ _Py_Specialize_CompareOp(PyObject *lhs, PyObject *rhs, _Py_CODEUNIT *instr,
     SPECIALIZATION_FAIL(COMPARE_OP, compare_op_fail_kind(lhs, rhs));
 failure:
     STAT_INC(COMPARE_OP, failure);
+    SPECIALIZATION_ATTEMPT(instr, 0);
     _Py_SET_OPCODE(*instr, COMPARE_OP);
     cache->counter = adaptive_counter_backoff(cache->counter);
     return;
 success:
     STAT_INC(COMPARE_OP, success);
+    SPECIALIZATION_ATTEMPT(instr, 1);
     cache->counter = adaptive_counter_cooldown();
 }
 
-#ifdef Py_STATS
 static int
 unpack_sequence_fail_kind(PyObject *seq)
 {
@@ -2009,7 +2372,6 @@ unpack_sequence_fail_kind(PyObject *seq)
     }
     return SPEC_FAIL_OTHER;
 }
-#endif
 
 void
 _Py_Specialize_UnpackSequence(PyObject *seq, _Py_CODEUNIT *instr, int oparg)
@@ -2040,15 +2402,16 @@ _Py_Specialize_UnpackSequence(PyObject *seq, _Py_CODEUNIT *instr, int oparg)
     SPECIALIZATION_FAIL(UNPACK_SEQUENCE, unpack_sequence_fail_kind(seq));
 failure:
     STAT_INC(UNPACK_SEQUENCE, failure);
+    SPECIALIZATION_ATTEMPT(instr, 0);
     _Py_SET_OPCODE(*instr, UNPACK_SEQUENCE);
     cache->counter = adaptive_counter_backoff(cache->counter);
     return;
 success:
     STAT_INC(UNPACK_SEQUENCE, success);
+    SPECIALIZATION_ATTEMPT(instr, 1);
     cache->counter = adaptive_counter_cooldown();
 }
 
-#ifdef Py_STATS
 
 int
  _PySpecialization_ClassifyIterator(PyObject *iter)
@@ -2118,7 +2481,6 @@ int
     return SPEC_FAIL_OTHER;
 }
 
-#endif
 
 void
 _Py_Specialize_ForIter(PyObject *iter, _Py_CODEUNIT *instr, int oparg)
@@ -2140,6 +2502,26 @@ _Py_Specialize_ForIter(PyObject *iter, _Py_CODEUNIT *instr, int oparg)
         _Py_SET_OPCODE(*instr, FOR_ITER_RANGE);
         goto success;
     }
+    else if (tp == &PyDictIterKey_Type) {
+        _Py_SET_OPCODE(*instr, FOR_ITER_DICT_KEYS);
+        goto success;
+    }
+    else if (tp == &PyDictIterValue_Type) {
+        _Py_SET_OPCODE(*instr, FOR_ITER_DICT_VALUES);
+        goto success;
+    }
+    else if (tp == &PyDictIterItem_Type &&
+             next_op == UNPACK_SEQUENCE && _Py_OPARG(next) == 2)
+    {
+        _Py_SET_OPCODE(*instr, FOR_ITER_DICT_ITEMS);
+        goto success;
+    }
+    else if (tp == &PyEnum_Type &&
+             next_op == UNPACK_SEQUENCE && _Py_OPARG(next) == 2)
+    {
+        _Py_SET_OPCODE(*instr, FOR_ITER_ENUMERATE);
+        goto success;
+    }
     else if (tp == &PyGen_Type && oparg <= SHRT_MAX) {
         assert(_Py_OPCODE(instr[oparg + INLINE_CACHE_ENTRIES_FOR_ITER + 1]) == END_FOR);
         _Py_SET_OPCODE(*instr, FOR_ITER_GEN);
@@ -2148,10 +2530,1102 @@ _Py_Specialize_ForIter(PyObject *iter, _Py_CODEUNIT *instr, int oparg)
     SPECIALIZATION_FAIL(FOR_ITER,
                         _PySpecialization_ClassifyIterator(iter));
     STAT_INC(FOR_ITER, failure);
+    SPECIALIZATION_ATTEMPT(instr, 0);
     _Py_SET_OPCODE(*instr, FOR_ITER);
     cache->counter = adaptive_counter_backoff(cache->counter);
     return;
 success:
     STAT_INC(FOR_ITER, success);
+    SPECIALIZATION_ATTEMPT(instr, 1);
+    cache->counter = adaptive_counter_cooldown();
+}
+
+void
+_Py_Specialize_Send(PyObject *receiver, _Py_CODEUNIT *instr, int oparg)
+{
+    assert(_PyOpcode_Caches[SEND] == INLINE_CACHE_ENTRIES_SEND);
+    _PySendCache *cache = (_PySendCache *)(instr + 1);
+    PyTypeObject *tp = Py_TYPE(receiver);
+    if ((tp == &PyGen_Type || tp == &PyCoro_Type) && oparg <= SHRT_MAX) {
+        _Py_SET_OPCODE(*instr, SEND_GEN);
+        goto success;
+    }
+    SPECIALIZATION_FAIL(SEND,
+                        _PySpecialization_ClassifyIterator(receiver));
+    STAT_INC(SEND, failure);
+    SPECIALIZATION_ATTEMPT(instr, 0);
+    _Py_SET_OPCODE(*instr, SEND);
+    cache->counter = adaptive_counter_backoff(cache->counter);
+    return;
+success:
+    STAT_INC(SEND, success);
+    SPECIALIZATION_ATTEMPT(instr, 1);
+    cache->counter = adaptive_counter_cooldown();
+}
+
+void
+_Py_Specialize_LoadSuperAttr(PyObject *global_super, PyObject *cls,
+                             PyObject *self, _Py_CODEUNIT *instr,
+                             PyObject *name, int load_method)
+{
+    assert(_PyOpcode_Caches[LOAD_SUPER_ATTR] ==
+           INLINE_CACHE_ENTRIES_LOAD_SUPER_ATTR);
+    _PySuperAttrCache *cache = (_PySuperAttrCache *)(instr + 1);
+    if (global_super != (PyObject *)&PySuper_Type) {
+        SPECIALIZATION_FAIL(LOAD_SUPER_ATTR, SPEC_FAIL_SUPER_SHADOWED);
+        goto fail;
+    }
+    if (!PyType_Check(cls)) {
+        SPECIALIZATION_FAIL(LOAD_SUPER_ATTR, SPEC_FAIL_SUPER_BAD_CLASS);
+        goto fail;
+    }
+    /* super() in a class method binds to the class itself */
+    if (PyType_Check(self)) {
+        SPECIALIZATION_FAIL(LOAD_SUPER_ATTR, SPEC_FAIL_SUPER_CLASS_METHOD);
+        goto fail;
+    }
+    PyTypeObject *self_type = Py_TYPE(self);
+    if (!PyType_IsSubtype(self_type, (PyTypeObject *)cls)) {
+        SPECIALIZATION_FAIL(LOAD_SUPER_ATTR, SPEC_FAIL_SUPER_NOT_SUBCLASS);
+        goto fail;
+    }
+    if (load_method && self_type->tp_getattro != PyObject_GenericGetAttr) {
+        SPECIALIZATION_FAIL(LOAD_SUPER_ATTR,
+                            SPEC_FAIL_SUPER_GETATTRO_OVERRIDDEN);
+        goto fail;
+    }
+    /* Assigns version tags to self_type and all of its bases */
+    _PyType_Lookup(self_type, name);
+    uint32_t class_version = ((PyTypeObject *)cls)->tp_version_tag;
+    uint32_t self_type_version = self_type->tp_version_tag;
+    if (class_version == 0 || self_type_version == 0) {
+        SPECIALIZATION_FAIL(LOAD_SUPER_ATTR, SPEC_FAIL_OUT_OF_VERSIONS);
+        goto fail;
+    }
+    PyObject *descr = _PySuper_LookupDescr((PyTypeObject *)cls, self_type,
+                                           name);
+    if (descr == NULL) {
+        PyErr_Clear();
+        SPECIALIZATION_FAIL(LOAD_SUPER_ATTR, SPEC_FAIL_SUPER_NOT_FOUND);
+        goto fail;
+    }
+    /* The cached descriptor is kept alive by the MRO of self_type
+       for as long as its version tag is unchanged */
+    Py_DECREF(descr);
+    if (load_method) {
+        if (!_PyType_HasFeature(Py_TYPE(descr),
+                                Py_TPFLAGS_METHOD_DESCRIPTOR)) {
+            SPECIALIZATION_FAIL(LOAD_SUPER_ATTR, SPEC_FAIL_SUPER_NOT_METHOD);
+            goto fail;
+        }
+        _Py_SET_OPCODE(*instr, LOAD_SUPER_ATTR_METHOD);
+    }
+    else {
+        _Py_SET_OPCODE(*instr, LOAD_SUPER_ATTR_ATTR);
+    }
+    write_u32(cache->class_version, class_version);
+    write_u32(cache->self_type_version, self_type_version);
+    write_obj(cache->descr, descr);
+    STAT_INC(LOAD_SUPER_ATTR, success);
+    SPECIALIZATION_ATTEMPT(instr, 1);
+    cache->counter = adaptive_counter_cooldown();
+    return;
+fail:
+    STAT_INC(LOAD_SUPER_ATTR, failure);
+    SPECIALIZATION_ATTEMPT(instr, 0);
+    _Py_SET_OPCODE(*instr, LOAD_SUPER_ATTR);
+    cache->counter = adaptive_counter_backoff(cache->counter);
+}
+
+static int
+contains_op_fail_kind(PyObject *value, PyObject *container)
+{
+    if (PyUnicode_CheckExact(container)) {
+        assert(!PyUnicode_CheckExact(value));
+        return SPEC_FAIL_CONTAINS_OP_STR_NON_STR;
+    }
+    if (PyList_Check(container)) {
+        return SPEC_FAIL_CONTAINS_OP_LIST;
+    }
+    if (PyBytes_Check(container) || PyByteArray_Check(container)) {
+        return SPEC_FAIL_CONTAINS_OP_BYTES;
+    }
+    if (PyRange_Check(container)) {
+        return SPEC_FAIL_CONTAINS_OP_RANGE;
+    }
+    if (PyDictKeys_Check(container) || PyDictItems_Check(container) ||
+        PyDictValues_Check(container))
+    {
+        return SPEC_FAIL_CONTAINS_OP_DICT_VIEW;
+    }
+    if (PyDict_Check(container)) {
+        return SPEC_FAIL_CONTAINS_OP_DICT_SUBCLASS;
+    }
+    if (PyAnySet_Check(container)) {
+        return SPEC_FAIL_CONTAINS_OP_SET_SUBCLASS;
+    }
+    if (Py_TYPE(container)->tp_flags & Py_TPFLAGS_HEAPTYPE) {
+        return SPEC_FAIL_CONTAINS_OP_USER_CLASS;
+    }
+    return SPEC_FAIL_OTHER;
+}
+
+void
+_Py_Specialize_ContainsOp(PyObject *value, PyObject *container,
+                          _Py_CODEUNIT *instr)
+{
+    assert(_PyOpcode_Caches[CONTAINS_OP] == INLINE_CACHE_ENTRIES_CONTAINS_OP);
+    _PyContainsOpCache *cache = (_PyContainsOpCache *)(instr + 1);
+    if (PyDict_CheckExact(container)) {
+        _Py_SET_OPCODE(*instr, CONTAINS_OP_DICT);
+        goto success;
+    }
+    if (PyAnySet_CheckExact(container)) {
+        _Py_SET_OPCODE(*instr, CONTAINS_OP_SET);
+        goto success;
+    }
+    if (PyUnicode_CheckExact(container) && PyUnicode_CheckExact(value)) {
+        _Py_SET_OPCODE(*instr, CONTAINS_OP_STR);
+        goto success;
+    }
+    if (PyTuple_CheckExact(container)) {
+        _Py_SET_OPCODE(*instr, CONTAINS_OP_TUPLE);
+        goto success;
+    }
+    SPECIALIZATION_FAIL(CONTAINS_OP, contains_op_fail_kind(value, container));
+    STAT_INC(CONTAINS_OP, failure);
+    SPECIALIZATION_ATTEMPT(instr, 0);
+    _Py_SET_OPCODE(*instr, CONTAINS_OP);
+    cache->counter = adaptive_counter_backoff(cache->counter);
+    return;
+success:
+    STAT_INC(CONTAINS_OP, success);
+    SPECIALIZATION_ATTEMPT(instr, 1);
     cache->counter = adaptive_counter_cooldown();
 }
+
+static int
+format_value_fail_kind(PyObject *value)
+{
+    if (PyBool_Check(value)) {
+        return SPEC_FAIL_FORMAT_VALUE_BOOL;
+    }
+    if (PyUnicode_Check(value)) {
+        return SPEC_FAIL_FORMAT_VALUE_STR_SUBCLASS;
+    }
+    return SPEC_FAIL_OTHER;
+}
+
+void
+_Py_Specialize_FormatValue(PyObject *value, _Py_CODEUNIT *instr, int oparg)
+{
+    assert(_PyOpcode_Caches[FORMAT_VALUE] == INLINE_CACHE_ENTRIES_FORMAT_VALUE);
+    _PyFormatValueCache *cache = (_PyFormatValueCache *)(instr + 1);
+    int conversion = oparg & FVC_MASK;
+    if ((oparg & FVS_MASK) == FVS_HAVE_SPEC) {
+        SPECIALIZATION_FAIL(FORMAT_VALUE, SPEC_FAIL_FORMAT_VALUE_FORMAT_SPEC);
+        goto fail;
+    }
+    if (PyUnicode_CheckExact(value)) {
+        if (conversion == FVC_NONE || conversion == FVC_STR) {
+            _Py_SET_OPCODE(*instr, FORMAT_VALUE_STR);
+            goto success;
+        }
+        SPECIALIZATION_FAIL(FORMAT_VALUE, SPEC_FAIL_FORMAT_VALUE_STR_CONVERSION);
+        goto fail;
+    }
+    if (PyLong_CheckExact(value)) {
+        _Py_SET_OPCODE(*instr, FORMAT_VALUE_INT);
+        goto success;
+    }
+    if (PyFloat_CheckExact(value)) {
+        _Py_SET_OPCODE(*instr, FORMAT_VALUE_FLOAT);
+        goto success;
+    }
+    SPECIALIZATION_FAIL(FORMAT_VALUE, format_value_fail_kind(value));
+fail:
+    STAT_INC(FORMAT_VALUE, failure);
+    SPECIALIZATION_ATTEMPT(instr, 0);
+    _Py_SET_OPCODE(*instr, FORMAT_VALUE);
+    cache->counter = adaptive_counter_backoff(cache->counter);
+    return;
+success:
+    STAT_INC(FORMAT_VALUE, success);
+    SPECIALIZATION_ATTEMPT(instr, 1);
+    cache->counter = adaptive_counter_cooldown();
+}
+
+static int
+call_function_ex_fail_kind(PyObject *func)
+{
+    if (PyMethod_Check(func)) {
+        return SPEC_FAIL_CALL_FUNCTION_EX_BOUND_METHOD;
+    }
+    if (PyCFunction_Check(func) || Py_IS_TYPE(func, &PyMethodDescr_Type)) {
+        return SPEC_FAIL_CALL_FUNCTION_EX_BUILTIN;
+    }
+    if (PyType_Check(func)) {
+        return SPEC_FAIL_CALL_FUNCTION_EX_CLASS;
+    }
+    if (PyFunction_Check(func)) {
+        return SPEC_FAIL_CALL_FUNCTION_EX_PY_OTHER;
+    }
+    return SPEC_FAIL_OTHER;
+}
+
+void
+_Py_Specialize_CallFunctionEx(PyObject *func, PyObject *callargs,
+                              _Py_CODEUNIT *instr)
+{
+    assert(_PyOpcode_Caches[CALL_FUNCTION_EX] ==
+           INLINE_CACHE_ENTRIES_CALL_FUNCTION_EX);
+    _PyCallFunctionExCache *cache = (_PyCallFunctionExCache *)(instr + 1);
+    if (!PyTuple_CheckExact(callargs)) {
+        SPECIALIZATION_FAIL(CALL_FUNCTION_EX,
+                            SPEC_FAIL_CALL_FUNCTION_EX_ARGS_NOT_TUPLE);
+        goto fail;
+    }
+    if (Py_IS_TYPE(func, &PyFunction_Type) &&
+        ((PyFunctionObject *)func)->vectorcall == _PyFunction_Vectorcall &&
+        _PyInterpreterState_GET()->eval_frame == NULL)
+    {
+        _Py_SET_OPCODE(*instr, CALL_FUNCTION_EX_PY);
+        goto success;
+    }
+    SPECIALIZATION_FAIL(CALL_FUNCTION_EX, call_function_ex_fail_kind(func));
+fail:
+    STAT_INC(CALL_FUNCTION_EX, failure);
+    SPECIALIZATION_ATTEMPT(instr, 0);
+    _Py_SET_OPCODE(*instr, CALL_FUNCTION_EX);
+    cache->counter = adaptive_counter_backoff(cache->counter);
+    return;
+success:
+    STAT_INC(CALL_FUNCTION_EX, success);
+    SPECIALIZATION_ATTEMPT(instr, 1);
+    cache->counter = adaptive_counter_cooldown();
+}
+
+
+/* Specialization profiles
+ *
+ * A profile records which adaptive instructions of each code object had
+ * specialized, and which had failed to and backed off. When a code object
+ * with the same bytecode is created again, typically by loading the same
+ * .pyc in a new process, its counters are primed from the profile:
+ * instructions that specialized before are specialized the first time they
+ * run rather than after warming up, and ones that failed don't try again
+ * until they have backed off as far as before. The specializer still checks
+ * the actual operands, and specialized instructions keep their guards, so a
+ * stale profile only costs time.
+ *
+ * Type and function versions and the other values in the inline caches are
+ * only meaningful in the process that assigned them, so it's these hints
+ * that are persisted rather than the specialized instructions themselves.
+ *
+ * A profile file is the marshalled tuple (magic, {key: hints}), where magic
+ * is the .pyc magic number, key is a hash of the code object's file name,
+ * qualified name, first line number and bytecode, and hints[i] is the hint
+ * for the instruction at index i.
+ */
+
+// The instruction had specialized; any other non-zero hint is the backoff
+// exponent it had reached by failing to.
+#define HINT_SPECIALIZED 1
+
+static uint64_t
+profile_hash(uint64_t hash, const void *data, size_t size)
+{
+    // FNV-1a, which unlike PyObject_Hash() is the same in every process
+    const unsigned char *bytes = data;
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ bytes[i]) * 0x100000001b3;
+    }
+    return hash;
+}
+
+static uint64_t
+profile_key(PyCodeObject *code)
+{
+    uint64_t hash = 0xcbf29ce484222325;
+    PyObject *names[2] = {code->co_filename, code->co_qualname};
+    for (int i = 0; i < 2; i++) {
+        hash = profile_hash(hash, PyUnicode_DATA(names[i]),
+                            PyUnicode_GET_LENGTH(names[i]) *
+                            PyUnicode_KIND(names[i]));
+    }
+    hash = profile_hash(hash, &code->co_firstlineno, sizeof(int));
+    _Py_CODEUNIT *instructions = _PyCode_CODE(code);
+    for (int i = 0; i < Py_SIZE(code); i++) {
+        int opcode = _Py_GetBaseOpcode(code, i);
+        unsigned char unit[2] = {opcode, _Py_OPARG(instructions[i])};
+        hash = profile_hash(hash, unit, sizeof(unit));
+        i += _PyOpcode_Caches[opcode];
+    }
+    return hash;
+}
+
+// Return the hints for code, or NULL if there are none (with no exception
+// set) or on error.
+static PyObject *
+get_profile_hints(PyCodeObject *code)
+{
+    PyObject *hints = NULL;
+    _Py_CODEUNIT *instructions = _PyCode_CODE(code);
+    for (int i = 0; i < Py_SIZE(code); i++) {
+        int opcode = _Py_GetOriginalOpcode(code, i);
+        int base = _PyOpcode_Deopt[opcode];
+        int caches = _PyOpcode_Caches[base];
+        if (caches == 0) {
+            continue;
+        }
+        int hint = 0;
+        if (opcode != base) {
+            hint = HINT_SPECIALIZED;
+        }
+        else {
+            int backoff = instructions[i + 1] & ((1<<ADAPTIVE_BACKOFF_BITS)-1);
+            int initial = base == JUMP_BACKWARD ? ADAPTIVE_BACK_EDGE_BACKOFF
+                                                : ADAPTIVE_WARMUP_BACKOFF;
+            if (backoff > initial) {
+                hint = backoff;
+            }
+        }
+        if (hint) {
+            if (hints == NULL) {
+                hints = PyBytes_FromStringAndSize(NULL, Py_SIZE(code));
+                if (hints == NULL) {
+                    return NULL;
+                }
+                memset(PyBytes_AS_STRING(hints), 0, Py_SIZE(code));
+            }
+            PyBytes_AS_STRING(hints)[i] = (char)hint;
+        }
+        i += caches;
+    }
+    return hints;
+}
+
+void
+_PySpecializationProfile_CodeCreated(PyInterpreterState *interp,
+                                     PyCodeObject *code)
+{
+    struct _Py_specialization_profile_state *state =
+        &interp->specialization_profile;
+    assert(state->codes != NULL);
+    // Without memory to remember it, code just can't be dumped.
+    (void)_Py_hashtable_set(state->codes, code, code);
+    PyObject *hints = _Py_hashtable_get(state->hints,
+                                        (void *)(uintptr_t)profile_key(code));
+    if (hints == NULL || PyBytes_GET_SIZE(hints) != Py_SIZE(code)) {
+        return;
+    }
+    const char *hint = PyBytes_AS_STRING(hints);
+    _Py_CODEUNIT *instructions = _PyCode_CODE(code);
+    for (int i = 0; i < Py_SIZE(code); i++) {
+        int opcode = _PyOpcode_Deopt[_Py_OPCODE(instructions[i])];
+        int caches = _PyOpcode_Caches[opcode];
+        if (caches == 0) {
+            continue;
+        }
+        if (hint[i] == HINT_SPECIALIZED) {
+            instructions[i + 1] = opcode == JUMP_BACKWARD ?
+                adaptive_counter_warmup() :
+                adaptive_counter_bits(0, ADAPTIVE_WARMUP_BACKOFF);
+        }
+        else if (hint[i] > 0 && hint[i] <= MAX_BACKOFF_VALUE) {
+            instructions[i + 1] = adaptive_counter_bits((1 << hint[i]) - 1,
+                                                        hint[i]);
+        }
+        i += caches;
+    }
+}
+
+void
+_PySpecializationProfile_CodeDestroyed(PyInterpreterState *interp,
+                                       PyCodeObject *code)
+{
+    assert(interp->specialization_profile.codes != NULL);
+    (void)_Py_hashtable_steal(interp->specialization_profile.codes, code);
+}
+
+static void
+decref_hints(void *hints)
+{
+    Py_DECREF((PyObject *)hints);
+}
+
+static PyObject *
+read_profile(PyObject *path)
+{
+    FILE *fp = _Py_fopen_obj(path, "rb");
+    if (fp == NULL) {
+        return NULL;
+    }
+    PyObject *profile = PyMarshal_ReadObjectFromFile(fp);
+    fclose(fp);
+    if (profile == NULL) {
+        return NULL;
+    }
+    PyObject *magic = PyLong_FromLong(PyImport_GetMagicNumber());
+    if (magic == NULL) {
+        Py_DECREF(profile);
+        return NULL;
+    }
+    int ok = (PyTuple_CheckExact(profile) && PyTuple_GET_SIZE(profile) == 2 &&
+              PyDict_CheckExact(PyTuple_GET_ITEM(profile, 1)));
+    if (ok) {
+        ok = PyObject_RichCompareBool(PyTuple_GET_ITEM(profile, 0), magic,
+                                      Py_EQ);
+    }
+    Py_DECREF(magic);
+    if (ok <= 0) {
+        if (ok == 0) {
+            PyErr_Format(PyExc_ValueError,
+                         "%R is not a specialization profile for this "
+                         "version of Python", path);
+        }
+        Py_DECREF(profile);
+        return NULL;
+    }
+    PyObject *hints = Py_NewRef(PyTuple_GET_ITEM(profile, 1));
+    Py_DECREF(profile);
+    return hints;
+}
+
+int
+_PySpecializationProfile_Load(PyInterpreterState *interp, PyObject *path)
+{
+    struct _Py_specialization_profile_state *state =
+        &interp->specialization_profile;
+    PyObject *profile = read_profile(path);
+    if (profile == NULL) {
+        return -1;
+    }
+    _Py_hashtable_t *hints = _Py_hashtable_new_full(
+        _Py_hashtable_hash_ptr, _Py_hashtable_compare_direct,
+        NULL, decref_hints, NULL);
+    if (hints == NULL) {
+        Py_DECREF(profile);
+        PyErr_NoMemory();
+        return -1;
+    }
+    Py_ssize_t pos = 0;
+    PyObject *key, *value;
+    while (PyDict_Next(profile, &pos, &key, &value)) {
+        if (!PyLong_CheckExact(key) || !PyBytes_CheckExact(value)) {
+            continue;
+        }
+        uint64_t hash = PyLong_AsUnsignedLongLongMask(key);
+        if (hash == (uint64_t)-1 && PyErr_Occurred()) {
+            goto error;
+        }
+        if (_Py_hashtable_set(hints, (void *)(uintptr_t)hash,
+                              Py_NewRef(value)) < 0)
+        {
+            Py_DECREF(value);
+            PyErr_NoMemory();
+            goto error;
+        }
+    }
+    if (state->codes == NULL) {
+        state->codes = _Py_hashtable_new(_Py_hashtable_hash_ptr,
+                                         _Py_hashtable_compare_direct);
+        if (state->codes == NULL) {
+            PyErr_NoMemory();
+            goto error;
+        }
+    }
+    if (state->hints != NULL) {
+        _Py_hashtable_destroy(state->hints);
+    }
+    state->hints = hints;
+    Py_DECREF(profile);
+    return 0;
+
+error:
+    _Py_hashtable_destroy(hints);
+    Py_DECREF(profile);
+    return -1;
+}
+
+static int
+add_code_hints(_Py_hashtable_t *codes, const void *code, const void *value,
+               void *profile)
+{
+    PyObject *hints = get_profile_hints((PyCodeObject *)code);
+    if (hints == NULL) {
+        return PyErr_Occurred() ? -1 : 0;
+    }
+    PyObject *key = PyLong_FromUnsignedLongLong(
+        profile_key((PyCodeObject *)code));
+    if (key == NULL) {
+        Py_DECREF(hints);
+        return -1;
+    }
+    int res = PyDict_SetItem((PyObject *)profile, key, hints);
+    Py_DECREF(key);
+    Py_DECREF(hints);
+    return res;
+}
+
+static int
+add_loaded_hints(_Py_hashtable_t *loaded, const void *key, const void *hints,
+                 void *profile)
+{
+    PyObject *pykey = PyLong_FromUnsignedLongLong((uintptr_t)key);
+    if (pykey == NULL) {
+        return -1;
+    }
+    int res = PyDict_SetItem((PyObject *)profile, pykey, (PyObject *)hints);
+    Py_DECREF(pykey);
+    return res;
+}
+
+static int
+profile_replace(PyObject *src, PyObject *dst)
+{
+#ifdef MS_WINDOWS
+    wchar_t *wsrc = PyUnicode_AsWideCharString(src, NULL);
+    if (wsrc == NULL) {
+        return -1;
+    }
+    wchar_t *wdst = PyUnicode_AsWideCharString(dst, NULL);
+    if (wdst == NULL) {
+        PyMem_Free(wsrc);
+        return -1;
+    }
+    BOOL ok;
+    Py_BEGIN_ALLOW_THREADS
+    ok = MoveFileExW(wsrc, wdst, MOVEFILE_REPLACE_EXISTING);
+    Py_END_ALLOW_THREADS
+    PyMem_Free(wsrc);
+    PyMem_Free(wdst);
+    if (!ok) {
+        PyErr_SetExcFromWindowsErrWithFilenameObjects(PyExc_OSError, 0,
+                                                      src, dst);
+        return -1;
+    }
+#else
+    PyObject *bsrc, *bdst;
+    if (!PyUnicode_FSConverter(src, &bsrc)) {
+        return -1;
+    }
+    if (!PyUnicode_FSConverter(dst, &bdst)) {
+        Py_DECREF(bsrc);
+        return -1;
+    }
+    int res;
+    Py_BEGIN_ALLOW_THREADS
+    res = rename(PyBytes_AS_STRING(bsrc), PyBytes_AS_STRING(bdst));
+    Py_END_ALLOW_THREADS
+    Py_DECREF(bsrc);
+    Py_DECREF(bdst);
+    if (res != 0) {
+        PyErr_SetFromErrnoWithFilenameObjects(PyExc_OSError, src, dst);
+        return -1;
+    }
+#endif
+    return 0;
+}
+
+int
+_PySpecializationProfile_Dump(PyInterpreterState *interp, PyObject *path)
+{
+    struct _Py_specialization_profile_state *state =
+        &interp->specialization_profile;
+    if (state->codes == NULL) {
+        PyErr_SetString(PyExc_RuntimeError,
+                        "no specialization profile has been loaded");
+        return -1;
+    }
+    // Hints for code objects that are still alive replace the loaded ones
+    PyObject *hints = PyDict_New();
+    if (hints == NULL) {
+        return -1;
+    }
+    if (_Py_hashtable_foreach(state->hints, add_loaded_hints, hints) < 0 ||
+        _Py_hashtable_foreach(state->codes, add_code_hints, hints) < 0)
+    {
+        Py_DECREF(hints);
+        return -1;
+    }
+    PyObject *profile = Py_BuildValue("(lN)", PyImport_GetMagicNumber(),
+                                      hints);
+    if (profile == NULL) {
+        return -1;
+    }
+    // Several processes may share a profile, so write it to a temporary file
+    // and move that into place.
+#ifdef MS_WINDOWS
+    long pid = (long)GetCurrentProcessId();
+#else
+    long pid = (long)getpid();
+#endif
+    PyObject *tmp = PyUnicode_FromFormat("%U.%ld.tmp", path, pid);
+    if (tmp == NULL) {
+        Py_DECREF(profile);
+        return -1;
+    }
+    FILE *fp = _Py_fopen_obj(tmp, "wb");
+    if (fp == NULL) {
+        goto error;
+    }
+    PyMarshal_WriteObjectToFile(profile, fp, Py_MARSHAL_VERSION);
+    int failed = ferror(fp);
+    if (fclose(fp) != 0 || failed) {
+        PyErr_SetFromErrnoWithFilenameObject(PyExc_OSError, tmp);
+        goto error;
+    }
+    if (profile_replace(tmp, path) < 0) {
+        goto error;
+    }
+    Py_DECREF(tmp);
+    Py_DECREF(profile);
+    return 0;
+
+error:
+    Py_DECREF(tmp);
+    Py_DECREF(profile);
+    return -1;
+}
+
+PyStatus
+_PySpecializationProfile_Init(PyInterpreterState *interp)
+{
+    const char *path = _Py_GetEnv(interp->config.use_environment,
+                                  "PYTHONSPECIALIZATIONPROFILE");
+    if (path == NULL) {
+        return _PyStatus_OK();
+    }
+    struct _Py_specialization_profile_state *state =
+        &interp->specialization_profile;
+    state->path = PyUnicode_DecodeFSDefault(path);
+    if (state->path == NULL) {
+        return _PyStatus_ERR("can't decode PYTHONSPECIALIZATIONPROFILE");
+    }
+    if (_PySpecializationProfile_Load(interp, state->path) == 0) {
+        return _PyStatus_OK();
+    }
+    // The file may not have been written yet, or be for another version of
+    // Python; either way it gets replaced at exit.
+    PyErr_Clear();
+    assert(state->hints == NULL && state->codes == NULL);
+    state->hints = _Py_hashtable_new_full(
+        _Py_hashtable_hash_ptr, _Py_hashtable_compare_direct,
+        NULL, decref_hints, NULL);
+    state->codes = _Py_hashtable_new(_Py_hashtable_hash_ptr,
+                                     _Py_hashtable_compare_direct);
+    if (state->hints == NULL || state->codes == NULL) {
+        return _PyStatus_NO_MEMORY();
+    }
+    return _PyStatus_OK();
+}
+
+void
+_PySpecializationProfile_AtExit(PyInterpreterState *interp)
+{
+    PyObject *path = interp->specialization_profile.path;
+    if (path != NULL && _PySpecializationProfile_Dump(interp, path) < 0) {
+        _PyErr_WriteUnraisableMsg("while writing the specialization profile",
+                                  NULL);
+    }
+}
+
+void
+_PySpecializationProfile_Fini(PyInterpreterState *interp)
+{
+    struct _Py_specialization_profile_state *state =
+        &interp->specialization_profile;
+    if (state->codes != NULL) {
+        _Py_hashtable_destroy(state->codes);
+        state->codes = NULL;
+    }
+    if (state->hints != NULL) {
+        _Py_hashtable_destroy(state->hints);
+        state->hints = NULL;
+    }
+    Py_CLEAR(state->path);
+}
+
+/* Specialization telemetry
+ *
+ * While it is on, the specializer counts its successes and failures, with
+ * the SPEC_FAIL kind of each failure, and DEOPT_IF() counts the misses of
+ * specialized instructions and the deoptimizations they lead to. The counts
+ * are kept for each opcode, as Py_STATS does, and for each instruction of
+ * each code object, so that it's possible to see which instructions of a
+ * function keep deoptimizing and why. The counts of a code object are
+ * discarded with it.
+ *
+ * Unlike Py_STATS this is available in every build; when it's off, the cost
+ * is a test when a specialized instruction misses or an instruction fails to
+ * specialize.
+ */
+
+struct _PySpecializationCounts {
+    uint64_t success;
+    uint64_t failure;
+    uint64_t miss;
+    uint64_t deopt;
+    uint64_t failure_kinds[SPECIALIZATION_FAILURE_KINDS];
+};
+
+// An instruction only records which kinds of failure it has seen
+struct _PyInstructionCounts {
+    int opcode;
+    uint64_t success;
+    uint64_t failure;
+    uint64_t miss;
+    uint64_t deopt;
+    uint64_t failure_kinds;
+};
+
+static struct _PyInstructionCounts *
+get_instruction_counts(struct _Py_specialization_telemetry_state *state,
+                       PyCodeObject *code, _Py_CODEUNIT *instr)
+{
+    Py_ssize_t index = instr - _PyCode_CODE(code);
+    if (index < 0 || index >= Py_SIZE(code)) {
+        return NULL;
+    }
+    if (code == state->last_code) {
+        return &state->last_counts[index];
+    }
+    // Without memory for them, the counts of code just aren't kept.
+    if (state->codes == NULL) {
+        state->codes = _Py_hashtable_new_full(
+            _Py_hashtable_hash_ptr, _Py_hashtable_compare_direct,
+            NULL, PyMem_Free, NULL);
+        if (state->codes == NULL) {
+            return NULL;
+        }
+    }
+    struct _PyInstructionCounts *counts = _Py_hashtable_get(state->codes,
+                                                            code);
+    if (counts == NULL) {
+        counts = PyMem_Calloc(Py_SIZE(code), sizeof(*counts));
+        if (counts == NULL) {
+            return NULL;
+        }
+        if (_Py_hashtable_set(state->codes, code, counts) < 0) {
+            PyMem_Free(counts);
+            return NULL;
+        }
+    }
+    state->last_code = code;
+    state->last_counts = counts;
+    return &counts[index];
+}
+
+static void
+record_attempt(PyInterpreterState *interp, _Py_CODEUNIT *instr, int success)
+{
+    struct _Py_specialization_telemetry_state *state =
+        &interp->specialization_telemetry;
+    assert(state->enabled && state->opcodes != NULL);
+    int opcode = _PyOpcode_Deopt[_Py_OPCODE(*instr)];
+    struct _PySpecializationCounts *opcode_counts = &state->opcodes[opcode];
+    // The specializer is only given the instruction, which is part of the
+    // code object that is running.
+    _PyInterpreterFrame *frame = _PyThreadState_GET()->cframe->current_frame;
+    struct _PyInstructionCounts *counts = NULL;
+    if (frame != NULL) {
+        counts = get_instruction_counts(state, frame->f_code, instr);
+    }
+    if (counts != NULL) {
+        counts->opcode = opcode;
+    }
+    if (success) {
+        opcode_counts->success++;
+        if (counts != NULL) {
+            counts->success++;
+        }
+    }
+    else {
+        int kind = state->failure_kind;
+        opcode_counts->failure++;
+        opcode_counts->failure_kinds[kind]++;
+        if (counts != NULL) {
+            counts->failure++;
+            counts->failure_kinds |= (uint64_t)1 << kind;
+        }
+    }
+}
+
+void
+_PySpecializationTelemetry_RecordMiss(PyInterpreterState *interp,
+                                      PyCodeObject *code, _Py_CODEUNIT *instr,
+                                      int opcode, int deopt)
+{
+    struct _Py_specialization_telemetry_state *state =
+        &interp->specialization_telemetry;
+    assert(state->enabled && state->opcodes != NULL);
+    struct _PyInstructionCounts *counts = get_instruction_counts(state, code,
+                                                                 instr);
+    state->opcodes[opcode].miss++;
+    if (counts != NULL) {
+        counts->opcode = opcode;
+        counts->miss++;
+    }
+    if (deopt) {
+        state->opcodes[opcode].deopt++;
+        if (counts != NULL) {
+            counts->deopt++;
+        }
+    }
+}
+
+void
+_PySpecializationTelemetry_CodeDestroyed(PyInterpreterState *interp,
+                                         PyCodeObject *code)
+{
+    struct _Py_specialization_telemetry_state *state =
+        &interp->specialization_telemetry;
+    assert(state->codes != NULL);
+    if (code == state->last_code) {
+        state->last_code = NULL;
+        state->last_counts = NULL;
+    }
+    PyMem_Free(_Py_hashtable_steal(state->codes, code));
+}
+
+int
+_PySpecializationTelemetry_Enable(PyInterpreterState *interp, int enabled)
+{
+    struct _Py_specialization_telemetry_state *state =
+        &interp->specialization_telemetry;
+    if (enabled && state->opcodes == NULL) {
+        state->opcodes = PyMem_Calloc(256, sizeof(*state->opcodes));
+        if (state->opcodes == NULL) {
+            PyErr_NoMemory();
+            return -1;
+        }
+    }
+    state->enabled = enabled;
+    return 0;
+}
+
+void
+_PySpecializationTelemetry_Clear(PyInterpreterState *interp)
+{
+    struct _Py_specialization_telemetry_state *state =
+        &interp->specialization_telemetry;
+    if (state->codes != NULL) {
+        _Py_hashtable_destroy(state->codes);
+        state->codes = NULL;
+    }
+    state->last_code = NULL;
+    state->last_counts = NULL;
+    if (state->opcodes != NULL) {
+        memset(state->opcodes, 0, 256 * sizeof(*state->opcodes));
+    }
+}
+
+static PyObject *
+instruction_counts_to_dict(struct _PyInstructionCounts *counts)
+{
+    PyObject *kinds = PyList_New(0);
+    if (kinds == NULL) {
+        return NULL;
+    }
+    for (int kind = 0; kind < SPECIALIZATION_FAILURE_KINDS; kind++) {
+        if (counts->failure_kinds & ((uint64_t)1 << kind)) {
+            PyObject *item = PyLong_FromLong(kind);
+            if (item == NULL || PyList_Append(kinds, item) < 0) {
+                Py_XDECREF(item);
+                Py_DECREF(kinds);
+                return NULL;
+            }
+            Py_DECREF(item);
+        }
+    }
+    Py_SETREF(kinds, PyList_AsTuple(kinds));
+    if (kinds == NULL) {
+        return NULL;
+    }
+    return Py_BuildValue("{sKsKsKsKsN}",
+                         "success", (unsigned long long)counts->success,
+                         "failure", (unsigned long long)counts->failure,
+                         "miss", (unsigned long long)counts->miss,
+                         "deopt", (unsigned long long)counts->deopt,
+                         "failure_kinds", kinds);
+}
+
+PyObject *
+_PySpecializationTelemetry_GetCounts(PyInterpreterState *interp,
+                                     PyCodeObject *code)
+{
+    struct _Py_specialization_telemetry_state *state =
+        &interp->specialization_telemetry;
+    PyObject *result = PyDict_New();
+    if (result == NULL || state->codes == NULL) {
+        return result;
+    }
+    struct _PyInstructionCounts *counts = _Py_hashtable_get(state->codes,
+                                                            code);
+    if (counts == NULL) {
+        return result;
+    }
+    for (int i = 0; i < Py_SIZE(code); i++) {
+        if (counts[i].success == 0 && counts[i].failure == 0 &&
+            counts[i].miss == 0)
+        {
+            continue;
+        }
+        PyObject *offset = PyLong_FromLong(i * (int)sizeof(_Py_CODEUNIT));
+        if (offset == NULL) {
+            goto error;
+        }
+        PyObject *item = instruction_counts_to_dict(&counts[i]);
+        if (item == NULL) {
+            Py_DECREF(offset);
+            goto error;
+        }
+        int err = PyDict_SetItem(result, offset, item);
+        Py_DECREF(offset);
+        Py_DECREF(item);
+        if (err < 0) {
+            goto error;
+        }
+    }
+    return result;
+
+error:
+    Py_DECREF(result);
+    return NULL;
+}
+
+static const char *const count_names[] = {
+    "success", "failure", "miss", "deopt",
+};
+
+// The same format as _Py_PrintSpecializationStats(), so that
+// Tools/scripts/summarize_stats.py can read both.
+static void
+print_opcode_counts(FILE *out, struct _PySpecializationCounts *counts)
+{
+    for (int i = 0; i < 256; i++) {
+        struct _PySpecializationCounts *c = &counts[i];
+        if (_PyOpcode_Caches[i]) {
+            fprintf(out, "opcode[%d].specializable : 1\n", i);
+        }
+        uint64_t values[] = {c->success, c->failure, c->miss, c->deopt};
+        for (int j = 0; j < (int)Py_ARRAY_LENGTH(values); j++) {
+            if (values[j]) {
+                fprintf(out, "    opcode[%d].specialization.%s : %" PRIu64
+                        "\n", i, count_names[j], values[j]);
+            }
+        }
+        for (int j = 0; j < SPECIALIZATION_FAILURE_KINDS; j++) {
+            if (c->failure_kinds[j]) {
+                fprintf(out, "    opcode[%d].specialization.failure_kinds[%d]"
+                        " : %" PRIu64 "\n", i, j, c->failure_kinds[j]);
+            }
+        }
+    }
+}
+
+static int
+print_code_counts(_Py_hashtable_t *codes, const void *key, const void *value,
+                  void *out)
+{
+    PyCodeObject *code = (PyCodeObject *)key;
+    const struct _PyInstructionCounts *counts = value;
+    PyObject *label = PyUnicode_FromFormat("%U (%U:%d)", code->co_qualname,
+                                           code->co_filename,
+                                           code->co_firstlineno);
+    if (label == NULL) {
+        return -1;
+    }
+    const char *name = PyUnicode_AsUTF8(label);
+    if (name == NULL) {
+        Py_DECREF(label);
+        return -1;
+    }
+    for (int i = 0; i < Py_SIZE(code); i++) {
+        const struct _PyInstructionCounts *c = &counts[i];
+        int offset = i * (int)sizeof(_Py_CODEUNIT);
+        uint64_t values[] = {c->success, c->failure, c->miss, c->deopt};
+        for (int j = 0; j < (int)Py_ARRAY_LENGTH(values); j++) {
+            if (values[j]) {
+                fprintf(out, "code[%s].offset[%d].opcode[%d].specialization.%s"
+                        " : %" PRIu64 "\n",
+                        name, offset, c->opcode, count_names[j], values[j]);
+            }
+        }
+        for (int j = 0; j < SPECIALIZATION_FAILURE_KINDS; j++) {
+            if (c->failure_kinds & ((uint64_t)1 << j)) {
+                fprintf(out, "code[%s].offset[%d].opcode[%d].specialization."
+                        "failure_kinds[%d] : 1\n", name, offset, c->opcode, j);
+            }
+        }
+    }
+    Py_DECREF(label);
+    return 0;
+}
+
+PyObject *
+_PySpecializationTelemetry_Dump(PyInterpreterState *interp, PyObject *dirname)
+{
+    struct _Py_specialization_telemetry_state *state =
+        &interp->specialization_telemetry;
+    // Use a random 160 bit number as the file name, as Py_STATS does.
+    unsigned char rand[20];
+    char hex_name[41];
+    if (_PyOS_URandomNonblock(rand, 20) < 0) {
+        return NULL;
+    }
+    for (int i = 0; i < 20; i++) {
+        hex_name[2*i] = "0123456789abcdef"[rand[i]&15];
+        hex_name[2*i+1] = "0123456789abcdef"[(rand[i]>>4)&15];
+    }
+    hex_name[40] = '\0';
+    PyObject *path;
+    if (dirname == NULL) {
+#ifdef MS_WINDOWS
+        path = PyUnicode_FromFormat("c:\\temp\\py_stats\\%s.txt", hex_name);
+#else
+        path = PyUnicode_FromFormat("/tmp/py_stats/%s.txt", hex_name);
+#endif
+    }
+    else {
+        path = PyUnicode_FromFormat("%U%c%s.txt", dirname, (int)SEP, hex_name);
+    }
+    if (path == NULL) {
+        return NULL;
+    }
+    FILE *out = _Py_fopen_obj(path, "w");
+    if (out == NULL) {
+        Py_DECREF(path);
+        return NULL;
+    }
+    if (state->opcodes != NULL) {
+        print_opcode_counts(out, state->opcodes);
+    }
+    if (state->codes != NULL &&
+        _Py_hashtable_foreach(state->codes, print_code_counts, out) < 0)
+    {
+        fclose(out);
+        Py_DECREF(path);
+        return NULL;
+    }
+    int failed = ferror(out);
+    if (fclose(out) != 0 || failed) {
+        PyErr_SetFromErrnoWithFilenameObject(PyExc_OSError, path);
+        Py_DECREF(path);
+        return NULL;
+    }
+    _PySpecializationTelemetry_Clear(interp);
+    return path;
+}
+
+void
+_PySpecializationTelemetry_Fini(PyInterpreterState *interp)
+{
+    struct _Py_specialization_telemetry_state *state =
+        &interp->specialization_telemetry;
+    _PySpecializationTelemetry_Clear(interp);
+    state->enabled = 0;
+    PyMem_Free(state->opcodes);
+    state->opcodes = NULL;
+}
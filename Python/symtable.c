@@ -102,6 +102,7 @@ ste_new(struct symtable *st, identifier name, _Py_block_ty block,
     ste->ste_generator = 0;
     ste->ste_coroutine = 0;
     ste->ste_comprehension = NoComprehension;
+    ste->ste_comp_inlined = 0;
     ste->ste_returns_value = 0;
     ste->ste_needs_class_closure = 0;
     ste->ste_comp_iter_target = 0;
@@ -559,8 +560,6 @@ analyze_name(PySTEntryObject *ste, PyObject *scopes, PyObject *name, long flags,
     return 1;
 }
 
-#undef SET_SCOPE
-
 /* If a name is defined in free and also in locals, then this block
    provides the binding for the free variable.  The name should be
    marked CELL in this block and removed from the free list.
@@ -706,6 +705,148 @@ update_symbols(PyObject *symbols, PyObject *scopes,
     return 0;
 }
 
+static int
+is_free_in_any_child(PySTEntryObject *entry, PyObject *key)
+{
+    for (Py_ssize_t i = 0; i < PyList_GET_SIZE(entry->ste_children); i++) {
+        PySTEntryObject *child_ste = (PySTEntryObject *)PyList_GET_ITEM(
+            entry->ste_children, i);
+        if (_PyST_GetScope(child_ste, key) == FREE) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* Decide whether the list, set or dict comprehension comp can be inlined
+   into the frame of the function block ste that encloses it.
+
+   The names bound by the comprehension become plain locals of the
+   function, which the compiler saves and restores around the inlined
+   code.  That is only safe if those names are not already used by the
+   function in some other way and are not captured by any closure.
+   Every other name of the comprehension must resolve to the same kind
+   of variable in the function.
+
+   scopes holds the scopes of the names of ste, local the names that ste
+   binds itself and children_free the free variables of all of ste's
+   children.
+
+   Returns 1 if the comprehension can be inlined, 0 if it cannot and -1
+   on error.
+*/
+static int
+can_inline_comprehension(PySTEntryObject *ste, PySTEntryObject *comp,
+                         PyObject *scopes, PyObject *local,
+                         PyObject *children_free)
+{
+    PyObject *name, *v;
+    Py_ssize_t pos = 0;
+
+    if (ste->ste_type != FunctionBlock ||
+        comp->ste_comprehension == NoComprehension ||
+        comp->ste_comprehension == GeneratorExpression) {
+        return 0;
+    }
+    while (PyDict_Next(comp->ste_symbols, &pos, &name, &v)) {
+        long flags = PyLong_AS_LONG(v);
+        long scope = (flags >> SCOPE_OFFSET) & SCOPE_MASK;
+        if (flags & DEF_PARAM) {
+            /* The implicit argument holding the outermost iterator */
+            continue;
+        }
+        if (scope == CELL) {
+            return 0;
+        }
+        PyObject *v_outer = PyDict_GetItemWithError(scopes, name);
+        if (v_outer == NULL && PyErr_Occurred()) {
+            return -1;
+        }
+        long outer_scope = v_outer ? PyLong_AS_LONG(v_outer) : 0;
+        if ((flags & DEF_LOCAL) && !(flags & DEF_NONLOCAL)) {
+            if (v_outer != NULL && outer_scope != LOCAL) {
+                return 0;
+            }
+            int r = PySet_Contains(children_free, name);
+            if (r != 0) {
+                return r < 0 ? -1 : 0;
+            }
+        }
+        else if (scope == FREE && outer_scope == LOCAL) {
+            /* The name must be bound by ste itself, not by another
+               inlined comprehension */
+            int r = PySet_Contains(local, name);
+            if (r <= 0) {
+                return r;
+            }
+        }
+        else if (v_outer != NULL && outer_scope != scope) {
+            int is_global = (scope == GLOBAL_IMPLICIT ||
+                             scope == GLOBAL_EXPLICIT);
+            int outer_is_global = (outer_scope == GLOBAL_IMPLICIT ||
+                                   outer_scope == GLOBAL_EXPLICIT);
+            if (!(is_global && outer_is_global)) {
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+/* Merge the symbols of the comprehension comp into the enclosing function
+   block ste, after can_inline_comprehension() agreed.
+
+   Names of the comprehension that are not known to the function are
+   added to its symbols and scopes.  Free variables of the comprehension
+   that the function binds itself are removed from comp_free, unless a
+   closure inside the comprehension still needs them.
+*/
+static int
+inline_comprehension(PySTEntryObject *ste, PySTEntryObject *comp,
+                     PyObject *scopes, PyObject *comp_free)
+{
+    PyObject *name, *v;
+    Py_ssize_t pos = 0;
+
+    while (PyDict_Next(comp->ste_symbols, &pos, &name, &v)) {
+        long flags = PyLong_AS_LONG(v);
+        long scope = (flags >> SCOPE_OFFSET) & SCOPE_MASK;
+        if (flags & DEF_PARAM) {
+            continue;
+        }
+        PyObject *v_outer = PyDict_GetItemWithError(scopes, name);
+        if (v_outer == NULL) {
+            if (PyErr_Occurred()) {
+                return 0;
+            }
+            PyObject *v_flags = PyLong_FromLong(
+                flags & ~(SCOPE_MASK << SCOPE_OFFSET));
+            if (v_flags == NULL) {
+                return 0;
+            }
+            int res = PyDict_SetItem(ste->ste_symbols, name, v_flags);
+            Py_DECREF(v_flags);
+            if (res < 0) {
+                return 0;
+            }
+            SET_SCOPE(scopes, name, scope);
+            if (scope == FREE) {
+                ste->ste_free = 1;
+            }
+        }
+        else if (scope == FREE && PyLong_AS_LONG(v_outer) == LOCAL &&
+                 !is_free_in_any_child(comp, name)) {
+            if (PySet_Discard(comp_free, name) < 0) {
+                return 0;
+            }
+        }
+    }
+    comp->ste_comp_inlined = 1;
+    return 1;
+}
+
+#undef SET_SCOPE
+
 /* Make final symbol table decisions for block of ste.
 
    Arguments:
@@ -736,8 +877,10 @@ analyze_block(PySTEntryObject *ste, PyObject *bound, PyObject *free,
 {
     PyObject *name, *v, *local = NULL, *scopes = NULL, *newbound = NULL;
     PyObject *newglobal = NULL, *newfree = NULL, *allfree = NULL;
+    PyObject *child_frees = NULL;
     PyObject *temp;
-    int i, success = 0;
+    Py_ssize_t i, nchildren;
+    int success = 0;
     Py_ssize_t pos = 0;
 
     local = PySet_New(NULL);  /* collect new names bound in block */
@@ -832,19 +975,87 @@ analyze_block(PySTEntryObject *ste, PyObject *bound, PyObject *free,
     allfree = PySet_New(NULL);
     if (!allfree)
         goto error;
-    for (i = 0; i < PyList_GET_SIZE(ste->ste_children); ++i) {
+    nchildren = PyList_GET_SIZE(ste->ste_children);
+    child_frees = PyList_New(nchildren);
+    if (!child_frees)
+        goto error;
+    for (i = 0; i < nchildren; ++i) {
         PyObject *c = PyList_GET_ITEM(ste->ste_children, i);
         PySTEntryObject* entry;
         assert(c && PySTEntry_Check(c));
         entry = (PySTEntryObject*)c;
+        PyObject *child_free = PySet_New(NULL);
+        if (!child_free)
+            goto error;
+        PyList_SET_ITEM(child_frees, i, child_free);
         if (!analyze_child_block(entry, newbound, newfree, newglobal,
-                                 allfree))
+                                 child_free))
+            goto error;
+        temp = PyNumber_InPlaceOr(allfree, child_free);
+        if (!temp)
             goto error;
+        Py_DECREF(temp);
         /* Check if any children have free variables */
         if (entry->ste_free || entry->ste_child_free)
             ste->ste_child_free = 1;
     }
 
+    /* Inline list, set and dict comprehensions into function blocks.
+       The children of an inlined comprehension become children of this
+       block, and its free variables are recollected without the names
+       that this block binds itself.
+     */
+    if (ste->ste_type == FunctionBlock && nchildren > 0) {
+        int inlined = 0;
+        for (i = 0; i < nchildren; ++i) {
+            PySTEntryObject *entry =
+                (PySTEntryObject *)PyList_GET_ITEM(ste->ste_children, i);
+            int r = can_inline_comprehension(ste, entry, scopes, local,
+                                             allfree);
+            if (r < 0)
+                goto error;
+            if (r == 0)
+                continue;
+            if (!inline_comprehension(ste, entry, scopes,
+                                      PyList_GET_ITEM(child_frees, i)))
+                goto error;
+            inlined = 1;
+        }
+        if (inlined) {
+            PyObject *children = PyList_New(0);
+            if (!children)
+                goto error;
+            if (PySet_Clear(allfree) < 0) {
+                Py_DECREF(children);
+                goto error;
+            }
+            for (i = 0; i < nchildren; ++i) {
+                PySTEntryObject *entry =
+                    (PySTEntryObject *)PyList_GET_ITEM(ste->ste_children, i);
+                temp = PyNumber_InPlaceOr(allfree,
+                                          PyList_GET_ITEM(child_frees, i));
+                if (!temp) {
+                    Py_DECREF(children);
+                    goto error;
+                }
+                Py_DECREF(temp);
+                if (entry->ste_comp_inlined) {
+                    temp = entry->ste_children;
+                    if (PyList_SetSlice(children, PY_SSIZE_T_MAX,
+                                        PY_SSIZE_T_MAX, temp) < 0) {
+                        Py_DECREF(children);
+                        goto error;
+                    }
+                }
+                else if (PyList_Append(children, (PyObject *)entry) < 0) {
+                    Py_DECREF(children);
+                    goto error;
+                }
+            }
+            Py_SETREF(ste->ste_children, children);
+        }
+    }
+
     temp = PyNumber_InPlaceOr(newfree, allfree);
     if (!temp)
         goto error;
@@ -872,6 +1083,7 @@ analyze_block(PySTEntryObject *ste, PyObject *bound, PyObject *free,
     Py_XDECREF(newglobal);
     Py_XDECREF(newfree);
     Py_XDECREF(allfree);
+    Py_XDECREF(child_frees);
     if (!success)
         assert(PyErr_Occurred());
     return success;
@@ -17,8 +17,10 @@ Data members:
 #include "Python.h"
 #include "pycore_call.h"          // _PyObject_CallNoArgs()
 #include "pycore_ceval.h"         // _PyEval_SetAsyncGenFinalizer()
+#include "pycore_code.h"          // _PySpecializationProfile_Load()
 #include "pycore_frame.h"         // _PyInterpreterFrame
 #include "pycore_initconfig.h"    // _PyStatus_EXCEPTION()
+#include "pycore_instruments.h"   // _Py_CreateMonitoringObject()
 #include "pycore_long.h"          // _PY_LONG_MAX_STR_DIGITS_THRESHOLD
 #include "pycore_namespace.h"     // _PyNamespace_New()
 #include "pycore_object.h"        // _PyObject_IS_GC()
@@ -2088,6 +2090,151 @@ sys__stats_dump_impl(PyObject *module)
 
 #endif
 
+/*[clinic input]
+sys._load_specialization_profile
+
+    path: unicode
+    /
+
+Load a specialization profile written by _dump_specialization_profile().
+
+Code objects created from now on with the same bytecode as those in the
+profile start out specialized as far as they had been.
+[clinic start generated code]*/
+
+static PyObject *
+sys__load_specialization_profile_impl(PyObject *module, PyObject *path)
+/*[clinic end generated code: output=2f01b06b43de7d68 input=2f951e2f015723b0]*/
+{
+    PyInterpreterState *interp = _PyInterpreterState_GET();
+    if (_PySpecializationProfile_Load(interp, path) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+sys._dump_specialization_profile
+
+    path: unicode
+    /
+
+Write how far code objects have specialized to a specialization profile.
+
+This covers the loaded profile and the code objects created since it was
+loaded, with _load_specialization_profile() or PYTHONSPECIALIZATIONPROFILE.
+[clinic start generated code]*/
+
+static PyObject *
+sys__dump_specialization_profile_impl(PyObject *module, PyObject *path)
+/*[clinic end generated code: output=1f58c608720cf90d input=f16ac845bb95182b]*/
+{
+    PyInterpreterState *interp = _PyInterpreterState_GET();
+    if (_PySpecializationProfile_Dump(interp, path) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+sys._specialization_telemetry_on
+
+Turn on the specialization telemetry.
+[clinic start generated code]*/
+
+static PyObject *
+sys__specialization_telemetry_on_impl(PyObject *module)
+/*[clinic end generated code: output=0827c94b4433ca94 input=1cd464c93b34a5ca]*/
+{
+    PyInterpreterState *interp = _PyInterpreterState_GET();
+    if (_PySpecializationTelemetry_Enable(interp, 1) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+sys._specialization_telemetry_off
+
+Turn off the specialization telemetry, keeping what it has counted.
+[clinic start generated code]*/
+
+static PyObject *
+sys__specialization_telemetry_off_impl(PyObject *module)
+/*[clinic end generated code: output=fde1fc6484404bd8 input=e1d5a9d128edaec6]*/
+{
+    PyInterpreterState *interp = _PyInterpreterState_GET();
+    if (_PySpecializationTelemetry_Enable(interp, 0) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+sys._specialization_telemetry_clear
+
+Clear the counts of the specialization telemetry.
+[clinic start generated code]*/
+
+static PyObject *
+sys__specialization_telemetry_clear_impl(PyObject *module)
+/*[clinic end generated code: output=f48eb4b1382b1dd8 input=f05d32115eabb94e]*/
+{
+    _PySpecializationTelemetry_Clear(_PyInterpreterState_GET());
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+sys._specialization_telemetry_dump
+
+    dirname: object = None
+
+Write the specialization telemetry to a new file, and clear it.
+
+The file is created in the directory dirname, by default the one that
+Py_STATS builds write their stats to, in the format that
+Tools/scripts/summarize_stats.py reads.  Return the file's path.
+[clinic start generated code]*/
+
+static PyObject *
+sys__specialization_telemetry_dump_impl(PyObject *module, PyObject *dirname)
+/*[clinic end generated code: output=a9801175e404958e input=2729ec65f1815679]*/
+{
+    if (dirname == Py_None) {
+        dirname = NULL;
+    }
+    else if (!PyUnicode_Check(dirname)) {
+        PyErr_Format(PyExc_TypeError,
+                     "dirname must be a str or None, not %.200s",
+                     Py_TYPE(dirname)->tp_name);
+        return NULL;
+    }
+    return _PySpecializationTelemetry_Dump(_PyInterpreterState_GET(), dirname);
+}
+
+/*[clinic input]
+sys._get_specialization_telemetry
+
+    code: object(subclass_of='&PyCode_Type', type='PyCodeObject *')
+    /
+
+Return the specialization telemetry of a code object.
+
+This is a dict mapping the offset of each instruction the telemetry has
+counted something for to a dict of its counts: "success" and "failure" for
+attempts to specialize it, "miss" for times its specialized form didn't
+apply, "deopt" for those that made it specialize again, and "failure_kinds",
+the SPEC_FAIL kinds of its failures.
+[clinic start generated code]*/
+
+static PyObject *
+sys__get_specialization_telemetry_impl(PyObject *module, PyCodeObject *code)
+/*[clinic end generated code: output=214e583f86158140 input=fe2eca263a632806]*/
+{
+    return _PySpecializationTelemetry_GetCounts(_PyInterpreterState_GET(),
+                                                code);
+}
+
 #ifdef ANDROID_API_LEVEL
 /*[clinic input]
 sys.getandroidapilevel
@@ -2242,6 +2389,13 @@ static PyMethodDef sys_methods[] = {
     SYS__STATS_CLEAR_METHODDEF
     SYS__STATS_DUMP_METHODDEF
 #endif
+    SYS__LOAD_SPECIALIZATION_PROFILE_METHODDEF
+    SYS__DUMP_SPECIALIZATION_PROFILE_METHODDEF
+    SYS__SPECIALIZATION_TELEMETRY_ON_METHODDEF
+    SYS__SPECIALIZATION_TELEMETRY_OFF_METHODDEF
+    SYS__SPECIALIZATION_TELEMETRY_CLEAR_METHODDEF
+    SYS__SPECIALIZATION_TELEMETRY_DUMP_METHODDEF
+    SYS__GET_SPECIALIZATION_TELEMETRY_METHODDEF
     {NULL, NULL}  // sentinel
 };
 
@@ -3199,6 +3353,8 @@ _PySys_InitCore(PyThreadState *tstate, PyObject *sysdict)
     SET_SYS("path_importer_cache", PyDict_New());
     SET_SYS("path_hooks", PyList_New(0));
 
+    SET_SYS("monitoring", _Py_CreateMonitoringObject());
+
     if (_PyErr_Occurred(tstate)) {
         goto err_occurred;
     }
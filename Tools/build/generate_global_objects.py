@@ -354,13 +354,13 @@ def generate_static_strings_initializer(identifiers, strings):
         printer.write(before)
         printer.write(START)
         printer.write("static inline void")
-        with printer.block("_PyUnicode_InitStaticStrings(void)"):
+        with printer.block("_PyUnicode_InitStaticStrings(PyInterpreterState *interp)"):
             printer.write(f'PyObject *string;')
             for i in sorted(identifiers):
                 # This use of _Py_ID() is ignored by iter_global_strings()
                 # since iter_files() ignores .h files.
                 printer.write(f'string = &_Py_ID({i});')
-                printer.write(f'PyUnicode_InternInPlace(&string);')
+                printer.write(f'_PyUnicode_InternStatic(interp, &string);')
             # XXX What about "strings"?
         printer.write(END)
         printer.write(after)
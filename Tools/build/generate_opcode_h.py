@@ -86,6 +86,7 @@ def main(opcode_py, outfile='Include/opcode.h', internaloutfile='Include/interna
     _pseudo_ops = opcode['_pseudo_ops']
 
     HAVE_ARGUMENT = opcode["HAVE_ARGUMENT"]
+    MIN_INSTRUMENTED_OPCODE = opcode["MIN_INSTRUMENTED_OPCODE"]
     MIN_PSEUDO_OPCODE = opcode["MIN_PSEUDO_OPCODE"]
     MAX_PSEUDO_OPCODE = opcode["MAX_PSEUDO_OPCODE"]
 
@@ -117,6 +118,8 @@ def main(opcode_py, outfile='Include/opcode.h', internaloutfile='Include/interna
                 op = opmap[name]
                 if op == HAVE_ARGUMENT:
                     fobj.write(DEFINE.format("HAVE_ARGUMENT", HAVE_ARGUMENT))
+                if op == MIN_INSTRUMENTED_OPCODE:
+                    fobj.write(DEFINE.format("MIN_INSTRUMENTED_OPCODE", MIN_INSTRUMENTED_OPCODE))
                 if op == MIN_PSEUDO_OPCODE:
                     fobj.write(DEFINE.format("MIN_PSEUDO_OPCODE", MIN_PSEUDO_OPCODE))
 
@@ -82,7 +82,9 @@ def clean_lines(text):
 # generated
 Python/deepfreeze/*.c
 Python/frozen_modules/*.h
+Python/executor_cases.c.h
 Python/generated_cases.c.h
+Python/opcode_metadata.h
 
 # not actually source
 Python/bytecodes.c
@@ -289,7 +291,11 @@ def clean_lines(text):
 
 SAME = {
     _abs('Include/*.h'): [_abs('Include/cpython/')],
-    _abs('Python/ceval.c'): ['Python/generated_cases.c.h'],
+    _abs('Python/ceval.c'): ['Python/generated_cases.c.h',
+                             'Python/executor_cases.c.h',
+                             'Python/opcode_metadata.h'],
+    _abs('Python/optimizer.c'): ['Python/opcode_metadata.h'],
+    _abs('Python/jit.c'): ['Python/opcode_metadata.h'],
 }
 
 MAX_SIZES = {
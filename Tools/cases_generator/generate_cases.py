@@ -2,16 +2,25 @@
 
 Reads the instruction definitions from bytecodes.c.
 Writes the cases to generated_cases.c.h, which is #included in ceval.c.
+Writes the tier-2 micro-op cases to executor_cases.c.h, also #included
+in ceval.c, and the micro-op metadata to opcode_metadata.h.
+
+The superinstructions for common pairs of instructions are listed in
+Lib/opcode.py; with --profile, they are chosen from a Py_STATS profile
+and the list is rewritten.
 """
 
 import argparse
+import collections
 import contextlib
 import dataclasses
+import json
 import os
 import re
 import sys
 import typing
 
+import lexer as lx
 import parser
 from parser import StackEffect
 
@@ -21,12 +30,72 @@
 DEFAULT_OUTPUT = os.path.relpath(
     os.path.join(os.path.dirname(__file__), "../../Python/generated_cases.c.h")
 )
+DEFAULT_EXECUTOR_OUTPUT = os.path.relpath(
+    os.path.join(os.path.dirname(__file__), "../../Python/executor_cases.c.h")
+)
+DEFAULT_METADATA_OUTPUT = os.path.relpath(
+    os.path.join(os.path.dirname(__file__), "../../Python/opcode_metadata.h")
+)
+DEFAULT_OPCODE_PY = os.path.relpath(
+    os.path.join(os.path.dirname(__file__), "../../Lib/opcode.py")
+)
+DEFAULT_OPCODE_H = os.path.relpath(
+    os.path.join(os.path.dirname(__file__), "../../Include/opcode.h")
+)
 BEGIN_MARKER = "// BEGIN BYTECODES //"
 END_MARKER = "// END BYTECODES //"
 RE_PREDICTED = r"^\s*(?:PREDICT\(|GO_TO_INSTRUCTION\(|DEOPT_IF\(.*?,\s*)(\w+)\);\s*$"
 UNUSED = "unused"
 BITS_PER_CODE_UNIT = 16
 
+TIER_ONE = 1
+TIER_TWO = 2
+
+# Identifiers that tie an instruction body to the tier-1 interpreter loop.
+# Instructions using any of these can't run in the tier-2 executor.
+TIER_ONE_ONLY_NAMES = frozenset(
+    {
+        "next_instr",
+        "opcode",
+        "kwnames",
+        "throwflag",
+        "binary_ops",
+        "entry_frame",
+        "JUMPBY",
+        "JUMPTO",
+        "INSTR_OFFSET",
+        "DISPATCH",
+        "DISPATCH_SAME_OPARG",
+        "DISPATCH_INLINED",
+        "GO_TO_INSTRUCTION",
+        "CHECK_EVAL_BREAKER",
+        "_PyFrame_SetStackPointer",
+        "start_frame",
+        "resume_frame",
+        "resume_with_error",
+        "exit_unwind",
+        "exception_unwind",
+        "handle_eval_breaker",
+    }
+)
+
+# Besides the names in TIER_ONE_ONLY_NAMES, the parts of a superinstruction
+# can't use these: an error or a deopt in the second part would be reported
+# at, or resume from, the first one.
+SUPER_UNSAFE_NAMES = frozenset({"ERROR_IF", "DEOPT_IF", "goto", "return"})
+
+# The list of superinstructions in Lib/opcode.py is between these lines.
+SUPERINSTRUCTIONS_BEGIN = "# BEGIN SUPERINSTRUCTIONS"
+SUPERINSTRUCTIONS_END = "# END SUPERINSTRUCTIONS"
+
+# Ops without a tier-2 body of their own, which the trace projector in
+# Python/optimizer.c translates by hand when they appear in an expansion.
+PROJECTOR_UOPS = frozenset({"_JUMP_IF"})
+
+# Micro-ops that aren't tier-1 instructions are numbered from here up.
+FIRST_UOP_ID = 300
+MAX_UOPS_PER_EXPANSION = 4
+
 arg_parser = argparse.ArgumentParser(
     description="Generate the code for the interpreter switch.",
     formatter_class=argparse.ArgumentDefaultsHelpFormatter,
@@ -37,6 +106,46 @@
 arg_parser.add_argument(
     "-o", "--output", type=str, help="Generated code", default=DEFAULT_OUTPUT
 )
+arg_parser.add_argument(
+    "-e",
+    "--executor-cases",
+    type=str,
+    help="Generated tier-2 micro-op cases",
+    default=DEFAULT_EXECUTOR_OUTPUT,
+)
+arg_parser.add_argument(
+    "-m",
+    "--metadata",
+    type=str,
+    help="Generated micro-op metadata",
+    default=DEFAULT_METADATA_OUTPUT,
+)
+arg_parser.add_argument(
+    "-p",
+    "--opcode-py",
+    type=str,
+    help="Opcode definitions, including the superinstructions",
+    default=DEFAULT_OPCODE_PY,
+)
+arg_parser.add_argument(
+    "--profile",
+    type=str,
+    help="Py_STATS profile to choose the superinstructions from (a directory "
+    "of raw stats, or a JSON file written by summarize_stats.py); "
+    "rewrites the list in --opcode-py",
+)
+arg_parser.add_argument(
+    "--opcode-h",
+    type=str,
+    help="Opcode numbers of the interpreter that wrote --profile",
+    default=DEFAULT_OPCODE_H,
+)
+arg_parser.add_argument(
+    "--superinstructions",
+    type=int,
+    help="How many superinstructions to choose with --profile",
+    default=5,
+)
 
 
 class Formatter:
@@ -111,6 +220,7 @@ class Instruction:
     inst: parser.InstDef
     kind: typing.Literal["inst", "op"]
     name: str
+    legacy: bool
     block: parser.Block
     block_text: list[str]  # Block.text, less curlies, less PREDICT() calls
     predictions: list[str]  # Prediction targets (instruction names)
@@ -130,6 +240,7 @@ def __init__(self, inst: parser.InstDef):
         self.inst = inst
         self.kind = inst.kind
         self.name = inst.name
+        self.legacy = inst.legacy
         self.block = inst.block
         self.block_text, self.predictions = extract_block_text(self.block)
         self.always_exits = always_exits(self.block_text)
@@ -142,10 +253,38 @@ def __init__(self, inst: parser.InstDef):
         ]
         self.output_effects = inst.outputs  # For consistency/completeness
 
-    def write(self, out: Formatter) -> None:
+    def is_viable_uop(self) -> bool:
+        """Whether the tier-2 executor can run this as a micro-op."""
+        if self.legacy:
+            return False
+        named = [c for c in self.cache_effects if c.name != UNUSED]
+        if len(named) > 1 or any(c.size > 2 for c in named):
+            # A micro-op carries at most one 32-bit cache entry (its operand)
+            return False
+        tokens = self.block.tokens
+        for i, tkn in enumerate(tokens):
+            if tkn.kind != lx.IDENTIFIER:
+                continue
+            if tkn.text in TIER_ONE_ONLY_NAMES:
+                return False
+            if tkn.text == "frame" and i + 1 < len(tokens):
+                if tokens[i + 1].kind == lx.EQUALS:
+                    # Pushes or pops a frame
+                    return False
+        return True
+
+    def is_super_component(self) -> bool:
+        """Whether this can be part of a superinstruction."""
+        if self.kind != "inst" or self.cache_offset or self.always_exits:
+            return False
+        if not self.is_viable_uop():
+            return False
+        return not any(tkn.text in SUPER_UNSAFE_NAMES for tkn in self.block.tokens)
+
+    def write(self, out: Formatter, tier: int = TIER_ONE) -> None:
         """Write one instruction, sans prologue and epilogue."""
         # Write a static assertion that a family's cache size is correct
-        if family := self.family:
+        if tier == TIER_ONE and (family := self.family):
             if self.name == family.members[0]:
                 if cache_size := family.size:
                     out.emit(
@@ -164,7 +303,7 @@ def write(self, out: Formatter) -> None:
             if oeffect.name not in input_names:
                 out.declare(oeffect, None)
 
-        self.write_body(out, 0)
+        self.write_body(out, 0, tier=tier)
 
         # Skip the rest if the block always exits
         if self.always_exits:
@@ -185,10 +324,12 @@ def write(self, out: Formatter) -> None:
                 out.assign(dst, oeffect)
 
         # Write cache effect
-        if self.cache_offset:
+        if tier == TIER_ONE and self.cache_offset:
             out.emit(f"JUMPBY({self.cache_offset});")
 
-    def write_body(self, out: Formatter, dedent: int, cache_adjust: int = 0) -> None:
+    def write_body(
+        self, out: Formatter, dedent: int, cache_adjust: int = 0, tier: int = TIER_ONE
+    ) -> None:
         """Write the instruction body."""
         # Write cache effect variable declarations and initializations
         cache_offset = cache_adjust
@@ -205,7 +346,13 @@ def write_body(self, out: Formatter, dedent: int, cache_adjust: int = 0) -> None
                 else:
                     typ = f"uint{bits}_t "
                     func = f"read_u{bits}"
-                out.emit(f"{typ}{ceffect.name} = {func}(next_instr + {cache_offset});")
+                if tier == TIER_TWO:
+                    # The projector copied the cache entry into the operand
+                    out.emit(f"{typ}{ceffect.name} = ({typ.strip()})operand;")
+                else:
+                    out.emit(
+                        f"{typ}{ceffect.name} = {func}(next_instr + {cache_offset});"
+                    )
             cache_offset += ceffect.size
         assert cache_offset == self.cache_offset + cache_adjust
 
@@ -248,10 +395,12 @@ class Component:
 
     def write_body(self, out: Formatter, cache_adjust: int) -> None:
         with out.block(""):
+            input_names = {ieffect.name for _, ieffect in self.input_mapping}
             for var, ieffect in self.input_mapping:
                 out.declare(ieffect, var)
             for _, oeffect in self.output_mapping:
-                out.declare(oeffect, None)
+                if oeffect.name not in input_names:
+                    out.declare(oeffect, None)
 
             self.instr.write_body(out, dedent=-4, cache_adjust=cache_adjust)
 
@@ -267,6 +416,7 @@ class SuperOrMacroInstruction:
     stack: list[StackEffect]
     initial_sp: int
     final_sp: int
+    cache_offset: int
 
 
 @dataclasses.dataclass
@@ -290,15 +440,32 @@ class Analyzer:
 
     filename: str
     output_filename: str
+    executor_filename: str
+    metadata_filename: str
+    opcode_filename: str
     src: str
+    superinstructions: list[tuple[str, str]]
     errors: int = 0
 
-    def __init__(self, filename: str, output_filename: str):
-        """Read the input file."""
+    def __init__(
+        self,
+        filename: str,
+        output_filename: str,
+        executor_filename: str,
+        metadata_filename: str,
+        opcode_filename: str,
+    ):
+        """Read the input files."""
         self.filename = filename
         self.output_filename = output_filename
+        self.executor_filename = executor_filename
+        self.metadata_filename = metadata_filename
+        self.opcode_filename = opcode_filename
         with open(filename) as f:
             self.src = f.read()
+        self.superinstructions = read_opcode_py(opcode_filename)[
+            "_superinstructions"
+        ]
 
     def error(self, msg: str, node: parser.Node) -> None:
         lineno = 0
@@ -380,14 +547,125 @@ def analyze(self) -> None:
 
         Raises SystemExit if there is an error.
         """
+        self.add_superinstructions()
+        self.find_tier_two_only_ops()
         self.find_predictions()
+        self.analyze_supers_and_macros()
         self.map_families()
         self.check_families()
-        self.analyze_supers_and_macros()
+
+    def choose_superinstructions(
+        self, profile: str, opcode_h: str, count: int
+    ) -> None:
+        """Choose superinstructions for the most common pairs of instructions.
+
+        The pairs are counted in a Py_STATS profile of the interpreter built
+        from the current list, which is then rewritten.
+        """
+        opcode = read_opcode_py(self.opcode_filename)
+        names = read_opcode_h(
+            opcode_h, {*opcode["opmap"], *opcode["_specialized_instructions"]}
+        )
+        deopt = {
+            specialized: base
+            for base, family in opcode["_specializations"].items()
+            for specialized in family
+        }
+        supers = {
+            f"{first}__{second}": (first, second)
+            for first, second in self.superinstructions
+        }
+        counts: collections.Counter[tuple[str, str]] = collections.Counter()
+        for key, value in read_profile(profile).items():
+            if m := re.fullmatch(r"opcode\[(\d+)\]\.pair_count\[(\d+)\]", key):
+                first, second = names.get(int(m[1])), names.get(int(m[2]))
+                if first is None or second is None:
+                    continue
+                if first in supers:
+                    # The next instruction follows the last one it ran
+                    first = supers[first][1]
+                else:
+                    first = deopt.get(first, first)
+                second = deopt.get(second, second)
+                counts[first, second] += value
+            elif m := re.fullmatch(r"opcode\[(\d+)\]\.execution_count", key):
+                # A superinstruction hides the pair it runs from the pair counts
+                if (name := names.get(int(m[1]))) in supers:
+                    counts[supers[name]] += value
+        pairs = [
+            pair
+            for pair, n in sorted(counts.items(), key=lambda item: (-item[1], item[0]))
+            if n and all(
+                (instr := self.instrs.get(name)) and instr.is_super_component()
+                for name in pair
+            )
+        ]
+        self.superinstructions = sorted(pairs[:count])
+        write_superinstructions(self.opcode_filename, self.superinstructions)
+        total = sum(counts.values()) or 1
+        chosen = sum(counts[pair] for pair in self.superinstructions)
+        print(
+            f"Chose {len(self.superinstructions)} superinstructions, covering "
+            f"{chosen / total:.1%} of the pairs in {profile}; "
+            f"wrote them to {self.opcode_filename}",
+            file=sys.stderr,
+        )
+
+    def add_superinstructions(self) -> None:
+        """Add a super-instruction for each pair in Lib/opcode.py.
+
+        Each one goes after the later of its two instructions.
+        """
+        position = {thing.name: i for i, thing in enumerate(self.everything)}
+        supers: dict[int, list[parser.Super]] = {}
+        for first, second in self.superinstructions:
+            name = f"{first}__{second}"
+            bad = [
+                op for op in (first, second)
+                if not ((instr := self.instrs.get(op)) and instr.is_super_component())
+            ]
+            if bad or name in self.supers:
+                reason = f"{bad[0]!r} can't be part of it" if bad else "already defined"
+                print(
+                    f"{self.opcode_filename}: superinstruction {name!r}: {reason}",
+                    file=sys.stderr,
+                )
+                self.errors += 1
+                continue
+            super = parser.Super(name, [parser.OpName(first), parser.OpName(second)])
+            self.supers[name] = super
+            where = max(position[first], position[second])
+            supers.setdefault(where, []).append(super)
+        everything: list[parser.InstDef | parser.Super | parser.Macro] = []
+        for i, thing in enumerate(self.everything):
+            everything.append(thing)
+            everything.extend(supers.get(i, ()))
+        self.everything = everything
+
+    def find_tier_two_only_ops(self) -> None:
+        """Find the ops that no super- or macro instruction uses.
+
+        These only ever run in the tier-2 executor.
+        """
+        used: set[str] = set()
+        for super in self.supers.values():
+            used.update(op.name for op in super.ops)
+        for macro in self.macros.values():
+            used.update(
+                uop.name for uop in macro.uops if isinstance(uop, parser.OpName)
+            )
+        self.tier_two_only = {
+            name
+            for name, instr in self.instrs.items()
+            if instr.kind == "op" and name not in used
+        }
 
     def find_predictions(self) -> None:
         """Find the instructions that need PREDICTED() labels."""
         for instr in self.instrs.values():
+            if instr.name in self.tier_two_only:
+                # Their DEOPT_IF() exits the trace; they predict nothing.
+                continue
             targets = set(instr.predictions)
             for line in instr.block_text:
                 if m := re.match(RE_PREDICTED, line):
@@ -407,6 +685,8 @@ def map_families(self) -> None:
             for member in family.members:
                 if member_instr := self.instrs.get(member):
                     member_instr.family = family
+                elif member in self.macro_instrs:
+                    pass
                 else:
                     self.error(
                         f"Unknown instruction {member!r} referenced in family {family.name!r}",
@@ -417,13 +697,17 @@ def check_families(self) -> None:
         """Check each family:
 
         - Must have at least 2 members
-        - All members must be known instructions
+        - All members must be known instructions or macros
         - All members must have the same cache, input and output effects
         """
         for family in self.families.values():
             if len(family.members) < 2:
                 self.error(f"Family {family.name!r} has insufficient members", family)
-            members = [member for member in family.members if member in self.instrs]
+            members = [
+                member
+                for member in family.members
+                if member in self.instrs or member in self.macro_instrs
+            ]
             if members != family.members:
                 unknown = set(family.members) - set(members)
                 self.error(
@@ -431,15 +715,9 @@ def check_families(self) -> None:
                 )
             if len(members) < 2:
                 continue
-            head = self.instrs[members[0]]
-            cache = head.cache_offset
-            input = len(head.input_effects)
-            output = len(head.output_effects)
+            cache, input, output = self.effect_counts(members[0])
             for member in members[1:]:
-                instr = self.instrs[member]
-                c = instr.cache_offset
-                i = len(instr.input_effects)
-                o = len(instr.output_effects)
+                c, i, o = self.effect_counts(member)
                 if (c, i, o) != (cache, input, output):
                     self.error(
                         f"Family {family.name!r} has inconsistent "
@@ -449,6 +727,17 @@ def check_families(self) -> None:
                         family,
                     )
 
+    def effect_counts(self, name: str) -> tuple[int, int, int]:
+        """Return (cache, inputs, outputs) of an instruction or macro."""
+        if instr := self.instrs.get(name):
+            return (
+                instr.cache_offset,
+                len(instr.input_effects),
+                len(instr.output_effects),
+            )
+        mac = self.macro_instrs[name]
+        return mac.cache_offset, mac.initial_sp, mac.final_sp
+
     def analyze_supers_and_macros(self) -> None:
         """Analyze each super- and macro instruction."""
         self.super_instrs = {}
@@ -467,24 +756,32 @@ def analyze_super(self, super: parser.Super) -> SuperInstruction:
             part, sp = self.analyze_instruction(instr, stack, sp)
             parts.append(part)
         final_sp = sp
-        return SuperInstruction(super.name, stack, initial_sp, final_sp, super, parts)
+        cache_offset = sum(instr.cache_offset for instr in components)
+        return SuperInstruction(
+            super.name, stack, initial_sp, final_sp, cache_offset, super, parts
+        )
 
     def analyze_macro(self, macro: parser.Macro) -> MacroInstruction:
         components = self.check_macro_components(macro)
         stack, initial_sp = self.stack_analysis(components)
         sp = initial_sp
+        cache_offset = 0
         parts: list[Component | parser.CacheEffect] = []
         for component in components:
             match component:
                 case parser.CacheEffect() as ceffect:
                     parts.append(ceffect)
+                    cache_offset += ceffect.size
                 case Instruction() as instr:
                     part, sp = self.analyze_instruction(instr, stack, sp)
                     parts.append(part)
+                    cache_offset += instr.cache_offset
                 case _:
                     typing.assert_never(component)
         final_sp = sp
-        return MacroInstruction(macro.name, stack, initial_sp, final_sp, macro, parts)
+        return MacroInstruction(
+            macro.name, stack, initial_sp, final_sp, cache_offset, macro, parts
+        )
 
     def analyze_instruction(
         self, instr: Instruction, stack: list[StackEffect], sp: int
@@ -558,9 +855,7 @@ def write_instructions(self) -> None:
         """Write instructions to output file."""
         with open(self.output_filename, "w") as f:
             # Write provenance header
-            f.write(f"// This file is generated by {os.path.relpath(__file__)}\n")
-            f.write(f"// from {os.path.relpath(self.filename)}\n")
-            f.write(f"// Do not edit!\n")
+            self.write_provenance_header(f)
 
             # Create formatter; the rest of the code uses this.
             self.out = Formatter(f, 8)
@@ -590,6 +885,188 @@ def write_instructions(self) -> None:
             file=sys.stderr,
         )
 
+    def write_provenance_header(self, f: typing.TextIO) -> None:
+        f.write(f"// This file is generated by {os.path.relpath(__file__)}\n")
+        f.write(f"// from {os.path.relpath(self.filename)}\n")
+        f.write(f"// Do not edit!\n")
+
+    def write_executor_instructions(self) -> None:
+        """Write the tier-2 micro-op cases to the executor output file."""
+        with open(self.executor_filename, "w") as f:
+            self.write_provenance_header(f)
+            self.out = Formatter(f, 8)
+            n_uops = 0
+            for thing in self.everything:
+                match thing:
+                    case parser.InstDef(name=name):
+                        instr = self.instrs[name]
+                        if instr.is_viable_uop():
+                            n_uops += 1
+                            self.out.emit("")
+                            with self.out.block(f"case {name}:"):
+                                instr.write(self.out, tier=TIER_TWO)
+                                if not instr.always_exits:
+                                    self.out.emit("break;")
+                    case parser.Super() | parser.Macro():
+                        pass
+                    case _:
+                        typing.assert_never(thing)
+        print(
+            f"Wrote {n_uops} micro-ops to {self.executor_filename}",
+            file=sys.stderr,
+        )
+
+    def usable_in_expansion(self, instr: Instruction) -> bool:
+        return instr.is_viable_uop() or instr.name in PROJECTOR_UOPS
+
+    def cache_operand(self, instr: Instruction, offset: int) -> tuple[int, int]:
+        """Return (offset, size) of the named cache entry, or (0, 0)."""
+        for ceffect in instr.cache_effects:
+            if ceffect.name != UNUSED:
+                return offset, ceffect.size
+            offset += ceffect.size
+        return 0, 0
+
+    def get_expansion(self, name: str) -> list[tuple[str, int, int, int]] | None:
+        """Return the micro-ops that a tier-1 instruction expands to.
+
+        Each entry is (uop, offset of the code unit holding its oparg,
+        offset of its operand in the cache following that code unit,
+        size of the operand). Returns None if some part can't be traced.
+        """
+        expansion: list[tuple[str, int, int, int]] = []
+        if instr := self.instrs.get(name):
+            if instr.kind != "inst" or not instr.is_viable_uop():
+                return None
+            expansion.append((name, 0, *self.cache_operand(instr, 0)))
+        elif sup := self.super_instrs.get(name):
+            offset = 0
+            for comp in sup.parts:
+                if not self.usable_in_expansion(comp.instr):
+                    return None
+                operand = self.cache_operand(comp.instr, 0)
+                expansion.append((comp.instr.name, offset, *operand))
+                offset += 1 + comp.instr.cache_offset
+        elif mac := self.macro_instrs.get(name):
+            cache_adjust = 0
+            for part in mac.parts:
+                match part:
+                    case parser.CacheEffect(size=size):
+                        cache_adjust += size
+                    case Component(instr=comp):
+                        if not self.usable_in_expansion(comp):
+                            return None
+                        operand = self.cache_operand(comp, cache_adjust)
+                        expansion.append((comp.name, 0, *operand))
+                        cache_adjust += comp.cache_offset
+        assert len(expansion) <= MAX_UOPS_PER_EXPANSION, name
+        return expansion
+
+    def write_metadata(self) -> None:
+        """Write micro-op ids, expansions and stack effects."""
+        uops = [
+            instr
+            for instr in self.instrs.values()
+            if instr.is_viable_uop() or instr.name in PROJECTOR_UOPS
+        ]
+        tier_one = [
+            thing.name
+            for thing in self.everything
+            if not isinstance(thing, parser.InstDef) or thing.kind == "inst"
+        ]
+        with open(self.metadata_filename, "w") as f:
+            self.write_provenance_header(f)
+            self.out = Formatter(f, 0)
+            self.out.emit("")
+            self.out.emit("// Micro-ops that aren't also tier-1 instructions")
+            uop_id = FIRST_UOP_ID
+            for instr in self.instrs.values():
+                if instr.kind == "op":
+                    self.out.emit(f"#define {instr.name} {uop_id}")
+                    uop_id += 1
+            self.out.emit(f"#define MAX_UOP_ID {uop_id - 1}")
+            self.out.emit("")
+            self.out.emit(f"#define MAX_UOPS_PER_EXPANSION {MAX_UOPS_PER_EXPANSION}")
+            self.out.emit("")
+            self.out.emit("// The superinstruction that _PyCode_Quicken() puts in place of the")
+            self.out.emit("// first of a pair of instructions, or 0")
+            self.out.emit("static inline int")
+            self.out.emit("_PyOpcode_Superinstruction(int first, int second)")
+            self.out.emit("{")
+            with self.out.indent():
+                with self.out.block("switch (first << 8 | second)"):
+                    for first, second in self.superinstructions:
+                        self.out.emit(f"case {first} << 8 | {second}:")
+                        self.out.emit(f"    return {first}__{second};")
+                self.out.emit("return 0;")
+            self.out.emit("}")
+            self.out.emit("")
+            self.out.emit("struct opcode_macro_expansion {")
+            with self.out.indent():
+                self.out.emit("int nuops;")
+                self.out.emit("struct {")
+                with self.out.indent():
+                    self.out.emit("int16_t uop;")
+                    self.out.emit("// Code unit holding the oparg, relative to the instruction")
+                    self.out.emit("int8_t offset;")
+                    self.out.emit("// Operand location in the cache following that code unit")
+                    self.out.emit("int8_t cache_offset;")
+                    self.out.emit("int8_t cache_size;  // 0 if there is no operand")
+                self.out.emit("} uops[MAX_UOPS_PER_EXPANSION];")
+            self.out.emit("};")
+            self.out.emit("")
+            self.out.emit("#ifndef NEED_OPCODE_METADATA")
+            self.out.emit(
+                "extern const struct opcode_macro_expansion "
+                "_PyOpcode_macro_expansion[256];"
+            )
+            self.out.emit("extern const char *const _PyUop_name[MAX_UOP_ID + 1];")
+            self.out.emit("extern const int8_t _PyUop_popped[MAX_UOP_ID + 1];")
+            self.out.emit("extern const int8_t _PyUop_pushed[MAX_UOP_ID + 1];")
+            self.out.emit("#else")
+            self.out.emit(
+                "const struct opcode_macro_expansion "
+                "_PyOpcode_macro_expansion[256] = {"
+            )
+            with self.out.indent():
+                for name in tier_one:
+                    expansion = self.get_expansion(name)
+                    if not expansion:
+                        continue
+                    parts = ", ".join(
+                        f"{{ {uop}, {offset}, {cache_offset}, {cache_size} }}"
+                        for uop, offset, cache_offset, cache_size in expansion
+                    )
+                    self.out.emit(
+                        f"[{name}] = {{ .nuops = {len(expansion)}, "
+                        f".uops = {{ {parts} }} }},"
+                    )
+            self.out.emit("};")
+            self.out.emit("")
+            self.out.emit("const char *const _PyUop_name[MAX_UOP_ID + 1] = {")
+            with self.out.indent():
+                for instr in uops:
+                    self.out.emit(f'[{instr.name}] = "{instr.name}",')
+            self.out.emit("};")
+            self.out.emit("")
+            self.out.emit("const int8_t _PyUop_popped[MAX_UOP_ID + 1] = {")
+            with self.out.indent():
+                for instr in uops:
+                    self.out.emit(f"[{instr.name}] = {len(instr.input_effects)},")
+            self.out.emit("};")
+            self.out.emit("")
+            self.out.emit("const int8_t _PyUop_pushed[MAX_UOP_ID + 1] = {")
+            with self.out.indent():
+                for instr in uops:
+                    self.out.emit(f"[{instr.name}] = {len(instr.output_effects)},")
+            self.out.emit("};")
+            self.out.emit("#endif  // NEED_OPCODE_METADATA")
+        print(
+            f"Wrote {len(uops)} micro-ops and {uop_id - FIRST_UOP_ID} "
+            f"micro-op ids to {self.metadata_filename}",
+            file=sys.stderr,
+        )
+
     def write_instr(self, instr: Instruction) -> None:
         name = instr.name
         self.out.emit("")
@@ -699,15 +1176,74 @@ def always_exits(lines: list[str]) -> bool:
     )
 
 
+def read_opcode_py(filename: str) -> dict[str, typing.Any]:
+    """Run Lib/opcode.py, returning its globals."""
+    namespace: dict[str, typing.Any] = {}
+    with open(filename) as f:
+        exec(f.read(), namespace)
+    return namespace
+
+
+def read_opcode_h(filename: str, known: set[str]) -> dict[int, str]:
+    """Map the numbers of the known opcodes in Include/opcode.h to names."""
+    names: dict[int, str] = {}
+    with open(filename) as f:
+        for line in f:
+            if m := re.match(r"#define (\w+) +(\d+)$", line.strip()):
+                if m[1] in known:
+                    names[int(m[2])] = m[1]
+    return names
+
+
+def read_profile(path: str) -> collections.Counter[str]:
+    """Read Py_STATS output, as Tools/scripts/summarize_stats.py does."""
+    if os.path.isfile(path):
+        with open(path) as f:
+            return collections.Counter(json.load(f))
+    stats: collections.Counter[str] = collections.Counter()
+    for filename in os.listdir(path):
+        with open(os.path.join(path, filename)) as f:
+            for line in f:
+                key, sep, value = line.partition(":")
+                if sep:
+                    stats[key.strip()] += int(value)
+    return stats
+
+
+def write_superinstructions(filename: str, pairs: list[tuple[str, str]]) -> None:
+    """Replace the list of superinstructions in Lib/opcode.py."""
+    with open(filename) as f:
+        lines = f.readlines()
+    stripped = [line.strip() for line in lines]
+    begin = stripped.index(SUPERINSTRUCTIONS_BEGIN)
+    end = stripped.index(SUPERINSTRUCTIONS_END)
+    lines[begin + 1 : end] = [
+        "_superinstructions = [\n",
+        *(f'    ("{first}", "{second}"),\n' for first, second in pairs),
+        "]\n",
+    ]
+    with open(filename, "w") as f:
+        f.writelines(lines)
+
+
 def main():
     """Parse command line, parse input, analyze, write output."""
     args = arg_parser.parse_args()  # Prints message and sys.exit(2) on error
-    a = Analyzer(args.input, args.output)  # Raises OSError if input unreadable
+    # Raises OSError if input unreadable
+    a = Analyzer(
+        args.input, args.output, args.executor_cases, args.metadata, args.opcode_py
+    )
     a.parse()  # Raises SyntaxError on failure
+    if args.profile:
+        a.choose_superinstructions(
+            args.profile, args.opcode_h, args.superinstructions
+        )
     a.analyze()  # Prints messages and sets a.errors on failure
     if a.errors:
         sys.exit(f"Found {a.errors} errors")
     a.write_instructions()  # Raises OSError if output can't be written
+    a.write_executor_instructions()
+    a.write_metadata()
 
 
 if __name__ == "__main__":
@@ -88,6 +88,7 @@ class InstHeader(Node):
     name: str
     inputs: list[InputEffect]
     outputs: list[OutputEffect]
+    legacy: bool = False  # inst(NAME) without a stack effect
 
 
 @dataclass
@@ -97,6 +98,7 @@ class InstDef(Node):
     inputs: list[InputEffect]
     outputs: list[OutputEffect]
     block: Block
+    legacy: bool = False  # inst(NAME) without a stack effect
 
 
 @dataclass
@@ -134,7 +136,9 @@ def definition(self) -> InstDef | Super | Macro | Family | None:
     def inst_def(self) -> InstDef | None:
         if hdr := self.inst_header():
             if block := self.block():
-                return InstDef(hdr.kind, hdr.name, hdr.inputs, hdr.outputs, block)
+                return InstDef(
+                    hdr.kind, hdr.name, hdr.inputs, hdr.outputs, block, hdr.legacy
+                )
             raise self.make_syntax_error("Expected block")
         return None
 
@@ -154,7 +158,7 @@ def inst_header(self) -> InstHeader | None:
                             return InstHeader(kind, name, inp, outp)
                 elif self.expect(lx.RPAREN) and kind == "inst":
                     # No legacy stack effect if kind is "op".
-                    return InstHeader(kind, name, [], [])
+                    return InstHeader(kind, name, [], [], legacy=True)
         return None
 
     def io_effect(self) -> tuple[list[InputEffect], list[OutputEffect]]:
@@ -0,0 +1,342 @@
+"""Build the stencils of the experimental JIT compiler (Python/jit.c).
+
+Every micro-op in Python/executor_cases.c.h is compiled from
+Tools/jit/template.c with the host C compiler (clang if available) into a
+relocatable ELF object. The machine code and read-only data of each object
+become a "stencil": a byte string plus a list of holes, which are the
+relocations that Python/jit.c patches when it copies the stencil into a
+compiled trace.
+
+Only x86-64 ELF is supported. The stencils are compiled for the large code
+model without PIC, so that every hole is a 64-bit absolute address
+(R_X86_64_64) that can be patched without knowing where the code will end
+up.
+
+Usage: build.py [--cc CC] -o Python/jit_stencils.h -- CFLAGS...
+
+Of the CFLAGS, only the preprocessor options (-D, -U and -I) are used, so
+that the stencils see the same configuration as the rest of the core.
+"""
+
+from __future__ import annotations
+
+import argparse
+import dataclasses
+import os
+import re
+import shlex
+import struct
+import subprocess
+import sys
+import tempfile
+
+TOOLS_JIT = os.path.dirname(os.path.abspath(__file__))
+ROOT = os.path.dirname(os.path.dirname(TOOLS_JIT))
+TEMPLATE = os.path.join(TOOLS_JIT, "template.c")
+EXECUTOR_CASES = os.path.join(ROOT, "Python", "executor_cases.c.h")
+SCRIPT_NAME = "Tools/jit/build.py"
+
+CFLAGS = [
+    "-O3",
+    "-std=gnu11",
+    # Every hole must be a 64-bit absolute relocation:
+    "-fno-pic",
+    "-mcmodel=large",
+    # One section per function, so _JIT_ENTRY comes first in the stencil:
+    "-ffunction-sections",
+    # No tables, unwind info or instrumentation that would need relocating
+    # or patching differently:
+    "-fno-jump-tables",
+    "-fno-asynchronous-unwind-tables",
+    "-fno-stack-protector",
+    "-fcf-protection=none",
+    "-fno-lto",
+    "-Wno-unused-label",
+    "-Wno-unused-variable",
+    "-Wno-unused-but-set-variable",
+]
+GCC_CFLAGS = [
+    # Keep cold code in the same section as the rest of the function
+    "-fno-reorder-blocks-and-partition",
+]
+
+# Symbols in the template whose addresses are patched with per-uop values
+HOLES = {
+    "_JIT_CONTINUE": "HoleValue_CONTINUE",
+    "_JIT_JUMP_TARGET": "HoleValue_JUMP_TARGET",
+    "_JIT_OPARG": "HoleValue_OPARG",
+    "_JIT_OPERAND": "HoleValue_OPERAND",
+    "_JIT_TARGET": "HoleValue_TARGET",
+}
+# ...of which these are code that the stencil must tail call
+TAIL_CALLS = {"_JIT_CONTINUE", "_JIT_JUMP_TARGET"}
+
+# Python/jit.c copies the data of each stencil to an address aligned like this
+DATA_ALIGN = 16
+
+SHT_SYMTAB = 2
+SHT_RELA = 4
+SHT_NOBITS = 8
+SHF_WRITE = 0x1
+SHF_ALLOC = 0x2
+SHF_EXECINSTR = 0x4
+SHN_UNDEF = 0
+EM_X86_64 = 62
+R_X86_64_64 = 1
+
+
+class StencilError(Exception):
+    pass
+
+
+@dataclasses.dataclass
+class Section:
+    name: str
+    type: int
+    flags: int
+    offset: int
+    size: int
+    link: int
+    info: int
+    align: int
+
+
+@dataclasses.dataclass
+class Symbol:
+    name: str
+    type: int
+    section: int
+    value: int
+
+
+@dataclasses.dataclass
+class Hole:
+    offset: int
+    value: str
+    symbol: str | None
+    addend: int
+
+
+@dataclasses.dataclass
+class Stencil:
+    body: bytearray = dataclasses.field(default_factory=bytearray)
+    holes: list[Hole] = dataclasses.field(default_factory=list)
+
+
+class ELFObject:
+    """Just enough of a reader for relocatable x86-64 ELF objects."""
+
+    def __init__(self, data: bytes) -> None:
+        self.data = data
+        if data[:4] != b"\x7fELF" or data[4] != 2 or data[5] != 1:
+            raise StencilError("not a little-endian ELF64 object")
+        (machine,) = struct.unpack_from("<H", data, 0x12)
+        if machine != EM_X86_64:
+            raise StencilError(f"unsupported machine {machine}")
+        shoff, = struct.unpack_from("<Q", data, 0x28)
+        shentsize, shnum, shstrndx = struct.unpack_from("<HHH", data, 0x3A)
+        raw = []
+        for i in range(shnum):
+            raw.append(struct.unpack_from("<IIQQQQIIQQ", data,
+                                          shoff + i * shentsize))
+        names = raw[shstrndx][4]
+        self.sections = [
+            Section(self._string(names, name), type, flags, offset, size,
+                    link, info, align)
+            for (name, type, flags, _, offset, size, link, info, align, _)
+            in raw
+        ]
+        self.symbols = []
+        for section in self.sections:
+            if section.type == SHT_SYMTAB:
+                strtab = self.sections[section.link].offset
+                for i in range(section.size // 24):
+                    name, info, _, shndx, value, _ = struct.unpack_from(
+                        "<IBBHQQ", data, section.offset + i * 24)
+                    self.symbols.append(Symbol(self._string(strtab, name),
+                                               info & 0xF, shndx, value))
+
+    def _string(self, table: int, offset: int) -> str:
+        end = self.data.index(b"\0", table + offset)
+        return self.data[table + offset:end].decode()
+
+    def contents(self, section: Section) -> bytes:
+        if section.type == SHT_NOBITS:
+            return bytes(section.size)
+        return self.data[section.offset:section.offset + section.size]
+
+    def relocations(self, section: Section):
+        for i in range(section.size // 24):
+            offset, info, addend = struct.unpack_from(
+                "<QQq", self.data, section.offset + i * 24)
+            yield offset, self.symbols[info >> 32], info & 0xFFFFFFFF, addend
+
+
+def is_tail_call(body: bytes, offset: int) -> bool:
+    """Check that the address loaded by the movabs at offset (the start of
+    its immediate) is jumped to rather than called."""
+    rex, opcode = body[offset - 2], body[offset - 1]
+    if rex not in (0x48, 0x49) or not 0xB8 <= opcode <= 0xBF:
+        raise StencilError("unexpected instruction for a code hole")
+    register = opcode - 0xB8
+    prefix = b"\x41" if rex == 0x49 else b""
+    call = prefix + bytes([0xFF, 0xD0 + register])
+    jump = prefix + bytes([0xFF, 0xE0 + register])
+    rest = body[offset + 8:]
+    calls, jumps = rest.find(call), rest.find(jump)
+    return jumps != -1 and (calls == -1 or jumps < calls)
+
+
+def parse(opname: str, obj: ELFObject) -> tuple[Stencil, Stencil]:
+    code, data = Stencil(), Stencil()
+    placed = {}  # section index -> (stencil, offset)
+    entry = next((s for s in obj.symbols if s.name == "_JIT_ENTRY"), None)
+    if entry is None:
+        raise StencilError("no _JIT_ENTRY")
+    order = sorted(range(len(obj.sections)),
+                   key=lambda i: i != entry.section)
+    for i in order:
+        section = obj.sections[i]
+        if not section.flags & SHF_ALLOC or not section.size:
+            continue
+        if section.flags & SHF_WRITE:
+            raise StencilError(f"writable data in {section.name}")
+        stencil = code if section.flags & SHF_EXECINSTR else data
+        align = max(section.align, 1)
+        if stencil is data and align > DATA_ALIGN:
+            raise StencilError(f"{section.name} is aligned to {align} bytes")
+        stencil.body.extend(bytes(-len(stencil.body) % align))
+        placed[i] = (stencil, len(stencil.body))
+        stencil.body.extend(obj.contents(section))
+    if placed[entry.section][1] + entry.value != 0:
+        raise StencilError("_JIT_ENTRY is not at the start of the code")
+    for section in obj.sections:
+        if section.type != SHT_RELA or section.info not in placed:
+            continue
+        stencil, base = placed[section.info]
+        for offset, symbol, kind, addend in obj.relocations(section):
+            if kind != R_X86_64_64:
+                raise StencilError(f"unsupported relocation type {kind} "
+                                   f"for {symbol.name!r}")
+            offset += base
+            if symbol.section != SHN_UNDEF:
+                if symbol.section not in placed:
+                    raise StencilError(f"reference to unplaced section of "
+                                       f"{symbol.name!r}")
+                target, target_base = placed[symbol.section]
+                value = ("HoleValue_CODE" if target is code
+                         else "HoleValue_DATA")
+                hole = Hole(offset, value, None,
+                            target_base + symbol.value + addend)
+            elif symbol.name in HOLES:
+                if (symbol.name in TAIL_CALLS and stencil is code
+                        and not is_tail_call(stencil.body, offset)):
+                    raise StencilError(f"{symbol.name} is not tail called; "
+                                       f"try building with clang")
+                hole = Hole(offset, HOLES[symbol.name], None, addend)
+            else:
+                hole = Hole(offset, "HoleValue_ZERO", symbol.name, addend)
+            stencil.holes.append(hole)
+    for stencil in (code, data):
+        stencil.holes.sort(key=lambda hole: hole.offset)
+    return code, data
+
+
+def get_uops() -> list[str]:
+    with open(EXECUTOR_CASES) as f:
+        return re.findall(r"^        case (\w+): \{$", f.read(), re.MULTILINE)
+
+
+def compile_uop(cc: list[str], cflags: list[str], opname: str,
+                tempdir: str) -> ELFObject:
+    output = os.path.join(tempdir, f"{opname}.o")
+    args = [*cc, *cflags, f"-D_JIT_OPCODE={opname}", "-c", TEMPLATE,
+            "-o", output]
+    try:
+        subprocess.run(args, check=True)
+    except subprocess.CalledProcessError:
+        raise StencilError(f"failed to compile the stencil for {opname}")
+    with open(output, "rb") as f:
+        return ELFObject(f.read())
+
+
+def format_bytes(body: bytes) -> list[str]:
+    lines = []
+    for i in range(0, len(body), 12):
+        chunk = body[i:i + 12]
+        lines.append("    " + " ".join(f"0x{b:02x}," for b in chunk))
+    return lines
+
+
+def format_stencil(opname: str, part: str, stencil: Stencil) -> list[str]:
+    lines = []
+    if stencil.body:
+        lines.append(f"static const unsigned char {opname}_{part}_body[] = {{")
+        lines.extend(format_bytes(stencil.body))
+        lines.append("};")
+    if stencil.holes:
+        lines.append(f"static const Hole {opname}_{part}_holes[] = {{")
+        for hole in stencil.holes:
+            symbol = f"(uintptr_t)&{hole.symbol}" if hole.symbol else "0"
+            lines.append(f"    {{{hole.offset:#x}, {hole.value}, {symbol}, "
+                         f"{hole.addend:#x}}},")
+        lines.append("};")
+    return lines
+
+
+def init_stencil(opname: str, part: str, stencil: Stencil) -> str:
+    body = f"{opname}_{part}_body" if stencil.body else "NULL"
+    holes = f"{opname}_{part}_holes" if stencil.holes else "NULL"
+    return (f"{{{len(stencil.body)}, {body}, "
+            f"{len(stencil.holes)}, {holes}}}")
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--cc", default="clang",
+                        help="C compiler to build the stencils with")
+    parser.add_argument("-o", "--output", required=True)
+    parser.add_argument("cflags", nargs="*")
+    args = parser.parse_args()
+    cc = shlex.split(args.cc)
+    version = subprocess.run([*cc, "--version"], capture_output=True,
+                             text=True, check=True).stdout.splitlines()[0]
+    cflags = [flag for flag in args.cflags
+              if flag.startswith(("-D", "-U", "-I"))]
+    cflags += CFLAGS
+    if "clang" not in version:
+        cflags += GCC_CFLAGS
+    lines = [
+        f"// Generated by {SCRIPT_NAME} from Python/executor_cases.c.h",
+        f"// with {version}",
+        "// Do not edit!",
+        "",
+    ]
+    groups = []
+    with tempfile.TemporaryDirectory() as tempdir:
+        for opname in get_uops():
+            obj = compile_uop(cc, cflags, opname, tempdir)
+            try:
+                code, data = parse(opname, obj)
+            except StencilError as e:
+                raise StencilError(f"{opname}: {e}") from None
+            lines.extend(format_stencil(opname, "code", code))
+            lines.extend(format_stencil(opname, "data", data))
+            lines.append("")
+            groups.append((opname, code, data))
+    lines.append("static const StencilGroup stencil_groups[MAX_UOP_ID + 1] = {")
+    for opname, code, data in groups:
+        lines.append(f"    [{opname}] = {{")
+        lines.append(f"        {init_stencil(opname, 'code', code)},")
+        lines.append(f"        {init_stencil(opname, 'data', data)},")
+        lines.append("    },")
+    lines.append("};")
+    with open(args.output, "w") as f:
+        f.write("\n".join(lines) + "\n")
+
+
+if __name__ == "__main__":
+    try:
+        main()
+    except StencilError as e:
+        sys.exit(f"{SCRIPT_NAME}: {e}")
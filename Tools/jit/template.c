@@ -0,0 +1,124 @@
+/* Template for the stencils of the experimental JIT compiler.
+ *
+ * Tools/jit/build.py compiles this file once for every micro-op in
+ * Python/executor_cases.c.h, with _JIT_OPCODE defined to that micro-op, and
+ * turns the resulting object code into a stencil for Python/jit.c. The
+ * extern _JIT_* symbols below are the holes that are patched when a trace
+ * is compiled: the oparg, operand and target of the micro-op, and the code
+ * of the next micro-op and of the one a taken branch jumps to.
+ *
+ * Each stencil has the signature of _PyJITFunction and ends in a tail call
+ * to the next one, so a compiled trace runs as a chain of jumps and only
+ * returns to the interpreter when it exits, deopts or raises.
+ */
+
+#define _PY_INTERPRETER
+
+#include "Python.h"
+#include "pycore_abstract.h"      // _PyIndex_Check()
+#include "pycore_call.h"          // _PyObject_FastCallDictTstate()
+#include "pycore_ceval.h"         // _PyEval_FormatExcCheckArg()
+#include "pycore_code.h"
+#include "pycore_dict.h"
+#include "pycore_frame.h"
+#include "pycore_long.h"          // _PyLong_Add()
+#include "pycore_object.h"
+#include "pycore_opcode.h"        // _PyOpcode_Deopt
+#include "pycore_pyerrors.h"      // _PyErr_Format()
+#include "pycore_range.h"         // _PyRangeIterObject
+#include "pycore_sliceobject.h"   // _PyBuildSlice_ConsumeRefs
+#include "pycore_uops.h"
+#include "opcode.h"
+#include "opcode_metadata.h"      // micro-op ids
+
+#include "ceval_macros.h"
+
+#undef DEOPT_IF
+#define DEOPT_IF(COND, INSTNAME)    \
+    if ((COND)) {                   \
+        STAT_INC((INSTNAME), miss); \
+        goto deoptimize;            \
+    }
+
+#undef PREDICT
+#define PREDICT(op) ((void)0)
+
+// The branch is taken once the rest of the micro-op has run
+#define JUMP_TO_UOP(INDEX) (jump_taken = 1)
+
+#define cframe (*tstate->cframe)
+
+#if defined(__clang__)
+#  define TAIL_CALL __attribute__((musttail))
+#else
+#  define TAIL_CALL
+#endif
+
+// Reads the value patched into the hole NAME. The asm hides from the
+// compiler that this is the address of an object, which it would otherwise
+// assume to be non-zero.
+#define PATCH_VALUE(TYPE, NAME)                   \
+    ({                                            \
+        extern char NAME;                         \
+        uintptr_t _value = (uintptr_t)&NAME;      \
+        __asm__("" : "+r"(_value));               \
+        (TYPE)_value;                             \
+    })
+
+extern _Py_CODEUNIT *_JIT_CONTINUE(_PyInterpreterFrame *frame,
+                                   PyObject **stack_pointer,
+                                   PyThreadState *tstate);
+extern _Py_CODEUNIT *_JIT_JUMP_TARGET(_PyInterpreterFrame *frame,
+                                      PyObject **stack_pointer,
+                                      PyThreadState *tstate);
+
+_Py_CODEUNIT *
+_JIT_ENTRY(_PyInterpreterFrame *frame, PyObject **stack_pointer,
+           PyThreadState *tstate)
+{
+    _Py_atomic_int * const eval_breaker = &tstate->interp->ceval.eval_breaker;
+    PyObject *names = frame->f_code->co_names;
+    PyObject *consts = frame->f_code->co_consts;
+    int oparg = PATCH_VALUE(int, _JIT_OPARG);
+    uint64_t operand = PATCH_VALUE(uint64_t, _JIT_OPERAND);
+    int jump_taken = 0;
+    /* Errors and exits are reported against the tier-1 instruction
+       this micro-op came from */
+    frame->prev_instr = _PyCode_CODE(frame->f_code) +
+                        PATCH_VALUE(uint32_t, _JIT_TARGET);
+    switch (_JIT_OPCODE) {
+
+#include "executor_cases.c.h"
+
+        default:
+            Py_UNREACHABLE();
+    }
+    if (jump_taken) {
+        TAIL_CALL return _JIT_JUMP_TARGET(frame, stack_pointer, tstate);
+    }
+    TAIL_CALL return _JIT_CONTINUE(frame, stack_pointer, tstate);
+
+unbound_local_error:
+    _PyEval_FormatExcCheckArg(tstate, PyExc_UnboundLocalError,
+        UNBOUNDLOCAL_ERROR_MSG,
+        PyTuple_GetItem(frame->f_code->co_localsplusnames, oparg)
+    );
+    goto error;
+
+pop_4_error:
+    STACK_SHRINK(1);
+pop_3_error:
+    STACK_SHRINK(1);
+pop_2_error:
+    STACK_SHRINK(1);
+pop_1_error:
+    STACK_SHRINK(1);
+error:
+    _PyFrame_SetStackPointer(frame, stack_pointer);
+    return NULL;
+
+deoptimize:
+exit_trace:
+    _PyFrame_SetStackPointer(frame, stack_pointer);
+    return frame->prev_instr;
+}
@@ -1,5 +1,8 @@
 """Print a summary of specialization stats for all files in the
 default stats folders.
+
+The files are written by Py_STATS builds, and in any build by
+sys._specialization_telemetry_dump().
 """
 
 import argparse
@@ -7,6 +10,7 @@
 import json
 import os.path
 import opcode
+import re
 from datetime import date
 import itertools
 import sys
@@ -105,14 +109,14 @@ def calculate_specialization_success_failure(family_stats):
 
 def calculate_specialization_failure_kinds(name, family_stats, defines):
     total_failures = family_stats.get("specialization.failure", 0)
-    failure_kinds = [ 0 ] * 30
+    failure_kinds = {}
     for key in family_stats:
         if not key.startswith("specialization.failure_kind"):
             continue
         _, index = key[:-1].split("[")
         index = int(index)
         failure_kinds[index] = family_stats[key]
-    failures = [(value, index) for (index, value) in enumerate(failure_kinds)]
+    failures = [(value, index) for (index, value) in failure_kinds.items()]
     failures.sort(reverse=True)
     rows = []
     for value, index in failures:
@@ -125,12 +129,15 @@ def print_specialization_stats(name, family_stats, defines):
     if "specializable" not in family_stats:
         return
     total = sum(family_stats.get(kind, 0) for kind in TOTAL)
-    if total == 0:
+    rows = calculate_specialization_success_failure(family_stats)
+    # Specialization telemetry has no execution counts, only attempts and
+    # misses
+    if total == 0 and not rows:
         return
     with Section(name, 3, f"specialization stats for {name} family"):
-        rows = calculate_specialization_stats(family_stats, total)
-        emit_table(("Kind", "Count", "Ratio"), rows)
-        rows = calculate_specialization_success_failure(family_stats)
+        if total:
+            emit_table(("Kind", "Count", "Ratio"),
+                       calculate_specialization_stats(family_stats, total))
         if rows:
             print_title("Specialization attempts", 4)
             emit_table(("", "Count:", "Ratio:"), rows)
@@ -176,9 +183,9 @@ def gather_stats(input):
         for filename in os.listdir(input):
             with open(os.path.join(input, filename)) as fd:
                 for line in fd:
-                    try:
-                        key, value = line.split(":")
-                    except ValueError:
+                    # File names in code object keys may contain colons
+                    key, sep, value = line.rpartition(":")
+                    if not sep:
                         print(f"Unparsable line: '{line.strip()}' in  {filename}", file=sys.stderr)
                         continue
                     key = key.strip()
@@ -198,6 +205,23 @@ def extract_opcode_stats(stats):
         opcode_stats[int(n)][rest.strip(".")] = value
     return opcode_stats
 
+CODE_KEY = re.compile(r"code\[(.*)\]\.offset\[(\d+)\]\.opcode\[(\d+)\]\.(.*)")
+
+def extract_code_stats(stats):
+    """
+    Returns the stats of individual instructions in the specialization
+    telemetry, as a dict mapping (code object, offset, opcode) to a dict of
+    their stats.
+    """
+    code_stats = collections.defaultdict(dict)
+    for key, value in stats.items():
+        match = CODE_KEY.fullmatch(key)
+        if match is None:
+            continue
+        code, offset, op, rest = match.groups()
+        code_stats[code, int(offset), int(op)][rest] = value
+    return code_stats
+
 def parse_kinds(spec_src, prefix="SPEC_FAIL"):
     defines = collections.defaultdict(list)
     start = "#define " + prefix + "_"
@@ -393,8 +417,9 @@ def calculate_specialization_effectiveness(opcode_stats, total):
 
 def emit_specialization_overview(opcode_stats, total):
     with Section("Specialization effectiveness"):
-        rows = calculate_specialization_effectiveness(opcode_stats, total)
-        emit_table(("Instructions", "Count:", "Ratio:"), rows)
+        if total:
+            rows = calculate_specialization_effectiveness(opcode_stats, total)
+            emit_table(("Instructions", "Count:", "Ratio:"), rows)
         for title, field in (("Deferred", "specialization.deferred"), ("Misses", "specialization.miss")):
             total = 0
             counts = []
@@ -405,7 +430,7 @@ def emit_specialization_overview(opcode_stats, total):
             counts.sort(reverse=True)
             if total:
                 with Section(f"{title} by instruction", 3):
-                    rows = [ (name, count, f"{100*count/total:0.1f}%") for (count, name) in counts[:10] ]
+                    rows = [ (name, count, f"{100*count/total:0.1f}%") for (count, name) in counts[:10] if count ]
                     emit_table(("Name", "Count:", "Ratio:"), rows)
 
 def emit_comparative_specialization_overview(base_opcode_stats, base_total, head_opcode_stats, head_total):
@@ -426,10 +451,10 @@ def get_stats_defines():
 def calculate_call_stats(stats):
     defines = get_stats_defines()
     total = 0
+    rows = []
     for key, value in stats.items():
         if "Calls to" in key:
             total += value
-            rows = []
     for key, value in stats.items():
         if "Calls to" in key:
             rows.append((key, value, f"{100*value/total:0.1f}%"))
@@ -493,6 +518,44 @@ def emit_comparative_object_stats(base_stats, head_stats):
         head_rows = calculate_object_stats(head_stats)
         emit_table(("",  "Base Count:", "Base Ratio:", "Head Count:", "Head Ratio:"), join_rows(base_rows, head_rows))
 
+def has_call_stats(stats):
+    return any(key.startswith("Calls to") for key in stats)
+
+def has_object_stats(stats):
+    return any(key.startswith("Object") for key in stats)
+
+def calculate_code_stats(code_stats, defines, limit=50):
+    deopts = []
+    for (code, offset, op), inst_stats in code_stats.items():
+        miss = inst_stats.get("specialization.miss", 0)
+        deopt = inst_stats.get("specialization.deopt", 0)
+        failure = inst_stats.get("specialization.failure", 0)
+        if not (miss or failure):
+            continue
+        kinds = []
+        for key in inst_stats:
+            if key.startswith("specialization.failure_kinds"):
+                _, index = key[:-1].split("[")
+                kinds.append(kind_to_text(int(index), defines, opname[op]))
+        deopts.append((deopt, miss, failure, code, offset, opname[op],
+                       ", ".join(sorted(kinds))))
+    deopts.sort(key=lambda row: row[:3], reverse=True)
+    return [(code, offset, name, deopt, miss, failure, kinds)
+            for (deopt, miss, failure, code, offset, name, kinds)
+            in deopts[:limit]]
+
+def emit_code_stats(code_stats):
+    rows = calculate_code_stats(code_stats, get_defines())
+    if not rows:
+        return
+    with Section("Deoptimizations by code object",
+                 summary="instructions that deoptimize or fail to specialize most often"):
+        emit_table(
+            ("Code object", "Offset:", "Instruction", "Deopts:", "Misses:",
+             "Failures:", "Failure kinds"),
+            rows
+        )
+
 def get_total(opcode_stats):
     total = 0
     for opcode_stat in opcode_stats:
@@ -556,12 +619,16 @@ def emit_pair_counts(opcode_stats, total):
 def output_single_stats(stats):
     opcode_stats = extract_opcode_stats(stats)
     total = get_total(opcode_stats)
-    emit_execution_counts(opcode_stats, total)
-    emit_pair_counts(opcode_stats, total)
+    if total:
+        emit_execution_counts(opcode_stats, total)
+        emit_pair_counts(opcode_stats, total)
     emit_specialization_stats(opcode_stats)
     emit_specialization_overview(opcode_stats, total)
-    emit_call_stats(stats)
-    emit_object_stats(stats)
+    emit_code_stats(extract_code_stats(stats))
+    if has_call_stats(stats):
+        emit_call_stats(stats)
+    if has_object_stats(stats):
+        emit_object_stats(stats)
     with Section("Meta stats", summary="Meta statistics"):
         emit_table(("", "Count:"), [('Number of data files', stats['__nfiles__'])])
 
@@ -582,8 +649,10 @@ def output_comparative_stats(base_stats, head_stats):
     emit_comparative_specialization_overview(
         base_opcode_stats, base_total, head_opcode_stats, head_total
     )
-    emit_comparative_call_stats(base_stats, head_stats)
-    emit_comparative_object_stats(base_stats, head_stats)
+    if has_call_stats(base_stats) and has_call_stats(head_stats):
+        emit_comparative_call_stats(base_stats, head_stats)
+    if has_object_stats(base_stats) and has_object_stats(head_stats):
+        emit_comparative_object_stats(base_stats, head_stats)
 
 def output_stats(inputs, json_output=None):
     if len(inputs) == 1: